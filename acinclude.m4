@@ -6,6 +6,28 @@ dnl Function to detect if libsmraw dependencies are available
 AC_DEFUN([AX_LIBSMRAW_CHECK_LOCAL],
   [dnl Check for internationalization functions in libsmraw/libsmraw_i18n.c
   AC_CHECK_FUNCS([bindtextdomain])
+
+  dnl Check for memory mapping functions in libsmraw/libsmraw_memory_map.c
+  AC_CHECK_HEADERS([fcntl.h sys/mman.h sys/stat.h unistd.h])
+  AC_CHECK_FUNCS([mmap munmap])
+
+  dnl Check for directory functions in libsmraw/libsmraw_directory_listing.c
+  AC_CHECK_HEADERS([dirent.h])
+  AC_CHECK_FUNCS([closedir opendir readdir])
+  AC_CHECK_MEMBERS(
+    [struct dirent.d_type],
+    [],
+    [],
+    [[#include <dirent.h>]])
+
+  dnl Check for file status functions in libsmraw/libsmraw_manifest.c
+  AC_CHECK_HEADERS([sys/stat.h])
+  AC_CHECK_FUNCS([fchmod fdopen mkstemp stat])
+  AC_CHECK_MEMBERS(
+    [struct stat.st_mtim.tv_nsec, struct stat.st_mtimespec.tv_nsec],
+    [],
+    [],
+    [[#include <sys/stat.h>]])
 ])
 
 dnl Function to check if DLL support is needed
@@ -0,0 +1,722 @@
+/*
+ * Access pattern hint functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/* readahead is only defined by the GNU C library when _GNU_SOURCE is set
+ */
+#if !defined( _GNU_SOURCE )
+#define _GNU_SOURCE 1
+#endif
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libsmraw_access_hint.h"
+#include "libsmraw_definitions.h"
+#include "libsmraw_libcerror.h"
+#include "libsmraw_libcthreads.h"
+#include "libsmraw_unused.h"
+
+#if defined( HAVE_POSIX_FADVISE ) && !defined( HAVE_GLIB_H ) && !defined( WINAPI )
+#define HAVE_LIBSMRAW_ACCESS_HINT_SUPPORT	1
+#endif
+
+/* Creates an access hint
+ * The maximum number of files bounds the number of file descriptors that are kept open for the hints
+ * Make sure the value access_hint is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_access_hint_initialize(
+     libsmraw_access_hint_t **access_hint,
+     uint32_t access_pattern_flags,
+     int maximum_number_of_files,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_access_hint_initialize";
+
+	if( access_hint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access hint.",
+		 function );
+
+		return( -1 );
+	}
+	if( *access_hint != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid access hint value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_files <= 0 )
+	 || ( (size_t) maximum_number_of_files > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libsmraw_access_hint_file_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of files value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*access_hint = memory_allocate_structure(
+	                libsmraw_access_hint_t );
+
+	if( *access_hint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create access hint.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *access_hint,
+	     0,
+	     sizeof( libsmraw_access_hint_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear access hint.",
+		 function );
+
+		memory_free(
+		 *access_hint );
+
+		*access_hint = NULL;
+
+		return( -1 );
+	}
+	( *access_hint )->files = (libsmraw_access_hint_file_t *) memory_allocate(
+	                                                           sizeof( libsmraw_access_hint_file_t ) * (size_t) maximum_number_of_files );
+
+	if( ( *access_hint )->files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create files.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *access_hint )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *access_hint )->access_pattern_flags    = access_pattern_flags;
+	( *access_hint )->maximum_number_of_files = maximum_number_of_files;
+
+	return( 1 );
+
+on_error:
+	if( *access_hint != NULL )
+	{
+		if( ( *access_hint )->files != NULL )
+		{
+			memory_free(
+			 ( *access_hint )->files );
+		}
+		memory_free(
+		 *access_hint );
+
+		*access_hint = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an access hint
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_access_hint_free(
+     libsmraw_access_hint_t **access_hint,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_access_hint_free";
+	int result            = 1;
+
+	if( access_hint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access hint.",
+		 function );
+
+		return( -1 );
+	}
+	if( *access_hint != NULL )
+	{
+		if( libsmraw_access_hint_close(
+		     *access_hint,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close access hint.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *access_hint )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 ( *access_hint )->files );
+
+		memory_free(
+		 *access_hint );
+
+		*access_hint = NULL;
+	}
+	return( result );
+}
+
+/* Opens a segment file to apply the access pattern hints to
+ * The hints are applied to the page cache of the segment file, which is shared
+ * with the file IO handle that reads the data
+ * A segment file is opened once, when the maximum number of files is reached
+ * the least recently used segment file is closed
+ * A missing filename or a segment file that cannot be opened is not considered
+ * an error, the data of the segment file is then read without hints
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_access_hint_open(
+     libsmraw_access_hint_t *access_hint,
+     int segment_file_index,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libsmraw_access_hint_file_t *access_hint_file = NULL;
+	static char *function                         = "libsmraw_access_hint_open";
+	int file_index                                = 0;
+
+	if( access_hint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access hint.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_file_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segment file index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     access_hint->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* Another thread could have opened the segment file in the meantime
+	 */
+	access_hint_file = libsmraw_access_hint_get_file(
+	                    access_hint,
+	                    segment_file_index );
+
+	if( access_hint_file == NULL )
+	{
+		if( access_hint->number_of_files < access_hint->maximum_number_of_files )
+		{
+			access_hint_file = &( access_hint->files[ access_hint->number_of_files ] );
+
+			access_hint->number_of_files += 1;
+		}
+		else
+		{
+			access_hint_file = &( access_hint->files[ 0 ] );
+
+			for( file_index = 1;
+			     file_index < access_hint->number_of_files;
+			     file_index++ )
+			{
+				if( access_hint->files[ file_index ].last_access_time < access_hint_file->last_access_time )
+				{
+					access_hint_file = &( access_hint->files[ file_index ] );
+				}
+			}
+#if defined( HAVE_LIBSMRAW_ACCESS_HINT_SUPPORT )
+			if( access_hint_file->file_descriptor != -1 )
+			{
+				libsmraw_access_hint_release_data(
+				 access_hint_file );
+
+				/* The descriptor is only used for hints, a close failure does not affect the data
+				 */
+				close(
+				 access_hint_file->file_descriptor );
+			}
+#endif
+		}
+		access_hint_file->segment_file_index = segment_file_index;
+		access_hint_file->file_descriptor    = -1;
+		access_hint_file->read_ahead_offset  = 0;
+		access_hint_file->release_offset     = 0;
+		access_hint_file->release_size       = 0;
+
+#if defined( HAVE_LIBSMRAW_ACCESS_HINT_SUPPORT )
+		if( filename != NULL )
+		{
+			access_hint_file->file_descriptor = open(
+			                                     filename,
+			                                     O_RDONLY );
+		}
+#else
+		LIBSMRAW_UNREFERENCED_PARAMETER( filename )
+#endif
+	}
+	access_hint->access_time          += 1;
+	access_hint_file->last_access_time = access_hint->access_time;
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     access_hint->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Closes the segment files the access pattern hints are applied to
+ * Data that was read but not yet released from the page cache is released
+ * Returns 0 if successful or -1 on error
+ */
+int libsmraw_access_hint_close(
+     libsmraw_access_hint_t *access_hint,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_access_hint_close";
+	int file_index        = 0;
+
+	if( access_hint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access hint.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     access_hint->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	for( file_index = 0;
+	     file_index < access_hint->number_of_files;
+	     file_index++ )
+	{
+		libsmraw_access_hint_release_data(
+		 &( access_hint->files[ file_index ] ) );
+
+#if defined( HAVE_LIBSMRAW_ACCESS_HINT_SUPPORT )
+		if( access_hint->files[ file_index ].file_descriptor != -1 )
+		{
+			close(
+			 access_hint->files[ file_index ].file_descriptor );
+		}
+#endif
+	}
+	access_hint->number_of_files = 0;
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     access_hint->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 0 );
+}
+
+/* Sets the access pattern flags
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_access_hint_set_access_pattern(
+     libsmraw_access_hint_t *access_hint,
+     uint32_t access_pattern_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_access_hint_set_access_pattern";
+	int file_index        = 0;
+
+	if( access_hint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access hint.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     access_hint->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	for( file_index = 0;
+	     file_index < access_hint->number_of_files;
+	     file_index++ )
+	{
+		if( ( access_pattern_flags & LIBSMRAW_ACCESS_PATTERN_FLAG_NO_REUSE ) == 0 )
+		{
+			access_hint->files[ file_index ].release_size = 0;
+		}
+		access_hint->files[ file_index ].read_ahead_offset = 0;
+	}
+	access_hint->access_pattern_flags = access_pattern_flags;
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     access_hint->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Applies the access pattern hints after data was read from a segment file
+ * Only hints that apply to the page cache of the segment file are used, since
+ * these also affect the file IO handle that reads the data
+ * On sequential access the data ahead of the reader is scheduled into the page cache
+ * On no-reuse access the data that was read is released from the page cache
+ * Returns 1 if successful, 0 if the segment file was not opened for hints or -1 on error
+ */
+int libsmraw_access_hint_data_read(
+     libsmraw_access_hint_t *access_hint,
+     int segment_file_index,
+     off64_t offset,
+     size_t size,
+     libcerror_error_t **error )
+{
+	libsmraw_access_hint_file_t *access_hint_file = NULL;
+	static char *function                         = "libsmraw_access_hint_data_read";
+	off64_t end_offset                            = 0;
+	int result                                    = 1;
+
+	if( access_hint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access hint.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     access_hint->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	access_hint_file = libsmraw_access_hint_get_file(
+	                    access_hint,
+	                    segment_file_index );
+
+	if( access_hint_file == NULL )
+	{
+		result = 0;
+	}
+	else
+	{
+		access_hint->access_time          += 1;
+		access_hint_file->last_access_time = access_hint->access_time;
+	}
+	if( ( access_hint_file != NULL )
+	 && ( access_hint_file->file_descriptor != -1 )
+	 && ( size > 0 ) )
+	{
+		end_offset = offset + (off64_t) size;
+
+		if( ( access_hint->access_pattern_flags & LIBSMRAW_ACCESS_PATTERN_FLAG_SEQUENTIAL ) != 0 )
+		{
+			/* Restart the read-ahead if the reader moved outside the scheduled data
+			 */
+			if( ( offset > access_hint_file->read_ahead_offset )
+			 || ( ( end_offset + ( 2 * LIBSMRAW_ACCESS_HINT_READ_AHEAD_SIZE ) ) < access_hint_file->read_ahead_offset ) )
+			{
+				access_hint_file->read_ahead_offset = end_offset;
+			}
+			/* Schedule the next part once the reader has consumed half of the read-ahead data
+			 */
+			if( ( end_offset + ( LIBSMRAW_ACCESS_HINT_READ_AHEAD_SIZE / 2 ) ) > access_hint_file->read_ahead_offset )
+			{
+#if defined( HAVE_LIBSMRAW_ACCESS_HINT_SUPPORT )
+#if defined( HAVE_READAHEAD )
+				readahead(
+				 access_hint_file->file_descriptor,
+				 (off_t) access_hint_file->read_ahead_offset,
+				 (size_t) ( end_offset + LIBSMRAW_ACCESS_HINT_READ_AHEAD_SIZE - access_hint_file->read_ahead_offset ) );
+#else
+				posix_fadvise(
+				 access_hint_file->file_descriptor,
+				 (off_t) access_hint_file->read_ahead_offset,
+				 (off_t) ( end_offset + LIBSMRAW_ACCESS_HINT_READ_AHEAD_SIZE - access_hint_file->read_ahead_offset ),
+				 POSIX_FADV_WILLNEED );
+#endif
+#endif /* defined( HAVE_LIBSMRAW_ACCESS_HINT_SUPPORT ) */
+				access_hint_file->read_ahead_offset = end_offset + LIBSMRAW_ACCESS_HINT_READ_AHEAD_SIZE;
+			}
+		}
+		if( ( access_hint->access_pattern_flags & LIBSMRAW_ACCESS_PATTERN_FLAG_NO_REUSE ) != 0 )
+		{
+			/* Contiguous data is collected to release it from the page cache in larger parts
+			 */
+			if( ( access_hint_file->release_size > 0 )
+			 && ( offset != ( access_hint_file->release_offset + (off64_t) access_hint_file->release_size ) ) )
+			{
+				libsmraw_access_hint_release_data(
+				 access_hint_file );
+			}
+			if( access_hint_file->release_size == 0 )
+			{
+				access_hint_file->release_offset = offset;
+			}
+			access_hint_file->release_size += size;
+
+			if( access_hint_file->release_size >= LIBSMRAW_ACCESS_HINT_RELEASE_SIZE )
+			{
+				libsmraw_access_hint_release_data(
+				 access_hint_file );
+			}
+		}
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     access_hint->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the file the hints are applied to of a specific segment file
+ * The caller must hold the access hint mutex
+ * Returns a pointer to the file or NULL if the segment file was not opened for hints
+ */
+libsmraw_access_hint_file_t *libsmraw_access_hint_get_file(
+                              libsmraw_access_hint_t *access_hint,
+                              int segment_file_index )
+{
+	int file_index = 0;
+
+	if( access_hint == NULL )
+	{
+		return( NULL );
+	}
+	for( file_index = 0;
+	     file_index < access_hint->number_of_files;
+	     file_index++ )
+	{
+		if( access_hint->files[ file_index ].segment_file_index == segment_file_index )
+		{
+			return( &( access_hint->files[ file_index ] ) );
+		}
+	}
+	return( NULL );
+}
+
+/* Releases the collected data from the page cache
+ * The hints are advisory, failures are ignored
+ * The caller must hold the access hint mutex
+ */
+void libsmraw_access_hint_release_data(
+      libsmraw_access_hint_file_t *access_hint_file )
+{
+	if( access_hint_file == NULL )
+	{
+		return;
+	}
+#if defined( HAVE_LIBSMRAW_ACCESS_HINT_SUPPORT )
+	if( ( access_hint_file->file_descriptor != -1 )
+	 && ( access_hint_file->release_size > 0 ) )
+	{
+		posix_fadvise(
+		 access_hint_file->file_descriptor,
+		 (off_t) access_hint_file->release_offset,
+		 (off_t) access_hint_file->release_size,
+		 POSIX_FADV_DONTNEED );
+	}
+#endif
+	access_hint_file->release_offset = 0;
+	access_hint_file->release_size   = 0;
+}
@@ -0,0 +1,139 @@
+/*
+ * Access pattern hint functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSMRAW_ACCESS_HINT_H )
+#define _LIBSMRAW_ACCESS_HINT_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsmraw_libcerror.h"
+#include "libsmraw_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libsmraw_access_hint_file libsmraw_access_hint_file_t;
+
+struct libsmraw_access_hint_file
+{
+	/* The index of the segment file
+	 */
+	int segment_file_index;
+
+	/* The file descriptor of the segment file or -1 if not available
+	 */
+	int file_descriptor;
+
+	/* The time of the last access
+	 */
+	uint64_t last_access_time;
+
+	/* The end offset of the data that was scheduled for read-ahead
+	 */
+	off64_t read_ahead_offset;
+
+	/* The offset of the data that is to be released from the page cache
+	 */
+	off64_t release_offset;
+
+	/* The size of the data that is to be released from the page cache
+	 */
+	size64_t release_size;
+};
+
+typedef struct libsmraw_access_hint libsmraw_access_hint_t;
+
+struct libsmraw_access_hint
+{
+	/* The access pattern flags
+	 */
+	uint32_t access_pattern_flags;
+
+	/* The segment files the hints are applied to
+	 */
+	libsmraw_access_hint_file_t *files;
+
+	/* The number of segment files the hints are applied to
+	 */
+	int number_of_files;
+
+	/* The maximum number of segment files the hints are applied to
+	 */
+	int maximum_number_of_files;
+
+	/* The access time, which is incremented on every access
+	 */
+	uint64_t access_time;
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libsmraw_access_hint_initialize(
+     libsmraw_access_hint_t **access_hint,
+     uint32_t access_pattern_flags,
+     int maximum_number_of_files,
+     libcerror_error_t **error );
+
+int libsmraw_access_hint_free(
+     libsmraw_access_hint_t **access_hint,
+     libcerror_error_t **error );
+
+int libsmraw_access_hint_open(
+     libsmraw_access_hint_t *access_hint,
+     int segment_file_index,
+     const char *filename,
+     libcerror_error_t **error );
+
+int libsmraw_access_hint_close(
+     libsmraw_access_hint_t *access_hint,
+     libcerror_error_t **error );
+
+int libsmraw_access_hint_set_access_pattern(
+     libsmraw_access_hint_t *access_hint,
+     uint32_t access_pattern_flags,
+     libcerror_error_t **error );
+
+int libsmraw_access_hint_data_read(
+     libsmraw_access_hint_t *access_hint,
+     int segment_file_index,
+     off64_t offset,
+     size_t size,
+     libcerror_error_t **error );
+
+libsmraw_access_hint_file_t *libsmraw_access_hint_get_file(
+                              libsmraw_access_hint_t *access_hint,
+                              int segment_file_index );
+
+void libsmraw_access_hint_release_data(
+      libsmraw_access_hint_file_t *access_hint_file );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSMRAW_ACCESS_HINT_H ) */
+
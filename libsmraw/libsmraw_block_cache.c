@@ -0,0 +1,1177 @@
+/*
+ * Block cache functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libsmraw_block_cache.h"
+#include "libsmraw_definitions.h"
+#include "libsmraw_direct_file.h"
+#include "libsmraw_libcerror.h"
+#include "libsmraw_libcthreads.h"
+
+/* Creates a block cache
+ * The blocks are distributed over multiple shards, each with its own lock and LRU list
+ * Make sure the value block_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_block_cache_initialize(
+     libsmraw_block_cache_t **block_cache,
+     size_t cache_size,
+     size_t block_size,
+     ssize_t (*read_function)(
+                intptr_t *data_handle,
+                void *buffer,
+                size_t buffer_size,
+                off64_t offset,
+                libcerror_error_t **error ),
+     intptr_t *data_handle,
+     libcerror_error_t **error )
+{
+	libsmraw_block_cache_shard_t *block_cache_shard = NULL;
+	static char *function                           = "libsmraw_block_cache_initialize";
+	size_t hash_table_size                          = 0;
+	size_t maximum_number_of_blocks                 = 0;
+	int number_of_shards                            = 0;
+	int shard_index                                 = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid block cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size == 0 )
+	 || ( block_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_size < block_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid cache size value smaller than block size.",
+		 function );
+
+		return( -1 );
+	}
+	maximum_number_of_blocks = cache_size / block_size;
+
+	if( maximum_number_of_blocks > (size_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum number of blocks value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sizeof( libsmraw_block_cache_entry_t * ) * maximum_number_of_blocks ) > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid hash table size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read function.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_shards = LIBSMRAW_BLOCK_CACHE_NUMBER_OF_SHARDS;
+
+	if( (size_t) number_of_shards > maximum_number_of_blocks )
+	{
+		number_of_shards = (int) maximum_number_of_blocks;
+	}
+	*block_cache = memory_allocate_structure(
+	                libsmraw_block_cache_t );
+
+	if( *block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *block_cache,
+	     0,
+	     sizeof( libsmraw_block_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear block cache.",
+		 function );
+
+		memory_free(
+		 *block_cache );
+
+		*block_cache = NULL;
+
+		return( -1 );
+	}
+	( *block_cache )->shards = (libsmraw_block_cache_shard_t *) memory_allocate(
+	                                                             sizeof( libsmraw_block_cache_shard_t ) * number_of_shards );
+
+	if( ( *block_cache )->shards == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create shards.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *block_cache )->shards,
+	     0,
+	     sizeof( libsmraw_block_cache_shard_t ) * number_of_shards ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear shards.",
+		 function );
+
+		memory_free(
+		 ( *block_cache )->shards );
+
+		( *block_cache )->shards = NULL;
+
+		goto on_error;
+	}
+	( *block_cache )->number_of_shards = number_of_shards;
+
+	for( shard_index = 0;
+	     shard_index < number_of_shards;
+	     shard_index++ )
+	{
+		block_cache_shard = &( ( *block_cache )->shards[ shard_index ] );
+
+		block_cache_shard->maximum_number_of_blocks = (int) ( maximum_number_of_blocks / number_of_shards );
+
+		if( (size_t) shard_index < ( maximum_number_of_blocks % number_of_shards ) )
+		{
+			block_cache_shard->maximum_number_of_blocks += 1;
+		}
+		block_cache_shard->number_of_slots = block_cache_shard->maximum_number_of_blocks;
+
+		hash_table_size = sizeof( libsmraw_block_cache_entry_t * ) * block_cache_shard->number_of_slots;
+
+		block_cache_shard->hash_table = (libsmraw_block_cache_entry_t **) memory_allocate(
+		                                                                   hash_table_size );
+
+		if( block_cache_shard->hash_table == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create shard: %d hash table.",
+			 function,
+			 shard_index );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     block_cache_shard->hash_table,
+		     0,
+		     hash_table_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear shard: %d hash table.",
+			 function,
+			 shard_index );
+
+			goto on_error;
+		}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_initialize(
+		     &( block_cache_shard->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create shard: %d mutex.",
+			 function,
+			 shard_index );
+
+			goto on_error;
+		}
+#endif
+	}
+	( *block_cache )->block_size    = block_size;
+	( *block_cache )->read_function = read_function;
+	( *block_cache )->data_handle   = data_handle;
+
+	return( 1 );
+
+on_error:
+	if( *block_cache != NULL )
+	{
+		if( ( *block_cache )->shards != NULL )
+		{
+			for( shard_index = 0;
+			     shard_index < number_of_shards;
+			     shard_index++ )
+			{
+				block_cache_shard = &( ( *block_cache )->shards[ shard_index ] );
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+				if( block_cache_shard->mutex != NULL )
+				{
+					libcthreads_mutex_free(
+					 &( block_cache_shard->mutex ),
+					 NULL );
+				}
+#endif
+				if( block_cache_shard->hash_table != NULL )
+				{
+					memory_free(
+					 block_cache_shard->hash_table );
+				}
+			}
+			memory_free(
+			 ( *block_cache )->shards );
+		}
+		memory_free(
+		 *block_cache );
+
+		*block_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a block cache
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_block_cache_free(
+     libsmraw_block_cache_t **block_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_block_cache_free";
+	int result            = 1;
+	int shard_index       = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block_cache != NULL )
+	{
+		if( libsmraw_block_cache_empty(
+		     *block_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty block cache.",
+			 function );
+
+			result = -1;
+		}
+		for( shard_index = 0;
+		     shard_index < ( *block_cache )->number_of_shards;
+		     shard_index++ )
+		{
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+			if( libcthreads_mutex_free(
+			     &( ( *block_cache )->shards[ shard_index ].mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free shard: %d mutex.",
+				 function,
+				 shard_index );
+
+				result = -1;
+			}
+#endif
+			memory_free(
+			 ( *block_cache )->shards[ shard_index ].hash_table );
+		}
+		memory_free(
+		 ( *block_cache )->shards );
+
+		memory_free(
+		 *block_cache );
+
+		*block_cache = NULL;
+	}
+	return( result );
+}
+
+/* Empties a block cache
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_block_cache_empty(
+     libsmraw_block_cache_t *block_cache,
+     libcerror_error_t **error )
+{
+	libsmraw_block_cache_entry_t *cache_entry       = NULL;
+	libsmraw_block_cache_shard_t *block_cache_shard = NULL;
+	static char *function                           = "libsmraw_block_cache_empty";
+	int shard_index                                 = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	for( shard_index = 0;
+	     shard_index < block_cache->number_of_shards;
+	     shard_index++ )
+	{
+		block_cache_shard = &( block_cache->shards[ shard_index ] );
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     block_cache_shard->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab shard: %d mutex.",
+			 function,
+			 shard_index );
+
+			return( -1 );
+		}
+#endif
+		while( block_cache_shard->most_recently_used != NULL )
+		{
+			cache_entry                           = block_cache_shard->most_recently_used;
+			block_cache_shard->most_recently_used = cache_entry->next_used;
+
+			memory_free(
+			 cache_entry->data );
+
+			memory_free(
+			 cache_entry );
+
+			block_cache_shard->number_of_blocks -= 1;
+		}
+		block_cache_shard->least_recently_used = NULL;
+
+		if( memory_set(
+		     block_cache_shard->hash_table,
+		     0,
+		     sizeof( libsmraw_block_cache_entry_t * ) * block_cache_shard->number_of_slots ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear shard: %d hash table.",
+			 function,
+			 shard_index );
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+			libcthreads_mutex_release(
+			 block_cache_shard->mutex,
+			 NULL );
+#endif
+			return( -1 );
+		}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_release(
+		     block_cache_shard->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release shard: %d mutex.",
+			 function,
+			 shard_index );
+
+			return( -1 );
+		}
+#endif
+	}
+	return( 1 );
+}
+
+/* Retrieves the block cache statistics
+ * The statistics are the sum of the statistics of all shards
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_block_cache_get_statistics(
+     libsmraw_block_cache_t *block_cache,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     uint64_t *number_of_evictions,
+     libcerror_error_t **error )
+{
+	libsmraw_block_cache_shard_t *block_cache_shard = NULL;
+	static char *function                           = "libsmraw_block_cache_get_statistics";
+	uint64_t safe_number_of_evictions               = 0;
+	uint64_t safe_number_of_hits                    = 0;
+	uint64_t safe_number_of_misses                  = 0;
+	int shard_index                                 = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_hits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of hits.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_misses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of misses.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_evictions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of evictions.",
+		 function );
+
+		return( -1 );
+	}
+	for( shard_index = 0;
+	     shard_index < block_cache->number_of_shards;
+	     shard_index++ )
+	{
+		block_cache_shard = &( block_cache->shards[ shard_index ] );
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     block_cache_shard->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab shard: %d mutex.",
+			 function,
+			 shard_index );
+
+			return( -1 );
+		}
+#endif
+		safe_number_of_hits      += block_cache_shard->number_of_hits;
+		safe_number_of_misses    += block_cache_shard->number_of_misses;
+		safe_number_of_evictions += block_cache_shard->number_of_evictions;
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_release(
+		     block_cache_shard->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release shard: %d mutex.",
+			 function,
+			 shard_index );
+
+			return( -1 );
+		}
+#endif
+	}
+	*number_of_hits      = safe_number_of_hits;
+	*number_of_misses    = safe_number_of_misses;
+	*number_of_evictions = safe_number_of_evictions;
+
+	return( 1 );
+}
+
+/* Removes an entry from the hash table and the LRU list of a shard
+ * The caller must hold the shard mutex
+ */
+void libsmraw_block_cache_shard_detach_entry(
+      libsmraw_block_cache_shard_t *block_cache_shard,
+      libsmraw_block_cache_entry_t *cache_entry )
+{
+	libsmraw_block_cache_entry_t **slot_entry = NULL;
+
+	slot_entry = &( block_cache_shard->hash_table[ cache_entry->slot_index ] );
+
+	while( *slot_entry != NULL )
+	{
+		if( *slot_entry == cache_entry )
+		{
+			*slot_entry = cache_entry->next_in_slot;
+
+			break;
+		}
+		slot_entry = &( ( *slot_entry )->next_in_slot );
+	}
+	if( cache_entry->previous_used != NULL )
+	{
+		cache_entry->previous_used->next_used = cache_entry->next_used;
+	}
+	else
+	{
+		block_cache_shard->most_recently_used = cache_entry->next_used;
+	}
+	if( cache_entry->next_used != NULL )
+	{
+		cache_entry->next_used->previous_used = cache_entry->previous_used;
+	}
+	else
+	{
+		block_cache_shard->least_recently_used = cache_entry->previous_used;
+	}
+	cache_entry->next_in_slot  = NULL;
+	cache_entry->previous_used = NULL;
+	cache_entry->next_used     = NULL;
+}
+
+/* Inserts an entry into the hash table and as most recently used into the LRU list of a shard
+ * The caller must hold the shard mutex
+ */
+void libsmraw_block_cache_shard_attach_entry(
+      libsmraw_block_cache_shard_t *block_cache_shard,
+      libsmraw_block_cache_entry_t *cache_entry )
+{
+	cache_entry->next_in_slot = block_cache_shard->hash_table[ cache_entry->slot_index ];
+
+	block_cache_shard->hash_table[ cache_entry->slot_index ] = cache_entry;
+
+	cache_entry->previous_used = NULL;
+	cache_entry->next_used     = block_cache_shard->most_recently_used;
+
+	if( block_cache_shard->most_recently_used != NULL )
+	{
+		block_cache_shard->most_recently_used->previous_used = cache_entry;
+	}
+	block_cache_shard->most_recently_used = cache_entry;
+
+	if( block_cache_shard->least_recently_used == NULL )
+	{
+		block_cache_shard->least_recently_used = cache_entry;
+	}
+}
+
+/* Retrieves the entry of a specific block from a shard
+ * The caller must hold the shard mutex
+ * Returns the entry or NULL if not cached
+ */
+libsmraw_block_cache_entry_t *libsmraw_block_cache_shard_get_entry(
+                               libsmraw_block_cache_shard_t *block_cache_shard,
+                               int slot_index,
+                               uint64_t block_index )
+{
+	libsmraw_block_cache_entry_t *cache_entry = NULL;
+
+	cache_entry = block_cache_shard->hash_table[ slot_index ];
+
+	while( cache_entry != NULL )
+	{
+		if( cache_entry->block_index == block_index )
+		{
+			break;
+		}
+		cache_entry = cache_entry->next_in_slot;
+	}
+	return( cache_entry );
+}
+
+/* Reads data at a specific offset
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libsmraw_block_cache_read_buffer(
+         libsmraw_block_cache_t *block_cache,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libsmraw_block_cache_read_buffer";
+	size_t block_offset   = 0;
+	size_t buffer_offset  = 0;
+	size_t read_size      = 0;
+	ssize_t read_count    = 0;
+	uint64_t block_index  = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_offset < buffer_size )
+	{
+		block_index  = (uint64_t) offset / block_cache->block_size;
+		block_offset = (size_t) ( (uint64_t) offset % block_cache->block_size );
+		read_size    = block_cache->block_size - block_offset;
+
+		if( read_size > ( buffer_size - buffer_offset ) )
+		{
+			read_size = buffer_size - buffer_offset;
+		}
+		read_count = libsmraw_block_cache_read_block(
+		              block_cache,
+		              block_index,
+		              block_offset,
+		              &( buffer[ buffer_offset ] ),
+		              read_size,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read block: %" PRIu64 ".",
+			 function,
+			 block_index );
+
+			return( -1 );
+		}
+		offset        += (off64_t) read_count;
+		buffer_offset += (size_t) read_count;
+
+		/* A short read indicates the end of the data
+		 */
+		if( (size_t) read_count < read_size )
+		{
+			break;
+		}
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Reads data of a specific block
+ * The block is read and cached if not already cached, which can evict the least recently used block
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libsmraw_block_cache_read_block(
+         libsmraw_block_cache_t *block_cache,
+         uint64_t block_index,
+         size_t block_offset,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libsmraw_block_cache_entry_t *cache_entry       = NULL;
+	libsmraw_block_cache_shard_t *block_cache_shard = NULL;
+	static char *function                           = "libsmraw_block_cache_read_block";
+	size_t read_size                                = 0;
+	ssize_t read_count                              = 0;
+	uint8_t read_uncached                           = 0;
+	int slot_index                                  = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_offset >= block_cache->block_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > ( block_cache->block_size - block_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Consecutive blocks are spread over the shards so that readers
+	 * of neighbouring blocks do not contend for the same lock
+	 */
+	block_cache_shard = &( block_cache->shards[ block_index % (uint64_t) block_cache->number_of_shards ] );
+	slot_index        = (int) ( ( block_index / (uint64_t) block_cache->number_of_shards ) % (uint64_t) block_cache_shard->number_of_slots );
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     block_cache_shard->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab shard mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	cache_entry = libsmraw_block_cache_shard_get_entry(
+	               block_cache_shard,
+	               slot_index,
+	               block_index );
+
+	if( cache_entry != NULL )
+	{
+		block_cache_shard->number_of_hits += 1;
+
+		libsmraw_block_cache_shard_detach_entry(
+		 block_cache_shard,
+		 cache_entry );
+
+		libsmraw_block_cache_shard_attach_entry(
+		 block_cache_shard,
+		 cache_entry );
+
+		read_size = 0;
+
+		if( block_offset < cache_entry->data_size )
+		{
+			read_size = cache_entry->data_size - block_offset;
+		}
+		if( read_size > buffer_size )
+		{
+			read_size = buffer_size;
+		}
+		if( read_size > 0 )
+		{
+			if( memory_copy(
+			     buffer,
+			     &( cache_entry->data[ block_offset ] ),
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy block data.",
+				 function );
+
+				read_size = (size_t) -1;
+			}
+		}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_release(
+		     block_cache_shard->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release shard mutex.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		if( read_size == (size_t) -1 )
+		{
+			return( -1 );
+		}
+		return( (ssize_t) read_size );
+	}
+	block_cache_shard->number_of_misses += 1;
+
+	/* Reserve a block, the least recently used block is reused when the shard is full
+	 */
+	if( block_cache_shard->number_of_blocks < block_cache_shard->maximum_number_of_blocks )
+	{
+		block_cache_shard->number_of_blocks += 1;
+	}
+	else
+	{
+		cache_entry = block_cache_shard->least_recently_used;
+
+		if( cache_entry != NULL )
+		{
+			block_cache_shard->number_of_evictions += 1;
+
+			libsmraw_block_cache_shard_detach_entry(
+			 block_cache_shard,
+			 cache_entry );
+		}
+		else
+		{
+			read_uncached = 1;
+		}
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     block_cache_shard->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release shard mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( read_uncached != 0 )
+	{
+		/* All blocks are being read by other threads, read without caching
+		 */
+		read_count = block_cache->read_function(
+		              block_cache->data_handle,
+		              buffer,
+		              buffer_size,
+		              (off64_t) ( block_index * block_cache->block_size ) + block_offset,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read block: %" PRIu64 " data.",
+			 function,
+			 block_index );
+
+			return( -1 );
+		}
+		return( read_count );
+	}
+	if( cache_entry == NULL )
+	{
+		cache_entry = memory_allocate_structure(
+		               libsmraw_block_cache_entry_t );
+
+		if( cache_entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create cache entry.",
+			 function );
+
+			goto on_error;
+		}
+		cache_entry->data = (uint8_t *) libsmraw_direct_file_allocate_buffer(
+		                                 sizeof( uint8_t ) * block_cache->block_size );
+
+		if( cache_entry->data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create cache entry data.",
+			 function );
+
+			goto on_error;
+		}
+		cache_entry->next_in_slot  = NULL;
+		cache_entry->previous_used = NULL;
+		cache_entry->next_used     = NULL;
+	}
+	cache_entry->block_index = block_index;
+	cache_entry->slot_index  = slot_index;
+	cache_entry->data_size   = 0;
+
+	read_count = block_cache->read_function(
+	              block_cache->data_handle,
+	              cache_entry->data,
+	              block_cache->block_size,
+	              (off64_t) ( block_index * block_cache->block_size ),
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read block: %" PRIu64 " data.",
+		 function,
+		 block_index );
+
+		goto on_error;
+	}
+	cache_entry->data_size = (size_t) read_count;
+
+	read_size = 0;
+
+	if( block_offset < cache_entry->data_size )
+	{
+		read_size = cache_entry->data_size - block_offset;
+	}
+	if( read_size > buffer_size )
+	{
+		read_size = buffer_size;
+	}
+	if( read_size > 0 )
+	{
+		if( memory_copy(
+		     buffer,
+		     &( cache_entry->data[ block_offset ] ),
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy block data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     block_cache_shard->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab shard mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	/* Empty blocks and blocks that were cached by another thread in the meantime are discarded
+	 */
+	if( ( cache_entry->data_size == 0 )
+	 || ( libsmraw_block_cache_shard_get_entry(
+	       block_cache_shard,
+	       slot_index,
+	       block_index ) != NULL ) )
+	{
+		block_cache_shard->number_of_blocks -= 1;
+
+		memory_free(
+		 cache_entry->data );
+
+		memory_free(
+		 cache_entry );
+	}
+	else
+	{
+		libsmraw_block_cache_shard_attach_entry(
+		 block_cache_shard,
+		 cache_entry );
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     block_cache_shard->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release shard mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( (ssize_t) read_size );
+
+on_error:
+	if( cache_entry != NULL )
+	{
+		if( cache_entry->data != NULL )
+		{
+			memory_free(
+			 cache_entry->data );
+		}
+		memory_free(
+		 cache_entry );
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     block_cache_shard->mutex,
+	     NULL ) == 1 )
+	{
+		block_cache_shard->number_of_blocks -= 1;
+
+		libcthreads_mutex_release(
+		 block_cache_shard->mutex,
+		 NULL );
+	}
+#else
+	block_cache_shard->number_of_blocks -= 1;
+#endif
+	return( -1 );
+}
+
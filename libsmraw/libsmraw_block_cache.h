@@ -0,0 +1,206 @@
+/*
+ * Block cache functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSMRAW_BLOCK_CACHE_H )
+#define _LIBSMRAW_BLOCK_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsmraw_libcerror.h"
+#include "libsmraw_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libsmraw_block_cache_entry libsmraw_block_cache_entry_t;
+
+struct libsmraw_block_cache_entry
+{
+	/* The block index
+	 */
+	uint64_t block_index;
+
+	/* The hash table slot index
+	 */
+	int slot_index;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The next entry in the same hash table slot
+	 */
+	libsmraw_block_cache_entry_t *next_in_slot;
+
+	/* The previous (more recently used) entry in the LRU list
+	 */
+	libsmraw_block_cache_entry_t *previous_used;
+
+	/* The next (less recently used) entry in the LRU list
+	 */
+	libsmraw_block_cache_entry_t *next_used;
+};
+
+typedef struct libsmraw_block_cache_shard libsmraw_block_cache_shard_t;
+
+struct libsmraw_block_cache_shard
+{
+	/* The maximum number of blocks
+	 */
+	int maximum_number_of_blocks;
+
+	/* The number of blocks, including blocks that are being read
+	 */
+	int number_of_blocks;
+
+	/* The hash table
+	 */
+	libsmraw_block_cache_entry_t **hash_table;
+
+	/* The number of hash table slots
+	 */
+	int number_of_slots;
+
+	/* The most recently used entry
+	 */
+	libsmraw_block_cache_entry_t *most_recently_used;
+
+	/* The least recently used entry
+	 */
+	libsmraw_block_cache_entry_t *least_recently_used;
+
+	/* The number of cache hits
+	 */
+	uint64_t number_of_hits;
+
+	/* The number of cache misses
+	 */
+	uint64_t number_of_misses;
+
+	/* The number of evicted blocks
+	 */
+	uint64_t number_of_evictions;
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+typedef struct libsmraw_block_cache libsmraw_block_cache_t;
+
+struct libsmraw_block_cache
+{
+	/* The block size
+	 */
+	size_t block_size;
+
+	/* The shards
+	 */
+	libsmraw_block_cache_shard_t *shards;
+
+	/* The number of shards
+	 */
+	int number_of_shards;
+
+	/* The data handle
+	 */
+	intptr_t *data_handle;
+
+	/* The read function
+	 */
+	ssize_t (*read_function)(
+	           intptr_t *data_handle,
+	           void *buffer,
+	           size_t buffer_size,
+	           off64_t offset,
+	           libcerror_error_t **error );
+};
+
+int libsmraw_block_cache_initialize(
+     libsmraw_block_cache_t **block_cache,
+     size_t cache_size,
+     size_t block_size,
+     ssize_t (*read_function)(
+                intptr_t *data_handle,
+                void *buffer,
+                size_t buffer_size,
+                off64_t offset,
+                libcerror_error_t **error ),
+     intptr_t *data_handle,
+     libcerror_error_t **error );
+
+int libsmraw_block_cache_free(
+     libsmraw_block_cache_t **block_cache,
+     libcerror_error_t **error );
+
+int libsmraw_block_cache_empty(
+     libsmraw_block_cache_t *block_cache,
+     libcerror_error_t **error );
+
+int libsmraw_block_cache_get_statistics(
+     libsmraw_block_cache_t *block_cache,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     uint64_t *number_of_evictions,
+     libcerror_error_t **error );
+
+void libsmraw_block_cache_shard_detach_entry(
+      libsmraw_block_cache_shard_t *block_cache_shard,
+      libsmraw_block_cache_entry_t *cache_entry );
+
+void libsmraw_block_cache_shard_attach_entry(
+      libsmraw_block_cache_shard_t *block_cache_shard,
+      libsmraw_block_cache_entry_t *cache_entry );
+
+libsmraw_block_cache_entry_t *libsmraw_block_cache_shard_get_entry(
+                               libsmraw_block_cache_shard_t *block_cache_shard,
+                               int slot_index,
+                               uint64_t block_index );
+
+ssize_t libsmraw_block_cache_read_buffer(
+         libsmraw_block_cache_t *block_cache,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+ssize_t libsmraw_block_cache_read_block(
+         libsmraw_block_cache_t *block_cache,
+         uint64_t block_index,
+         size_t block_offset,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSMRAW_BLOCK_CACHE_H ) */
+
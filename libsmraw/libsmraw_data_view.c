@@ -0,0 +1,320 @@
+/*
+ * Data view functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libsmraw_data_view.h"
+#include "libsmraw_libcerror.h"
+#include "libsmraw_types.h"
+
+/* Creates a data view
+ * Make sure the value data_view is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_data_view_initialize(
+     libsmraw_data_view_t **data_view,
+     libcerror_error_t **error )
+{
+	libsmraw_internal_data_view_t *internal_data_view = NULL;
+	static char *function                             = "libsmraw_data_view_initialize";
+
+	if( data_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data view.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_view != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data view value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_data_view = memory_allocate_structure(
+	                      libsmraw_internal_data_view_t );
+
+	if( internal_data_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data view.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_data_view,
+	     0,
+	     sizeof( libsmraw_internal_data_view_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data view.",
+		 function );
+
+		goto on_error;
+	}
+	*data_view = (libsmraw_data_view_t *) internal_data_view;
+
+	return( 1 );
+
+on_error:
+	if( internal_data_view != NULL )
+	{
+		memory_free(
+		 internal_data_view );
+	}
+	return( -1 );
+}
+
+/* Frees a data view
+ * This releases the data referenced by the data view
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_data_view_free(
+     libsmraw_data_view_t **data_view,
+     libcerror_error_t **error )
+{
+	libsmraw_internal_data_view_t *internal_data_view = NULL;
+	static char *function                             = "libsmraw_data_view_free";
+
+	if( data_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data view.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_view != NULL )
+	{
+		internal_data_view = (libsmraw_internal_data_view_t *) *data_view;
+		*data_view         = NULL;
+
+		if( internal_data_view->buffer != NULL )
+		{
+			memory_free(
+			 internal_data_view->buffer );
+		}
+		memory_free(
+		 internal_data_view );
+	}
+	return( 1 );
+}
+
+/* Sets the data view to reference data that is owned elsewhere
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_internal_data_view_set_reference(
+     libsmraw_internal_data_view_t *internal_data_view,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_internal_data_view_set_reference";
+
+	if( internal_data_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data view.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_data_view->buffer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data view - buffer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	internal_data_view->data      = data;
+	internal_data_view->data_size = data_size;
+
+	return( 1 );
+}
+
+/* Allocates a buffer owned by the data view
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_internal_data_view_allocate_buffer(
+     libsmraw_internal_data_view_t *internal_data_view,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_internal_data_view_allocate_buffer";
+
+	if( internal_data_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data view.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_data_view->buffer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data view - buffer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_data_view->buffer = (uint8_t *) memory_allocate(
+	                                          sizeof( uint8_t ) * buffer_size );
+
+	if( internal_data_view->buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		return( -1 );
+	}
+	internal_data_view->data      = internal_data_view->buffer;
+	internal_data_view->data_size = buffer_size;
+
+	return( 1 );
+}
+
+/* Retrieves the data of the data view
+ * The data remains valid until the data view is freed or the handle is closed
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_data_view_get_data(
+     libsmraw_data_view_t *data_view,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libsmraw_internal_data_view_t *internal_data_view = NULL;
+	static char *function                             = "libsmraw_data_view_get_data";
+
+	if( data_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_data_view = (libsmraw_internal_data_view_t *) data_view;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	*data      = internal_data_view->data;
+	*data_size = internal_data_view->data_size;
+
+	return( 1 );
+}
+
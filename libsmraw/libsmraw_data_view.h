@@ -0,0 +1,85 @@
+/*
+ * Data view functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSMRAW_DATA_VIEW_H )
+#define _LIBSMRAW_DATA_VIEW_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsmraw_extern.h"
+#include "libsmraw_libcerror.h"
+#include "libsmraw_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libsmraw_internal_data_view libsmraw_internal_data_view_t;
+
+struct libsmraw_internal_data_view
+{
+	/* The data
+	 */
+	const uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The buffer, used when the data is not referenced directly
+	 */
+	uint8_t *buffer;
+};
+
+int libsmraw_data_view_initialize(
+     libsmraw_data_view_t **data_view,
+     libcerror_error_t **error );
+
+LIBSMRAW_EXTERN \
+int libsmraw_data_view_free(
+     libsmraw_data_view_t **data_view,
+     libcerror_error_t **error );
+
+int libsmraw_internal_data_view_set_reference(
+     libsmraw_internal_data_view_t *internal_data_view,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libsmraw_internal_data_view_allocate_buffer(
+     libsmraw_internal_data_view_t *internal_data_view,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+LIBSMRAW_EXTERN \
+int libsmraw_data_view_get_data(
+     libsmraw_data_view_t *data_view,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSMRAW_DATA_VIEW_H ) */
+
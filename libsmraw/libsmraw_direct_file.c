@@ -0,0 +1,994 @@
+/*
+ * Direct IO file functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/* O_DIRECT is only defined by the GNU C library when _GNU_SOURCE is set
+ */
+#if !defined( _GNU_SOURCE )
+#define _GNU_SOURCE 1
+#endif
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H ) || defined( WINAPI )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libsmraw_definitions.h"
+#include "libsmraw_direct_file.h"
+#include "libsmraw_libcerror.h"
+
+#if defined( O_DIRECT ) && defined( HAVE_POSIX_MEMALIGN ) && defined( HAVE_FREE ) && !defined( HAVE_GLIB_H ) && !defined( WINAPI )
+#define HAVE_LIBSMRAW_DIRECT_IO_SUPPORT	1
+#endif
+
+/* Allocates a buffer that is aligned for direct IO
+ * The buffer is freed with memory_free
+ * Returns a pointer to the buffer or NULL on error
+ */
+void *libsmraw_direct_file_allocate_buffer(
+       size_t buffer_size )
+{
+#if defined( HAVE_LIBSMRAW_DIRECT_IO_SUPPORT )
+	void *buffer = NULL;
+
+	if( buffer_size == 0 )
+	{
+		return( NULL );
+	}
+	if( posix_memalign(
+	     &buffer,
+	     LIBSMRAW_DIRECT_IO_ALIGNMENT,
+	     buffer_size ) != 0 )
+	{
+		return( NULL );
+	}
+	return( buffer );
+#else
+	return( memory_allocate(
+	         buffer_size ) );
+#endif
+}
+
+/* Creates a direct IO file
+ * Make sure the value direct_file is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_direct_file_initialize(
+     libsmraw_direct_file_t **direct_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_direct_file_initialize";
+
+	if( direct_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *direct_file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid direct file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*direct_file = memory_allocate_structure(
+	                libsmraw_direct_file_t );
+
+	if( *direct_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create direct file.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *direct_file,
+	     0,
+	     sizeof( libsmraw_direct_file_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear direct file.",
+		 function );
+
+		goto on_error;
+	}
+	( *direct_file )->file_descriptor = -1;
+
+	return( 1 );
+
+on_error:
+	if( *direct_file != NULL )
+	{
+		memory_free(
+		 *direct_file );
+
+		*direct_file = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a direct IO file
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_direct_file_free(
+     libsmraw_direct_file_t **direct_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_direct_file_free";
+	int result            = 1;
+
+	if( direct_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *direct_file != NULL )
+	{
+		if( ( *direct_file )->file_descriptor != -1 )
+		{
+			if( libsmraw_direct_file_close(
+			     *direct_file,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close direct file.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *direct_file );
+
+		*direct_file = NULL;
+	}
+	return( result );
+}
+
+/* Opens a file for direct IO
+ * A file opened for write access must already exist
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_direct_file_open(
+     libsmraw_direct_file_t *direct_file,
+     const char *filename,
+     int access_flags,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBSMRAW_DIRECT_IO_SUPPORT )
+	struct stat file_statistics;
+
+	int file_descriptor   = -1;
+	int open_flags        = 0;
+#endif
+	static char *function = "libsmraw_direct_file_open";
+
+	if( direct_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_file->file_descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid direct file - file descriptor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBSMRAW_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBSMRAW_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBSMRAW_DIRECT_IO_SUPPORT )
+	/* Write access also requires read access to merge partially written blocks
+	 */
+	if( ( access_flags & LIBSMRAW_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		open_flags = O_RDWR | O_DIRECT;
+	}
+	else
+	{
+		open_flags = O_RDONLY | O_DIRECT;
+	}
+	file_descriptor = open(
+	                   filename,
+	                   open_flags );
+
+	if( file_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open file: %s for direct IO.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( fstat(
+	     file_descriptor,
+	     &file_statistics ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 errno,
+		 "%s: unable to retrieve file statistics.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_statistics.st_size < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	/* The bounce buffer is allocated once per open file and reused
+	 * by every unaligned read and write
+	 */
+	direct_file->bounce_buffer = (uint8_t *) libsmraw_direct_file_allocate_buffer(
+	                                          LIBSMRAW_DIRECT_IO_BOUNCE_BUFFER_SIZE );
+
+	if( direct_file->bounce_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create bounce buffer.",
+		 function );
+
+		goto on_error;
+	}
+	direct_file->file_descriptor = file_descriptor;
+	direct_file->access_flags    = access_flags;
+	direct_file->current_offset  = 0;
+	direct_file->data_size       = (size64_t) file_statistics.st_size;
+	direct_file->is_padded       = 0;
+
+	return( 1 );
+
+on_error:
+	if( file_descriptor != -1 )
+	{
+		close(
+		 file_descriptor );
+	}
+	return( -1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: direct IO not supported.",
+	 function );
+
+	return( -1 );
+#endif /* defined( HAVE_LIBSMRAW_DIRECT_IO_SUPPORT ) */
+}
+
+/* Closes a direct IO file
+ * A file that was padded to a whole number of blocks is truncated to the size of its data
+ * Returns 0 if successful or -1 on error
+ */
+int libsmraw_direct_file_close(
+     libsmraw_direct_file_t *direct_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_direct_file_close";
+	int result            = 0;
+
+	if( direct_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBSMRAW_DIRECT_IO_SUPPORT )
+	if( direct_file->file_descriptor != -1 )
+	{
+		if( direct_file->is_padded != 0 )
+		{
+			if( ftruncate(
+			     direct_file->file_descriptor,
+			     (off_t) direct_file->data_size ) != 0 )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_RESIZE_FAILED,
+				 errno,
+				 "%s: unable to truncate file to size of data.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( close(
+		     direct_file->file_descriptor ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 errno,
+			 "%s: unable to close file.",
+			 function );
+
+			result = -1;
+		}
+	}
+#endif
+	if( direct_file->bounce_buffer != NULL )
+	{
+		memory_free(
+		 direct_file->bounce_buffer );
+
+		direct_file->bounce_buffer = NULL;
+	}
+	direct_file->file_descriptor = -1;
+	direct_file->current_offset  = 0;
+	direct_file->data_size       = 0;
+	direct_file->is_padded       = 0;
+
+	return( result );
+}
+
+/* Reads data from the current offset into a buffer
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libsmraw_direct_file_read_buffer(
+         libsmraw_direct_file_t *direct_file,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	static char *function = "libsmraw_direct_file_read_buffer";
+	ssize_t read_count    = 0;
+
+	if( direct_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libsmraw_direct_file_read_buffer_at_offset(
+	              direct_file,
+	              buffer,
+	              buffer_size,
+	              direct_file->current_offset,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer.",
+		 function );
+
+		return( -1 );
+	}
+	direct_file->current_offset += (off64_t) read_count;
+
+	return( read_count );
+}
+
+/* Reads data at a specific offset into a buffer
+ * Aligned parts are read directly into the buffer, unaligned head and tail
+ * parts are read through a bounce buffer
+ * This function does not change the current offset
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libsmraw_direct_file_read_buffer_at_offset(
+         libsmraw_direct_file_t *direct_file,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+#if defined( HAVE_LIBSMRAW_DIRECT_IO_SUPPORT )
+	size_t aligned_size    = 0;
+	size_t block_offset    = 0;
+	size_t buffer_offset   = 0;
+	size_t copy_size       = 0;
+	size_t read_size       = 0;
+	ssize_t read_count     = 0;
+#endif
+	static char *function  = "libsmraw_direct_file_read_buffer_at_offset";
+
+	if( direct_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_file->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid direct file - missing file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_file->bounce_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid direct file - missing bounce buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBSMRAW_DIRECT_IO_SUPPORT )
+	/* Do not read the padding of a file opened for write
+	 */
+	if( (size64_t) offset >= direct_file->data_size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) buffer_size > ( direct_file->data_size - (size64_t) offset ) )
+	{
+		buffer_size = (size_t) ( direct_file->data_size - (size64_t) offset );
+	}
+	while( buffer_offset < buffer_size )
+	{
+		block_offset = (size_t) ( offset % LIBSMRAW_DIRECT_IO_ALIGNMENT );
+		read_size    = buffer_size - buffer_offset;
+
+		if( ( block_offset == 0 )
+		 && ( read_size >= LIBSMRAW_DIRECT_IO_ALIGNMENT )
+		 && ( ( (intptr_t) &( buffer[ buffer_offset ] ) % LIBSMRAW_DIRECT_IO_ALIGNMENT ) == 0 ) )
+		{
+			read_size -= read_size % LIBSMRAW_DIRECT_IO_ALIGNMENT;
+
+			read_count = pread(
+			              direct_file->file_descriptor,
+			              &( buffer[ buffer_offset ] ),
+			              read_size,
+			              (off_t) offset );
+
+			if( read_count == -1 )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 errno,
+				 "%s: unable to read from file at offset: %" PRIi64 ".",
+				 function,
+				 offset );
+
+				return( -1 );
+			}
+			copy_size = (size_t) read_count;
+		}
+		else
+		{
+			aligned_size = block_offset + read_size;
+
+			if( aligned_size > LIBSMRAW_DIRECT_IO_BOUNCE_BUFFER_SIZE )
+			{
+				aligned_size = LIBSMRAW_DIRECT_IO_BOUNCE_BUFFER_SIZE;
+			}
+			else if( ( aligned_size % LIBSMRAW_DIRECT_IO_ALIGNMENT ) != 0 )
+			{
+				aligned_size += LIBSMRAW_DIRECT_IO_ALIGNMENT - ( aligned_size % LIBSMRAW_DIRECT_IO_ALIGNMENT );
+			}
+			read_count = pread(
+			              direct_file->file_descriptor,
+			              direct_file->bounce_buffer,
+			              aligned_size,
+			              (off_t) ( offset - (off64_t) block_offset ) );
+
+			if( read_count == -1 )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 errno,
+				 "%s: unable to read from file at offset: %" PRIi64 ".",
+				 function,
+				 offset - (off64_t) block_offset );
+
+				return( -1 );
+			}
+			copy_size = 0;
+
+			if( (size_t) read_count > block_offset )
+			{
+				copy_size = (size_t) read_count - block_offset;
+
+				if( copy_size > read_size )
+				{
+					copy_size = read_size;
+				}
+				if( memory_copy(
+				     &( buffer[ buffer_offset ] ),
+				     &( direct_file->bounce_buffer[ block_offset ] ),
+				     copy_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy data from bounce buffer.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			read_size = aligned_size;
+		}
+		buffer_offset += copy_size;
+		offset        += (off64_t) copy_size;
+
+		/* A short read indicates the end of the file
+		 */
+		if( (size_t) read_count < read_size )
+		{
+			break;
+		}
+	}
+	return( (ssize_t) buffer_offset );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: direct IO not supported.",
+	 function );
+
+	return( -1 );
+#endif /* defined( HAVE_LIBSMRAW_DIRECT_IO_SUPPORT ) */
+}
+
+/* Writes data from a buffer at the current offset
+ * Aligned parts are written directly from the buffer, unaligned head and tail
+ * parts are merged with the data in the file in a bounce buffer
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t libsmraw_direct_file_write_buffer(
+         libsmraw_direct_file_t *direct_file,
+         const uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+#if defined( HAVE_LIBSMRAW_DIRECT_IO_SUPPORT )
+	off64_t aligned_offset = 0;
+	size_t aligned_size    = 0;
+	size_t block_offset    = 0;
+	size_t buffer_offset   = 0;
+	size_t tail_offset     = 0;
+	size_t write_size      = 0;
+	ssize_t read_count     = 0;
+	ssize_t write_count    = 0;
+#endif
+	static char *function  = "libsmraw_direct_file_write_buffer";
+
+	if( direct_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_file->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid direct file - missing file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_file->bounce_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid direct file - missing bounce buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( direct_file->access_flags & LIBSMRAW_ACCESS_FLAG_WRITE ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid direct file - not opened for write access.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBSMRAW_DIRECT_IO_SUPPORT )
+	while( buffer_offset < buffer_size )
+	{
+		block_offset = (size_t) ( direct_file->current_offset % LIBSMRAW_DIRECT_IO_ALIGNMENT );
+		write_size   = buffer_size - buffer_offset;
+
+		if( ( block_offset == 0 )
+		 && ( write_size >= LIBSMRAW_DIRECT_IO_ALIGNMENT )
+		 && ( ( (intptr_t) &( buffer[ buffer_offset ] ) % LIBSMRAW_DIRECT_IO_ALIGNMENT ) == 0 ) )
+		{
+			write_size -= write_size % LIBSMRAW_DIRECT_IO_ALIGNMENT;
+
+			write_count = pwrite(
+			               direct_file->file_descriptor,
+			               &( buffer[ buffer_offset ] ),
+			               write_size,
+			               (off_t) direct_file->current_offset );
+
+			if( write_count != (ssize_t) write_size )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 errno,
+				 "%s: unable to write to file at offset: %" PRIi64 ".",
+				 function,
+				 direct_file->current_offset );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			if( ( block_offset + write_size ) > LIBSMRAW_DIRECT_IO_BOUNCE_BUFFER_SIZE )
+			{
+				write_size = LIBSMRAW_DIRECT_IO_BOUNCE_BUFFER_SIZE - block_offset;
+			}
+			aligned_offset = direct_file->current_offset - (off64_t) block_offset;
+			aligned_size   = block_offset + write_size;
+
+			if( ( aligned_size % LIBSMRAW_DIRECT_IO_ALIGNMENT ) != 0 )
+			{
+				aligned_size += LIBSMRAW_DIRECT_IO_ALIGNMENT - ( aligned_size % LIBSMRAW_DIRECT_IO_ALIGNMENT );
+			}
+			if( memory_set(
+			     direct_file->bounce_buffer,
+			     0,
+			     aligned_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear bounce buffer.",
+				 function );
+
+				return( -1 );
+			}
+			/* Merge the existing data of the partially written head block
+			 */
+			if( ( block_offset != 0 )
+			 && ( (size64_t) aligned_offset < direct_file->data_size ) )
+			{
+				read_count = pread(
+				              direct_file->file_descriptor,
+				              direct_file->bounce_buffer,
+				              LIBSMRAW_DIRECT_IO_ALIGNMENT,
+				              (off_t) aligned_offset );
+
+				if( read_count == -1 )
+				{
+					libcerror_system_set_error(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 errno,
+					 "%s: unable to read head block at offset: %" PRIi64 ".",
+					 function,
+					 aligned_offset );
+
+					return( -1 );
+				}
+			}
+			/* Merge the existing data of the partially written tail block
+			 */
+			tail_offset = aligned_size - LIBSMRAW_DIRECT_IO_ALIGNMENT;
+
+			if( ( ( block_offset + write_size ) < aligned_size )
+			 && ( ( block_offset == 0 )
+			  || ( tail_offset != 0 ) )
+			 && ( (size64_t) ( aligned_offset + (off64_t) tail_offset ) < direct_file->data_size ) )
+			{
+				read_count = pread(
+				              direct_file->file_descriptor,
+				              &( direct_file->bounce_buffer[ tail_offset ] ),
+				              LIBSMRAW_DIRECT_IO_ALIGNMENT,
+				              (off_t) ( aligned_offset + (off64_t) tail_offset ) );
+
+				if( read_count == -1 )
+				{
+					libcerror_system_set_error(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 errno,
+					 "%s: unable to read tail block at offset: %" PRIi64 ".",
+					 function,
+					 aligned_offset + (off64_t) tail_offset );
+
+					return( -1 );
+				}
+			}
+			if( memory_copy(
+			     &( direct_file->bounce_buffer[ block_offset ] ),
+			     &( buffer[ buffer_offset ] ),
+			     write_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy data to bounce buffer.",
+				 function );
+
+				return( -1 );
+			}
+			write_count = pwrite(
+			               direct_file->file_descriptor,
+			               direct_file->bounce_buffer,
+			               aligned_size,
+			               (off_t) aligned_offset );
+
+			if( write_count != (ssize_t) aligned_size )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 errno,
+				 "%s: unable to write to file at offset: %" PRIi64 ".",
+				 function,
+				 aligned_offset );
+
+				return( -1 );
+			}
+			if( (size64_t) ( aligned_offset + (off64_t) aligned_size ) > direct_file->data_size )
+			{
+				direct_file->is_padded = 1;
+			}
+		}
+		buffer_offset               += write_size;
+		direct_file->current_offset += (off64_t) write_size;
+
+		if( (size64_t) direct_file->current_offset > direct_file->data_size )
+		{
+			direct_file->data_size = (size64_t) direct_file->current_offset;
+		}
+	}
+	return( (ssize_t) buffer_offset );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: direct IO not supported.",
+	 function );
+
+	return( -1 );
+#endif /* defined( HAVE_LIBSMRAW_DIRECT_IO_SUPPORT ) */
+}
+
+/* Seeks a certain offset
+ * Returns the offset or -1 on error
+ */
+off64_t libsmraw_direct_file_seek_offset(
+         libsmraw_direct_file_t *direct_file,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libsmraw_direct_file_seek_offset";
+
+	if( direct_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	direct_file->current_offset = offset;
+
+	return( offset );
+}
+
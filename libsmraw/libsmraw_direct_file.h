@@ -0,0 +1,113 @@
+/*
+ * Direct IO file functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSMRAW_DIRECT_FILE_H )
+#define _LIBSMRAW_DIRECT_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsmraw_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libsmraw_direct_file libsmraw_direct_file_t;
+
+struct libsmraw_direct_file
+{
+	/* The file descriptor
+	 */
+	int file_descriptor;
+
+	/* The access flags
+	 */
+	int access_flags;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* The size of the data in the file
+	 */
+	size64_t data_size;
+
+	/* Value to indicate the file was padded beyond the end of the data
+	 */
+	uint8_t is_padded;
+
+	/* The aligned bounce buffer used for unaligned reads and writes
+	 */
+	uint8_t *bounce_buffer;
+};
+
+void *libsmraw_direct_file_allocate_buffer(
+       size_t buffer_size );
+
+int libsmraw_direct_file_initialize(
+     libsmraw_direct_file_t **direct_file,
+     libcerror_error_t **error );
+
+int libsmraw_direct_file_free(
+     libsmraw_direct_file_t **direct_file,
+     libcerror_error_t **error );
+
+int libsmraw_direct_file_open(
+     libsmraw_direct_file_t *direct_file,
+     const char *filename,
+     int access_flags,
+     libcerror_error_t **error );
+
+int libsmraw_direct_file_close(
+     libsmraw_direct_file_t *direct_file,
+     libcerror_error_t **error );
+
+ssize_t libsmraw_direct_file_read_buffer(
+         libsmraw_direct_file_t *direct_file,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+ssize_t libsmraw_direct_file_read_buffer_at_offset(
+         libsmraw_direct_file_t *direct_file,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+ssize_t libsmraw_direct_file_write_buffer(
+         libsmraw_direct_file_t *direct_file,
+         const uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+off64_t libsmraw_direct_file_seek_offset(
+         libsmraw_direct_file_t *direct_file,
+         off64_t offset,
+         libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSMRAW_DIRECT_FILE_H ) */
+
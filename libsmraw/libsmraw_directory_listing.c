@@ -0,0 +1,817 @@
+/*
+ * Directory listing functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_DIRENT_H )
+#include <dirent.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "libsmraw_directory_listing.h"
+#include "libsmraw_libcerror.h"
+#include "libsmraw_unused.h"
+
+/* Creates a directory listing
+ * Make sure the value directory_listing is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_directory_listing_initialize(
+     libsmraw_directory_listing_t **directory_listing,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_directory_listing_initialize";
+
+	if( directory_listing == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory listing.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory_listing != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory listing value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*directory_listing = memory_allocate_structure(
+	                      libsmraw_directory_listing_t );
+
+	if( *directory_listing == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create directory listing.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *directory_listing,
+	     0,
+	     sizeof( libsmraw_directory_listing_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear directory listing.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *directory_listing != NULL )
+	{
+		memory_free(
+		 *directory_listing );
+
+		*directory_listing = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a directory listing
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_directory_listing_free(
+     libsmraw_directory_listing_t **directory_listing,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_directory_listing_free";
+	int entry_index       = 0;
+
+	if( directory_listing == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory listing.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory_listing != NULL )
+	{
+		if( ( *directory_listing )->entry_names != NULL )
+		{
+			for( entry_index = 0;
+			     entry_index < ( *directory_listing )->number_of_entries;
+			     entry_index++ )
+			{
+				memory_free(
+				 ( *directory_listing )->entry_names[ entry_index ] );
+			}
+			memory_free(
+			 ( *directory_listing )->entry_names );
+		}
+		memory_free(
+		 *directory_listing );
+
+		*directory_listing = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends an entry name to the directory listing
+ * The entry names must be sorted before entries can be looked up
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_directory_listing_append_entry_name(
+     libsmraw_directory_listing_t *directory_listing,
+     const char *entry_name,
+     size_t entry_name_length,
+     libcerror_error_t **error )
+{
+	char *safe_entry_name           = NULL;
+	static char *function           = "libsmraw_directory_listing_append_entry_name";
+	void *reallocation              = NULL;
+	int number_of_allocated_entries = 0;
+
+	if( directory_listing == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory listing.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry name.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_name_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid entry name length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_listing->number_of_entries == INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory listing - number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	safe_entry_name = narrow_string_allocate(
+	                   entry_name_length + 1 );
+
+	if( safe_entry_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry name.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_string_copy(
+	     safe_entry_name,
+	     entry_name,
+	     entry_name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set entry name.",
+		 function );
+
+		goto on_error;
+	}
+	safe_entry_name[ entry_name_length ] = 0;
+
+	if( directory_listing->number_of_entries >= directory_listing->number_of_allocated_entries )
+	{
+		/* Grow the entry names exponentially to keep appending amortized constant time
+		 */
+		if( directory_listing->number_of_allocated_entries == 0 )
+		{
+			number_of_allocated_entries = 64;
+		}
+		else if( directory_listing->number_of_allocated_entries > ( INT_MAX / 2 ) )
+		{
+			number_of_allocated_entries = INT_MAX;
+		}
+		else
+		{
+			number_of_allocated_entries = directory_listing->number_of_allocated_entries * 2;
+		}
+		if( ( sizeof( char * ) * (size_t) number_of_allocated_entries ) > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: invalid entry names size value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		reallocation = memory_reallocate(
+		                directory_listing->entry_names,
+		                sizeof( char * ) * (size_t) number_of_allocated_entries );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to reallocate entry names.",
+			 function );
+
+			goto on_error;
+		}
+		directory_listing->entry_names                 = (char **) reallocation;
+		directory_listing->number_of_allocated_entries = number_of_allocated_entries;
+	}
+	directory_listing->entry_names[ directory_listing->number_of_entries ] = safe_entry_name;
+
+	directory_listing->number_of_entries += 1;
+
+	return( 1 );
+
+on_error:
+	if( safe_entry_name != NULL )
+	{
+		memory_free(
+		 safe_entry_name );
+	}
+	return( -1 );
+}
+
+/* Compares two names
+ * Returns a value less than, equal to or greater than 0 if the first name is
+ * less than, equal to or greater than the second name
+ */
+static int libsmraw_directory_listing_compare_names(
+            const char *first_name,
+            size_t first_name_length,
+            const char *second_name,
+            size_t second_name_length )
+{
+	size_t compare_length = first_name_length;
+	int result            = 0;
+
+	if( compare_length > second_name_length )
+	{
+		compare_length = second_name_length;
+	}
+	if( compare_length > 0 )
+	{
+		result = narrow_string_compare(
+		          first_name,
+		          second_name,
+		          compare_length );
+	}
+	if( result == 0 )
+	{
+		if( first_name_length < second_name_length )
+		{
+			result = -1;
+		}
+		else if( first_name_length > second_name_length )
+		{
+			result = 1;
+		}
+	}
+	return( result );
+}
+
+#if defined( HAVE_LIBSMRAW_DIRECTORY_LISTING_SUPPORT )
+
+/* Compares two entry names
+ * Callback function to sort the entry names
+ * Returns a value less than, equal to or greater than 0 if the first entry name is
+ * less than, equal to or greater than the second entry name
+ */
+static int libsmraw_directory_listing_compare_entry_names(
+            const void *first_entry_name,
+            const void *second_entry_name )
+{
+	const char *first_name  = *( (const char **) first_entry_name );
+	const char *second_name = *( (const char **) second_entry_name );
+
+	return( libsmraw_directory_listing_compare_names(
+	         first_name,
+	         narrow_string_length( first_name ),
+	         second_name,
+	         narrow_string_length( second_name ) ) );
+}
+
+/* Determines if a directory entry is a regular file or a symbolic link to a regular file
+ * The file type of the directory entry is used when available, otherwise the entry is stat-ed
+ * Returns 1 if the entry is a file, 0 if not or -1 on error
+ */
+static int libsmraw_directory_listing_entry_is_file(
+            const char *directory_name,
+            size_t directory_name_length,
+            struct dirent *directory_entry,
+            size_t entry_name_length,
+            libcerror_error_t **error )
+{
+#if defined( HAVE_SYS_STAT_H ) && defined( HAVE_STAT )
+	struct stat file_statistics;
+
+	char *entry_path        = NULL;
+	static char *function   = "libsmraw_directory_listing_entry_is_file";
+	size_t entry_path_index = 0;
+	size_t entry_path_size  = 0;
+	int result              = 0;
+#endif
+
+#if defined( HAVE_STRUCT_DIRENT_D_TYPE )
+	if( directory_entry->d_type == DT_REG )
+	{
+		return( 1 );
+	}
+	/* The file type of a symbolic link is that of its target
+	 */
+	if( ( directory_entry->d_type != DT_UNKNOWN )
+	 && ( directory_entry->d_type != DT_LNK ) )
+	{
+		return( 0 );
+	}
+#endif
+#if defined( HAVE_SYS_STAT_H ) && defined( HAVE_STAT )
+	entry_path_size = directory_name_length + entry_name_length + 2;
+
+	entry_path = narrow_string_allocate(
+	              entry_path_size );
+
+	if( entry_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry path.",
+		 function );
+
+		return( -1 );
+	}
+	if( narrow_string_copy(
+	     entry_path,
+	     directory_name,
+	     directory_name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set directory name in entry path.",
+		 function );
+
+		memory_free(
+		 entry_path );
+
+		return( -1 );
+	}
+	entry_path_index = directory_name_length;
+
+	if( directory_name[ directory_name_length - 1 ] != '/' )
+	{
+		entry_path[ entry_path_index++ ] = '/';
+	}
+	if( narrow_string_copy(
+	     &( entry_path[ entry_path_index ] ),
+	     directory_entry->d_name,
+	     entry_name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set entry name in entry path.",
+		 function );
+
+		memory_free(
+		 entry_path );
+
+		return( -1 );
+	}
+	entry_path[ entry_path_index + entry_name_length ] = 0;
+
+	/* An entry that was removed after it was read is not a file
+	 */
+	if( ( stat(
+	       entry_path,
+	       &file_statistics ) == 0 )
+	 && ( ( file_statistics.st_mode & S_IFMT ) == S_IFREG ) )
+	{
+		result = 1;
+	}
+	memory_free(
+	 entry_path );
+
+	return( result );
+#else
+	LIBSMRAW_UNREFERENCED_PARAMETER( directory_name )
+	LIBSMRAW_UNREFERENCED_PARAMETER( directory_name_length )
+	LIBSMRAW_UNREFERENCED_PARAMETER( entry_name_length )
+	LIBSMRAW_UNREFERENCED_PARAMETER( error )
+
+	/* Without file status functions entries are assumed to be files,
+	 * the segment files are verified when they are opened
+	 */
+	return( 1 );
+#endif
+}
+
+#endif /* defined( HAVE_LIBSMRAW_DIRECTORY_LISTING_SUPPORT ) */
+
+/* Reads the entries of the directory that contains the file
+ * This allows to match many segment filenames without accessing each segment file
+ * Only entries that are (symbolic links to) regular files are read
+ * Returns 1 if successful, 0 if the directory could not be read or -1 on error
+ */
+int libsmraw_directory_listing_read(
+     libsmraw_directory_listing_t *directory_listing,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBSMRAW_DIRECTORY_LISTING_SUPPORT )
+	struct dirent *directory_entry = NULL;
+	DIR *directory_stream          = NULL;
+	char *directory_name           = NULL;
+	size_t directory_name_length   = 0;
+	size_t entry_name_length       = 0;
+	int result                     = 0;
+#endif
+
+	static char *function          = "libsmraw_directory_listing_read";
+
+	if( directory_listing == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory listing.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_listing->entry_names != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory listing - entry names value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid filename length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBSMRAW_DIRECTORY_LISTING_SUPPORT )
+	directory_name_length = filename_length;
+
+	while( directory_name_length > 0 )
+	{
+		if( filename[ directory_name_length - 1 ] == '/' )
+		{
+			break;
+		}
+		directory_name_length--;
+	}
+	/* Keep the separator of the root directory
+	 */
+	if( directory_name_length > 1 )
+	{
+		directory_name_length--;
+	}
+	if( directory_name_length == 0 )
+	{
+		directory_name_length = 1;
+
+		filename = ".";
+	}
+	directory_name = narrow_string_allocate(
+	                  directory_name_length + 1 );
+
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create directory name.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_string_copy(
+	     directory_name,
+	     filename,
+	     directory_name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set directory name.",
+		 function );
+
+		goto on_error;
+	}
+	directory_name[ directory_name_length ] = 0;
+
+	directory_stream = opendir(
+	                    directory_name );
+
+	if( directory_stream == NULL )
+	{
+		memory_free(
+		 directory_name );
+
+		return( 0 );
+	}
+	directory_entry = readdir(
+	                   directory_stream );
+
+	while( directory_entry != NULL )
+	{
+		entry_name_length = narrow_string_length(
+		                     directory_entry->d_name );
+
+		if( ( entry_name_length > 2 )
+		 || ( directory_entry->d_name[ 0 ] != '.' )
+		 || ( ( entry_name_length == 2 )
+		  &&  ( directory_entry->d_name[ 1 ] != '.' ) ) )
+		{
+			result = libsmraw_directory_listing_entry_is_file(
+			          directory_name,
+			          directory_name_length,
+			          directory_entry,
+			          entry_name_length,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine if entry is a file.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			result = 0;
+		}
+		if( result != 0 )
+		{
+			if( libsmraw_directory_listing_append_entry_name(
+			     directory_listing,
+			     directory_entry->d_name,
+			     entry_name_length,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append entry name.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		directory_entry = readdir(
+		                   directory_stream );
+	}
+	if( closedir(
+	     directory_stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close directory.",
+		 function );
+
+		directory_stream = NULL;
+
+		goto on_error;
+	}
+	directory_stream = NULL;
+
+	memory_free(
+	 directory_name );
+
+	directory_name = NULL;
+
+	if( directory_listing->number_of_entries > 1 )
+	{
+		qsort(
+		 directory_listing->entry_names,
+		 (size_t) directory_listing->number_of_entries,
+		 sizeof( char * ),
+		 &libsmraw_directory_listing_compare_entry_names );
+	}
+	return( 1 );
+
+on_error:
+	if( directory_stream != NULL )
+	{
+		closedir(
+		 directory_stream );
+	}
+	if( directory_name != NULL )
+	{
+		memory_free(
+		 directory_name );
+	}
+	return( -1 );
+#else
+	return( 0 );
+#endif /* defined( HAVE_LIBSMRAW_DIRECTORY_LISTING_SUPPORT ) */
+}
+
+/* Determines if the directory listing contains the entry of the file
+ * Only the last path segment of the filename is matched
+ * Returns 1 if the directory listing contains the entry, 0 if not or -1 on error
+ */
+int libsmraw_directory_listing_has_entry(
+     libsmraw_directory_listing_t *directory_listing,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	const char *entry_name   = NULL;
+	static char *function    = "libsmraw_directory_listing_has_entry";
+	size_t entry_name_length = 0;
+	int entry_index          = 0;
+	int lower_entry_index    = 0;
+	int result               = 0;
+	int upper_entry_index    = 0;
+
+	if( directory_listing == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory listing.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid filename length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	entry_name_length = filename_length;
+
+	while( entry_name_length > 0 )
+	{
+		if( filename[ entry_name_length - 1 ] == '/' )
+		{
+			break;
+		}
+		entry_name_length--;
+	}
+	entry_name        = &( filename[ entry_name_length ] );
+	entry_name_length = filename_length - entry_name_length;
+
+	if( entry_name_length == 0 )
+	{
+		return( 0 );
+	}
+	upper_entry_index = directory_listing->number_of_entries;
+
+	while( lower_entry_index < upper_entry_index )
+	{
+		entry_index = lower_entry_index + ( ( upper_entry_index - lower_entry_index ) / 2 );
+
+		result = libsmraw_directory_listing_compare_names(
+		          entry_name,
+		          entry_name_length,
+		          directory_listing->entry_names[ entry_index ],
+		          narrow_string_length( directory_listing->entry_names[ entry_index ] ) );
+
+		if( result == 0 )
+		{
+			return( 1 );
+		}
+		else if( result < 0 )
+		{
+			upper_entry_index = entry_index;
+		}
+		else
+		{
+			lower_entry_index = entry_index + 1;
+		}
+	}
+	return( 0 );
+}
+
@@ -0,0 +1,86 @@
+/*
+ * Directory listing functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSMRAW_DIRECTORY_LISTING_H )
+#define _LIBSMRAW_DIRECTORY_LISTING_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsmraw_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_DIRENT_H ) && defined( HAVE_OPENDIR ) && defined( HAVE_READDIR ) && defined( HAVE_CLOSEDIR ) && !defined( WINAPI )
+#define HAVE_LIBSMRAW_DIRECTORY_LISTING_SUPPORT	1
+#endif
+
+typedef struct libsmraw_directory_listing libsmraw_directory_listing_t;
+
+struct libsmraw_directory_listing
+{
+	/* The entry names, sorted in ascending order
+	 */
+	char **entry_names;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_allocated_entries;
+};
+
+int libsmraw_directory_listing_initialize(
+     libsmraw_directory_listing_t **directory_listing,
+     libcerror_error_t **error );
+
+int libsmraw_directory_listing_free(
+     libsmraw_directory_listing_t **directory_listing,
+     libcerror_error_t **error );
+
+int libsmraw_directory_listing_append_entry_name(
+     libsmraw_directory_listing_t *directory_listing,
+     const char *entry_name,
+     size_t entry_name_length,
+     libcerror_error_t **error );
+
+int libsmraw_directory_listing_read(
+     libsmraw_directory_listing_t *directory_listing,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+int libsmraw_directory_listing_has_entry(
+     libsmraw_directory_listing_t *directory_listing,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSMRAW_DIRECTORY_LISTING_H ) */
+
@@ -26,6 +26,8 @@
 #include <types.h>
 #include <wide_string.h>
 
+#include "libsmraw_block_cache.h"
+#include "libsmraw_data_view.h"
 #include "libsmraw_definitions.h"
 #include "libsmraw_handle.h"
 #include "libsmraw_information_file.h"
@@ -37,7 +39,15 @@
 #include "libsmraw_libfdata.h"
 #include "libsmraw_libfvalue.h"
 #include "libsmraw_libuna.h"
+#include "libsmraw_manifest.h"
+#include "libsmraw_pool_policy.h"
+#include "libsmraw_read_ahead.h"
+#include "libsmraw_read_queue.h"
+#include "libsmraw_segment_table.h"
+#include "libsmraw_support.h"
 #include "libsmraw_types.h"
+#include "libsmraw_unused.h"
+#include "libsmraw_write_behind.h"
 
 /* Creates a handle
  * Make sure the value handle is referencing, is set to NULL
@@ -174,6 +184,8 @@ int libsmraw_handle_initialize(
 	}
 #endif
 	internal_handle->maximum_number_of_open_handles = LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES;
+	internal_handle->write_buffer_size              = LIBSMRAW_DEFAULT_WRITE_BUFFER_SIZE;
+	internal_handle->write_queue_size               = 0;
 
 	*handle = (libsmraw_handle_t *) internal_handle;
 
@@ -272,6 +284,22 @@ int libsmraw_handle_free(
 			result = -1;
 		}
 #endif
+		if( internal_handle->block_cache != NULL )
+		{
+			if( libsmraw_block_cache_free(
+			     &( internal_handle->block_cache ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free block cache.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( libsmraw_io_handle_free(
 		     &( internal_handle->io_handle ),
 		     error ) != 1 )
@@ -452,6 +480,10 @@ int libsmraw_internal_handle_initialize_write_values(
 }
 
 /* Opens a set of storage media RAW files
+ * LIBSMRAW_ACCESS_FLAG_MEMORY_MAP maps the segment files into memory on read only access
+ * LIBSMRAW_ACCESS_FLAG_LAZY_OPEN only opens the first and last segment file on read only access
+ * LIBSMRAW_ACCESS_FLAG_DIRECT_IO accesses the segment files using direct IO, bypassing the page cache
+ * LIBSMRAW_ACCESS_FLAG_MANIFEST uses and maintains a segment manifest on read only access
  * Returns 1 if successful or -1 on error
  */
 int libsmraw_handle_open(
@@ -463,14 +495,18 @@ int libsmraw_handle_open(
 {
 	libbfio_handle_t *file_io_handle            = NULL;
 	libbfio_pool_t *file_io_pool                = NULL;
+	libcerror_error_t *manifest_error           = NULL;
 	libsmraw_internal_handle_t *internal_handle = NULL;
 	system_character_t *information_filename    = NULL;
+	char *manifest_filename                     = NULL;
 	static char *function                       = "libsmraw_handle_open";
 	size_t filename_index                       = 0;
 	size_t filename_length                      = 0;
 	size_t information_filename_length          = 0;
+	size_t manifest_filename_size               = 0;
 	int bfio_access_flags                       = 0;
 	int filename_iterator                       = 0;
+	int result                                  = 0;
 
 	if( handle == NULL )
 	{
@@ -552,6 +588,54 @@ int libsmraw_handle_open(
 
 		return( -1 );
 	}
+	if( ( ( access_flags & LIBSMRAW_ACCESS_FLAG_MEMORY_MAP ) != 0 )
+	 && ( ( access_flags & LIBSMRAW_ACCESS_FLAG_WRITE ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: memory mapping is only supported for read only access.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBSMRAW_ACCESS_FLAG_DIRECT_IO ) != 0 )
+	 && ( ( access_flags & ( LIBSMRAW_ACCESS_FLAG_MEMORY_MAP | LIBSMRAW_ACCESS_FLAG_LAZY_OPEN ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: direct IO is not supported in combination with memory mapping or lazy opening.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBSMRAW_ACCESS_FLAG_LAZY_OPEN ) != 0 )
+	 && ( ( access_flags & ( LIBSMRAW_ACCESS_FLAG_WRITE | LIBSMRAW_ACCESS_FLAG_MEMORY_MAP ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: lazy opening is only supported for read only access without memory mapping.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBSMRAW_ACCESS_FLAG_MANIFEST ) != 0 )
+	 && ( ( access_flags & LIBSMRAW_ACCESS_FLAG_WRITE ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: segment manifest is only supported for read only access.",
+		 function );
+
+		return( -1 );
+	}
 	/* Open for read only or read/write
 	 */
 	if( ( access_flags & LIBSMRAW_ACCESS_FLAG_READ ) != 0 )
@@ -595,6 +679,95 @@ int libsmraw_handle_open(
 
 			goto on_error;
 		}
+		/* A segment manifest that matches the segment files provides their sizes
+		 * without the need to open them
+		 */
+		if( ( access_flags & LIBSMRAW_ACCESS_FLAG_MANIFEST ) != 0 )
+		{
+			if( libsmraw_manifest_create_filename(
+			     &manifest_filename,
+			     &manifest_filename_size,
+			     filenames[ 0 ],
+			     filename_length,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create manifest filename.",
+				 function );
+
+				goto on_error;
+			}
+			if( libsmraw_manifest_initialize(
+			     &( internal_handle->manifest ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create manifest.",
+				 function );
+
+				goto on_error;
+			}
+			result = libsmraw_manifest_read(
+			          internal_handle->manifest,
+			          manifest_filename,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read manifest.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				result = libsmraw_manifest_compare_segment_files(
+				          internal_handle->manifest,
+				          filenames,
+				          number_of_filenames,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to compare manifest with segment files.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			/* A missing or stale manifest is replaced after the segment files have been opened
+			 */
+			if( result == 0 )
+			{
+				if( libsmraw_manifest_free(
+				     &( internal_handle->manifest ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free manifest.",
+					 function );
+
+					goto on_error;
+				}
+			}
+		}
 		if( libbfio_pool_initialize(
 		     &file_io_pool,
 		     number_of_filenames,
@@ -766,6 +939,96 @@ int libsmraw_handle_open(
 	}
 	file_io_pool = NULL;
 
+	if( manifest_filename != NULL )
+	{
+		if( internal_handle->manifest != NULL )
+		{
+			if( libsmraw_manifest_free(
+			     &( internal_handle->manifest ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free manifest.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		/* The manifest is an optimization, failing to write it,
+		 * for example in a read-only directory, is not an error
+		 */
+		else if( libsmraw_handle_write_manifest(
+		          manifest_filename,
+		          filenames,
+		          number_of_filenames,
+		          &manifest_error ) == -1 )
+		{
+			libcerror_error_free(
+			 &manifest_error );
+		}
+		memory_free(
+		 manifest_filename );
+
+		manifest_filename = NULL;
+	}
+	if( ( access_flags & LIBSMRAW_ACCESS_FLAG_MEMORY_MAP ) != 0 )
+	{
+		if( libsmraw_io_handle_open_memory_maps(
+		     internal_handle->io_handle,
+		     internal_handle->file_io_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to map segment files into memory.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( access_flags & LIBSMRAW_ACCESS_FLAG_DIRECT_IO ) != 0 )
+	{
+		if( libsmraw_io_handle_open_direct_files(
+		     internal_handle->io_handle,
+		     internal_handle->file_io_pool,
+		     access_flags & ( LIBSMRAW_ACCESS_FLAG_READ | LIBSMRAW_ACCESS_FLAG_WRITE ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open segment files for direct IO.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The access pattern hints are only applied to the segment files opened by the library
+	 */
+	if( ( access_flags & LIBSMRAW_ACCESS_FLAG_READ ) != 0 )
+	{
+		if( libsmraw_io_handle_set_segment_file_names(
+		     internal_handle->io_handle,
+		     internal_handle->file_io_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set segment file names.",
+			 function );
+
+			goto on_error;
+		}
+	}
+
 	/* Open the information file
 	 */
 	if( internal_handle->io_handle->basename != NULL )
@@ -887,6 +1150,17 @@ on_error:
 		memory_free(
 		 information_filename );
 	}
+	if( manifest_filename != NULL )
+	{
+		memory_free(
+		 manifest_filename );
+	}
+	if( internal_handle->manifest != NULL )
+	{
+		libsmraw_manifest_free(
+		 &( internal_handle->manifest ),
+		 NULL );
+	}
 	if( file_io_handle != NULL )
 	{
 		libbfio_handle_free(
@@ -901,12 +1175,41 @@ on_error:
 	}
 	if( internal_handle->information_file != NULL )
 	{
-		libsmraw_information_file_initialize(
+		libsmraw_information_file_free(
 		 &( internal_handle->information_file ),
 		 NULL );
 	}
 	if( internal_handle->file_io_pool != NULL )
 	{
+		/* Remove the values created by libsmraw_handle_open_file_io_pool
+		 * since they reference the file IO pool
+		 */
+		if( internal_handle->segment_table != NULL )
+		{
+			libsmraw_segment_table_free(
+			 &( internal_handle->segment_table ),
+			 NULL );
+		}
+		if( internal_handle->io_handle->pool_policy != NULL )
+		{
+			libsmraw_pool_policy_free(
+			 &( internal_handle->io_handle->pool_policy ),
+			 NULL );
+		}
+		if( internal_handle->segments_stream != NULL )
+		{
+			libfdata_stream_free(
+			 &( internal_handle->segments_stream ),
+			 NULL );
+		}
+		internal_handle->read_values_initialized = 0;
+
+		libsmraw_io_handle_close_direct_files(
+		 internal_handle->io_handle,
+		 NULL );
+
+		internal_handle->io_handle->use_direct_io = 0;
+
 		libbfio_pool_free(
 		 &( internal_handle->file_io_pool ),
 		 NULL );
@@ -921,6 +1224,10 @@ on_error:
 #if defined( HAVE_WIDE_CHARACTER_TYPE )
 
 /* Opens a set of storage media RAW files
+ * LIBSMRAW_ACCESS_FLAG_MEMORY_MAP maps the segment files into memory on read only access
+ * LIBSMRAW_ACCESS_FLAG_LAZY_OPEN only opens the first and last segment file on read only access
+ * LIBSMRAW_ACCESS_FLAG_DIRECT_IO accesses the segment files using direct IO, bypassing the page cache
+ * LIBSMRAW_ACCESS_FLAG_MANIFEST is ignored
  * Returns 1 if successful or -1 on error
  */
 int libsmraw_handle_open_wide(
@@ -1021,6 +1328,42 @@ int libsmraw_handle_open_wide(
 
 		return( -1 );
 	}
+	if( ( ( access_flags & LIBSMRAW_ACCESS_FLAG_MEMORY_MAP ) != 0 )
+	 && ( ( access_flags & LIBSMRAW_ACCESS_FLAG_WRITE ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: memory mapping is only supported for read only access.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBSMRAW_ACCESS_FLAG_DIRECT_IO ) != 0 )
+	 && ( ( access_flags & ( LIBSMRAW_ACCESS_FLAG_MEMORY_MAP | LIBSMRAW_ACCESS_FLAG_LAZY_OPEN ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: direct IO is not supported in combination with memory mapping or lazy opening.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBSMRAW_ACCESS_FLAG_LAZY_OPEN ) != 0 )
+	 && ( ( access_flags & ( LIBSMRAW_ACCESS_FLAG_WRITE | LIBSMRAW_ACCESS_FLAG_MEMORY_MAP ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: lazy opening is only supported for read only access without memory mapping.",
+		 function );
+
+		return( -1 );
+	}
 	/* Open for read only or read/write
 	 */
 	if( ( access_flags & LIBSMRAW_ACCESS_FLAG_READ ) != 0 )
@@ -1235,6 +1578,61 @@ int libsmraw_handle_open_wide(
 	}
 	file_io_pool = NULL;
 
+	if( ( access_flags & LIBSMRAW_ACCESS_FLAG_MEMORY_MAP ) != 0 )
+	{
+		if( libsmraw_io_handle_open_memory_maps(
+		     internal_handle->io_handle,
+		     internal_handle->file_io_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to map segment files into memory.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( access_flags & LIBSMRAW_ACCESS_FLAG_DIRECT_IO ) != 0 )
+	{
+		if( libsmraw_io_handle_open_direct_files(
+		     internal_handle->io_handle,
+		     internal_handle->file_io_pool,
+		     access_flags & ( LIBSMRAW_ACCESS_FLAG_READ | LIBSMRAW_ACCESS_FLAG_WRITE ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open segment files for direct IO.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The access pattern hints are only applied to the segment files opened by the library
+	 */
+	if( ( access_flags & LIBSMRAW_ACCESS_FLAG_READ ) != 0 )
+	{
+		if( libsmraw_io_handle_set_segment_file_names(
+		     internal_handle->io_handle,
+		     internal_handle->file_io_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set segment file names.",
+			 function );
+
+			goto on_error;
+		}
+	}
+
 	/* Open the information file
 	 */
 	if( internal_handle->io_handle->basename != NULL )
@@ -1370,14 +1768,43 @@ on_error:
 	}
 	if( internal_handle->information_file != NULL )
 	{
-		libsmraw_information_file_initialize(
+		libsmraw_information_file_free(
 		 &( internal_handle->information_file ),
 		 NULL );
 	}
 	if( internal_handle->file_io_pool != NULL )
 	{
-		libbfio_pool_free(
-		 &( internal_handle->file_io_pool ),
+		/* Remove the values created by libsmraw_handle_open_file_io_pool
+		 * since they reference the file IO pool
+		 */
+		if( internal_handle->segment_table != NULL )
+		{
+			libsmraw_segment_table_free(
+			 &( internal_handle->segment_table ),
+			 NULL );
+		}
+		if( internal_handle->io_handle->pool_policy != NULL )
+		{
+			libsmraw_pool_policy_free(
+			 &( internal_handle->io_handle->pool_policy ),
+			 NULL );
+		}
+		if( internal_handle->segments_stream != NULL )
+		{
+			libfdata_stream_free(
+			 &( internal_handle->segments_stream ),
+			 NULL );
+		}
+		internal_handle->read_values_initialized = 0;
+
+		libsmraw_io_handle_close_direct_files(
+		 internal_handle->io_handle,
+		 NULL );
+
+		internal_handle->io_handle->use_direct_io = 0;
+
+		libbfio_pool_free(
+		 &( internal_handle->file_io_pool ),
 		 NULL );
 	}
 	libsmraw_io_handle_clear(
@@ -1390,6 +1817,10 @@ on_error:
 #endif
 
 /* Opens a set of storage media RAW files using a Basic File IO (bfio) pool
+ * LIBSMRAW_ACCESS_FLAG_MEMORY_MAP is ignored
+ * LIBSMRAW_ACCESS_FLAG_LAZY_OPEN only opens the first and last pool entry on read only access
+ * LIBSMRAW_ACCESS_FLAG_DIRECT_IO is ignored
+ * LIBSMRAW_ACCESS_FLAG_MANIFEST is ignored
  * Returns 1 if successful or -1 on error
  */
 int libsmraw_handle_open_file_io_pool(
@@ -1398,14 +1829,19 @@ int libsmraw_handle_open_file_io_pool(
      int access_flags,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *file_io_handle            = NULL;
 	libsmraw_internal_handle_t *internal_handle = NULL;
 	static char *function                       = "libsmraw_handle_open_file_io_pool";
 	size64_t file_io_handle_size                = 0;
+	size64_t inferred_segment_size              = 0;
+	size64_t *segment_file_sizes                = NULL;
+	off64_t segment_data_offset                 = 0;
+	uint8_t lazy_open                           = 0;
+	uint8_t use_manifest                        = 0;
+	uint8_t segment_flags                       = 0;
 	int number_of_file_io_handles               = 0;
 	int bfio_access_flags                       = 0;
 	int file_io_handle_index                    = 0;
-	int file_io_handle_is_open                  = 0;
+	int segment_index                           = 0;
 
 	if( handle == NULL )
 	{
@@ -1527,6 +1963,19 @@ int libsmraw_handle_open_file_io_pool(
 
 			goto on_error;
 		}
+		if( libsmraw_segment_table_initialize(
+		     &( internal_handle->segment_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create segment table.",
+			 function );
+
+			goto on_error;
+		}
 		if( ( access_flags & LIBSMRAW_ACCESS_FLAG_WRITE ) != 0 )
 		{
 			bfio_access_flags = LIBBFIO_OPEN_READ_WRITE;
@@ -1535,26 +1984,128 @@ int libsmraw_handle_open_file_io_pool(
 		{
 			bfio_access_flags = LIBBFIO_OPEN_READ;
 		}
-		for( file_io_handle_index = 0;
-		     file_io_handle_index < number_of_file_io_handles;
-		     file_io_handle_index++ )
+		/* The segment file sizes are provided by the segment manifest when set by open
+		 */
+		if( ( internal_handle->manifest != NULL )
+		 && ( internal_handle->manifest->number_of_segments == number_of_file_io_handles )
+		 && ( ( access_flags & LIBSMRAW_ACCESS_FLAG_WRITE ) == 0 ) )
+		{
+			use_manifest = 1;
+		}
+		/* On lazy opening only the first and last segment file are opened.
+		 * The other segment files are expected to have the size of the first segment file,
+		 * which is verified when the segment file is first accessed.
+		 */
+		if( ( ( access_flags & LIBSMRAW_ACCESS_FLAG_LAZY_OPEN ) != 0 )
+		 && ( ( access_flags & LIBSMRAW_ACCESS_FLAG_WRITE ) == 0 )
+		 && ( use_manifest == 0 )
+		 && ( number_of_file_io_handles > 2 ) )
 		{
-			if( libbfio_pool_get_handle(
+			if( libsmraw_io_handle_get_segment_file_size(
+			     internal_handle->io_handle,
 			     file_io_pool,
-			     file_io_handle_index,
-			     &file_io_handle,
+			     0,
+			     bfio_access_flags,
+			     &inferred_segment_size,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to retrieve file IO handle from pool entry: %d.",
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve size of segment file: 0.",
+				 function );
+
+				goto on_error;
+			}
+			if( libsmraw_io_handle_get_segment_file_size(
+			     internal_handle->io_handle,
+			     file_io_pool,
+			     number_of_file_io_handles - 1,
+			     bfio_access_flags,
+			     &file_io_handle_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve size of segment file: %d.",
 				 function,
-				 file_io_handle_index );
+				 number_of_file_io_handles - 1 );
+
+				goto on_error;
+			}
+			/* The sizes cannot be inferred if the last segment file is larger than the first,
+			 * in which case all segment files are opened
+			 */
+			if( ( inferred_segment_size > 0 )
+			 && ( file_io_handle_size <= inferred_segment_size ) )
+			{
+				lazy_open = 1;
+			}
+		}
+		if( lazy_open == 0 )
+		{
+			if( ( sizeof( size64_t ) * (size_t) number_of_file_io_handles ) > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: invalid segment file sizes size value exceeds maximum.",
+				 function );
+
+				goto on_error;
+			}
+			segment_file_sizes = (size64_t *) memory_allocate(
+			                                   sizeof( size64_t ) * (size_t) number_of_file_io_handles );
+
+			if( segment_file_sizes == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create segment file sizes.",
+				 function );
+
+				goto on_error;
+			}
+			if( use_manifest != 0 )
+			{
+				for( segment_index = 0;
+				     segment_index < number_of_file_io_handles;
+				     segment_index++ )
+				{
+					segment_file_sizes[ segment_index ] = internal_handle->manifest->segments[ segment_index ].size;
+				}
+			}
+			/* The segment files are opened and their sizes determined in parallel
+			 * when multi-threading is supported
+			 */
+			else if( libsmraw_io_handle_get_segment_file_sizes(
+			     internal_handle->io_handle,
+			     file_io_pool,
+			     number_of_file_io_handles,
+			     bfio_access_flags,
+			     segment_file_sizes,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sizes of segment files.",
+				 function );
 
 				goto on_error;
 			}
+		}
+		for( file_io_handle_index = 0;
+		     file_io_handle_index < number_of_file_io_handles;
+		     file_io_handle_index++ )
+		{
 #if defined( HAVE_DEBUG_OUTPUT )
 			if( libcnotify_verbose != 0 )
 			{
@@ -1564,70 +2115,81 @@ int libsmraw_handle_open_file_io_pool(
 				 file_io_handle_index );
 			}
 #endif
-			file_io_handle_is_open = libbfio_handle_is_open(
-			                          file_io_handle,
-			                          error );
-
-			if( file_io_handle_is_open == -1 )
+			if( ( lazy_open != 0 )
+			 && ( file_io_handle_index > 0 )
+			 && ( file_io_handle_index < ( number_of_file_io_handles - 1 ) ) )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_OPEN_FAILED,
-				 "%s: unable to determine if file IO handle is open.",
-				 function );
-
-				goto on_error;
+				file_io_handle_size = inferred_segment_size;
+				segment_flags       = LIBSMRAW_SEGMENT_FLAG_SIZE_INFERRED;
+			}
+			else if( segment_file_sizes != NULL )
+			{
+				file_io_handle_size = segment_file_sizes[ file_io_handle_index ];
+				segment_flags       = 0;
+
+				/* The segment manifest was only compared with the first and last segment file,
+				 * hence the sizes of the other segment files are verified on first access
+				 * by a reading thread, see libsmraw_internal_handle_verify_segment_size
+				 */
+				if( ( use_manifest != 0 )
+				 && ( file_io_handle_index > 0 )
+				 && ( file_io_handle_index < ( number_of_file_io_handles - 1 ) ) )
+				{
+					segment_flags = LIBSMRAW_SEGMENT_FLAG_SIZE_INFERRED;
+				}
 			}
-			else if( file_io_handle_is_open == 0 )
+			else
 			{
-				if( libbfio_pool_open(
+				if( libsmraw_io_handle_get_segment_file_size(
+				     internal_handle->io_handle,
 				     file_io_pool,
 				     file_io_handle_index,
 				     bfio_access_flags,
+				     &file_io_handle_size,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_OPEN_FAILED,
-					 "%s: unable to open pool entry: %d.",
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve size of segment file: %d.",
 					 function,
 					 file_io_handle_index );
 
 					goto on_error;
 				}
+				segment_flags = 0;
 			}
-			if( libbfio_pool_get_size(
-			     file_io_pool,
+			if( libfdata_stream_set_segment_by_index(
+			     internal_handle->segments_stream,
 			     file_io_handle_index,
-			     &file_io_handle_size,
+			     file_io_handle_index,
+			     0,
+			     file_io_handle_size,
+			     0,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve file size for pool entry: %d.",
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set segment: %d in segments stream.",
 				 function,
 				 file_io_handle_index );
 
 				goto on_error;
 			}
-			if( libfdata_stream_set_segment_by_index(
-			     internal_handle->segments_stream,
-			     file_io_handle_index,
-			     file_io_handle_index,
-			     0,
+			if( libsmraw_segment_table_append_segment(
+			     internal_handle->segment_table,
 			     file_io_handle_size,
-			     0,
+			     segment_flags,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set segment: %d in segments stream.",
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append segment: %d to segment table.",
 				 function,
 				 file_io_handle_index );
 
@@ -1656,13 +2218,116 @@ int libsmraw_handle_open_file_io_pool(
 
 			goto on_error;
 		}
+		if( internal_handle->io_handle->media_size > 0 )
+		{
+			/* Make sure the segments stream has calculated its mapped ranges
+			 * before concurrent reads use it with the read/write lock held for reading
+			 */
+			if( libfdata_stream_get_segment_index_at_offset(
+			     internal_handle->segments_stream,
+			     0,
+			     &segment_index,
+			     &segment_data_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve segment index at offset: 0 from segments stream.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( segment_file_sizes != NULL )
+		{
+			memory_free(
+			 segment_file_sizes );
+
+			segment_file_sizes = NULL;
+		}
+		/* On read only access the segment files are opened and closed by the pool policy,
+		 * which keeps frequently accessed segment files open, instead of the least recently used
+		 * policy of the file IO pool, and does not close segment files that are being read
+		 */
+		if( ( access_flags & LIBSMRAW_ACCESS_FLAG_WRITE ) == 0 )
+		{
+			if( libsmraw_pool_policy_initialize(
+			     &( internal_handle->io_handle->pool_policy ),
+			     number_of_file_io_handles,
+			     internal_handle->maximum_number_of_open_handles,
+			     bfio_access_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create pool policy.",
+				 function );
+
+				goto on_error;
+			}
+			if( libbfio_pool_set_maximum_number_of_open_handles(
+			     file_io_pool,
+			     LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set maximum number of open handles in file IO pool.",
+				 function );
+
+				goto on_error;
+			}
+			/* The segment files opened to determine their size are closed by the pool policy
+			 */
+			if( libsmraw_pool_policy_add_open_entries(
+			     internal_handle->io_handle->pool_policy,
+			     file_io_pool,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to add open segment files to pool policy.",
+				 function );
+
+				goto on_error;
+			}
+		}
 		internal_handle->read_values_initialized = 1;
 	}
+	if( ( access_flags & LIBSMRAW_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		internal_handle->has_write_access = 1;
+	}
 	internal_handle->file_io_pool = file_io_pool;
 
 	return( 1 );
 
 on_error:
+	if( segment_file_sizes != NULL )
+	{
+		memory_free(
+		 segment_file_sizes );
+	}
+	if( internal_handle->segment_table != NULL )
+	{
+		libsmraw_segment_table_free(
+		 &( internal_handle->segment_table ),
+		 NULL );
+	}
+	if( internal_handle->io_handle->pool_policy != NULL )
+	{
+		libsmraw_pool_policy_free(
+		 &( internal_handle->io_handle->pool_policy ),
+		 NULL );
+	}
 	if( internal_handle->segments_stream != NULL )
 	{
 		libfdata_stream_free(
@@ -1876,61 +2541,290 @@ on_error:
 	return( -1 );
 }
 
-/* Closes a RAW handle
- * Returns the 0 if successful or -1 on error
+/* Writes a segment manifest of the segment files
+ * Returns 1 if successful, 0 if the values of a segment file are not available or -1 on error
  */
-int libsmraw_handle_close(
-     libsmraw_handle_t *handle,
+int libsmraw_handle_write_manifest(
+     const char *manifest_filename,
+     char * const filenames[],
+     int number_of_filenames,
      libcerror_error_t **error )
 {
-	libsmraw_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libsmraw_handle_close";
-	int result                                  = 0;
+	libsmraw_manifest_t *manifest = NULL;
+	const char *extension         = NULL;
+	static char *function         = "libsmraw_handle_write_manifest";
+	size_t filename_index         = 0;
+	size_t filename_length        = 0;
+	uint8_t naming_schema         = 0;
+	int result                    = 0;
 
-	if( handle == NULL )
+	if( manifest_filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
+		 "%s: invalid manifest filename.",
 		 function );
 
 		return( -1 );
 	}
-	internal_handle = (libsmraw_internal_handle_t *) handle;
+	if( filenames == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filenames.",
+		 function );
 
-	if( internal_handle->file_io_pool == NULL )
+		return( -1 );
+	}
+	if( libsmraw_manifest_initialize(
+	     &manifest,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing file IO pool.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create manifest.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( internal_handle->write_information_on_close != 0 )
+	result = libsmraw_manifest_set_segment_files(
+	          manifest,
+	          filenames,
+	          number_of_filenames,
+	          error );
+
+	if( result == -1 )
 	{
-		if( libsmraw_information_file_open(
-		     internal_handle->information_file,
-		     internal_handle->information_file->name,
-		     LIBSMRAW_OPEN_WRITE,
-		     error ) != 1 )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set segment files in manifest.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		/* Determine the naming schema from the extension of the first segment file
+		 */
+		filename_length = narrow_string_length(
+		                   filenames[ 0 ] );
+
+		for( filename_index = filename_length;
+		     filename_index > 0;
+		     filename_index-- )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_OPEN_FAILED,
-			 "%s: unable to open information file.",
-			 function );
+			if( filenames[ 0 ][ filename_index - 1 ] == '.' )
+			{
+				extension = &( filenames[ 0 ][ filename_index ] );
 
-			return( -1 );
+				break;
+			}
+			else if( filenames[ 0 ][ filename_index - 1 ] == '/' )
+			{
+				break;
+			}
 		}
-		if( libsmraw_information_file_write_section(
-		     internal_handle->information_file,
-		     (uint8_t *) "information_values",
+		if( extension != NULL )
+		{
+			if( libsmraw_glob_determine_naming_schema(
+			     extension,
+			     filename_length - filename_index,
+			     &naming_schema,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine naming schema.",
+				 function );
+
+				goto on_error;
+			}
+			manifest->naming_schema = naming_schema;
+		}
+		if( libsmraw_manifest_write(
+		     manifest,
+		     manifest_filename,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write manifest.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libsmraw_manifest_free(
+	     &manifest,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free manifest.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( manifest != NULL )
+	{
+		libsmraw_manifest_free(
+		 &manifest,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes a RAW handle
+ * Returns the 0 if successful or -1 on error
+ */
+int libsmraw_handle_close(
+     libsmraw_handle_t *handle,
+     libcerror_error_t **error )
+{
+	libsmraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmraw_handle_close";
+	int result                                  = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmraw_internal_handle_t *) handle;
+
+	if( internal_handle->file_io_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing file IO pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->write_behind != NULL )
+	{
+		if( libsmraw_write_behind_flush(
+		     internal_handle->write_behind,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush write-behind.",
+			 function );
+
+			result = -1;
+		}
+		if( libsmraw_write_behind_free(
+		     &( internal_handle->write_behind ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free write-behind.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_handle->read_ahead != NULL )
+	{
+		if( libsmraw_read_ahead_free(
+		     &( internal_handle->read_ahead ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read-ahead.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_handle->block_cache != NULL )
+	{
+		if( libsmraw_block_cache_empty(
+		     internal_handle->block_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty block cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( internal_handle->read_queue != NULL )
+	{
+		if( libsmraw_read_queue_free(
+		     &( internal_handle->read_queue ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read queue.",
+			 function );
+
+			result = -1;
+		}
+	}
+#endif
+	if( internal_handle->write_information_on_close != 0 )
+	{
+		if( libsmraw_information_file_open(
+		     internal_handle->information_file,
+		     internal_handle->information_file->name,
+		     LIBSMRAW_OPEN_WRITE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open information file.",
+			 function );
+
+			return( -1 );
+		}
+		if( libsmraw_information_file_write_section(
+		     internal_handle->information_file,
+		     (uint8_t *) "information_values",
 		     18,
 		     internal_handle->information_values,
 		     error ) != 1 )
@@ -1974,6 +2868,19 @@ int libsmraw_handle_close(
 			result = -1;
 		}
 	}
+	if( libsmraw_io_handle_close_direct_files(
+	     internal_handle->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close direct IO segment files.",
+		 function );
+
+		result = -1;
+	}
 	if( internal_handle->file_io_pool_created_in_library != 0 )
 	{
 		if( libbfio_pool_close_all(
@@ -2004,7 +2911,21 @@ int libsmraw_handle_close(
 		}
 		internal_handle->file_io_pool_created_in_library = 0;
 	}
+	if( libsmraw_io_handle_finalize_segments(
+	     internal_handle->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to finalize segment files.",
+		 function );
+
+		result = -1;
+	}
 	internal_handle->file_io_pool             = NULL;
+	internal_handle->has_write_access         = 0;
 	internal_handle->read_values_initialized  = 0;
 	internal_handle->write_values_initialized = 0;
 
@@ -2034,6 +2955,22 @@ int libsmraw_handle_close(
 
 		result = -1;
 	}
+	if( internal_handle->segment_table != NULL )
+	{
+		if( libsmraw_segment_table_free(
+		     &( internal_handle->segment_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free segment table.",
+			 function );
+
+			result = -1;
+		}
+	}
 	if( internal_handle->information_file != NULL )
 	{
 		if( libsmraw_information_file_free(
@@ -2143,6 +3080,23 @@ ssize_t libsmraw_handle_read_buffer(
 		return( -1 );
 	}
 #endif
+	/* Buffered data is written first so that it can be read back,
+	 * the write-behind is recreated on the next write since reading
+	 * changes the current offset of the segments stream
+	 */
+	if( libsmraw_internal_handle_flush_write_behind(
+	     internal_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush write-behind.",
+		 function );
+
+		goto on_error;
+	}
 	if( libfdata_stream_get_offset(
 	     internal_handle->segments_stream,
 	     &current_offset,
@@ -2178,7 +3132,80 @@ ssize_t libsmraw_handle_read_buffer(
 	{
 		buffer_size = (size_t) ( internal_handle->io_handle->media_size - (size64_t) current_offset );
 	}
-	if( buffer_size > 0 )
+	/* Read-ahead is only used for sequential reading of segment files
+	 * that are not memory mapped and not opened with write access,
+	 * since written data would not be in the read-ahead window
+	 */
+	if( ( buffer_size > 0 )
+	 && ( internal_handle->read_ahead_size > 0 )
+	 && ( internal_handle->read_values_initialized != 0 )
+	 && ( internal_handle->has_write_access == 0 )
+	 && ( internal_handle->write_values_initialized == 0 )
+	 && ( internal_handle->io_handle->number_of_memory_maps == 0 ) )
+	{
+		read_count = libsmraw_internal_handle_read_buffer_with_read_ahead(
+		              internal_handle,
+		              (uint8_t *) buffer,
+		              buffer_size,
+		              current_offset,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer using read-ahead.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* Other reads of segment files that are not written use the positional read,
+	 * which maps the offset using the segment table
+	 */
+	else if( ( buffer_size > 0 )
+	      && ( internal_handle->segment_table != NULL )
+	      && ( internal_handle->write_values_initialized == 0 ) )
+	{
+		read_count = libsmraw_internal_handle_read_buffer_at_offset(
+		              internal_handle,
+		              (uint8_t *) buffer,
+		              buffer_size,
+		              current_offset,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 current_offset,
+			 current_offset );
+
+			goto on_error;
+		}
+		if( libfdata_stream_seek_offset(
+		     internal_handle->segments_stream,
+		     current_offset + (off64_t) read_count,
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek offset in segments stream.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else if( buffer_size > 0 )
 	{
 		read_count = libfdata_stream_read_buffer(
 		              internal_handle->segments_stream,
@@ -2226,67 +3253,2650 @@ on_error:
 	return( -1 );
 }
 
-/* Reads (media) data at a specific offset
+/* Reads (media) data at the current offset using the read-ahead
+ * The read-ahead is created on first use
+ * This function updates the current offset of the segments stream
+ * and must be called while holding the read/write lock for writing
  * Returns the number of bytes read or -1 on error
  */
-ssize_t libsmraw_handle_read_buffer_at_offset(
-         libsmraw_handle_t *handle,
-         void *buffer,
+ssize_t libsmraw_internal_handle_read_buffer_with_read_ahead(
+         libsmraw_internal_handle_t *internal_handle,
+         uint8_t *buffer,
          size_t buffer_size,
          off64_t offset,
          libcerror_error_t **error )
 {
-	static char *function = "libsmraw_handle_read_buffer_at_offset";
+	static char *function = "libsmraw_internal_handle_read_buffer_with_read_ahead";
 	ssize_t read_count    = 0;
 
-	if( libsmraw_handle_seek_offset(
-	     handle,
-	     offset,
-	     SEEK_SET,
-	     error ) == -1 )
+	if( internal_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->has_write_access != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid handle - read-ahead not supported with write access.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->read_ahead == NULL )
+	{
+		/* The prefetch runs without holding the read/write lock, which is safe
+		 * since positional reads do not use the segments stream and the prefetch
+		 * does not verify inferred segment sizes, which changes the segment table
+		 * The prefetch bypasses the block cache to prevent the window evicting cached blocks
+		 */
+		if( libsmraw_read_ahead_initialize(
+		     &( internal_handle->read_ahead ),
+		     internal_handle->read_ahead_size,
+		     (ssize_t (*)(intptr_t *, void *, size_t, off64_t, libcerror_error_t **)) &libsmraw_internal_handle_read_segments_at_offset,
+		     (ssize_t (*)(intptr_t *, void *, size_t, off64_t, libcerror_error_t **)) &libsmraw_internal_handle_prefetch_segments_at_offset,
+		     (intptr_t *) internal_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create read-ahead.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	read_count = libsmraw_read_ahead_read_buffer(
+	              internal_handle->read_ahead,
+	              buffer,
+	              buffer_size,
+	              offset,
+	              internal_handle->io_handle->media_size,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer from read-ahead at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	if( libfdata_stream_seek_offset(
+	     internal_handle->segments_stream,
+	     offset + (off64_t) read_count,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset in segments stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Reads (media) data at a specific offset
+ * The block cache is used when enabled and the segment files are read-only and not memory mapped
+ * This function does not change the current offset of the segments stream
+ * and can be called while holding the read/write lock for reading when there is a segment table
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libsmraw_internal_handle_read_buffer_at_offset(
+         libsmraw_internal_handle_t *internal_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libsmraw_internal_handle_read_buffer_at_offset";
+	ssize_t read_count    = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_handle->block_cache != NULL )
+	 && ( internal_handle->write_values_initialized == 0 )
+	 && ( internal_handle->io_handle->number_of_memory_maps == 0 ) )
+	{
+		read_count = libsmraw_block_cache_read_buffer(
+		              internal_handle->block_cache,
+		              buffer,
+		              buffer_size,
+		              offset,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer from block cache.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		read_count = libsmraw_internal_handle_read_segments_at_offset(
+		              internal_handle,
+		              buffer,
+		              buffer_size,
+		              offset,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer from segments.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( read_count );
+}
+
+/* Verifies the size of a segment that was inferred on lazy opening
+ * or that was read from the segment manifest
+ * The segment file is opened on first access by the file IO pool
+ * The segment table is only updated while holding its mutex, hence this function
+ * can be called while holding the read/write lock for reading
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_internal_handle_verify_segment_size(
+     libsmraw_internal_handle_t *internal_handle,
+     int segment_index,
+     libcerror_error_t **error )
+{
+	static char *function      = "libsmraw_internal_handle_verify_segment_size";
+	size64_t segment_file_size = 0;
+	uint8_t segment_flags      = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmraw_segment_table_get_segment_flags(
+	     internal_handle->segment_table,
+	     segment_index,
+	     &segment_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve segment: %d flags.",
+		 function,
+		 segment_index );
+
+		return( -1 );
+	}
+	if( ( segment_flags & LIBSMRAW_SEGMENT_FLAG_SIZE_INFERRED ) == 0 )
+	{
+		return( 1 );
+	}
+	if( libsmraw_io_handle_get_segment_file_size(
+	     internal_handle->io_handle,
+	     internal_handle->file_io_pool,
+	     segment_index,
+	     LIBBFIO_OPEN_READ,
+	     &segment_file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size of segment file: %d.",
+		 function,
+		 segment_index );
+
+		return( -1 );
+	}
+	/* Another reader can have verified the segment in the meantime,
+	 * which the segment table handles
+	 */
+	if( libsmraw_segment_table_verify_segment_size(
+	     internal_handle->segment_table,
+	     segment_index,
+	     segment_file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to verify size of segment: %d.",
+		 function,
+		 segment_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the segment file that contains a specific (media) offset
+ * The segment table is used when reading and the segments stream otherwise,
+ * which requires the read/write lock to be grabbed for writing
+ * Segments with an inferred size are verified if verify_segment_sizes is set
+ * and are considered not available otherwise
+ * Returns 1 if successful, 0 if the offset is beyond the media size or not available or -1 on error
+ */
+int libsmraw_internal_handle_get_segment_file_at_offset(
+     libsmraw_internal_handle_t *internal_handle,
+     off64_t offset,
+     uint8_t verify_segment_sizes,
+     int *segment_index,
+     int *segment_file_index,
+     off64_t *segment_file_offset,
+     size64_t *segment_remaining_size,
+     libcerror_error_t **error )
+{
+	static char *function       = "libsmraw_internal_handle_get_segment_file_at_offset";
+	size64_t segment_size       = 0;
+	off64_t segment_data_offset = 0;
+	off64_t segment_offset      = 0;
+	uint32_t segment_flags      = 0;
+	uint8_t table_segment_flags = 0;
+	int result                  = 0;
+	int safe_segment_file_index = 0;
+	int safe_segment_index      = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment index.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_file_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment file index.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_file_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment file offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_remaining_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment remaining size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->segment_table != NULL )
+	{
+		/* When reading every pool entry contains exactly one segment
+		 * that starts at the beginning of the segment file
+		 */
+		result = libsmraw_segment_table_get_segment_at_offset(
+		          internal_handle->segment_table,
+		          offset,
+		          &safe_segment_index,
+		          &segment_data_offset,
+		          &segment_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment at offset: %" PRIi64 " (0x%08" PRIx64 ") from segment table.",
+			 function,
+			 offset,
+			 offset );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		safe_segment_file_index = safe_segment_index;
+
+		if( internal_handle->segment_table->has_inferred_segment_sizes != 0 )
+		{
+			if( verify_segment_sizes != 0 )
+			{
+				if( libsmraw_internal_handle_verify_segment_size(
+				     internal_handle,
+				     safe_segment_index,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to verify size of segment: %d.",
+					 function,
+					 safe_segment_index );
+
+					return( -1 );
+				}
+			}
+			else
+			{
+				if( libsmraw_segment_table_get_segment_flags(
+				     internal_handle->segment_table,
+				     safe_segment_index,
+				     &table_segment_flags,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve segment: %d flags.",
+					 function,
+					 safe_segment_index );
+
+					return( -1 );
+				}
+				if( ( table_segment_flags & LIBSMRAW_SEGMENT_FLAG_SIZE_INFERRED ) != 0 )
+				{
+					return( 0 );
+				}
+			}
+		}
+	}
+	else
+	{
+		if( libfdata_stream_get_segment_index_at_offset(
+		     internal_handle->segments_stream,
+		     offset,
+		     &safe_segment_index,
+		     &segment_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment index at offset: %" PRIi64 " (0x%08" PRIx64 ") from segments stream.",
+			 function,
+			 offset,
+			 offset );
+
+			return( -1 );
+		}
+		if( libfdata_stream_get_segment_by_index(
+		     internal_handle->segments_stream,
+		     safe_segment_index,
+		     &safe_segment_file_index,
+		     &segment_offset,
+		     &segment_size,
+		     &segment_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment: %d from segments stream.",
+			 function,
+			 safe_segment_index );
+
+			return( -1 );
+		}
+	}
+	if( ( segment_data_offset < 0 )
+	 || ( (size64_t) segment_data_offset >= segment_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segment: %d data offset value out of bounds.",
+		 function,
+		 safe_segment_index );
+
+		return( -1 );
+	}
+	*segment_index          = safe_segment_index;
+	*segment_file_index     = safe_segment_file_index;
+	*segment_file_offset    = segment_offset + segment_data_offset;
+	*segment_remaining_size = segment_size - (size64_t) segment_data_offset;
+
+	return( 1 );
+}
+
+/* Reads (media) data at a specific offset directly from the segment files
+ * This function does not change the current offset of the segments stream
+ * and can be called while holding the read/write lock for reading when there is a segment table
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libsmraw_internal_handle_read_segments_at_offset(
+         libsmraw_internal_handle_t *internal_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	return( libsmraw_internal_handle_read_segment_files_at_offset(
+	         internal_handle,
+	         buffer,
+	         buffer_size,
+	         offset,
+	         1,
+	         error ) );
+}
+
+/* Prefetches (media) data at a specific offset directly from the segment files
+ * This function is called without holding the read/write lock and does not change the segment table,
+ * hence reading stops at a segment of which the inferred size was not yet verified
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libsmraw_internal_handle_prefetch_segments_at_offset(
+         libsmraw_internal_handle_t *internal_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	return( libsmraw_internal_handle_read_segment_files_at_offset(
+	         internal_handle,
+	         buffer,
+	         buffer_size,
+	         offset,
+	         0,
+	         error ) );
+}
+
+/* Reads (media) data at a specific offset directly from the segment files
+ * Segments with an inferred size are verified if verify_segment_sizes is set,
+ * otherwise reading stops at the first segment with an inferred size
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libsmraw_internal_handle_read_segment_files_at_offset(
+         libsmraw_internal_handle_t *internal_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         uint8_t verify_segment_sizes,
+         libcerror_error_t **error )
+{
+	static char *function           = "libsmraw_internal_handle_read_segment_files_at_offset";
+	size64_t segment_remaining_size = 0;
+	size_t buffer_offset            = 0;
+	size_t read_size                = 0;
+	ssize_t read_count              = 0;
+	off64_t segment_file_offset     = 0;
+	int result                      = 0;
+	int segment_file_index          = 0;
+	int segment_index               = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Bail out early for requests to read beyond the media size
+	 */
+	if( (size64_t) offset >= internal_handle->io_handle->media_size )
+	{
+		return( 0 );
+	}
+	if( ( (size64_t) offset + buffer_size ) >= internal_handle->io_handle->media_size )
+	{
+		buffer_size = (size_t) ( internal_handle->io_handle->media_size - (size64_t) offset );
+	}
+	while( buffer_offset < buffer_size )
+	{
+		result = libsmraw_internal_handle_get_segment_file_at_offset(
+		          internal_handle,
+		          offset,
+		          verify_segment_sizes,
+		          &segment_index,
+		          &segment_file_index,
+		          &segment_file_offset,
+		          &segment_remaining_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment file at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		read_size = buffer_size - buffer_offset;
+
+		if( (size64_t) read_size > segment_remaining_size )
+		{
+			read_size = (size_t) segment_remaining_size;
+		}
+		read_count = libsmraw_io_handle_read_segment_data_at_offset(
+		              internal_handle->io_handle,
+		              internal_handle->file_io_pool,
+		              segment_file_index,
+		              &( buffer[ buffer_offset ] ),
+		              read_size,
+		              segment_file_offset,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read segment: %d data.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+		offset        += (off64_t) read_count;
+		buffer_offset += (size_t) read_count;
+
+		if( internal_handle->io_handle->abort != 0 )
+		{
+			break;
+		}
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Writes the data buffered by the write-behind and frees it
+ * The write-behind is recreated on the next write
+ * This function must be called while holding the read/write lock for writing
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_internal_handle_flush_write_behind(
+     libsmraw_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_internal_handle_flush_write_behind";
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->write_behind == NULL )
+	{
+		return( 1 );
+	}
+	if( libsmraw_write_behind_flush(
+	     internal_handle->write_behind,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush write-behind.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmraw_write_behind_free(
+	     &( internal_handle->write_behind ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free write-behind.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Grabs the read/write lock for a read that does not change the current offset
+ * The read/write lock is grabbed for writing when there is no segment table,
+ * since mapping an offset using the segments stream can change its mapped ranges,
+ * or when there is a write-behind, of which the data is written first so that
+ * it can be read back
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_internal_handle_grab_for_positional_read(
+     libsmraw_internal_handle_t *internal_handle,
+     uint8_t *is_exclusive,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_internal_handle_grab_for_positional_read";
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( is_exclusive == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid is exclusive.",
+		 function );
+
+		return( -1 );
+	}
+	*is_exclusive = 0;
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_handle->segment_table != NULL )
+	 && ( internal_handle->write_behind == NULL ) )
+	{
+		return( 1 );
+	}
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+	*is_exclusive = 1;
+#endif
+	if( libsmraw_internal_handle_flush_write_behind(
+	     internal_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush write-behind.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_handle->read_write_lock,
+	 NULL );
+
+	*is_exclusive = 0;
+#endif
+	return( -1 );
+}
+
+/* Releases the read/write lock grabbed for a read that does not change the current offset
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_internal_handle_release_for_positional_read(
+     libsmraw_internal_handle_t *internal_handle,
+     uint8_t is_exclusive,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_internal_handle_release_for_positional_read";
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( is_exclusive != 0 )
+	{
+		if( libcthreads_read_write_lock_release_for_write(
+		     internal_handle->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( libcthreads_read_write_lock_release_for_read(
+	          internal_handle->read_write_lock,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	LIBSMRAW_UNREFERENCED_PARAMETER( is_exclusive )
+#endif
+	return( 1 );
+}
+
+/* Reads (media) data at a specific offset
+ * This function does not change the current offset
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libsmraw_handle_read_buffer_at_offset(
+         libsmraw_handle_t *handle,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libsmraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmraw_handle_read_buffer_at_offset";
+	ssize_t read_count                          = 0;
+	uint8_t is_exclusive                        = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmraw_internal_handle_t *) handle;
+
+	if( internal_handle->file_io_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing file IO pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmraw_internal_handle_grab_for_positional_read(
+	     internal_handle,
+	     &is_exclusive,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libsmraw_internal_handle_read_buffer_at_offset(
+	              internal_handle,
+	              (uint8_t *) buffer,
+	              buffer_size,
+	              offset,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		read_count = -1;
+	}
+	if( libsmraw_internal_handle_release_for_positional_read(
+	     internal_handle,
+	     is_exclusive,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock.",
+		 function );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Retrieves a read-only view of (media) data at a specific offset
+ * The data is referenced directly when the range is memory mapped and
+ * otherwise read into a buffer owned by the data view
+ * The data view must be freed before the handle is closed
+ * This function does not change the current offset
+ * Returns 1 if successful, 0 if the offset is beyond the media size or -1 on error
+ */
+int libsmraw_handle_get_data_view(
+     libsmraw_handle_t *handle,
+     off64_t offset,
+     size_t size,
+     libsmraw_data_view_t **data_view,
+     libcerror_error_t **error )
+{
+	libsmraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmraw_handle_get_data_view";
+	uint8_t is_exclusive                        = 0;
+	int result                                  = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmraw_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->file_io_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing file IO pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data view.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_view != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data view value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmraw_internal_handle_grab_for_positional_read(
+	     internal_handle,
+	     &is_exclusive,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) offset < internal_handle->io_handle->media_size )
+	{
+		if( ( (size64_t) offset + size ) >= internal_handle->io_handle->media_size )
+		{
+			size = (size_t) ( internal_handle->io_handle->media_size - (size64_t) offset );
+		}
+		result = libsmraw_internal_handle_get_data_view(
+		          internal_handle,
+		          offset,
+		          size,
+		          data_view,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data view at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			result = -1;
+		}
+	}
+	if( libsmraw_internal_handle_release_for_positional_read(
+	     internal_handle,
+	     is_exclusive,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock.",
+		 function );
+
+		if( *data_view != NULL )
+		{
+			libsmraw_data_view_free(
+			 data_view,
+			 NULL );
+		}
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves a read-only view of (media) data at a specific offset
+ * The range must be within the media size
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_internal_handle_get_data_view(
+     libsmraw_internal_handle_t *internal_handle,
+     off64_t offset,
+     size_t size,
+     libsmraw_data_view_t **data_view,
+     libcerror_error_t **error )
+{
+	libsmraw_internal_data_view_t *internal_data_view = NULL;
+	const uint8_t *segment_data                       = NULL;
+	static char *function                             = "libsmraw_internal_handle_get_data_view";
+	size64_t segment_remaining_size                   = 0;
+	ssize_t read_count                                = 0;
+	off64_t segment_file_offset                       = 0;
+	int result                                        = 0;
+	int segment_file_index                            = 0;
+	int segment_index                                 = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data view.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmraw_data_view_initialize(
+	     data_view,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data view.",
+		 function );
+
+		goto on_error;
+	}
+	internal_data_view = (libsmraw_internal_data_view_t *) *data_view;
+
+	if( internal_handle->io_handle->memory_maps != NULL )
+	{
+		if( libsmraw_internal_handle_get_segment_file_at_offset(
+		     internal_handle,
+		     offset,
+		     1,
+		     &segment_index,
+		     &segment_file_index,
+		     &segment_file_offset,
+		     &segment_remaining_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment file at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			goto on_error;
+		}
+		/* Only a range that does not cross a segment boundary can be referenced directly
+		 */
+		if( (size64_t) size <= segment_remaining_size )
+		{
+			result = libsmraw_io_handle_get_mapped_segment_data_at_offset(
+			          internal_handle->io_handle,
+			          segment_file_index,
+			          segment_file_offset,
+			          size,
+			          &segment_data,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve mapped segment: %d data.",
+				 function,
+				 segment_index );
+
+				goto on_error;
+			}
+		}
+	}
+	if( result != 0 )
+	{
+		if( libsmraw_internal_data_view_set_reference(
+		     internal_data_view,
+		     segment_data,
+		     size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set data view reference.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( libsmraw_internal_data_view_allocate_buffer(
+		     internal_data_view,
+		     size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create data view buffer.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = libsmraw_internal_handle_read_buffer_at_offset(
+		              internal_handle,
+		              internal_data_view->buffer,
+		              size,
+		              offset,
+		              error );
+
+		if( read_count != (ssize_t) size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *data_view != NULL )
+	{
+		libsmraw_data_view_free(
+		 data_view,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Submits a batch of read requests
+ * The read requests are processed asynchronously when multi-threading is
+ * supported and otherwise synchronously before this function returns
+ * The read requests and their buffers must remain valid until they are reaped
+ * This function does not change the current offset
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_handle_submit_reads(
+     libsmraw_handle_t *handle,
+     libsmraw_read_request_t *read_requests,
+     int number_of_read_requests,
+     libcerror_error_t **error )
+{
+	libsmraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmraw_handle_submit_reads";
+	int read_request_index                      = 0;
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	int result                                  = 1;
+#else
+	libcerror_error_t *read_error               = NULL;
+#endif
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmraw_internal_handle_t *) handle;
+
+	if( internal_handle->file_io_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing file IO pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_requests == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read requests.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_read_requests <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of read requests value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	for( read_request_index = 0;
+	     read_request_index < number_of_read_requests;
+	     read_request_index++ )
+	{
+		if( read_requests[ read_request_index ].buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid read request: %d - missing buffer.",
+			 function,
+			 read_request_index );
+
+			return( -1 );
+		}
+		if( read_requests[ read_request_index ].buffer_size > (size_t) SSIZE_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid read request: %d - buffer size value exceeds maximum.",
+			 function,
+			 read_request_index );
+
+			return( -1 );
+		}
+		if( read_requests[ read_request_index ].offset < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid read request: %d - offset value out of bounds.",
+			 function,
+			 read_request_index );
+
+			return( -1 );
+		}
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+	/* Buffered data is written first so that the read queue threads
+	 * can read it back while holding the read/write lock for reading
+	 */
+	if( libsmraw_internal_handle_flush_write_behind(
+	     internal_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush write-behind.",
+		 function );
+
+		result = -1;
+	}
+	else if( internal_handle->read_queue == NULL )
+	{
+		if( libsmraw_read_queue_initialize(
+		     &( internal_handle->read_queue ),
+		     LIBSMRAW_NUMBER_OF_READ_THREADS,
+		     (ssize_t (*)(intptr_t *, void *, size_t, off64_t, libcerror_error_t **)) &libsmraw_handle_read_buffer_at_offset,
+		     (intptr_t *) handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create read queue.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+	if( result != 1 )
+	{
+		return( -1 );
+	}
+	/* The read requests are pushed without holding the read/write lock
+	 * since the read queue threads grab it for reading
+	 */
+	for( read_request_index = 0;
+	     read_request_index < number_of_read_requests;
+	     read_request_index++ )
+	{
+		if( libsmraw_read_queue_push(
+		     internal_handle->read_queue,
+		     &( read_requests[ read_request_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push read request: %d onto read queue.",
+			 function,
+			 read_request_index );
+
+			return( -1 );
+		}
+	}
+#else
+	for( read_request_index = 0;
+	     read_request_index < number_of_read_requests;
+	     read_request_index++ )
+	{
+		read_requests[ read_request_index ].read_count = libsmraw_handle_read_buffer_at_offset(
+		                                                  handle,
+		                                                  read_requests[ read_request_index ].buffer,
+		                                                  read_requests[ read_request_index ].buffer_size,
+		                                                  read_requests[ read_request_index ].offset,
+		                                                  &read_error );
+
+		if( read_requests[ read_request_index ].read_count < 0 )
+		{
+			libcerror_error_free(
+			 &read_error );
+
+			read_requests[ read_request_index ].read_count = -1;
+		}
+	}
+#endif /* defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT ) */
+
+	return( 1 );
+}
+
+/* Waits until all submitted read requests have completed
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_handle_reap_reads(
+     libsmraw_handle_t *handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_handle_reap_reads";
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	libsmraw_internal_handle_t *internal_handle = NULL;
+#endif
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	internal_handle = (libsmraw_internal_handle_t *) handle;
+
+	if( internal_handle->read_queue != NULL )
+	{
+		if( libsmraw_read_queue_wait(
+		     internal_handle->read_queue,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for read requests to complete.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( 1 );
+}
+
+/* Writes a buffer
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t libsmraw_handle_write_buffer(
+         libsmraw_handle_t *handle,
+         const void *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libsmraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmraw_handle_write_buffer";
+	ssize_t write_count                         = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmraw_internal_handle_t *) handle;
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	write_count = libsmraw_internal_handle_write_buffer(
+	               internal_handle,
+	               (uint8_t *) buffer,
+	               buffer_size,
+	               error );
+
+	if( write_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write buffer.",
+		 function );
+
+		write_count = -1;
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( write_count );
+}
+
+/* Writes a buffer
+ * The writer thread of the write-behind does not grab the read/write lock,
+ * the buffered and queued data is written before the segments stream is used
+ * by any function that holds the read/write lock
+ * This function must be called while holding the read/write lock for writing
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t libsmraw_internal_handle_write_buffer(
+         libsmraw_internal_handle_t *internal_handle,
+         const uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	static char *function  = "libsmraw_internal_handle_write_buffer";
+	off64_t current_offset = 0;
+	ssize_t write_count    = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->file_io_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing file IO pool.",
+		 function );
+
+		return( -1 );
+	}
+	/* The read-ahead reads segment data in the background and would contain stale data after a write
+	 */
+	if( internal_handle->read_ahead != NULL )
+	{
+		if( libsmraw_read_ahead_free(
+		     &( internal_handle->read_ahead ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read-ahead.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_handle->write_values_initialized == 0 )
+	{
+		if( libsmraw_internal_handle_initialize_write_values(
+		     internal_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize write values.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* Bail out early for requests to write empty buffers
+	 */
+	if( buffer_size == 0 )
+	{
+		return( 0 );
+	}
+	/* The segments stream is not used while the writer thread writes queued buffers
+	 */
+	if( internal_handle->write_behind != NULL )
+	{
+		current_offset = internal_handle->write_behind->current_offset;
+	}
+	else if( libfdata_stream_get_offset(
+	          internal_handle->segments_stream,
+	          &current_offset,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current offset from segments stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( current_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid current offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_handle->media_size > 0 )
+	{
+		/* Bail out early for requests to write beyond the media size
+		 */
+		if( (size64_t) current_offset >= internal_handle->io_handle->media_size )
+		{
+			return( 0 );
+		}
+		if( ( (size64_t) current_offset + buffer_size ) >= internal_handle->io_handle->media_size )
+		{
+			buffer_size = (size_t) ( internal_handle->io_handle->media_size - (size64_t) current_offset );
+		}
+	}
+	if( internal_handle->write_buffer_size == 0 )
+	{
+		write_count = libsmraw_internal_handle_write_segments_data(
+		               internal_handle,
+		               (uint8_t *) buffer,
+		               buffer_size,
+		               error );
+
+		if( write_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write buffer to segments stream.",
+			 function );
+
+			return( -1 );
+		}
+		return( write_count );
+	}
+	if( internal_handle->write_behind == NULL )
+	{
+		/* Buffered data is written up to a segment file boundary so that
+		 * a single write does not need to be split over segment files
+		 */
+		if( libsmraw_write_behind_initialize(
+		     &( internal_handle->write_behind ),
+		     internal_handle->write_buffer_size,
+		     internal_handle->io_handle->maximum_segment_size,
+		     internal_handle->write_queue_size,
+		     (ssize_t (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &libsmraw_internal_handle_write_segments_data,
+		     (intptr_t *) internal_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create write-behind.",
+			 function );
+
+			return( -1 );
+		}
+		internal_handle->write_behind->current_offset = current_offset;
+	}
+	write_count = libsmraw_write_behind_write_buffer(
+	               internal_handle->write_behind,
+	               (uint8_t *) buffer,
+	               buffer_size,
+	               current_offset,
+	               error );
+
+	if( write_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write buffer to write-behind.",
+		 function );
+
+		return( -1 );
+	}
+	return( write_count );
+}
+
+/* Writes data to the segments stream at its current offset
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t libsmraw_internal_handle_write_segments_data(
+         libsmraw_internal_handle_t *internal_handle,
+         const uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	static char *function = "libsmraw_internal_handle_write_segments_data";
+	ssize_t write_count   = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	write_count = libfdata_stream_write_buffer(
+	               internal_handle->segments_stream,
+	               (intptr_t *) internal_handle->file_io_pool,
+	               (uint8_t *) buffer,
+	               buffer_size,
+	               0,
+	               error );
+
+	if( write_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write buffer to segments stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( write_count );
+}
+
+/* Writes (media) data at a specific offset,
+ * Returns the number of input bytes written, 0 when no longer bytes can be written or -1 on error
+ */
+ssize_t libsmraw_handle_write_buffer_at_offset(
+         libsmraw_handle_t *handle,
+         const void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libsmraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmraw_handle_write_buffer_at_offset";
+	ssize_t write_count                         = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmraw_internal_handle_t *) handle;
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libsmraw_internal_handle_seek_offset(
+	     internal_handle,
+	     offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset.",
+		 function );
+
+		write_count = -1;
+	}
+	else
+	{
+		write_count = libsmraw_internal_handle_write_buffer(
+		               internal_handle,
+		               (uint8_t *) buffer,
+		               buffer_size,
+		               error );
+
+		if( write_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write buffer.",
+			 function );
+
+			write_count = -1;
+		}
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( write_count );
+}
+
+/* Seeks a certain offset
+ * Returns the offset or -1 on error
+ */
+off64_t libsmraw_handle_seek_offset(
+         libsmraw_handle_t *handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	libsmraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmraw_handle_seek_offset";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmraw_internal_handle_t *) handle;
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	offset = libsmraw_internal_handle_seek_offset(
+	          internal_handle,
+	          offset,
+	          whence,
+	          error );
+
+	if( offset == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset.",
+		 function );
+
+		offset = -1;
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( offset );
+}
+
+/* Seeks a certain offset
+ * This function must be called while holding the read/write lock for writing
+ * Returns the offset or -1 on error
+ */
+off64_t libsmraw_internal_handle_seek_offset(
+         libsmraw_internal_handle_t *internal_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "libsmraw_internal_handle_seek_offset";
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->file_io_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing file IO pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->write_behind != NULL )
+	{
+		/* Seeking to the current offset, as done by libsmraw_handle_write_buffer_at_offset
+		 * for sequential writes, does not require the buffered data to be written
+		 */
+		if( ( whence == SEEK_SET )
+		 && ( offset == internal_handle->write_behind->current_offset ) )
+		{
+			return( offset );
+		}
+		if( libsmraw_write_behind_flush(
+		     internal_handle->write_behind,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush write-behind.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	offset = libfdata_stream_seek_offset(
+	          internal_handle->segments_stream,
+	          offset,
+	          whence,
+	          error );
+
+	if( offset == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to seek offset in segments stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->write_behind != NULL )
+	{
+		internal_handle->write_behind->current_offset = offset;
+	}
+	return( offset );
+}
+
+/* Retrieves the current offset of the (media) data
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_handle_get_offset(
+     libsmraw_handle_t *handle,
+     off64_t *offset,
+     libcerror_error_t **error )
+{
+	libsmraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmraw_handle_get_offset";
+	int result                                  = 1;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmraw_internal_handle_t *) handle;
+
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* The offset includes data that is buffered or queued but not yet written
+	 */
+	if( internal_handle->write_behind != NULL )
+	{
+		*offset = internal_handle->write_behind->current_offset;
+	}
+	else if( libfdata_stream_get_offset(
+	          internal_handle->segments_stream,
+	          offset,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve offset from segments stream.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the maximum number of (concurrent) open file handles
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_handle_set_maximum_number_of_open_handles(
+     libsmraw_handle_t *handle,
+     int maximum_number_of_open_handles,
+     libcerror_error_t **error )
+{
+	libsmraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmraw_handle_set_maximum_number_of_open_handles";
+	int result                                  = 1;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmraw_internal_handle_t *) handle;
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* The writer thread uses the file IO pool, hence buffered data is written first
+	 */
+	if( libsmraw_internal_handle_flush_write_behind(
+	     internal_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush write-behind.",
+		 function );
+
+		result = -1;
+	}
+	else if( internal_handle->io_handle->pool_policy != NULL )
+	{
+		if( libsmraw_pool_policy_set_maximum_number_of_open_handles(
+		     internal_handle->io_handle->pool_policy,
+		     maximum_number_of_open_handles,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set maximum number of open handles in pool policy.",
+			 function );
+
+			result = -1;
+		}
+	}
+	else if( internal_handle->file_io_pool != NULL )
+	{
+		if( libbfio_pool_set_maximum_number_of_open_handles(
+		     internal_handle->file_io_pool,
+		     maximum_number_of_open_handles,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set maximum number of open handles in file IO handle.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		internal_handle->maximum_number_of_open_handles = maximum_number_of_open_handles;
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the read-ahead window size
+ * A size of 0 disables read-ahead
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_handle_set_read_ahead_size(
+     libsmraw_handle_t *handle,
+     size_t read_ahead_size,
+     libcerror_error_t **error )
+{
+	libsmraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmraw_handle_set_read_ahead_size";
+	int result                                  = 1;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmraw_internal_handle_t *) handle;
+
+	if( read_ahead_size > (size_t) LIBSMRAW_MAXIMUM_READ_AHEAD_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid read-ahead size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* The read-ahead is recreated on the next read with the new size
+	 */
+	if( internal_handle->read_ahead != NULL )
+	{
+		if( libsmraw_read_ahead_free(
+		     &( internal_handle->read_ahead ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read-ahead.",
+			 function );
+
+			result = -1;
+		}
+	}
+	internal_handle->read_ahead_size = read_ahead_size;
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the access pattern
+ * A value of 0 removes the access pattern hints
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_handle_set_access_pattern(
+     libsmraw_handle_t *handle,
+     uint32_t access_pattern_flags,
+     libcerror_error_t **error )
+{
+	libsmraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmraw_handle_set_access_pattern";
+	int result                                  = 1;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmraw_internal_handle_t *) handle;
+
+	if( ( access_pattern_flags & ~( LIBSMRAW_ACCESS_PATTERN_FLAG_SEQUENTIAL | LIBSMRAW_ACCESS_PATTERN_FLAG_RANDOM | LIBSMRAW_ACCESS_PATTERN_FLAG_NO_REUSE ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access pattern flags: 0x%08" PRIx32 ".",
+		 function,
+		 access_pattern_flags );
+
+		return( -1 );
+	}
+	if( ( ( access_pattern_flags & LIBSMRAW_ACCESS_PATTERN_FLAG_SEQUENTIAL ) != 0 )
+	 && ( ( access_pattern_flags & LIBSMRAW_ACCESS_PATTERN_FLAG_RANDOM ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: sequential and random access pattern cannot be combined.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* The writer thread applies the access hints, hence buffered data is written first
+	 */
+	if( libsmraw_internal_handle_flush_write_behind(
+	     internal_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush write-behind.",
+		 function );
 
-		return( -1 );
+		result = -1;
 	}
-	read_count = libsmraw_handle_read_buffer(
-	              handle,
-	              buffer,
-	              buffer_size,
-	              error );
+	/* The read-ahead reads segment data in the background, it is recreated on the next read
+	 */
+	else if( internal_handle->read_ahead != NULL )
+	{
+		if( libsmraw_read_ahead_free(
+		     &( internal_handle->read_ahead ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read-ahead.",
+			 function );
 
-	if( read_count < 0 )
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		if( libsmraw_io_handle_set_access_pattern(
+		     internal_handle->io_handle,
+		     access_pattern_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set access pattern in IO handle.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read buffer.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	return( read_count );
+#endif
+	return( result );
 }
 
-/* Writes a buffer
- * Returns the number of bytes written or -1 on error
+/* Sets the write buffer size
+ * A size of 0 disables the write buffer
+ * Returns 1 if successful or -1 on error
  */
-ssize_t libsmraw_handle_write_buffer(
-         libsmraw_handle_t *handle,
-         const void *buffer,
-         size_t buffer_size,
-         libcerror_error_t **error )
+int libsmraw_handle_set_write_buffer_size(
+     libsmraw_handle_t *handle,
+     size_t write_buffer_size,
+     libcerror_error_t **error )
 {
 	libsmraw_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libsmraw_handle_write_buffer";
-	off64_t current_offset                      = 0;
-	ssize_t write_count                         = 0;
+	static char *function                       = "libsmraw_handle_set_write_buffer_size";
+	int result                                  = 1;
 
 	if( handle == NULL )
 	{
@@ -2301,224 +5911,325 @@ ssize_t libsmraw_handle_write_buffer(
 	}
 	internal_handle = (libsmraw_internal_handle_t *) handle;
 
-	if( internal_handle->io_handle == NULL )
+	if( write_buffer_size > (size_t) LIBSMRAW_MAXIMUM_WRITE_BUFFER_SIZE )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid write buffer size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->file_io_pool == NULL )
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing file IO pool.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->write_values_initialized == 0 )
+#endif
+	/* The write-behind is recreated on the next write with the new size
+	 */
+	if( internal_handle->write_behind != NULL )
 	{
-		if( libsmraw_internal_handle_initialize_write_values(
-		     internal_handle,
+		if( libsmraw_write_behind_flush(
+		     internal_handle->write_behind,
 		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush write-behind.",
+			 function );
+
+			result = -1;
+		}
+		else if( libsmraw_write_behind_free(
+		          &( internal_handle->write_behind ),
+		          error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to initialize write values.",
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free write-behind.",
 			 function );
 
-			return( -1 );
+			result = -1;
 		}
 	}
-	/* Bail out early for requests to write empty buffers
-	 */
-	if( buffer_size == 0 )
+	if( result == 1 )
 	{
-		return( 0 );
+		internal_handle->write_buffer_size = write_buffer_size;
 	}
-	if( libfdata_stream_get_offset(
-	     internal_handle->segments_stream,
-	     &current_offset,
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve current offset from segments stream.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	if( current_offset < 0 )
+#endif
+	return( result );
+}
+
+/* Sets the write queue size
+ * A size of 0 disables the writer thread
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_handle_set_write_queue_size(
+     libsmraw_handle_t *handle,
+     int write_queue_size,
+     libcerror_error_t **error )
+{
+	libsmraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmraw_handle_set_write_queue_size";
+	int result                                  = 1;
+
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid current offset value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->io_handle->media_size > 0 )
-	{
-		/* Bail out early for requests to write beyond the media size
-		 */
-		if( (size64_t) current_offset >= internal_handle->io_handle->media_size )
-		{
-			return( 0 );
-		}
-		if( ( (size64_t) current_offset + buffer_size ) >= internal_handle->io_handle->media_size )
-		{
-			buffer_size = (size_t) ( internal_handle->io_handle->media_size - (size64_t) current_offset );
-		}
-	}
-	write_count = libfdata_stream_write_buffer(
-	               internal_handle->segments_stream,
-	               (intptr_t *) internal_handle->file_io_pool,
-	               (uint8_t *) buffer,
-	               buffer_size,
-	               0,
-	               error );
+	internal_handle = (libsmraw_internal_handle_t *) handle;
 
-	if( write_count < 0 )
+	if( ( write_queue_size < 0 )
+	 || ( write_queue_size > LIBSMRAW_MAXIMUM_WRITE_QUEUE_SIZE ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to write buffer to segments stream.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid write queue size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	return( write_count );
-}
-
-/* Writes (media) data at a specific offset,
- * Returns the number of input bytes written, 0 when no longer bytes can be written or -1 on error
- */
-ssize_t libsmraw_handle_write_buffer_at_offset(
-         libsmraw_handle_t *handle,
-         const void *buffer,
-         size_t buffer_size,
-         off64_t offset,
-         libcerror_error_t **error )
-{
-	static char *function = "libsmraw_handle_write_buffer_at_offset";
-	ssize_t write_count   = 0;
-
-	if( libsmraw_handle_seek_offset(
-	     handle,
-	     offset,
-	     SEEK_SET,
-	     error ) == -1 )
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	write_count = libsmraw_handle_write_buffer(
-	               handle,
-	               buffer,
-	               buffer_size,
-	               error );
+#endif
+	/* The write-behind is recreated on the next write with the new number of buffers
+	 */
+	if( internal_handle->write_behind != NULL )
+	{
+		if( libsmraw_write_behind_flush(
+		     internal_handle->write_behind,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush write-behind.",
+			 function );
 
-	if( write_count < 0 )
+			result = -1;
+		}
+		else if( libsmraw_write_behind_free(
+		          &( internal_handle->write_behind ),
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free write-behind.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		internal_handle->write_queue_size = write_queue_size;
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to write buffer.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	return( write_count );
+#endif
+	return( result );
 }
 
-/* Seeks a certain offset
- * Returns the offset or -1 on error
+/* Sets the block cache size
+ * A cache size of 0 disables the block cache
+ * Returns 1 if successful or -1 on error
  */
-off64_t libsmraw_handle_seek_offset(
-         libsmraw_handle_t *handle,
-         off64_t offset,
-         int whence,
-         libcerror_error_t **error )
+int libsmraw_handle_set_block_cache_size(
+     libsmraw_handle_t *handle,
+     size_t cache_size,
+     size_t block_size,
+     libcerror_error_t **error )
 {
 	libsmraw_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libsmraw_handle_seek_offset";
+	static char *function                       = "libsmraw_handle_set_block_cache_size";
+	int result                                  = 1;
 
 	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmraw_internal_handle_t *) handle;
+
+	if( cache_size > (size_t) LIBSMRAW_MAXIMUM_BLOCK_CACHE_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid cache size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	internal_handle = (libsmraw_internal_handle_t *) handle;
+	if( ( cache_size > 0 )
+	 && ( ( block_size == 0 )
+	  ||  ( block_size > cache_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
 
-	if( internal_handle->file_io_pool == NULL )
+		return( -1 );
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing file IO pool.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	offset = libfdata_stream_seek_offset(
-	          internal_handle->segments_stream,
-	          offset,
-	          whence,
-	          error );
+#endif
+	if( internal_handle->block_cache != NULL )
+	{
+		if( libsmraw_block_cache_free(
+		     &( internal_handle->block_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free block cache.",
+			 function );
 
-	if( offset == -1 )
+			result = -1;
+		}
+	}
+	if( ( result == 1 )
+	 && ( cache_size > 0 ) )
+	{
+		if( libsmraw_block_cache_initialize(
+		     &( internal_handle->block_cache ),
+		     cache_size,
+		     block_size,
+		     (ssize_t (*)(intptr_t *, void *, size_t, off64_t, libcerror_error_t **)) &libsmraw_internal_handle_read_segments_at_offset,
+		     (intptr_t *) internal_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create block cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to seek offset in segments stream.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	return( offset );
+#endif
+	return( result );
 }
 
-/* Retrieves the current offset of the (media) data
- * Returns 1 if successful or -1 on error
+/* Retrieves the block cache statistics
+ * Returns 1 if successful, 0 if the block cache is disabled or -1 on error
  */
-int libsmraw_handle_get_offset(
+int libsmraw_handle_get_block_cache_statistics(
      libsmraw_handle_t *handle,
-     off64_t *offset,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     uint64_t *number_of_evictions,
      libcerror_error_t **error )
 {
 	libsmraw_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libsmraw_handle_get_offset";
+	static char *function                       = "libsmraw_handle_get_block_cache_statistics";
+	int result                                  = 0;
 
 	if( handle == NULL )
 	{
@@ -2533,33 +6244,73 @@ int libsmraw_handle_get_offset(
 	}
 	internal_handle = (libsmraw_internal_handle_t *) handle;
 
-	if( libfdata_stream_get_offset(
-	     internal_handle->segments_stream,
-	     offset,
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve offset from segments stream.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+#endif
+	if( internal_handle->block_cache != NULL )
+	{
+		result = libsmraw_block_cache_get_statistics(
+		          internal_handle->block_cache,
+		          number_of_hits,
+		          number_of_misses,
+		          number_of_evictions,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve block cache statistics.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
 }
 
-/* Sets the maximum number of (concurrent) open file handles
- * Returns 1 if successful or -1 on error
+/* Retrieves the open handle statistics
+ * Returns 1 if successful, 0 if the number of open handles is not limited by the pool policy or -1 on error
  */
-int libsmraw_handle_set_maximum_number_of_open_handles(
+int libsmraw_handle_get_open_handle_statistics(
      libsmraw_handle_t *handle,
-     int maximum_number_of_open_handles,
+     uint64_t *number_of_opens,
+     uint64_t *number_of_closes,
      libcerror_error_t **error )
 {
 	libsmraw_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libsmraw_handle_set_maximum_number_of_open_handles";
+	static char *function                       = "libsmraw_handle_get_open_handle_statistics";
+	uint64_t number_of_hits                     = 0;
+	int result                                  = 0;
 
 	if( handle == NULL )
 	{
@@ -2574,26 +6325,59 @@ int libsmraw_handle_set_maximum_number_of_open_handles(
 	}
 	internal_handle = (libsmraw_internal_handle_t *) handle;
 
-	if( internal_handle->file_io_pool != NULL )
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
 	{
-		if( libbfio_pool_set_maximum_number_of_open_handles(
-		     internal_handle->file_io_pool,
-		     maximum_number_of_open_handles,
-		     error ) != 1 )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( internal_handle->io_handle->pool_policy != NULL )
+	 && ( internal_handle->maximum_number_of_open_handles > 0 ) )
+	{
+		result = libsmraw_pool_policy_get_statistics(
+		          internal_handle->io_handle->pool_policy,
+		          &number_of_hits,
+		          number_of_opens,
+		          number_of_closes,
+		          error );
+
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set maximum number of open handles in file IO handle.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve pool policy statistics.",
 			 function );
 
-			return( -1 );
+			result = -1;
 		}
 	}
-	internal_handle->maximum_number_of_open_handles = maximum_number_of_open_handles;
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
 
-	return( 1 );
+		return( -1 );
+	}
+#endif
+	return( result );
 }
 
 /* Retrieves the segment filename size
@@ -2806,7 +6590,7 @@ int libsmraw_handle_get_segment_filename_wide(
      libcerror_error_t **error )
 {
 	libsmraw_internal_handle_t *internal_handle = NULL;
-	static char *function                      = "libsmraw_handle_get_segment_filename_wide";
+	static char *function                       = "libsmraw_handle_get_segment_filename_wide";
 
 	if( handle == NULL )
 	{
@@ -3005,6 +6789,58 @@ int libsmraw_handle_set_maximum_segment_size(
 	return( 1 );
 }
 
+/* Sets the segment file preallocation
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_handle_set_preallocate_segments(
+     libsmraw_handle_t *handle,
+     uint8_t preallocate_segments,
+     libcerror_error_t **error )
+{
+	libsmraw_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmraw_handle_set_preallocate_segments";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmraw_internal_handle_t *) handle;
+
+	if( internal_handle->write_values_initialized != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: segment file preallocation cannot be changed.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmraw_io_handle_set_preallocate_segments(
+	     internal_handle->io_handle,
+	     preallocate_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set segment file preallocation in IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Retrieves the filename size of the segment file of the current offset
  * The filename size should include the end of string character
  * Returns 1 if successful or -1 on error
@@ -3267,6 +7103,37 @@ int libsmraw_handle_get_file_io_handle(
 
 		return( -1 );
 	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* Buffered data is written first so that the writer thread no longer uses the segments stream
+	 * and the current offset of the segments stream includes the buffered data
+	 */
+	if( libsmraw_internal_handle_flush_write_behind(
+	     internal_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush write-behind.",
+		 function );
+
+		goto on_error;
+	}
 	if( libfdata_stream_get_offset(
 	     internal_handle->segments_stream,
 	     &current_offset,
@@ -3279,7 +7146,7 @@ int libsmraw_handle_get_file_io_handle(
 		 "%s: unable to retrieve current offset from segments stream.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( libfdata_stream_get_segment_index_at_offset(
 	     internal_handle->segments_stream,
@@ -3297,7 +7164,7 @@ int libsmraw_handle_get_file_io_handle(
 		 current_offset,
 		 current_offset );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( libbfio_pool_get_handle(
 	     internal_handle->file_io_pool,
@@ -3315,9 +7182,32 @@ int libsmraw_handle_get_file_io_handle(
 		 current_offset,
 		 current_offset );
 
+		goto on_error;
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
 		return( -1 );
 	}
+#endif
 	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_handle->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
 }
 
 /* Retrieves the media size
@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libsmraw_block_cache.h"
 #include "libsmraw_extern.h"
 #include "libsmraw_information_file.h"
 #include "libsmraw_io_handle.h"
@@ -33,7 +34,12 @@
 #include "libsmraw_libcthreads.h"
 #include "libsmraw_libfdata.h"
 #include "libsmraw_libfvalue.h"
+#include "libsmraw_manifest.h"
+#include "libsmraw_read_ahead.h"
+#include "libsmraw_read_queue.h"
+#include "libsmraw_segment_table.h"
 #include "libsmraw_types.h"
+#include "libsmraw_write_behind.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -51,6 +57,10 @@ struct libsmraw_internal_handle
 	 */
 	libfdata_stream_t *segments_stream;
 
+	/* The segment table used to map offsets onto segments when reading
+	 */
+	libsmraw_segment_table_t *segment_table;
+
 	/* The pool of file IO handles
 	 */
 	libbfio_pool_t *file_io_pool;
@@ -63,6 +73,10 @@ struct libsmraw_internal_handle
 	 */
 	int maximum_number_of_open_handles;
 
+	/* Value to indicate if the segment files were opened with write access
+	 */
+	uint8_t has_write_access;
+
 	/* A value to indicate if the read values have been initialized
 	 */
 	uint8_t read_values_initialized;
@@ -80,6 +94,10 @@ struct libsmraw_internal_handle
 	 */
 	libsmraw_information_file_t *information_file;
 
+	/* The segment manifest, only set while opening
+	 */
+	libsmraw_manifest_t *manifest;
+
 	/* The media values table
 	 */
 	libfvalue_table_t *media_values;
@@ -92,10 +110,38 @@ struct libsmraw_internal_handle
 	 */
 	libfvalue_table_t *integrity_hash_values;
 
+	/* The read-ahead window size, 0 if disabled
+	 */
+	size_t read_ahead_size;
+
+	/* The read-ahead used for sequential reads
+	 */
+	libsmraw_read_ahead_t *read_ahead;
+
+	/* The block cache used for random access reads, NULL if disabled
+	 */
+	libsmraw_block_cache_t *block_cache;
+
+	/* The write buffer size, 0 if disabled
+	 */
+	size_t write_buffer_size;
+
+	/* The number of write buffers queued for the writer thread, 0 if disabled
+	 */
+	int write_queue_size;
+
+	/* The write-behind used to coalesce writes
+	 */
+	libsmraw_write_behind_t *write_behind;
+
 #if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
 	/* The read/write lock
 	 */
 	libcthreads_read_write_lock_t *read_write_lock;
+
+	/* The read queue used for batched reads
+	 */
+	libsmraw_read_queue_t *read_queue;
 #endif
 };
 
@@ -149,6 +195,12 @@ int libsmraw_handle_read_information_file(
      libsmraw_internal_handle_t *internal_handle,
      libcerror_error_t **error );
 
+int libsmraw_handle_write_manifest(
+     const char *manifest_filename,
+     char * const filenames[],
+     int number_of_filenames,
+     libcerror_error_t **error );
+
 LIBSMRAW_EXTERN \
 int libsmraw_handle_close(
      libsmraw_handle_t *handle,
@@ -161,6 +213,71 @@ ssize_t libsmraw_handle_read_buffer(
          size_t buffer_size,
          libcerror_error_t **error );
 
+ssize_t libsmraw_internal_handle_read_buffer_with_read_ahead(
+         libsmraw_internal_handle_t *internal_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+ssize_t libsmraw_internal_handle_read_buffer_at_offset(
+         libsmraw_internal_handle_t *internal_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+int libsmraw_internal_handle_verify_segment_size(
+     libsmraw_internal_handle_t *internal_handle,
+     int segment_index,
+     libcerror_error_t **error );
+
+int libsmraw_internal_handle_get_segment_file_at_offset(
+     libsmraw_internal_handle_t *internal_handle,
+     off64_t offset,
+     uint8_t verify_segment_sizes,
+     int *segment_index,
+     int *segment_file_index,
+     off64_t *segment_file_offset,
+     size64_t *segment_remaining_size,
+     libcerror_error_t **error );
+
+ssize_t libsmraw_internal_handle_read_segments_at_offset(
+         libsmraw_internal_handle_t *internal_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+ssize_t libsmraw_internal_handle_prefetch_segments_at_offset(
+         libsmraw_internal_handle_t *internal_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+ssize_t libsmraw_internal_handle_read_segment_files_at_offset(
+         libsmraw_internal_handle_t *internal_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         uint8_t verify_segment_sizes,
+         libcerror_error_t **error );
+
+int libsmraw_internal_handle_flush_write_behind(
+     libsmraw_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
+int libsmraw_internal_handle_grab_for_positional_read(
+     libsmraw_internal_handle_t *internal_handle,
+     uint8_t *is_exclusive,
+     libcerror_error_t **error );
+
+int libsmraw_internal_handle_release_for_positional_read(
+     libsmraw_internal_handle_t *internal_handle,
+     uint8_t is_exclusive,
+     libcerror_error_t **error );
+
 LIBSMRAW_EXTERN \
 ssize_t libsmraw_handle_read_buffer_at_offset(
          libsmraw_handle_t *handle,
@@ -169,6 +286,39 @@ ssize_t libsmraw_handle_read_buffer_at_offset(
          off64_t offset,
          libcerror_error_t **error );
 
+LIBSMRAW_EXTERN \
+int libsmraw_handle_get_data_view(
+     libsmraw_handle_t *handle,
+     off64_t offset,
+     size_t size,
+     libsmraw_data_view_t **data_view,
+     libcerror_error_t **error );
+
+int libsmraw_internal_handle_get_data_view(
+     libsmraw_internal_handle_t *internal_handle,
+     off64_t offset,
+     size_t size,
+     libsmraw_data_view_t **data_view,
+     libcerror_error_t **error );
+
+LIBSMRAW_EXTERN \
+int libsmraw_handle_submit_reads(
+     libsmraw_handle_t *handle,
+     libsmraw_read_request_t *read_requests,
+     int number_of_read_requests,
+     libcerror_error_t **error );
+
+LIBSMRAW_EXTERN \
+int libsmraw_handle_reap_reads(
+     libsmraw_handle_t *handle,
+     libcerror_error_t **error );
+
+ssize_t libsmraw_internal_handle_write_segments_data(
+         libsmraw_internal_handle_t *internal_handle,
+         const uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
 LIBSMRAW_EXTERN \
 ssize_t libsmraw_handle_write_buffer(
          libsmraw_handle_t *handle,
@@ -176,6 +326,12 @@ ssize_t libsmraw_handle_write_buffer(
          size_t buffer_size,
          libcerror_error_t **error );
 
+ssize_t libsmraw_internal_handle_write_buffer(
+         libsmraw_internal_handle_t *internal_handle,
+         const uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
 LIBSMRAW_EXTERN \
 ssize_t libsmraw_handle_write_buffer_at_offset(
          libsmraw_handle_t *handle,
@@ -191,6 +347,12 @@ off64_t libsmraw_handle_seek_offset(
          int whence,
          libcerror_error_t **error );
 
+off64_t libsmraw_internal_handle_seek_offset(
+         libsmraw_internal_handle_t *internal_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
 LIBSMRAW_EXTERN \
 int libsmraw_handle_get_offset(
      libsmraw_handle_t *handle,
@@ -203,6 +365,52 @@ int libsmraw_handle_set_maximum_number_of_open_handles(
      int maximum_number_of_open_handles,
      libcerror_error_t **error );
 
+LIBSMRAW_EXTERN \
+int libsmraw_handle_set_read_ahead_size(
+     libsmraw_handle_t *handle,
+     size_t read_ahead_size,
+     libcerror_error_t **error );
+
+LIBSMRAW_EXTERN \
+int libsmraw_handle_set_access_pattern(
+     libsmraw_handle_t *handle,
+     uint32_t access_pattern_flags,
+     libcerror_error_t **error );
+
+LIBSMRAW_EXTERN \
+int libsmraw_handle_set_write_buffer_size(
+     libsmraw_handle_t *handle,
+     size_t write_buffer_size,
+     libcerror_error_t **error );
+
+LIBSMRAW_EXTERN \
+int libsmraw_handle_set_write_queue_size(
+     libsmraw_handle_t *handle,
+     int write_queue_size,
+     libcerror_error_t **error );
+
+LIBSMRAW_EXTERN \
+int libsmraw_handle_set_block_cache_size(
+     libsmraw_handle_t *handle,
+     size_t cache_size,
+     size_t block_size,
+     libcerror_error_t **error );
+
+LIBSMRAW_EXTERN \
+int libsmraw_handle_get_block_cache_statistics(
+     libsmraw_handle_t *handle,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     uint64_t *number_of_evictions,
+     libcerror_error_t **error );
+
+LIBSMRAW_EXTERN \
+int libsmraw_handle_get_open_handle_statistics(
+     libsmraw_handle_t *handle,
+     uint64_t *number_of_opens,
+     uint64_t *number_of_closes,
+     libcerror_error_t **error );
+
 LIBSMRAW_EXTERN \
 int libsmraw_handle_get_segment_filename_size(
      libsmraw_handle_t *handle,
@@ -259,6 +467,12 @@ int libsmraw_handle_set_maximum_segment_size(
      size64_t maximum_segment_size,
      libcerror_error_t **error );
 
+LIBSMRAW_EXTERN \
+int libsmraw_handle_set_preallocate_segments(
+     libsmraw_handle_t *handle,
+     uint8_t preallocate_segments,
+     libcerror_error_t **error );
+
 LIBSMRAW_EXTERN \
 int libsmraw_handle_get_filename_size(
      libsmraw_handle_t *handle,
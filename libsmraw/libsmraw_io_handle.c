@@ -26,13 +26,32 @@
 #include <types.h>
 #include <wide_string.h>
 
+#if defined( HAVE_ERRNO_H ) || defined( WINAPI )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
 #include "libsmraw_definitions.h"
 #include "libsmraw_filename.h"
 #include "libsmraw_io_handle.h"
 #include "libsmraw_libbfio.h"
 #include "libsmraw_libcerror.h"
 #include "libsmraw_libclocale.h"
+#include "libsmraw_libcthreads.h"
 #include "libsmraw_libuna.h"
+#include "libsmraw_memory_map.h"
+#include "libsmraw_pool_policy.h"
 #include "libsmraw_unused.h"
 
 /* Creates an IO handle
@@ -95,7 +114,9 @@ int libsmraw_io_handle_initialize(
 
 		goto on_error;
 	}
-	( *io_handle )->maximum_segment_size = LIBSMRAW_DEFAULT_MAXIMUM_SEGMENT_SIZE;
+	( *io_handle )->maximum_segment_size       = LIBSMRAW_DEFAULT_MAXIMUM_SEGMENT_SIZE;
+	( *io_handle )->preallocated_segment_index = -1;
+	( *io_handle )->current_segment_file_index = -1;
 
 	return( 1 );
 
@@ -118,6 +139,7 @@ int libsmraw_io_handle_free(
      libcerror_error_t **error )
 {
 	static char *function = "libsmraw_io_handle_free";
+	int result            = 1;
 
 	if( io_handle == NULL )
 	{
@@ -132,6 +154,67 @@ int libsmraw_io_handle_free(
 	}
 	if( *io_handle != NULL )
 	{
+		if( libsmraw_io_handle_wait_for_segment_preallocation(
+		     *io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to wait for segment preallocation.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *io_handle )->memory_maps != NULL )
+		{
+			if( libsmraw_io_handle_close_memory_maps(
+			     *io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close memory maps.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *io_handle )->direct_files != NULL )
+		{
+			if( libsmraw_io_handle_close_direct_files(
+			     *io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close direct files.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *io_handle )->access_hint != NULL )
+		{
+			if( libsmraw_access_hint_free(
+			     &( ( *io_handle )->access_hint ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free access hint.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( ( *io_handle )->basename != NULL )
 		{
 			memory_free(
@@ -142,7 +225,7 @@ int libsmraw_io_handle_free(
 
 		*io_handle = NULL;
 	}
-	return( 1 );
+	return( result );
 }
 
 /* Clears the IO handle
@@ -165,6 +248,99 @@ int libsmraw_io_handle_clear(
 
 		return( -1 );
 	}
+	if( libsmraw_io_handle_wait_for_segment_preallocation(
+	     io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to wait for segment preallocation.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->memory_maps != NULL )
+	{
+		if( libsmraw_io_handle_close_memory_maps(
+		     io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close memory maps.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( io_handle->direct_files != NULL )
+	{
+		if( libsmraw_io_handle_close_direct_files(
+		     io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close direct files.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( io_handle->access_hint != NULL )
+	{
+		if( libsmraw_access_hint_free(
+		     &( io_handle->access_hint ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free access hint.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( io_handle->pool_policy != NULL )
+	{
+		if( libsmraw_pool_policy_free(
+		     &( io_handle->pool_policy ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free pool policy.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( io_handle->segment_file_names != NULL )
+	{
+		if( libsmraw_io_handle_clear_segment_file_names(
+		     io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear segment file names.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	if( io_handle->basename != NULL )
 	{
 		memory_free(
@@ -184,30 +360,28 @@ int libsmraw_io_handle_clear(
 
 		return( -1 );
 	}
-	io_handle->maximum_segment_size = LIBSMRAW_DEFAULT_MAXIMUM_SEGMENT_SIZE;
+	io_handle->maximum_segment_size       = LIBSMRAW_DEFAULT_MAXIMUM_SEGMENT_SIZE;
+	io_handle->preallocated_segment_index = -1;
+	io_handle->current_segment_file_index = -1;
 
 	return( 1 );
 }
 
-/* Creates a new segment file
- * Callback function for the segments stream
- * Returns the number of bytes read or -1 on error
+/* Maps the segment files of the file IO pool into memory
+ * The file IO pool must only contain file IO handles
+ * Segment files that cannot be mapped are read using the file IO pool
+ * Returns 1 if successful or -1 on error
  */
-int libsmraw_io_handle_create_segment(
+int libsmraw_io_handle_open_memory_maps(
      libsmraw_io_handle_t *io_handle,
      libbfio_pool_t *file_io_pool,
-     int segment_index,
-     int *segment_file_index,
-     off64_t *segment_offset,
-     size64_t *segment_size,
-     uint32_t *segment_flags,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *file_io_handle = NULL;
-	system_character_t *filename     = NULL;
-	static char *function            = "libsmraw_io_handle_create_segment";
-	size_t filename_size             = 0;
-	int file_io_pool_entry           = 0;
+	char *filename                = NULL;
+	static char *function         = "libsmraw_io_handle_open_memory_maps";
+	int file_io_handle_index      = 0;
+	int number_of_file_io_handles = 0;
+	int result                    = 0;
 
 	if( io_handle == NULL )
 	{
@@ -220,194 +394,2891 @@ int libsmraw_io_handle_create_segment(
 
 		return( -1 );
 	}
-	if( segment_file_index == NULL )
+	if( io_handle->memory_maps != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO handle - memory maps value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_pool_get_number_of_handles(
+	     file_io_pool,
+	     &number_of_file_io_handles,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve the number of file IO handles in the pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_file_io_handles <= 0 )
+	{
+		return( 1 );
+	}
+	if( (size_t) number_of_file_io_handles > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libsmraw_memory_map_t * ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of file IO handles value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	io_handle->memory_maps = (libsmraw_memory_map_t **) memory_allocate(
+	                                                     sizeof( libsmraw_memory_map_t * ) * number_of_file_io_handles );
+
+	if( io_handle->memory_maps == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create memory maps.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     io_handle->memory_maps,
+	     0,
+	     sizeof( libsmraw_memory_map_t * ) * number_of_file_io_handles ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear memory maps.",
+		 function );
+
+		memory_free(
+		 io_handle->memory_maps );
+
+		io_handle->memory_maps = NULL;
+
+		goto on_error;
+	}
+	io_handle->number_of_memory_maps = number_of_file_io_handles;
+
+	for( file_io_handle_index = 0;
+	     file_io_handle_index < number_of_file_io_handles;
+	     file_io_handle_index++ )
+	{
+		if( libsmraw_io_handle_get_segment_file_name(
+		     io_handle,
+		     file_io_pool,
+		     file_io_handle_index,
+		     &filename,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filename of file IO handle: %d.",
+			 function,
+			 file_io_handle_index );
+
+			goto on_error;
+		}
+		if( libsmraw_memory_map_initialize(
+		     &( io_handle->memory_maps[ file_io_handle_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create memory map: %d.",
+			 function,
+			 file_io_handle_index );
+
+			goto on_error;
+		}
+		result = libsmraw_memory_map_open(
+		          io_handle->memory_maps[ file_io_handle_index ],
+		          filename,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open memory map: %d.",
+			 function,
+			 file_io_handle_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			/* A segment file that cannot be mapped is read using the file IO pool
+			 */
+			if( libsmraw_memory_map_free(
+			     &( io_handle->memory_maps[ file_io_handle_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free memory map: %d.",
+				 function,
+				 file_io_handle_index );
+
+				goto on_error;
+			}
+		}
+		memory_free(
+		 filename );
+
+		filename = NULL;
+	}
+	return( 1 );
+
+on_error:
+	if( filename != NULL )
+	{
+		memory_free(
+		 filename );
+	}
+	if( io_handle->memory_maps != NULL )
+	{
+		libsmraw_io_handle_close_memory_maps(
+		 io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Unmaps the segment files from memory
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_io_handle_close_memory_maps(
+     libsmraw_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_io_handle_close_memory_maps";
+	int memory_map_index  = 0;
+	int result            = 1;
+
+	if( io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid segment file index.",
+		 "%s: invalid IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( segment_offset == NULL )
+	if( io_handle->memory_maps != NULL )
+	{
+		for( memory_map_index = 0;
+		     memory_map_index < io_handle->number_of_memory_maps;
+		     memory_map_index++ )
+		{
+			if( libsmraw_memory_map_free(
+			     &( io_handle->memory_maps[ memory_map_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free memory map: %d.",
+				 function,
+				 memory_map_index );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 io_handle->memory_maps );
+
+		io_handle->memory_maps = NULL;
+	}
+	io_handle->number_of_memory_maps = 0;
+
+	return( result );
+}
+
+/* Retrieves the memory map of a specific segment file
+ * Returns the memory map or NULL if the segment file is not mapped
+ */
+libsmraw_memory_map_t *libsmraw_io_handle_get_memory_map(
+                        libsmraw_io_handle_t *io_handle,
+                        int segment_file_index )
+{
+	if( ( io_handle == NULL )
+	 || ( io_handle->memory_maps == NULL )
+	 || ( segment_file_index < 0 )
+	 || ( segment_file_index >= io_handle->number_of_memory_maps ) )
+	{
+		return( NULL );
+	}
+	return( io_handle->memory_maps[ segment_file_index ] );
+}
+
+/* Opens the segment files of the file IO pool for direct IO
+ * The file IO pool must only contain file IO handles
+ * Segment files that are added to the pool later are opened by create segment
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_io_handle_open_direct_files(
+     libsmraw_io_handle_t *io_handle,
+     libbfio_pool_t *file_io_pool,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	static char *function         = "libsmraw_io_handle_open_direct_files";
+	int file_io_handle_index      = 0;
+	int number_of_file_io_handles = 0;
+
+	if( io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid segment offset.",
+		 "%s: invalid IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( segment_size == NULL )
+	if( io_handle->direct_files != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO handle - direct files value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_pool_get_number_of_handles(
+	     file_io_pool,
+	     &number_of_file_io_handles,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve the number of file IO handles in the pool.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle->use_direct_io = 1;
+
+	for( file_io_handle_index = 0;
+	     file_io_handle_index < number_of_file_io_handles;
+	     file_io_handle_index++ )
+	{
+		if( libsmraw_io_handle_open_direct_file(
+		     io_handle,
+		     file_io_pool,
+		     file_io_handle_index,
+		     access_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open direct file: %d.",
+			 function,
+			 file_io_handle_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	libsmraw_io_handle_close_direct_files(
+	 io_handle,
+	 NULL );
+
+	io_handle->use_direct_io = 0;
+
+	return( -1 );
+}
+
+/* Retrieves the narrow filename of the segment file of a specific file IO pool entry
+ * The file IO pool entry must be a file IO handle
+ * The filename is freed with memory_free
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_io_handle_get_segment_file_name(
+     libsmraw_io_handle_t *io_handle,
+     libbfio_pool_t *file_io_pool,
+     int file_io_pool_entry,
+     char **filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libsmraw_io_handle_get_segment_file_name";
+	size_t filename_size             = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( *filename != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid filename value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_pool_get_handle(
+	     file_io_pool,
+	     file_io_pool_entry,
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file IO handle: %d from pool.",
+		 function,
+		 file_io_pool_entry );
+
+		goto on_error;
+	}
+	if( libbfio_file_get_name_size(
+	     file_io_handle,
+	     &filename_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve filename size of file IO handle: %d.",
+		 function,
+		 file_io_pool_entry );
+
+		goto on_error;
+	}
+	if( ( filename_size == 0 )
+	 || ( filename_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	*filename = narrow_string_allocate(
+	             filename_size );
+
+	if( *filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_get_name(
+	     file_io_handle,
+	     *filename,
+	     filename_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve filename of file IO handle: %d.",
+		 function,
+		 file_io_pool_entry );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *filename != NULL )
+	{
+		memory_free(
+		 *filename );
+
+		*filename = NULL;
+	}
+	return( -1 );
+}
+
+/* Opens the segment file of a specific file IO pool entry for direct IO
+ * The file IO pool entry must be a file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_io_handle_open_direct_file(
+     libsmraw_io_handle_t *io_handle,
+     libbfio_pool_t *file_io_pool,
+     int file_io_pool_entry,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	char *filename        = NULL;
+	void *reallocation    = NULL;
+	static char *function = "libsmraw_io_handle_open_direct_file";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_io_pool_entry < 0 )
+	 || ( (size_t) file_io_pool_entry >= ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libsmraw_direct_file_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file IO pool entry value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_pool_entry >= io_handle->number_of_direct_files )
+	{
+		reallocation = memory_reallocate(
+		                io_handle->direct_files,
+		                sizeof( libsmraw_direct_file_t * ) * ( file_io_pool_entry + 1 ) );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to reallocate direct files.",
+			 function );
+
+			return( -1 );
+		}
+		io_handle->direct_files = (libsmraw_direct_file_t **) reallocation;
+
+		if( memory_set(
+		     &( io_handle->direct_files[ io_handle->number_of_direct_files ] ),
+		     0,
+		     sizeof( libsmraw_direct_file_t * ) * ( file_io_pool_entry + 1 - io_handle->number_of_direct_files ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear direct files.",
+			 function );
+
+			return( -1 );
+		}
+		io_handle->number_of_direct_files = file_io_pool_entry + 1;
+	}
+	if( io_handle->direct_files[ file_io_pool_entry ] != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO handle - direct file: %d value already set.",
+		 function,
+		 file_io_pool_entry );
+
+		return( -1 );
+	}
+	if( libsmraw_io_handle_get_segment_file_name(
+	     io_handle,
+	     file_io_pool,
+	     file_io_pool_entry,
+	     &filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve filename of file IO pool entry: %d.",
+		 function,
+		 file_io_pool_entry );
+
+		goto on_error;
+	}
+	if( libsmraw_direct_file_initialize(
+	     &( io_handle->direct_files[ file_io_pool_entry ] ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create direct file: %d.",
+		 function,
+		 file_io_pool_entry );
+
+		goto on_error;
+	}
+	if( libsmraw_direct_file_open(
+	     io_handle->direct_files[ file_io_pool_entry ],
+	     filename,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open direct file: %d.",
+		 function,
+		 file_io_pool_entry );
+
+		goto on_error;
+	}
+	memory_free(
+	 filename );
+
+	return( 1 );
+
+on_error:
+	if( io_handle->direct_files[ file_io_pool_entry ] != NULL )
+	{
+		libsmraw_direct_file_free(
+		 &( io_handle->direct_files[ file_io_pool_entry ] ),
+		 NULL );
+	}
+	if( filename != NULL )
+	{
+		memory_free(
+		 filename );
+	}
+	return( -1 );
+}
+
+/* Closes the direct IO files of the segment files
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_io_handle_close_direct_files(
+     libsmraw_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_io_handle_close_direct_files";
+	int direct_file_index = 0;
+	int result            = 1;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->direct_files != NULL )
+	{
+		for( direct_file_index = 0;
+		     direct_file_index < io_handle->number_of_direct_files;
+		     direct_file_index++ )
+		{
+			if( io_handle->direct_files[ direct_file_index ] == NULL )
+			{
+				continue;
+			}
+			if( libsmraw_direct_file_free(
+			     &( io_handle->direct_files[ direct_file_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free direct file: %d.",
+				 function,
+				 direct_file_index );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 io_handle->direct_files );
+
+		io_handle->direct_files = NULL;
+	}
+	io_handle->number_of_direct_files = 0;
+
+	return( result );
+}
+
+/* Retrieves the direct IO file of a specific segment file
+ * Returns the direct IO file or NULL if the segment file is not accessed using direct IO
+ */
+libsmraw_direct_file_t *libsmraw_io_handle_get_direct_file(
+                         libsmraw_io_handle_t *io_handle,
+                         int segment_file_index )
+{
+	if( ( io_handle == NULL )
+	 || ( io_handle->direct_files == NULL )
+	 || ( segment_file_index < 0 )
+	 || ( segment_file_index >= io_handle->number_of_direct_files ) )
+	{
+		return( NULL );
+	}
+	return( io_handle->direct_files[ segment_file_index ] );
+}
+
+/* Sets the access pattern hints that are applied to the segment files on read
+ * Access pattern flags of 0 removes the hints
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_io_handle_set_access_pattern(
+     libsmraw_io_handle_t *io_handle,
+     uint32_t access_pattern_flags,
+     libcerror_error_t **error )
+{
+	static char *function       = "libsmraw_io_handle_set_access_pattern";
+	int maximum_number_of_files = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( access_pattern_flags == 0 )
+	{
+		if( io_handle->access_hint != NULL )
+		{
+			if( libsmraw_access_hint_free(
+			     &( io_handle->access_hint ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free access hint.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	else if( io_handle->access_hint == NULL )
+	{
+		/* The file descriptors used for the hints are bounded like the open handles of the file IO pool
+		 */
+		maximum_number_of_files = LIBSMRAW_ACCESS_HINT_DEFAULT_MAXIMUM_NUMBER_OF_FILES;
+
+		if( ( io_handle->pool_policy != NULL )
+		 && ( io_handle->pool_policy->maximum_number_of_open_handles > 0 ) )
+		{
+			maximum_number_of_files = io_handle->pool_policy->maximum_number_of_open_handles;
+		}
+		if( libsmraw_access_hint_initialize(
+		     &( io_handle->access_hint ),
+		     access_pattern_flags,
+		     maximum_number_of_files,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create access hint.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( libsmraw_access_hint_set_access_pattern(
+		     io_handle->access_hint,
+		     access_pattern_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set access pattern of access hint.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Sets the narrow filenames of the segment files the access pattern hints are applied to
+ * The file IO pool must only contain file IO handles that were created by the library
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_io_handle_set_segment_file_names(
+     libsmraw_io_handle_t *io_handle,
+     libbfio_pool_t *file_io_pool,
+     libcerror_error_t **error )
+{
+	static char *function         = "libsmraw_io_handle_set_segment_file_names";
+	int file_io_handle_index      = 0;
+	int number_of_file_io_handles = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->segment_file_names != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO handle - segment file names value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_pool_get_number_of_handles(
+	     file_io_pool,
+	     &number_of_file_io_handles,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve the number of file IO handles in the pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_file_io_handles <= 0 )
+	{
+		return( 1 );
+	}
+	if( (size_t) number_of_file_io_handles > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( char * ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of file IO handles value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	io_handle->segment_file_names = (char **) memory_allocate(
+	                                           sizeof( char * ) * number_of_file_io_handles );
+
+	if( io_handle->segment_file_names == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create segment file names.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     io_handle->segment_file_names,
+	     0,
+	     sizeof( char * ) * number_of_file_io_handles ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear segment file names.",
+		 function );
+
+		memory_free(
+		 io_handle->segment_file_names );
+
+		io_handle->segment_file_names = NULL;
+
+		goto on_error;
+	}
+	io_handle->number_of_segment_file_names = number_of_file_io_handles;
+
+	for( file_io_handle_index = 0;
+	     file_io_handle_index < number_of_file_io_handles;
+	     file_io_handle_index++ )
+	{
+		if( libsmraw_io_handle_get_segment_file_name(
+		     io_handle,
+		     file_io_pool,
+		     file_io_handle_index,
+		     &( io_handle->segment_file_names[ file_io_handle_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filename of file IO handle: %d.",
+			 function,
+			 file_io_handle_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( io_handle->segment_file_names != NULL )
+	{
+		libsmraw_io_handle_clear_segment_file_names(
+		 io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Clears the narrow filenames of the segment files
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_io_handle_clear_segment_file_names(
+     libsmraw_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function   = "libsmraw_io_handle_clear_segment_file_names";
+	int segment_file_index  = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->segment_file_names != NULL )
+	{
+		for( segment_file_index = 0;
+		     segment_file_index < io_handle->number_of_segment_file_names;
+		     segment_file_index++ )
+		{
+			if( io_handle->segment_file_names[ segment_file_index ] != NULL )
+			{
+				memory_free(
+				 io_handle->segment_file_names[ segment_file_index ] );
+			}
+		}
+		memory_free(
+		 io_handle->segment_file_names );
+
+		io_handle->segment_file_names = NULL;
+	}
+	io_handle->number_of_segment_file_names = 0;
+
+	return( 1 );
+}
+
+/* Applies the access pattern hints after data was read from a segment file
+ * The segment file is opened for hints when it is first read, which includes
+ * segment files that are opened later by the file IO pool
+ * Hints are only applied to segment files of which the filename was set
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_io_handle_apply_access_hints(
+     libsmraw_io_handle_t *io_handle,
+     int segment_file_index,
+     off64_t segment_data_offset,
+     size_t segment_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_io_handle_apply_access_hints";
+	int result            = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->access_hint == NULL )
+	 || ( io_handle->segment_file_names == NULL )
+	 || ( segment_file_index < 0 )
+	 || ( segment_file_index >= io_handle->number_of_segment_file_names ) )
+	{
+		return( 1 );
+	}
+	result = libsmraw_access_hint_data_read(
+	          io_handle->access_hint,
+	          segment_file_index,
+	          segment_data_offset,
+	          segment_data_size,
+	          error );
+
+	if( result == 0 )
+	{
+		result = libsmraw_access_hint_open(
+		          io_handle->access_hint,
+		          segment_file_index,
+		          io_handle->segment_file_names[ segment_file_index ],
+		          error );
+
+		if( result == 1 )
+		{
+			result = libsmraw_access_hint_data_read(
+			          io_handle->access_hint,
+			          segment_file_index,
+			          segment_data_offset,
+			          segment_data_size,
+			          error );
+		}
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to apply access hints to segment file: %d.",
+		 function,
+		 segment_file_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates a new segment file
+ * Callback function for the segments stream
+ * Returns the number of bytes read or -1 on error
+ */
+int libsmraw_io_handle_create_segment(
+     libsmraw_io_handle_t *io_handle,
+     libbfio_pool_t *file_io_pool,
+     int segment_index,
+     int *segment_file_index,
+     off64_t *segment_offset,
+     size64_t *segment_size,
+     uint32_t *segment_flags,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	system_character_t *filename     = NULL;
+	static char *function            = "libsmraw_io_handle_create_segment";
+	size_t filename_size             = 0;
+	int access_flags                 = LIBBFIO_OPEN_WRITE_TRUNCATE;
+	int file_io_pool_entry           = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_file_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment file index.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment size.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->preallocate_segments != 0 )
+	{
+		if( libsmraw_io_handle_wait_for_segment_preallocation(
+		     io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for segment preallocation.",
+			 function );
+
+			goto on_error;
+		}
+		if( io_handle->preallocated_segment_index == -1 )
+		{
+			if( libsmraw_io_handle_preallocate_segment(
+			     io_handle,
+			     segment_index,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to preallocate segment: %d.",
+				 function,
+				 segment_index );
+
+				goto on_error;
+			}
+			if( libsmraw_io_handle_wait_for_segment_preallocation(
+			     io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to wait for segment preallocation.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		/* A segment file that was created ahead of time must not be truncated
+		 * otherwise its preallocated storage is released
+		 */
+		if( io_handle->preallocated_segment_index == segment_index )
+		{
+			access_flags = LIBBFIO_OPEN_WRITE;
+
+			io_handle->preallocated_segment_index = -1;
+		}
+	}
+	if( libsmraw_filename_create(
+	     &filename,
+	     &filename_size,
+	     io_handle->basename,
+	     io_handle->basename_size,
+	     io_handle->number_of_segments,
+	     segment_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create segment filename: %d.",
+		 function,
+		 segment_index );
+
+		goto on_error;
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_size,
+	     error ) != 1 )
+#else
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_size,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set name in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 filename );
+
+	filename = NULL;
+
+	if( libbfio_pool_append_handle(
+	     file_io_pool,
+	     &file_io_pool_entry,
+	     file_io_handle,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append file IO handle to pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_pool_open(
+	     file_io_pool,
+	     file_io_pool_entry,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file IO pool entry: %d.",
+		 function,
+		 file_io_pool_entry );
+
+		file_io_handle = NULL;
+
+		goto on_error;
+	}
+	file_io_handle = NULL;
+
+	if( io_handle->use_direct_io != 0 )
+	{
+		if( libsmraw_io_handle_open_direct_file(
+		     io_handle,
+		     file_io_pool,
+		     file_io_pool_entry,
+		     LIBSMRAW_ACCESS_FLAG_WRITE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open direct file: %d.",
+			 function,
+			 file_io_pool_entry );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	/* Create the next segment file in the background while the current one is being written
+	 */
+	if( ( io_handle->preallocate_segments != 0 )
+	 && ( io_handle->preallocated_segment_index == -1 ) )
+	{
+		if( libsmraw_io_handle_preallocate_segment(
+		     io_handle,
+		     segment_index + 1,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to preallocate segment: %d.",
+			 function,
+			 segment_index + 1 );
+
+			goto on_error;
+		}
+	}
+#endif
+	if( io_handle->maximum_segment_size == 0 )
+	{
+		*segment_size = (size64_t) INT64_MAX;
+	}
+	else
+	{
+		*segment_size = io_handle->maximum_segment_size;
+	}
+	*segment_file_index = file_io_pool_entry;
+	*segment_offset     = 0;
+	*segment_flags      = 0;
+
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( filename != NULL )
+	{
+		memory_free(
+		 filename );
+	}
+	return( -1 );
+}
+
+/* Creates a segment file and preallocates its storage
+ * A segment file that already exists is left untouched, since it was not created by this handle
+ * Returns 1 if successful, 0 if the segment file already exists or -1 on error
+ */
+int libsmraw_io_handle_preallocate_segment_file(
+     const system_character_t *filename,
+     size64_t segment_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_io_handle_preallocate_segment_file";
+
+#if defined( HAVE_LIBSMRAW_SEGMENT_PREALLOCATION_SUPPORT )
+	int file_descriptor   = -1;
+#endif
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid segment size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBSMRAW_SEGMENT_PREALLOCATION_SUPPORT )
+	file_descriptor = open(
+	                   filename,
+	                   O_WRONLY | O_CREAT | O_EXCL,
+	                   S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH );
+
+	if( file_descriptor == -1 )
+	{
+		if( errno == EEXIST )
+		{
+			return( 0 );
+		}
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	/* A failed preallocation is not fatal, the segment file then grows as it is written
+	 */
+	if( segment_size > 0 )
+	{
+		posix_fallocate(
+		 file_descriptor,
+		 0,
+		 (off_t) segment_size );
+	}
+	if( close(
+	     file_descriptor ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close file: %s.",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	return( 1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: segment file preallocation not supported.",
+	 function );
+
+	return( -1 );
+#endif /* defined( HAVE_LIBSMRAW_SEGMENT_PREALLOCATION_SUPPORT ) */
+}
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+
+/* Processes a segment preallocation request
+ * Callback function for the preallocation thread
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_io_handle_process_segment_preallocation_request(
+     libsmraw_segment_preallocation_request_t *preallocation_request )
+{
+	if( preallocation_request == NULL )
+	{
+		return( -1 );
+	}
+	/* The result is checked when the preallocation thread is joined,
+	 * if the segment file was not created by this handle it is truncated when it is opened
+	 */
+	preallocation_request->result = libsmraw_io_handle_preallocate_segment_file(
+	                                 preallocation_request->filename,
+	                                 preallocation_request->segment_size,
+	                                 NULL );
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT ) */
+
+/* Creates a segment file ahead of time and preallocates it to the size of the segment
+ * If multi-threading is supported the segment file is created in the background
+ * Returns 1 if successful, 0 if the segment should not be preallocated or already exists or -1 on error
+ */
+int libsmraw_io_handle_preallocate_segment(
+     libsmraw_io_handle_t *io_handle,
+     int segment_index,
+     libcerror_error_t **error )
+{
+	static char *function        = "libsmraw_io_handle_preallocate_segment";
+
+#if defined( HAVE_LIBSMRAW_SEGMENT_PREALLOCATION_SUPPORT )
+	system_character_t *filename = NULL;
+	size64_t segment_offset      = 0;
+	size64_t segment_size        = 0;
+	size_t filename_size         = 0;
+
+#if !defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	int result                   = 0;
+#endif
+#endif
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->preallocated_segment_index != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO handle - preallocated segment index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid segment index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBSMRAW_SEGMENT_PREALLOCATION_SUPPORT )
+	if( io_handle->maximum_segment_size == 0 )
+	{
+		return( 0 );
+	}
+	if( ( io_handle->number_of_segments != 0 )
+	 && ( segment_index >= io_handle->number_of_segments ) )
+	{
+		return( 0 );
+	}
+	segment_size = io_handle->maximum_segment_size;
+
+	/* The last segment only needs to hold the remainder of the media data
+	 */
+	if( io_handle->media_size != 0 )
+	{
+		segment_offset = (size64_t) segment_index * io_handle->maximum_segment_size;
+
+		if( segment_offset >= io_handle->media_size )
+		{
+			return( 0 );
+		}
+		if( ( io_handle->media_size - segment_offset ) < segment_size )
+		{
+			segment_size = io_handle->media_size - segment_offset;
+		}
+	}
+	if( libsmraw_filename_create(
+	     &filename,
+	     &filename_size,
+	     io_handle->basename,
+	     io_handle->basename_size,
+	     io_handle->number_of_segments,
+	     segment_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create segment filename: %d.",
+		 function,
+		 segment_index );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	io_handle->preallocation_request.filename     = filename;
+	io_handle->preallocation_request.segment_size = segment_size;
+	io_handle->preallocation_request.result       = 0;
+
+	if( libcthreads_thread_create(
+	     &( io_handle->preallocation_thread ),
+	     NULL,
+	     (int (*)(void *)) &libsmraw_io_handle_process_segment_preallocation_request,
+	     (void *) &( io_handle->preallocation_request ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create preallocation thread.",
+		 function );
+
+		io_handle->preallocation_request.filename = NULL;
+
+		goto on_error;
+	}
+	/* The filename is freed when the preallocation thread is joined
+	 */
+	filename = NULL;
+#else
+	result = libsmraw_io_handle_preallocate_segment_file(
+	          filename,
+	          segment_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to preallocate segment file: %d.",
+		 function,
+		 segment_index );
+
+		goto on_error;
+	}
+	memory_free(
+	 filename );
+
+	filename = NULL;
+
+	/* A segment file that already exists was not created by this handle
+	 */
+	if( result == 0 )
+	{
+		return( 0 );
+	}
+#endif /* defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT ) */
+
+	io_handle->preallocated_segment_index = segment_index;
+
+	return( 1 );
+
+on_error:
+	if( filename != NULL )
+	{
+		memory_free(
+		 filename );
+	}
+	return( -1 );
+#else
+	return( 0 );
+#endif /* defined( HAVE_LIBSMRAW_SEGMENT_PREALLOCATION_SUPPORT ) */
+}
+
+/* Waits for the background preallocation of a segment file to complete
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_io_handle_wait_for_segment_preallocation(
+     libsmraw_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_io_handle_wait_for_segment_preallocation";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( io_handle->preallocation_thread != NULL )
+	{
+		if( libcthreads_thread_join(
+		     &( io_handle->preallocation_thread ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join preallocation thread.",
+			 function );
+
+			return( -1 );
+		}
+		/* Only a segment file that was created by this handle is treated as
+		 * created ahead of time, so that it is neither reused without truncation
+		 * nor removed when the segments are finalized
+		 */
+		if( io_handle->preallocation_request.result != 1 )
+		{
+			io_handle->preallocated_segment_index = -1;
+		}
+		if( io_handle->preallocation_request.filename != NULL )
+		{
+			memory_free(
+			 io_handle->preallocation_request.filename );
+
+			io_handle->preallocation_request.filename = NULL;
+		}
+	}
+#endif
+	return( 1 );
+}
+
+/* Finalizes the segment files after writing
+ * Removes the segment file that was created ahead of time by this handle but was not written
+ * and truncates the last written segment file to the size of its data
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_io_handle_finalize_segments(
+     libsmraw_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function        = "libsmraw_io_handle_finalize_segments";
+
+#if defined( HAVE_LIBSMRAW_SEGMENT_PREALLOCATION_SUPPORT )
+	system_character_t *filename = NULL;
+	size_t filename_size         = 0;
+	int file_descriptor          = -1;
+	int segment_index            = 0;
+#endif
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmraw_io_handle_wait_for_segment_preallocation(
+	     io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to wait for segment preallocation.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBSMRAW_SEGMENT_PREALLOCATION_SUPPORT )
+	if( io_handle->preallocated_segment_index != -1 )
+	{
+		segment_index = io_handle->preallocated_segment_index;
+
+		io_handle->preallocated_segment_index = -1;
+
+		if( libsmraw_filename_create(
+		     &filename,
+		     &filename_size,
+		     io_handle->basename,
+		     io_handle->basename_size,
+		     io_handle->number_of_segments,
+		     segment_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create segment filename: %d.",
+			 function,
+			 segment_index );
+
+			goto on_error;
+		}
+		if( ( unlink(
+		       filename ) != 0 )
+		 && ( errno != ENOENT ) )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_UNLINK_FAILED,
+			 errno,
+			 "%s: unable to remove unused segment file: %s.",
+			 function,
+			 filename );
+
+			goto on_error;
+		}
+		memory_free(
+		 filename );
+
+		filename = NULL;
+	}
+	if( ( io_handle->preallocate_segments != 0 )
+	 && ( io_handle->number_of_written_segments > 0 ) )
+	{
+		segment_index = io_handle->number_of_written_segments - 1;
+
+		io_handle->number_of_written_segments = 0;
+
+		if( libsmraw_filename_create(
+		     &filename,
+		     &filename_size,
+		     io_handle->basename,
+		     io_handle->basename_size,
+		     io_handle->number_of_segments,
+		     segment_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create segment filename: %d.",
+			 function,
+			 segment_index );
+
+			goto on_error;
+		}
+		file_descriptor = open(
+		                   filename,
+		                   O_WRONLY );
+
+		if( file_descriptor == -1 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 errno,
+			 "%s: unable to open file: %s.",
+			 function,
+			 filename );
+
+			goto on_error;
+		}
+		/* Release the preallocated storage beyond the end of the data
+		 */
+		if( ftruncate(
+		     file_descriptor,
+		     (off_t) io_handle->last_segment_data_size ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_RESIZE_FAILED,
+			 errno,
+			 "%s: unable to truncate file: %s.",
+			 function,
+			 filename );
+
+			goto on_error;
+		}
+		if( close(
+		     file_descriptor ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 errno,
+			 "%s: unable to close file: %s.",
+			 function,
+			 filename );
+
+			file_descriptor = -1;
+
+			goto on_error;
+		}
+		memory_free(
+		 filename );
+	}
+	return( 1 );
+
+on_error:
+	if( file_descriptor != -1 )
+	{
+		close(
+		 file_descriptor );
+	}
+	if( filename != NULL )
+	{
+		memory_free(
+		 filename );
+	}
+	return( -1 );
+#else
+	return( 1 );
+#endif /* defined( HAVE_LIBSMRAW_SEGMENT_PREALLOCATION_SUPPORT ) */
+}
+
+/* Retrieves the size of a segment file
+ * The file IO pool entry is opened if it is not open yet,
+ * by the pool policy if there is one, so that the number of open handles is limited
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_io_handle_get_segment_file_size(
+     libsmraw_io_handle_t *io_handle,
+     libbfio_pool_t *file_io_pool,
+     int file_io_pool_entry,
+     int access_flags,
+     size64_t *segment_file_size,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libsmraw_io_handle_get_segment_file_size";
+	int file_io_handle_is_open       = 0;
+	int result                       = 1;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_file_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment file size.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->pool_policy != NULL )
+	{
+		if( libsmraw_pool_policy_acquire(
+		     io_handle->pool_policy,
+		     file_io_pool,
+		     file_io_pool_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to acquire pool entry: %d.",
+			 function,
+			 file_io_pool_entry );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( libbfio_pool_get_handle(
+		     file_io_pool,
+		     file_io_pool_entry,
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file IO handle from pool entry: %d.",
+			 function,
+			 file_io_pool_entry );
+
+			return( -1 );
+		}
+		file_io_handle_is_open = libbfio_handle_is_open(
+		                          file_io_handle,
+		                          error );
+
+		if( file_io_handle_is_open == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to determine if file IO handle is open.",
+			 function );
+
+			return( -1 );
+		}
+		else if( file_io_handle_is_open == 0 )
+		{
+			if( libbfio_pool_open(
+			     file_io_pool,
+			     file_io_pool_entry,
+			     access_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open pool entry: %d.",
+				 function,
+				 file_io_pool_entry );
+
+				return( -1 );
+			}
+		}
+	}
+	if( libbfio_pool_get_size(
+	     file_io_pool,
+	     file_io_pool_entry,
+	     segment_file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size for pool entry: %d.",
+		 function,
+		 file_io_pool_entry );
+
+		result = -1;
+	}
+	if( io_handle->pool_policy != NULL )
+	{
+		if( libsmraw_pool_policy_release(
+		     io_handle->pool_policy,
+		     file_io_pool_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release pool entry: %d.",
+			 function,
+			 file_io_pool_entry );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Retrieves the sizes of segment files
+ * The segment file sizes are determined by multiple threads if multi-threading is supported,
+ * where each thread opens and closes a clone of the file IO handle of the segment files
+ * it determines the size of, so that the file IO pool entries are not changed
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_io_handle_get_segment_file_sizes(
+     libsmraw_io_handle_t *io_handle,
+     libbfio_pool_t *file_io_pool,
+     int number_of_segment_files,
+     int access_flags,
+     size64_t *segment_file_sizes,
+     libcerror_error_t **error )
+{
+	static char *function                               = "libsmraw_io_handle_get_segment_file_sizes";
+	int segment_file_index                              = 0;
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_t *threads[ LIBSMRAW_MAXIMUM_NUMBER_OF_OPEN_THREADS ];
+
+	libsmraw_segment_file_size_requests_t size_requests;
+
+	libbfio_handle_t *file_io_handle                    = NULL;
+	int number_of_threads                               = 0;
+	int result                                          = 1;
+	int thread_index                                    = 0;
+#endif
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_segment_files < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of segment files value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_file_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment file sizes.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( number_of_segment_files > 1 )
+	{
+		if( memory_set(
+		     &size_requests,
+		     0,
+		     sizeof( libsmraw_segment_file_size_requests_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear size requests.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     threads,
+		     0,
+		     sizeof( libcthreads_thread_t * ) * LIBSMRAW_MAXIMUM_NUMBER_OF_OPEN_THREADS ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear threads.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( sizeof( libsmraw_segment_file_size_request_t ) * (size_t) number_of_segment_files ) > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: invalid size requests size value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		size_requests.size_requests = (libsmraw_segment_file_size_request_t *) memory_allocate(
+		                               sizeof( libsmraw_segment_file_size_request_t ) * (size_t) number_of_segment_files );
+
+		if( size_requests.size_requests == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create size requests.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     size_requests.size_requests,
+		     0,
+		     sizeof( libsmraw_segment_file_size_request_t ) * (size_t) number_of_segment_files ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear size requests.",
+			 function );
+
+			goto on_error;
+		}
+		size_requests.number_of_size_requests = number_of_segment_files;
+		size_requests.access_flags            = access_flags;
+
+		/* Clone the file IO handles up front, the threads do not access the file IO pool
+		 * or the file IO handles that it manages
+		 */
+		for( segment_file_index = 0;
+		     segment_file_index < number_of_segment_files;
+		     segment_file_index++ )
+		{
+			if( libbfio_pool_get_handle(
+			     file_io_pool,
+			     segment_file_index,
+			     &file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve file IO handle from pool entry: %d.",
+				 function,
+				 segment_file_index );
+
+				goto on_error;
+			}
+			if( libbfio_handle_clone(
+			     &( size_requests.size_requests[ segment_file_index ].file_io_handle ),
+			     file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to clone file IO handle of pool entry: %d.",
+				 function,
+				 segment_file_index );
+
+				goto on_error;
+			}
+		}
+		if( libcthreads_mutex_initialize(
+		     &( size_requests.mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create mutex.",
+			 function );
+
+			goto on_error;
+		}
+		number_of_threads = number_of_segment_files;
+
+		if( number_of_threads > LIBSMRAW_MAXIMUM_NUMBER_OF_OPEN_THREADS )
+		{
+			number_of_threads = LIBSMRAW_MAXIMUM_NUMBER_OF_OPEN_THREADS;
+		}
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
+		{
+			if( libcthreads_thread_create(
+			     &( threads[ thread_index ] ),
+			     NULL,
+			     (int (*)(void *)) &libsmraw_io_handle_process_segment_file_size_requests,
+			     (void *) &size_requests,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create thread: %d.",
+				 function,
+				 thread_index );
+
+				goto on_error;
+			}
+		}
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
+		{
+			if( libcthreads_thread_join(
+			     &( threads[ thread_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread: %d.",
+				 function,
+				 thread_index );
+
+				result = -1;
+			}
+		}
+		if( result != 1 )
+		{
+			goto on_error;
+		}
+		/* Publish the sizes in segment file index order, the error of the first
+		 * failed size request is passed on to the caller
+		 */
+		for( segment_file_index = 0;
+		     segment_file_index < number_of_segment_files;
+		     segment_file_index++ )
+		{
+			if( size_requests.size_requests[ segment_file_index ].result != 1 )
+			{
+				if( ( error != NULL )
+				 && ( *error == NULL ) )
+				{
+					*error = size_requests.size_requests[ segment_file_index ].error;
+
+					size_requests.size_requests[ segment_file_index ].error = NULL;
+				}
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve size of segment file: %d.",
+				 function,
+				 segment_file_index );
+
+				goto on_error;
+			}
+			segment_file_sizes[ segment_file_index ] = size_requests.size_requests[ segment_file_index ].segment_file_size;
+
+			if( libbfio_handle_free(
+			     &( size_requests.size_requests[ segment_file_index ].file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file IO handle of segment file: %d.",
+				 function,
+				 segment_file_index );
+
+				goto on_error;
+			}
+		}
+		if( libcthreads_mutex_free(
+		     &( size_requests.mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			goto on_error;
+		}
+		memory_free(
+		 size_requests.size_requests );
+
+		return( 1 );
+	}
+#endif /* defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT ) */
+
+	for( segment_file_index = 0;
+	     segment_file_index < number_of_segment_files;
+	     segment_file_index++ )
+	{
+		if( libsmraw_io_handle_get_segment_file_size(
+		     io_handle,
+		     file_io_pool,
+		     segment_file_index,
+		     access_flags,
+		     &( segment_file_sizes[ segment_file_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size of segment file: %d.",
+			 function,
+			 segment_file_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( number_of_segment_files > 1 )
+	{
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
+		{
+			if( threads[ thread_index ] != NULL )
+			{
+				libcthreads_thread_join(
+				 &( threads[ thread_index ] ),
+				 NULL );
+			}
+		}
+		if( size_requests.mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( size_requests.mutex ),
+			 NULL );
+		}
+		if( size_requests.size_requests != NULL )
+		{
+			for( segment_file_index = 0;
+			     segment_file_index < number_of_segment_files;
+			     segment_file_index++ )
+			{
+				if( size_requests.size_requests[ segment_file_index ].file_io_handle != NULL )
+				{
+					libbfio_handle_free(
+					 &( size_requests.size_requests[ segment_file_index ].file_io_handle ),
+					 NULL );
+				}
+				if( size_requests.size_requests[ segment_file_index ].error != NULL )
+				{
+					libcerror_error_free(
+					 &( size_requests.size_requests[ segment_file_index ].error ) );
+				}
+			}
+			memory_free(
+			 size_requests.size_requests );
+		}
+	}
+#endif
+	return( -1 );
+}
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+
+/* Processes segment file size requests until no size requests remain
+ * Callback function for the segment file size threads
+ * The error of a failed size request is stored in the size request
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_io_handle_process_segment_file_size_requests(
+     libsmraw_segment_file_size_requests_t *size_requests )
+{
+	libsmraw_segment_file_size_request_t *size_request = NULL;
+	static char *function                               = "libsmraw_io_handle_process_segment_file_size_requests";
+	int file_io_handle_is_open                          = 0;
+	int size_request_index                              = 0;
+
+	if( size_requests == NULL )
+	{
+		return( -1 );
+	}
+	do
+	{
+		if( libcthreads_mutex_grab(
+		     size_requests->mutex,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+		size_request_index = size_requests->next_size_request_index;
+
+		if( size_request_index < size_requests->number_of_size_requests )
+		{
+			size_requests->next_size_request_index += 1;
+		}
+		if( libcthreads_mutex_release(
+		     size_requests->mutex,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+		if( size_request_index >= size_requests->number_of_size_requests )
+		{
+			break;
+		}
+		size_request = &( size_requests->size_requests[ size_request_index ] );
+
+		size_request->result = -1;
+
+		file_io_handle_is_open = libbfio_handle_is_open(
+		                          size_request->file_io_handle,
+		                          &( size_request->error ) );
+
+		if( file_io_handle_is_open == 0 )
+		{
+			if( libbfio_handle_open(
+			     size_request->file_io_handle,
+			     size_requests->access_flags,
+			     &( size_request->error ) ) == 1 )
+			{
+				if( libbfio_handle_get_size(
+				     size_request->file_io_handle,
+				     &( size_request->segment_file_size ),
+				     &( size_request->error ) ) == 1 )
+				{
+					size_request->result = 1;
+				}
+				if( libbfio_handle_close(
+				     size_request->file_io_handle,
+				     &( size_request->error ) ) != 0 )
+				{
+					size_request->result = -1;
+				}
+			}
+		}
+		else if( file_io_handle_is_open == 1 )
+		{
+			if( libbfio_handle_get_size(
+			     size_request->file_io_handle,
+			     &( size_request->segment_file_size ),
+			     &( size_request->error ) ) == 1 )
+			{
+				size_request->result = 1;
+			}
+		}
+		if( size_request->result != 1 )
+		{
+			libcerror_error_set(
+			 &( size_request->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size of segment file: %d.",
+			 function,
+			 size_request_index );
+		}
+	}
+	while( size_request_index < size_requests->number_of_size_requests );
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT ) */
+
+/* Reads segment data into a buffer
+ * Callback function for the segments stream
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libsmraw_io_handle_read_segment_data(
+         libsmraw_io_handle_t *io_handle,
+         libbfio_pool_t *file_io_pool,
+         int segment_index LIBSMRAW_ATTRIBUTE_UNUSED,
+         int segment_file_index,
+         uint8_t *segment_data,
+         size_t segment_data_size,
+         uint32_t segment_flags LIBSMRAW_ATTRIBUTE_UNUSED,
+         uint8_t read_flags LIBSMRAW_ATTRIBUTE_UNUSED,
+         libcerror_error_t **error )
+{
+	libsmraw_direct_file_t *direct_file = NULL;
+	libsmraw_memory_map_t *memory_map   = NULL;
+	static char *function               = "libsmraw_io_handle_read_segment_data";
+	ssize_t read_count                  = 0;
+	off64_t segment_data_offset         = 0;
+
+	LIBSMRAW_UNREFERENCED_PARAMETER( segment_index )
+	LIBSMRAW_UNREFERENCED_PARAMETER( segment_flags )
+	LIBSMRAW_UNREFERENCED_PARAMETER( read_flags )
+
+	if( io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid segment size.",
+		 "%s: invalid IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( segment_flags == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid segment flags.",
-		 function );
+	memory_map = libsmraw_io_handle_get_memory_map(
+	              io_handle,
+	              segment_file_index );
 
-		return( -1 );
+	direct_file = libsmraw_io_handle_get_direct_file(
+	               io_handle,
+	               segment_file_index );
+
+	if( memory_map != NULL )
+	{
+		read_count = libsmraw_memory_map_read_buffer(
+		              memory_map,
+		              segment_data,
+		              segment_data_size,
+		              error );
 	}
-	if( libsmraw_filename_create(
-	     &filename,
-	     &filename_size,
-	     io_handle->basename,
-	     io_handle->basename_size,
-	     io_handle->number_of_segments,
-	     segment_index,
-	     error ) != 1 )
+	else if( direct_file != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create segment filename: %d.",
-		 function,
-		 segment_index );
-
-		goto on_error;
+		read_count = libsmraw_direct_file_read_buffer(
+		              direct_file,
+		              segment_data,
+		              segment_data_size,
+		              error );
 	}
-	if( libbfio_file_initialize(
-	     &file_io_handle,
-	     error ) != 1 )
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file IO handle.",
-		 function );
+		if( io_handle->pool_policy != NULL )
+		{
+			if( libsmraw_pool_policy_acquire(
+			     io_handle->pool_policy,
+			     file_io_pool,
+			     segment_file_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to acquire pool entry: %d.",
+				 function,
+				 segment_file_index );
+
+				return( -1 );
+			}
+		}
+		/* The offset of the segments stream is tracked by seek segment offset,
+		 * it is only retrieved from the file IO pool if the segment file was not sought
+		 */
+		if( io_handle->current_segment_file_index != segment_file_index )
+		{
+			if( libbfio_pool_get_offset(
+			     file_io_pool,
+			     segment_file_index,
+			     &( io_handle->current_segment_file_offset ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve offset of pool entry: %d.",
+				 function,
+				 segment_file_index );
+
+				read_count = -1;
+			}
+			else
+			{
+				io_handle->current_segment_file_index = segment_file_index;
+			}
+		}
+		segment_data_offset = io_handle->current_segment_file_offset;
 
-		goto on_error;
+		/* The pool policy can close the segment file between seek and read
+		 * hence the segment data is read at the tracked offset
+		 */
+		if( read_count == -1 )
+		{
+			io_handle->current_segment_file_index = -1;
+		}
+		else if( io_handle->pool_policy != NULL )
+		{
+			read_count = libbfio_pool_read_buffer_at_offset(
+			              file_io_pool,
+			              segment_file_index,
+			              segment_data,
+			              segment_data_size,
+			              segment_data_offset,
+			              error );
+		}
+		else
+		{
+			read_count = libbfio_pool_read_buffer(
+			              file_io_pool,
+			              segment_file_index,
+			              segment_data,
+			              segment_data_size,
+			              error );
+		}
+		if( read_count == -1 )
+		{
+			io_handle->current_segment_file_index = -1;
+		}
+		else
+		{
+			io_handle->current_segment_file_offset += (off64_t) read_count;
+		}
+		if( io_handle->pool_policy != NULL )
+		{
+			if( libsmraw_pool_policy_release(
+			     io_handle->pool_policy,
+			     segment_file_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release pool entry: %d.",
+				 function,
+				 segment_file_index );
+
+				return( -1 );
+			}
+		}
+		if( ( io_handle->access_hint != NULL )
+		 && ( read_count > 0 ) )
+		{
+			if( libsmraw_io_handle_apply_access_hints(
+			     io_handle,
+			     segment_file_index,
+			     segment_data_offset,
+			     (size_t) read_count,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to apply access hints.",
+				 function );
+
+				return( -1 );
+			}
+		}
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libbfio_file_set_name_wide(
-	     file_io_handle,
-	     filename,
-	     filename_size,
-	     error ) != 1 )
-#else
-	if( libbfio_file_set_name(
-	     file_io_handle,
-	     filename,
-	     filename_size,
-	     error ) != 1 )
-#endif
+
+	if( read_count == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set name in file IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read segment data.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	memory_free(
-	 filename );
+	return( read_count );
+}
 
-	filename = NULL;
+/* Reads segment data at a specific offset into a buffer
+ * This function does not change the current offset of the segments stream
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libsmraw_io_handle_read_segment_data_at_offset(
+         libsmraw_io_handle_t *io_handle,
+         libbfio_pool_t *file_io_pool,
+         int segment_file_index,
+         uint8_t *segment_data,
+         size_t segment_data_size,
+         off64_t segment_data_offset,
+         libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle    = NULL;
+	libsmraw_direct_file_t *direct_file = NULL;
+	libsmraw_memory_map_t *memory_map   = NULL;
+	static char *function               = "libsmraw_io_handle_read_segment_data_at_offset";
+	ssize_t read_count                  = 0;
 
-	if( libbfio_pool_append_handle(
-	     file_io_pool,
-	     &file_io_pool_entry,
-	     file_io_handle,
-	     LIBBFIO_OPEN_WRITE_TRUNCATE,
-	     error ) != 1 )
+	if( io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append file IO handle to pool.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libbfio_pool_open(
-	     file_io_pool,
-	     file_io_pool_entry,
-	     LIBBFIO_OPEN_WRITE_TRUNCATE,
-	     error ) != 1 )
+	if( segment_data_offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open file IO pool entry: %d.",
-		 function,
-		 file_io_pool_entry );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segment data offset value out of bounds.",
+		 function );
 
-		file_io_handle = NULL;
+		return( -1 );
+	}
+	memory_map = libsmraw_io_handle_get_memory_map(
+	              io_handle,
+	              segment_file_index );
 
-		goto on_error;
+	direct_file = libsmraw_io_handle_get_direct_file(
+	               io_handle,
+	               segment_file_index );
+
+	if( memory_map != NULL )
+	{
+		read_count = libsmraw_memory_map_read_buffer_at_offset(
+		              memory_map,
+		              segment_data,
+		              segment_data_size,
+		              segment_data_offset,
+		              error );
 	}
-	if( io_handle->maximum_segment_size == 0 )
+	else if( direct_file != NULL )
 	{
-		*segment_size = (size64_t) INT64_MAX;
+		read_count = libsmraw_direct_file_read_buffer_at_offset(
+		              direct_file,
+		              segment_data,
+		              segment_data_size,
+		              segment_data_offset,
+		              error );
 	}
 	else
 	{
-		*segment_size = io_handle->maximum_segment_size;
+		if( io_handle->pool_policy != NULL )
+		{
+			if( libsmraw_pool_policy_acquire(
+			     io_handle->pool_policy,
+			     file_io_pool,
+			     segment_file_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to acquire pool entry: %d.",
+				 function,
+				 segment_file_index );
+
+				return( -1 );
+			}
+		}
+		/* An acquired pool entry is open and is not closed until it is released,
+		 * hence it is read using its file IO handle directly so that reads from
+		 * different segment files are not serialized by the file IO pool
+		 */
+		if( io_handle->pool_policy != NULL )
+		{
+			read_count = -1;
+
+			if( libbfio_pool_get_handle(
+			     file_io_pool,
+			     segment_file_index,
+			     &file_io_handle,
+			     error ) == 1 )
+			{
+				read_count = libbfio_handle_read_buffer_at_offset(
+				              file_io_handle,
+				              segment_data,
+				              segment_data_size,
+				              segment_data_offset,
+				              error );
+			}
+			else
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve file IO handle: %d from pool.",
+				 function,
+				 segment_file_index );
+			}
+		}
+		else
+		{
+			read_count = libbfio_pool_read_buffer_at_offset(
+			              file_io_pool,
+			              segment_file_index,
+			              segment_data,
+			              segment_data_size,
+			              segment_data_offset,
+			              error );
+		}
+		/* The pool entry is released after the read so that it cannot be closed while it is read
+		 */
+		if( io_handle->pool_policy != NULL )
+		{
+			if( libsmraw_pool_policy_release(
+			     io_handle->pool_policy,
+			     segment_file_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release pool entry: %d.",
+				 function,
+				 segment_file_index );
+
+				return( -1 );
+			}
+		}
+		if( ( io_handle->access_hint != NULL )
+		 && ( read_count > 0 ) )
+		{
+			if( libsmraw_io_handle_apply_access_hints(
+			     io_handle,
+			     segment_file_index,
+			     segment_data_offset,
+			     (size_t) read_count,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to apply access hints.",
+				 function );
+
+				return( -1 );
+			}
+		}
 	}
-	*segment_file_index = file_io_pool_entry;
-	*segment_offset     = 0;
-	*segment_flags      = 0;
-
-	return( 1 );
 
-on_error:
-	if( file_io_handle != NULL )
-	{
-		libbfio_handle_free(
-		 &file_io_handle,
-		 NULL );
-	}
-	if( filename != NULL )
+	if( read_count == -1 )
 	{
-		memory_free(
-		 filename );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read segment data at offset: %" PRIi64 " (0x%08" PRIx64 ") from pool entry: %d.",
+		 function,
+		 segment_data_offset,
+		 segment_data_offset,
+		 segment_file_index );
+
+		return( -1 );
 	}
-	return( -1 );
+	return( read_count );
 }
 
-/* Reads segment data into a buffer
- * Callback function for the segments stream
- * Returns the number of bytes read or -1 on error
+/* Retrieves a reference to memory mapped segment data at a specific offset
+ * Returns 1 if successful, 0 if the segment data is not mapped or -1 on error
  */
-ssize_t libsmraw_io_handle_read_segment_data(
-         libsmraw_io_handle_t *io_handle,
-         libbfio_pool_t *file_io_pool,
-         int segment_index LIBSMRAW_ATTRIBUTE_UNUSED,
-         int segment_file_index,
-         uint8_t *segment_data,
-         size_t segment_data_size,
-         uint32_t segment_flags LIBSMRAW_ATTRIBUTE_UNUSED,
-         uint8_t read_flags LIBSMRAW_ATTRIBUTE_UNUSED,
-         libcerror_error_t **error )
+int libsmraw_io_handle_get_mapped_segment_data_at_offset(
+     libsmraw_io_handle_t *io_handle,
+     int segment_file_index,
+     off64_t segment_data_offset,
+     size_t segment_data_size,
+     const uint8_t **segment_data,
+     libcerror_error_t **error )
 {
-	static char *function = "libsmraw_io_handle_read_segment_data";
-	ssize_t read_count    = 0;
-
-	LIBSMRAW_UNREFERENCED_PARAMETER( segment_index )
-	LIBSMRAW_UNREFERENCED_PARAMETER( segment_flags )
-	LIBSMRAW_UNREFERENCED_PARAMETER( read_flags )
+	libsmraw_memory_map_t *memory_map = NULL;
+	static char *function             = "libsmraw_io_handle_get_mapped_segment_data_at_offset";
+	int result                        = 0;
 
 	if( io_handle == NULL )
 	{
@@ -420,25 +3291,36 @@ ssize_t libsmraw_io_handle_read_segment_data(
 
 		return( -1 );
 	}
-	read_count = libbfio_pool_read_buffer(
-	              file_io_pool,
-	              segment_file_index,
-	              segment_data,
-	              segment_data_size,
-	              error );
+	memory_map = libsmraw_io_handle_get_memory_map(
+	              io_handle,
+	              segment_file_index );
 
-	if( read_count == -1 )
+	if( memory_map == NULL )
+	{
+		return( 0 );
+	}
+	result = libsmraw_memory_map_get_data_at_offset(
+	          memory_map,
+	          segment_data_offset,
+	          segment_data_size,
+	          segment_data,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read segment data.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve mapped data at offset: %" PRIi64 " (0x%08" PRIx64 ") from memory map: %d.",
+		 function,
+		 segment_data_offset,
+		 segment_data_offset,
+		 segment_file_index );
 
 		return( -1 );
 	}
-	return( read_count );
+	return( result );
 }
 
 /* Writes segment data from a buffer
@@ -448,7 +3330,7 @@ ssize_t libsmraw_io_handle_read_segment_data(
 ssize_t libsmraw_io_handle_write_segment_data(
          libsmraw_io_handle_t *io_handle,
          libbfio_pool_t *file_io_pool,
-         int segment_index LIBSMRAW_ATTRIBUTE_UNUSED,
+         int segment_index,
          int segment_file_index,
          const uint8_t *segment_data,
          size_t segment_data_size,
@@ -456,10 +3338,11 @@ ssize_t libsmraw_io_handle_write_segment_data(
          uint8_t write_flags LIBSMRAW_ATTRIBUTE_UNUSED,
          libcerror_error_t **error )
 {
-	static char *function = "libsmraw_io_handle_write_segment_data";
-	ssize_t write_count    = 0;
+	libsmraw_direct_file_t *direct_file = NULL;
+	static char *function               = "libsmraw_io_handle_write_segment_data";
+	ssize_t write_count                 = 0;
+	off64_t data_offset                 = 0;
 
-	LIBSMRAW_UNREFERENCED_PARAMETER( segment_index )
 	LIBSMRAW_UNREFERENCED_PARAMETER( segment_flags )
 	LIBSMRAW_UNREFERENCED_PARAMETER( write_flags )
 
@@ -474,12 +3357,27 @@ ssize_t libsmraw_io_handle_write_segment_data(
 
 		return( -1 );
 	}
-	write_count = libbfio_pool_write_buffer(
-	               file_io_pool,
-	               segment_file_index,
-	               segment_data,
-	               segment_data_size,
-	               error );
+	direct_file = libsmraw_io_handle_get_direct_file(
+	               io_handle,
+	               segment_file_index );
+
+	if( direct_file != NULL )
+	{
+		write_count = libsmraw_direct_file_write_buffer(
+		               direct_file,
+		               segment_data,
+		               segment_data_size,
+		               error );
+	}
+	else
+	{
+		write_count = libbfio_pool_write_buffer(
+		               file_io_pool,
+		               segment_file_index,
+		               segment_data,
+		               segment_data_size,
+		               error );
+	}
 
 	if( write_count == -1 )
 	{
@@ -492,6 +3390,42 @@ ssize_t libsmraw_io_handle_write_segment_data(
 
 		return( -1 );
 	}
+	/* Track the end of the data of the last written segment so that
+	 * its preallocated storage can be truncated on close
+	 */
+	if( io_handle->preallocate_segments != 0 )
+	{
+		if( direct_file != NULL )
+		{
+			data_offset = direct_file->current_offset;
+		}
+		else if( libbfio_pool_get_offset(
+		          file_io_pool,
+		          segment_file_index,
+		          &data_offset,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve offset of file IO pool entry: %d.",
+			 function,
+			 segment_file_index );
+
+			return( -1 );
+		}
+		if( segment_index >= io_handle->number_of_written_segments )
+		{
+			io_handle->number_of_written_segments = segment_index + 1;
+			io_handle->last_segment_data_size     = 0;
+		}
+		if( ( segment_index == ( io_handle->number_of_written_segments - 1 ) )
+		 && ( (size64_t) data_offset > io_handle->last_segment_data_size ) )
+		{
+			io_handle->last_segment_data_size = (size64_t) data_offset;
+		}
+	}
 	return( write_count );
 }
 
@@ -507,7 +3441,9 @@ off64_t libsmraw_io_handle_seek_segment_offset(
          off64_t segment_offset,
          libcerror_error_t **error )
 {
-	static char *function = "libsmraw_io_handle_seek_segment_offset";
+	libsmraw_direct_file_t *direct_file = NULL;
+	libsmraw_memory_map_t *memory_map   = NULL;
+	static char *function               = "libsmraw_io_handle_seek_segment_offset";
 
 	LIBSMRAW_UNREFERENCED_PARAMETER( segment_index )
 
@@ -522,12 +3458,84 @@ off64_t libsmraw_io_handle_seek_segment_offset(
 
 		return( -1 );
 	}
-	segment_offset = libbfio_pool_seek_offset(
-	                  file_io_pool,
-	                  segment_file_index,
-	                  segment_offset,
-	                  SEEK_SET,
-	                  error );
+	memory_map = libsmraw_io_handle_get_memory_map(
+	              io_handle,
+	              segment_file_index );
+
+	direct_file = libsmraw_io_handle_get_direct_file(
+	               io_handle,
+	               segment_file_index );
+
+	if( memory_map != NULL )
+	{
+		segment_offset = libsmraw_memory_map_seek_offset(
+		                  memory_map,
+		                  segment_offset,
+		                  error );
+	}
+	else if( direct_file != NULL )
+	{
+		segment_offset = libsmraw_direct_file_seek_offset(
+		                  direct_file,
+		                  segment_offset,
+		                  error );
+	}
+	else
+	{
+		if( io_handle->pool_policy != NULL )
+		{
+			if( libsmraw_pool_policy_acquire(
+			     io_handle->pool_policy,
+			     file_io_pool,
+			     segment_file_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to acquire pool entry: %d.",
+				 function,
+				 segment_file_index );
+
+				return( -1 );
+			}
+		}
+		segment_offset = libbfio_pool_seek_offset(
+		                  file_io_pool,
+		                  segment_file_index,
+		                  segment_offset,
+		                  SEEK_SET,
+		                  error );
+
+		if( segment_offset == -1 )
+		{
+			io_handle->current_segment_file_index = -1;
+		}
+		else
+		{
+			io_handle->current_segment_file_index  = segment_file_index;
+			io_handle->current_segment_file_offset = segment_offset;
+		}
+		if( io_handle->pool_policy != NULL )
+		{
+			if( libsmraw_pool_policy_release(
+			     io_handle->pool_policy,
+			     segment_file_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release pool entry: %d.",
+				 function,
+				 segment_file_index );
+
+				return( -1 );
+			}
+		}
+	}
 
 	if( segment_offset == -1 )
 	{
@@ -1638,3 +4646,35 @@ int libsmraw_io_handle_set_maximum_segment_size(
 	return( 1 );
 }
 
+/* Sets the segment file preallocation
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_io_handle_set_preallocate_segments(
+     libsmraw_io_handle_t *io_handle,
+     uint8_t preallocate_segments,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_io_handle_set_preallocate_segments";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( preallocate_segments != 0 )
+	{
+		io_handle->preallocate_segments = 1;
+	}
+	else
+	{
+		io_handle->preallocate_segments = 0;
+	}
+	return( 1 );
+}
+
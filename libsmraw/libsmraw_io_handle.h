@@ -25,15 +25,45 @@
 #include <common.h>
 #include <types.h>
 
+#include "libsmraw_access_hint.h"
+#include "libsmraw_direct_file.h"
 #include "libsmraw_libbfio.h"
 #include "libsmraw_libcerror.h"
+#include "libsmraw_libcthreads.h"
+#include "libsmraw_memory_map.h"
+#include "libsmraw_pool_policy.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+#if defined( HAVE_POSIX_FALLOCATE ) && defined( HAVE_FTRUNCATE ) && defined( HAVE_UNLINK ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER ) && !defined( WINAPI )
+#define HAVE_LIBSMRAW_SEGMENT_PREALLOCATION_SUPPORT	1
+#endif
+
 extern const uint8_t *smraw_file_signature;
 
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+
+typedef struct libsmraw_segment_preallocation_request libsmraw_segment_preallocation_request_t;
+
+struct libsmraw_segment_preallocation_request
+{
+	/* The segment filename
+	 */
+	system_character_t *filename;
+
+	/* The segment size
+	 */
+	size64_t segment_size;
+
+	/* The result, 1 if created, 0 if the segment file already exists or -1 on error
+	 */
+	int result;
+};
+
+#endif /* defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT ) */
+
 typedef struct libsmraw_io_handle libsmraw_io_handle_t;
 
 struct libsmraw_io_handle
@@ -58,11 +88,133 @@ struct libsmraw_io_handle
 	 */
 	int number_of_segments;
 
+	/* The memory maps of the segment files
+	 */
+	libsmraw_memory_map_t **memory_maps;
+
+	/* The number of memory maps
+	 */
+	int number_of_memory_maps;
+
+	/* The direct IO files of the segment files
+	 */
+	libsmraw_direct_file_t **direct_files;
+
+	/* The number of direct IO files
+	 */
+	int number_of_direct_files;
+
+	/* Value to indicate the segment files should be accessed using direct IO
+	 */
+	uint8_t use_direct_io;
+
+	/* The access pattern hints applied to the segment files on read
+	 */
+	libsmraw_access_hint_t *access_hint;
+
+	/* The narrow filenames of the segment files the access pattern hints are applied to
+	 * These are only set for segment files that were opened by the library
+	 */
+	char **segment_file_names;
+
+	/* The number of segment file names
+	 */
+	int number_of_segment_file_names;
+
+	/* The index of the segment file of the current offset of the segments stream or -1 if not set
+	 */
+	int current_segment_file_index;
+
+	/* The current offset of the segments stream in the segment file
+	 */
+	off64_t current_segment_file_offset;
+
+	/* The pool policy that limits the number of open segment files on read
+	 */
+	libsmraw_pool_policy_t *pool_policy;
+
+	/* Value to indicate the segment files should be preallocated on write
+	 */
+	uint8_t preallocate_segments;
+
+	/* The index of the segment file that was created ahead of time by this handle or -1 if not set
+	 */
+	int preallocated_segment_index;
+
+	/* The number of written segments
+	 */
+	int number_of_written_segments;
+
+	/* The size of the data written to the last written segment
+	 */
+	size64_t last_segment_data_size;
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	/* The thread that preallocates the next segment file in the background
+	 */
+	libcthreads_thread_t *preallocation_thread;
+
+	/* The preallocation request of the preallocation thread
+	 */
+	libsmraw_segment_preallocation_request_t preallocation_request;
+#endif
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
 };
 
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+
+typedef struct libsmraw_segment_file_size_request libsmraw_segment_file_size_request_t;
+
+struct libsmraw_segment_file_size_request
+{
+	/* The file IO handle
+	 * This is a clone of the file IO pool entry that is owned by the size request
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The segment file size
+	 */
+	size64_t segment_file_size;
+
+	/* The result, 1 if successful or -1 on error
+	 */
+	int result;
+
+	/* The error of a failed size request
+	 */
+	libcerror_error_t *error;
+};
+
+typedef struct libsmraw_segment_file_size_requests libsmraw_segment_file_size_requests_t;
+
+struct libsmraw_segment_file_size_requests
+{
+	/* The size requests
+	 */
+	libsmraw_segment_file_size_request_t *size_requests;
+
+	/* The number of size requests
+	 */
+	int number_of_size_requests;
+
+	/* The index of the next size request to process
+	 */
+	int next_size_request_index;
+
+	/* The access flags
+	 */
+	int access_flags;
+
+	/* The mutex that protects the next size request index
+	 */
+	libcthreads_mutex_t *mutex;
+};
+
+#endif /* defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT ) */
+
 int libsmraw_io_handle_initialize(
      libsmraw_io_handle_t **io_handle,
      libcerror_error_t **error );
@@ -75,6 +227,68 @@ int libsmraw_io_handle_clear(
      libsmraw_io_handle_t *io_handle,
      libcerror_error_t **error );
 
+int libsmraw_io_handle_open_memory_maps(
+     libsmraw_io_handle_t *io_handle,
+     libbfio_pool_t *file_io_pool,
+     libcerror_error_t **error );
+
+int libsmraw_io_handle_close_memory_maps(
+     libsmraw_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+libsmraw_memory_map_t *libsmraw_io_handle_get_memory_map(
+                        libsmraw_io_handle_t *io_handle,
+                        int segment_file_index );
+
+int libsmraw_io_handle_open_direct_files(
+     libsmraw_io_handle_t *io_handle,
+     libbfio_pool_t *file_io_pool,
+     int access_flags,
+     libcerror_error_t **error );
+
+int libsmraw_io_handle_get_segment_file_name(
+     libsmraw_io_handle_t *io_handle,
+     libbfio_pool_t *file_io_pool,
+     int file_io_pool_entry,
+     char **filename,
+     libcerror_error_t **error );
+
+int libsmraw_io_handle_open_direct_file(
+     libsmraw_io_handle_t *io_handle,
+     libbfio_pool_t *file_io_pool,
+     int file_io_pool_entry,
+     int access_flags,
+     libcerror_error_t **error );
+
+int libsmraw_io_handle_close_direct_files(
+     libsmraw_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+libsmraw_direct_file_t *libsmraw_io_handle_get_direct_file(
+                         libsmraw_io_handle_t *io_handle,
+                         int segment_file_index );
+
+int libsmraw_io_handle_set_access_pattern(
+     libsmraw_io_handle_t *io_handle,
+     uint32_t access_pattern_flags,
+     libcerror_error_t **error );
+
+int libsmraw_io_handle_set_segment_file_names(
+     libsmraw_io_handle_t *io_handle,
+     libbfio_pool_t *file_io_pool,
+     libcerror_error_t **error );
+
+int libsmraw_io_handle_clear_segment_file_names(
+     libsmraw_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libsmraw_io_handle_apply_access_hints(
+     libsmraw_io_handle_t *io_handle,
+     int segment_file_index,
+     off64_t segment_data_offset,
+     size_t segment_data_size,
+     libcerror_error_t **error );
+
 int libsmraw_io_handle_create_segment(
      libsmraw_io_handle_t *io_handle,
      libbfio_pool_t *file_io_pool,
@@ -85,6 +299,54 @@ int libsmraw_io_handle_create_segment(
      uint32_t *segment_flags,
      libcerror_error_t **error );
 
+int libsmraw_io_handle_preallocate_segment_file(
+     const system_character_t *filename,
+     size64_t segment_size,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+
+int libsmraw_io_handle_process_segment_preallocation_request(
+     libsmraw_segment_preallocation_request_t *preallocation_request );
+
+#endif /* defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT ) */
+
+int libsmraw_io_handle_preallocate_segment(
+     libsmraw_io_handle_t *io_handle,
+     int segment_index,
+     libcerror_error_t **error );
+
+int libsmraw_io_handle_wait_for_segment_preallocation(
+     libsmraw_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libsmraw_io_handle_finalize_segments(
+     libsmraw_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libsmraw_io_handle_get_segment_file_size(
+     libsmraw_io_handle_t *io_handle,
+     libbfio_pool_t *file_io_pool,
+     int file_io_pool_entry,
+     int access_flags,
+     size64_t *segment_file_size,
+     libcerror_error_t **error );
+
+int libsmraw_io_handle_get_segment_file_sizes(
+     libsmraw_io_handle_t *io_handle,
+     libbfio_pool_t *file_io_pool,
+     int number_of_segment_files,
+     int access_flags,
+     size64_t *segment_file_sizes,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+
+int libsmraw_io_handle_process_segment_file_size_requests(
+     libsmraw_segment_file_size_requests_t *size_requests );
+
+#endif /* defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT ) */
+
 ssize_t libsmraw_io_handle_read_segment_data(
          libsmraw_io_handle_t *io_handle,
          libbfio_pool_t *file_io_pool,
@@ -96,6 +358,23 @@ ssize_t libsmraw_io_handle_read_segment_data(
          uint8_t read_flags,
          libcerror_error_t **error );
 
+ssize_t libsmraw_io_handle_read_segment_data_at_offset(
+         libsmraw_io_handle_t *io_handle,
+         libbfio_pool_t *file_io_pool,
+         int segment_file_index,
+         uint8_t *segment_data,
+         size_t segment_data_size,
+         off64_t segment_data_offset,
+         libcerror_error_t **error );
+
+int libsmraw_io_handle_get_mapped_segment_data_at_offset(
+     libsmraw_io_handle_t *io_handle,
+     int segment_file_index,
+     off64_t segment_data_offset,
+     size_t segment_data_size,
+     const uint8_t **segment_data,
+     libcerror_error_t **error );
+
 ssize_t libsmraw_io_handle_write_segment_data(
          libsmraw_io_handle_t *io_handle,
          libbfio_pool_t *file_io_pool,
@@ -163,6 +442,11 @@ int libsmraw_io_handle_set_maximum_segment_size(
      size64_t maximum_segment_size,
      libcerror_error_t **error );
 
+int libsmraw_io_handle_set_preallocate_segments(
+     libsmraw_io_handle_t *io_handle,
+     uint8_t preallocate_segments,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
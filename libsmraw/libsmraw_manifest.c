@@ -0,0 +1,1514 @@
+/*
+ * Segment manifest functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libsmraw_definitions.h"
+#include "libsmraw_libcerror.h"
+#include "libsmraw_manifest.h"
+
+/* The manifest file header consists of:
+ * signature                8 bytes
+ * format version           4 bytes
+ * number of segments       4 bytes
+ * media size               8 bytes
+ * naming schema            1 byte
+ * reserved                 7 bytes
+ *
+ * Followed by for every segment:
+ * segment file size        8 bytes
+ * modification time        8 bytes, in nanoseconds since January 1, 1970 (UTC)
+ * name length              2 bytes
+ * name                     name length bytes
+ */
+const uint8_t libsmraw_manifest_signature[ 8 ] = {
+	's', 'm', 'r', 'a', 'w', 'm', 'f', 0 };
+
+#define LIBSMRAW_MANIFEST_FORMAT_VERSION		2
+#define LIBSMRAW_MANIFEST_FILE_HEADER_SIZE		32
+#define LIBSMRAW_MANIFEST_SEGMENT_HEADER_SIZE		18
+
+/* Retrieves the last path segment of a filename
+ */
+static const char *libsmraw_manifest_get_name(
+                    const char *filename,
+                    size_t filename_length,
+                    size_t *name_length )
+{
+	size_t name_index = filename_length;
+
+	while( name_index > 0 )
+	{
+		if( filename[ name_index - 1 ] == '/' )
+		{
+			break;
+		}
+		name_index--;
+	}
+	*name_length = filename_length - name_index;
+
+	return( &( filename[ name_index ] ) );
+}
+
+/* Creates a manifest
+ * Make sure the value manifest is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_manifest_initialize(
+     libsmraw_manifest_t **manifest,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_manifest_initialize";
+
+	if( manifest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest.",
+		 function );
+
+		return( -1 );
+	}
+	if( *manifest != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid manifest value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*manifest = memory_allocate_structure(
+	             libsmraw_manifest_t );
+
+	if( *manifest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create manifest.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *manifest,
+	     0,
+	     sizeof( libsmraw_manifest_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear manifest.",
+		 function );
+
+		goto on_error;
+	}
+	( *manifest )->naming_schema = LIBSMRAW_SEGMENT_FILE_NAMING_SCHEMA_UNKNOWN;
+
+	return( 1 );
+
+on_error:
+	if( *manifest != NULL )
+	{
+		memory_free(
+		 *manifest );
+
+		*manifest = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a manifest
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_manifest_free(
+     libsmraw_manifest_t **manifest,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_manifest_free";
+
+	if( manifest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest.",
+		 function );
+
+		return( -1 );
+	}
+	if( *manifest != NULL )
+	{
+		libsmraw_manifest_clear(
+		 *manifest );
+
+		memory_free(
+		 *manifest );
+
+		*manifest = NULL;
+	}
+	return( 1 );
+}
+
+/* Clears the segments of a manifest
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_manifest_clear(
+     libsmraw_manifest_t *manifest )
+{
+	int segment_index = 0;
+
+	if( manifest == NULL )
+	{
+		return( -1 );
+	}
+	if( manifest->segments != NULL )
+	{
+		for( segment_index = 0;
+		     segment_index < manifest->number_of_segments;
+		     segment_index++ )
+		{
+			if( manifest->segments[ segment_index ].name != NULL )
+			{
+				memory_free(
+				 manifest->segments[ segment_index ].name );
+			}
+		}
+		memory_free(
+		 manifest->segments );
+
+		manifest->segments = NULL;
+	}
+	manifest->number_of_segments = 0;
+	manifest->media_size         = 0;
+	manifest->naming_schema      = LIBSMRAW_SEGMENT_FILE_NAMING_SCHEMA_UNKNOWN;
+
+	return( 1 );
+}
+
+/* Creates the manifest filename from the filename of the first segment file
+ * The manifest filename is the basename followed by the extension .raw.manifest,
+ * analogous to the information filename
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_manifest_create_filename(
+     char **manifest_filename,
+     size_t *manifest_filename_size,
+     const char *segment_filename,
+     size_t segment_filename_length,
+     libcerror_error_t **error )
+{
+	char *safe_manifest_filename = NULL;
+	static char *function        = "libsmraw_manifest_create_filename";
+	size_t basename_length       = 0;
+
+	if( manifest_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( manifest_filename_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest filename size.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( segment_filename_length <= 4 )
+	 || ( segment_filename_length > (size_t) ( SSIZE_MAX - 14 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segment filename length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	basename_length = segment_filename_length - 4;
+
+	safe_manifest_filename = narrow_string_allocate(
+	                          basename_length + 14 );
+
+	if( safe_manifest_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create manifest filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_string_copy(
+	     safe_manifest_filename,
+	     segment_filename,
+	     basename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy basename to manifest filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_string_copy(
+	     &( safe_manifest_filename[ basename_length ] ),
+	     ".raw.manifest",
+	     13 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy extension to manifest filename.",
+		 function );
+
+		goto on_error;
+	}
+	safe_manifest_filename[ basename_length + 13 ] = 0;
+
+	*manifest_filename      = safe_manifest_filename;
+	*manifest_filename_size = basename_length + 14;
+
+	return( 1 );
+
+on_error:
+	if( safe_manifest_filename != NULL )
+	{
+		memory_free(
+		 safe_manifest_filename );
+	}
+	return( -1 );
+}
+
+/* Retrieves the size and modification time of a segment file without opening it
+ * The modification time is in nanoseconds since January 1, 1970 (UTC)
+ * Returns 1 if successful, 0 if the values are not available or -1 on error
+ */
+int libsmraw_manifest_get_segment_file_values(
+     const char *filename,
+     size64_t *segment_size,
+     int64_t *modification_time,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBSMRAW_MANIFEST_SUPPORT )
+	struct stat file_statistics;
+#endif
+
+	static char *function = "libsmraw_manifest_get_segment_file_values";
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment size.",
+		 function );
+
+		return( -1 );
+	}
+	if( modification_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid modification time.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBSMRAW_MANIFEST_SUPPORT )
+	if( stat(
+	     filename,
+	     &file_statistics ) != 0 )
+	{
+		return( 0 );
+	}
+	if( ( file_statistics.st_mode & S_IFMT ) != S_IFREG )
+	{
+		return( 0 );
+	}
+	*segment_size      = (size64_t) file_statistics.st_size;
+	*modification_time = (int64_t) file_statistics.st_mtime * 1000000000;
+
+	/* A segment file rewritten within the same second is only detected
+	 * if the modification time has sub-second precision
+	 */
+#if defined( HAVE_STRUCT_STAT_ST_MTIM_TV_NSEC )
+	*modification_time += (int64_t) file_statistics.st_mtim.tv_nsec;
+#elif defined( HAVE_STRUCT_STAT_ST_MTIMESPEC_TV_NSEC )
+	*modification_time += (int64_t) file_statistics.st_mtimespec.tv_nsec;
+#endif
+
+	return( 1 );
+#else
+	return( 0 );
+#endif /* defined( HAVE_LIBSMRAW_MANIFEST_SUPPORT ) */
+}
+
+/* Appends a segment to the manifest
+ * Only the last path segment of the filename is stored
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_manifest_append_segment(
+     libsmraw_manifest_t *manifest,
+     const char *filename,
+     size_t filename_length,
+     size64_t segment_size,
+     int64_t modification_time,
+     libcerror_error_t **error )
+{
+	libsmraw_manifest_segment_t *segment = NULL;
+	const char *name                     = NULL;
+	char *safe_name                      = NULL;
+	static char *function                = "libsmraw_manifest_append_segment";
+	void *reallocation                   = NULL;
+	size_t name_length                   = 0;
+
+	if( manifest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid filename length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	name = libsmraw_manifest_get_name(
+	        filename,
+	        filename_length,
+	        &name_length );
+
+	if( ( name_length == 0 )
+	 || ( name_length > (size_t) UINT16_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename - name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_size > (size64_t) ( UINT64_MAX - manifest->media_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segment size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( manifest->number_of_segments == INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid manifest - number of segments value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	safe_name = narrow_string_allocate(
+	             name_length + 1 );
+
+	if( safe_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_string_copy(
+	     safe_name,
+	     name,
+	     name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy name.",
+		 function );
+
+		goto on_error;
+	}
+	safe_name[ name_length ] = 0;
+
+	reallocation = memory_reallocate(
+	                manifest->segments,
+	                sizeof( libsmraw_manifest_segment_t ) * ( manifest->number_of_segments + 1 ) );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to reallocate segments.",
+		 function );
+
+		goto on_error;
+	}
+	manifest->segments = (libsmraw_manifest_segment_t *) reallocation;
+
+	segment = &( manifest->segments[ manifest->number_of_segments ] );
+
+	segment->name              = safe_name;
+	segment->name_size         = name_length + 1;
+	segment->size              = segment_size;
+	segment->modification_time = modification_time;
+
+	manifest->number_of_segments += 1;
+	manifest->media_size         += segment_size;
+
+	return( 1 );
+
+on_error:
+	if( safe_name != NULL )
+	{
+		memory_free(
+		 safe_name );
+	}
+	return( -1 );
+}
+
+/* Sets the segments of the manifest from the segment files
+ * Returns 1 if successful, 0 if the values of a segment file are not available or -1 on error
+ */
+int libsmraw_manifest_set_segment_files(
+     libsmraw_manifest_t *manifest,
+     char * const filenames[],
+     int number_of_filenames,
+     libcerror_error_t **error )
+{
+	static char *function     = "libsmraw_manifest_set_segment_files";
+	size64_t segment_size     = 0;
+	int64_t modification_time = 0;
+	int filename_index        = 0;
+	int result                = 0;
+
+	if( manifest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest.",
+		 function );
+
+		return( -1 );
+	}
+	if( manifest->segments != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid manifest - segments value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filenames == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filenames.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_filenames <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of filenames value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( filename_index = 0;
+	     filename_index < number_of_filenames;
+	     filename_index++ )
+	{
+		result = libsmraw_manifest_get_segment_file_values(
+		          filenames[ filename_index ],
+		          &segment_size,
+		          &modification_time,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve values of segment file: %d.",
+			 function,
+			 filename_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		if( libsmraw_manifest_append_segment(
+		     manifest,
+		     filenames[ filename_index ],
+		     narrow_string_length(
+		      filenames[ filename_index ] ),
+		     segment_size,
+		     modification_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append segment: %d.",
+			 function,
+			 filename_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Compares the manifest with the segment files
+ * The names of the segment files and the sizes and modification times of the first
+ * and last segment file must match the manifest. To keep the number of file system
+ * requests independent of the number of segment files the sizes of the other segment
+ * files are not checked, these must be verified when the segment file is first accessed
+ * Returns 1 if the manifest matches the segment files, 0 if not or -1 on error
+ */
+int libsmraw_manifest_compare_segment_files(
+     libsmraw_manifest_t *manifest,
+     char * const filenames[],
+     int number_of_filenames,
+     libcerror_error_t **error )
+{
+	libsmraw_manifest_segment_t *segment = NULL;
+	const char *name                     = NULL;
+	static char *function                = "libsmraw_manifest_compare_segment_files";
+	size64_t segment_size                = 0;
+	size_t name_length                   = 0;
+	int64_t modification_time            = 0;
+	int filename_index                   = 0;
+	int result                           = 0;
+
+	if( manifest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest.",
+		 function );
+
+		return( -1 );
+	}
+	if( filenames == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filenames.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_filenames != manifest->number_of_segments )
+	{
+		return( 0 );
+	}
+	for( filename_index = 0;
+	     filename_index < number_of_filenames;
+	     filename_index++ )
+	{
+		segment = &( manifest->segments[ filename_index ] );
+
+		if( filenames[ filename_index ] == NULL )
+		{
+			return( 0 );
+		}
+		name = libsmraw_manifest_get_name(
+		        filenames[ filename_index ],
+		        narrow_string_length(
+		         filenames[ filename_index ] ),
+		        &name_length );
+
+		if( ( ( name_length + 1 ) != segment->name_size )
+		 || ( narrow_string_compare(
+		       name,
+		       segment->name,
+		       name_length ) != 0 ) )
+		{
+			return( 0 );
+		}
+		if( ( filename_index > 0 )
+		 && ( filename_index < ( number_of_filenames - 1 ) ) )
+		{
+			continue;
+		}
+		result = libsmraw_manifest_get_segment_file_values(
+		          filenames[ filename_index ],
+		          &segment_size,
+		          &modification_time,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve values of segment file: %d.",
+			 function,
+			 filename_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		if( ( segment_size != segment->size )
+		 || ( modification_time != segment->modification_time ) )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Creates the filename of a segment in the directory of the reference filename
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_manifest_get_segment_filename(
+     libsmraw_manifest_t *manifest,
+     int segment_index,
+     const char *reference_filename,
+     size_t reference_filename_length,
+     char **segment_filename,
+     size_t *segment_filename_size,
+     libcerror_error_t **error )
+{
+	libsmraw_manifest_segment_t *segment = NULL;
+	char *safe_segment_filename          = NULL;
+	static char *function                = "libsmraw_manifest_get_segment_filename";
+	size_t directory_name_length         = 0;
+	size_t name_length                   = 0;
+
+	if( manifest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( segment_index < 0 )
+	 || ( segment_index >= manifest->number_of_segments ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segment index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( reference_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid reference filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( reference_filename_length > (size_t) ( SSIZE_MAX - UINT16_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid reference filename length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_filename_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment filename size.",
+		 function );
+
+		return( -1 );
+	}
+	segment = &( manifest->segments[ segment_index ] );
+
+	libsmraw_manifest_get_name(
+	 reference_filename,
+	 reference_filename_length,
+	 &name_length );
+
+	directory_name_length = reference_filename_length - name_length;
+
+	safe_segment_filename = narrow_string_allocate(
+	                         directory_name_length + segment->name_size );
+
+	if( safe_segment_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create segment filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( directory_name_length > 0 )
+	{
+		if( narrow_string_copy(
+		     safe_segment_filename,
+		     reference_filename,
+		     directory_name_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy directory name to segment filename.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( narrow_string_copy(
+	     &( safe_segment_filename[ directory_name_length ] ),
+	     segment->name,
+	     segment->name_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy name to segment filename.",
+		 function );
+
+		goto on_error;
+	}
+	*segment_filename      = safe_segment_filename;
+	*segment_filename_size = directory_name_length + segment->name_size;
+
+	return( 1 );
+
+on_error:
+	if( safe_segment_filename != NULL )
+	{
+		memory_free(
+		 safe_segment_filename );
+	}
+	return( -1 );
+}
+
+/* Reads a manifest file
+ * Returns 1 if successful, 0 if the manifest file does not exist or is not valid or -1 on error
+ */
+int libsmraw_manifest_read(
+     libsmraw_manifest_t *manifest,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	uint8_t file_header[ LIBSMRAW_MANIFEST_FILE_HEADER_SIZE ];
+	uint8_t segment_header[ LIBSMRAW_MANIFEST_SEGMENT_HEADER_SIZE ];
+
+	FILE *file_stream           = NULL;
+	char *name                  = NULL;
+	static char *function       = "libsmraw_manifest_read";
+	size64_t media_size         = 0;
+	size64_t segment_size       = 0;
+	uint32_t format_version     = 0;
+	uint32_t number_of_segments = 0;
+	uint32_t segment_index      = 0;
+	uint16_t name_length        = 0;
+	int64_t modification_time   = 0;
+	int result                  = 1;
+
+	if( manifest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest.",
+		 function );
+
+		return( -1 );
+	}
+	if( manifest->segments != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid manifest - segments value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( HAVE_LIBSMRAW_MANIFEST_SUPPORT )
+	return( 0 );
+#else
+	file_stream = file_stream_open(
+	               filename,
+	               FILE_STREAM_BINARY_OPEN_READ );
+
+	if( file_stream == NULL )
+	{
+		return( 0 );
+	}
+	/* The name buffer can contain the maximum name length and the end of string character
+	 */
+	name = narrow_string_allocate(
+	        UINT16_MAX + 1 );
+
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name.",
+		 function );
+
+		result = -1;
+	}
+	else if( file_stream_read(
+	          file_stream,
+	          file_header,
+	          LIBSMRAW_MANIFEST_FILE_HEADER_SIZE ) != LIBSMRAW_MANIFEST_FILE_HEADER_SIZE )
+	{
+		result = 0;
+	}
+	else if( memory_compare(
+	          file_header,
+	          libsmraw_manifest_signature,
+	          8 ) != 0 )
+	{
+		result = 0;
+	}
+	if( result == 1 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( file_header[ 8 ] ),
+		 format_version );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( file_header[ 12 ] ),
+		 number_of_segments );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( file_header[ 16 ] ),
+		 media_size );
+
+		if( ( format_version != LIBSMRAW_MANIFEST_FORMAT_VERSION )
+		 || ( number_of_segments == 0 )
+		 || ( number_of_segments > (uint32_t) INT_MAX ) )
+		{
+			result = 0;
+		}
+	}
+	for( segment_index = 0;
+	     ( result == 1 ) && ( segment_index < number_of_segments );
+	     segment_index++ )
+	{
+		if( file_stream_read(
+		     file_stream,
+		     segment_header,
+		     LIBSMRAW_MANIFEST_SEGMENT_HEADER_SIZE ) != LIBSMRAW_MANIFEST_SEGMENT_HEADER_SIZE )
+		{
+			result = 0;
+
+			break;
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 &( segment_header[ 0 ] ),
+		 segment_size );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( segment_header[ 8 ] ),
+		 modification_time );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 &( segment_header[ 16 ] ),
+		 name_length );
+
+		if( ( name_length == 0 )
+		 || ( file_stream_read(
+		       file_stream,
+		       name,
+		       (size_t) name_length ) != (size_t) name_length ) )
+		{
+			result = 0;
+
+			break;
+		}
+		name[ name_length ] = 0;
+
+		/* The name is stored without directory
+		 */
+		if( narrow_string_search_character(
+		     name,
+		     '/',
+		     (size_t) name_length ) != NULL )
+		{
+			result = 0;
+
+			break;
+		}
+		if( segment_size > (size64_t) ( UINT64_MAX - manifest->media_size ) )
+		{
+			result = 0;
+
+			break;
+		}
+		if( libsmraw_manifest_append_segment(
+		     manifest,
+		     name,
+		     (size_t) name_length,
+		     segment_size,
+		     modification_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append segment: %" PRIu32 ".",
+			 function,
+			 segment_index );
+
+			result = -1;
+		}
+	}
+	if( ( result == 1 )
+	 && ( media_size != manifest->media_size ) )
+	{
+		result = 0;
+	}
+	if( result == 1 )
+	{
+		manifest->naming_schema = file_header[ 24 ];
+	}
+	if( file_stream_close(
+	     file_stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close manifest file.",
+		 function );
+
+		result = -1;
+	}
+	if( name != NULL )
+	{
+		memory_free(
+		 name );
+	}
+	if( result != 1 )
+	{
+		libsmraw_manifest_clear(
+		 manifest );
+	}
+	return( result );
+#endif /* !defined( HAVE_LIBSMRAW_MANIFEST_SUPPORT ) */
+}
+
+/* Writes a manifest file
+ * The manifest is written to a uniquely named temporary file that replaces the manifest file
+ * so that concurrent readers never observe a partially written manifest and concurrent
+ * writers do not write to the same temporary file
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_manifest_write(
+     libsmraw_manifest_t *manifest,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	uint8_t file_header[ LIBSMRAW_MANIFEST_FILE_HEADER_SIZE ];
+	uint8_t segment_header[ LIBSMRAW_MANIFEST_SEGMENT_HEADER_SIZE ];
+
+	libsmraw_manifest_segment_t *segment = NULL;
+	FILE *file_stream                    = NULL;
+	char *temporary_filename             = NULL;
+	static char *function                = "libsmraw_manifest_write";
+	size_t filename_length               = 0;
+	int segment_index                    = 0;
+
+#if defined( HAVE_MKSTEMP ) && defined( HAVE_FDOPEN )
+	const char *temporary_suffix         = ".XXXXXX";
+	size_t temporary_suffix_length       = 7;
+	int file_descriptor                  = -1;
+#else
+	const char *temporary_suffix         = ".tmp";
+	size_t temporary_suffix_length       = 4;
+#endif
+
+	if( manifest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest.",
+		 function );
+
+		return( -1 );
+	}
+	if( manifest->number_of_segments <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid manifest - missing segments.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( filename_length > (size_t) ( SSIZE_MAX - temporary_suffix_length - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid filename length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	temporary_filename = narrow_string_allocate(
+	                      filename_length + temporary_suffix_length + 1 );
+
+	if( temporary_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create temporary filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_string_copy(
+	     temporary_filename,
+	     filename,
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy filename to temporary filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_string_copy(
+	     &( temporary_filename[ filename_length ] ),
+	     temporary_suffix,
+	     temporary_suffix_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy extension to temporary filename.",
+		 function );
+
+		goto on_error;
+	}
+	temporary_filename[ filename_length + temporary_suffix_length ] = 0;
+
+#if defined( HAVE_MKSTEMP ) && defined( HAVE_FDOPEN )
+	file_descriptor = mkstemp(
+	                   temporary_filename );
+
+	if( file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to create temporary file: %s.",
+		 function,
+		 temporary_filename );
+
+		/* Prevent on_error from removing a file that was not created
+		 */
+		memory_free(
+		 temporary_filename );
+
+		return( -1 );
+	}
+#if defined( HAVE_FCHMOD )
+	/* The temporary file is created readable by the owner only, however the manifest
+	 * should be usable by everyone that can read the segment files
+	 */
+	fchmod(
+	 file_descriptor,
+	 S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH );
+#endif
+	file_stream = fdopen(
+	               file_descriptor,
+	               FILE_STREAM_BINARY_OPEN_WRITE );
+
+	if( file_stream == NULL )
+	{
+		close(
+		 file_descriptor );
+	}
+#else
+	file_stream = file_stream_open(
+	               temporary_filename,
+	               FILE_STREAM_BINARY_OPEN_WRITE );
+#endif
+	if( file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %s.",
+		 function,
+		 temporary_filename );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     file_header,
+	     0,
+	     LIBSMRAW_MANIFEST_FILE_HEADER_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     file_header,
+	     libsmraw_manifest_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature to file header.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( file_header[ 8 ] ),
+	 LIBSMRAW_MANIFEST_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( file_header[ 12 ] ),
+	 (uint32_t) manifest->number_of_segments );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( file_header[ 16 ] ),
+	 manifest->media_size );
+
+	file_header[ 24 ] = manifest->naming_schema;
+
+	if( file_stream_write(
+	     file_stream,
+	     file_header,
+	     LIBSMRAW_MANIFEST_FILE_HEADER_SIZE ) != LIBSMRAW_MANIFEST_FILE_HEADER_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write file header.",
+		 function );
+
+		goto on_error;
+	}
+	for( segment_index = 0;
+	     segment_index < manifest->number_of_segments;
+	     segment_index++ )
+	{
+		segment = &( manifest->segments[ segment_index ] );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( segment_header[ 0 ] ),
+		 segment->size );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( segment_header[ 8 ] ),
+		 (uint64_t) segment->modification_time );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 &( segment_header[ 16 ] ),
+		 (uint16_t) ( segment->name_size - 1 ) );
+
+		if( file_stream_write(
+		     file_stream,
+		     segment_header,
+		     LIBSMRAW_MANIFEST_SEGMENT_HEADER_SIZE ) != LIBSMRAW_MANIFEST_SEGMENT_HEADER_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write segment: %d header.",
+			 function,
+			 segment_index );
+
+			goto on_error;
+		}
+		if( file_stream_write(
+		     file_stream,
+		     segment->name,
+		     segment->name_size - 1 ) != ( segment->name_size - 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write segment: %d name.",
+			 function,
+			 segment_index );
+
+			goto on_error;
+		}
+	}
+	if( file_stream_close(
+	     file_stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file: %s.",
+		 function,
+		 temporary_filename );
+
+		file_stream = NULL;
+
+		goto on_error;
+	}
+	file_stream = NULL;
+
+	if( rename(
+	     temporary_filename,
+	     filename ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to replace file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	memory_free(
+	 temporary_filename );
+
+	return( 1 );
+
+on_error:
+	if( file_stream != NULL )
+	{
+		file_stream_close(
+		 file_stream );
+	}
+	if( temporary_filename != NULL )
+	{
+		remove(
+		 temporary_filename );
+
+		memory_free(
+		 temporary_filename );
+	}
+	return( -1 );
+}
+
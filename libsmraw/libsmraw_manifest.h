@@ -0,0 +1,150 @@
+/*
+ * Segment manifest functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSMRAW_MANIFEST_H )
+#define _LIBSMRAW_MANIFEST_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsmraw_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_SYS_STAT_H ) && defined( HAVE_STAT ) && !defined( WINAPI )
+#define HAVE_LIBSMRAW_MANIFEST_SUPPORT	1
+#endif
+
+extern const uint8_t libsmraw_manifest_signature[ 8 ];
+
+typedef struct libsmraw_manifest_segment libsmraw_manifest_segment_t;
+
+struct libsmraw_manifest_segment
+{
+	/* The segment filename, without the directory
+	 */
+	char *name;
+
+	/* The segment filename size, including the end of string character
+	 */
+	size_t name_size;
+
+	/* The segment file size
+	 */
+	size64_t size;
+
+	/* The segment file modification time in nanoseconds since January 1, 1970 (UTC)
+	 */
+	int64_t modification_time;
+};
+
+typedef struct libsmraw_manifest libsmraw_manifest_t;
+
+struct libsmraw_manifest
+{
+	/* The naming schema
+	 */
+	uint8_t naming_schema;
+
+	/* The segments
+	 */
+	libsmraw_manifest_segment_t *segments;
+
+	/* The number of segments
+	 */
+	int number_of_segments;
+
+	/* The media size
+	 */
+	size64_t media_size;
+};
+
+int libsmraw_manifest_initialize(
+     libsmraw_manifest_t **manifest,
+     libcerror_error_t **error );
+
+int libsmraw_manifest_free(
+     libsmraw_manifest_t **manifest,
+     libcerror_error_t **error );
+
+int libsmraw_manifest_clear(
+     libsmraw_manifest_t *manifest );
+
+int libsmraw_manifest_create_filename(
+     char **manifest_filename,
+     size_t *manifest_filename_size,
+     const char *segment_filename,
+     size_t segment_filename_length,
+     libcerror_error_t **error );
+
+int libsmraw_manifest_get_segment_file_values(
+     const char *filename,
+     size64_t *segment_size,
+     int64_t *modification_time,
+     libcerror_error_t **error );
+
+int libsmraw_manifest_append_segment(
+     libsmraw_manifest_t *manifest,
+     const char *filename,
+     size_t filename_length,
+     size64_t segment_size,
+     int64_t modification_time,
+     libcerror_error_t **error );
+
+int libsmraw_manifest_set_segment_files(
+     libsmraw_manifest_t *manifest,
+     char * const filenames[],
+     int number_of_filenames,
+     libcerror_error_t **error );
+
+int libsmraw_manifest_compare_segment_files(
+     libsmraw_manifest_t *manifest,
+     char * const filenames[],
+     int number_of_filenames,
+     libcerror_error_t **error );
+
+int libsmraw_manifest_get_segment_filename(
+     libsmraw_manifest_t *manifest,
+     int segment_index,
+     const char *reference_filename,
+     size_t reference_filename_length,
+     char **segment_filename,
+     size_t *segment_filename_size,
+     libcerror_error_t **error );
+
+int libsmraw_manifest_read(
+     libsmraw_manifest_t *manifest,
+     const char *filename,
+     libcerror_error_t **error );
+
+int libsmraw_manifest_write(
+     libsmraw_manifest_t *manifest,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSMRAW_MANIFEST_H ) */
+
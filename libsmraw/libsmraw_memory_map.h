@@ -0,0 +1,102 @@
+/*
+ * Memory mapped segment file functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSMRAW_MEMORY_MAP_H )
+#define _LIBSMRAW_MEMORY_MAP_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsmraw_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_SYS_MMAN_H ) && defined( HAVE_MMAP ) && defined( HAVE_MUNMAP ) && !defined( WINAPI )
+#define HAVE_LIBSMRAW_MEMORY_MAP_SUPPORT	1
+#endif
+
+typedef struct libsmraw_memory_map libsmraw_memory_map_t;
+
+struct libsmraw_memory_map
+{
+	/* The mapped data
+	 */
+	uint8_t *data;
+
+	/* The mapped data size
+	 */
+	size_t data_size;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+};
+
+int libsmraw_memory_map_initialize(
+     libsmraw_memory_map_t **memory_map,
+     libcerror_error_t **error );
+
+int libsmraw_memory_map_free(
+     libsmraw_memory_map_t **memory_map,
+     libcerror_error_t **error );
+
+int libsmraw_memory_map_open(
+     libsmraw_memory_map_t *memory_map,
+     const char *filename,
+     libcerror_error_t **error );
+
+int libsmraw_memory_map_close(
+     libsmraw_memory_map_t *memory_map,
+     libcerror_error_t **error );
+
+ssize_t libsmraw_memory_map_read_buffer(
+         libsmraw_memory_map_t *memory_map,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+ssize_t libsmraw_memory_map_read_buffer_at_offset(
+         libsmraw_memory_map_t *memory_map,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+int libsmraw_memory_map_get_data_at_offset(
+     libsmraw_memory_map_t *memory_map,
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
+     libcerror_error_t **error );
+
+off64_t libsmraw_memory_map_seek_offset(
+         libsmraw_memory_map_t *memory_map,
+         off64_t offset,
+         libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSMRAW_MEMORY_MAP_H ) */
+
@@ -0,0 +1,1091 @@
+/*
+ * File IO pool policy functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libsmraw_libbfio.h"
+#include "libsmraw_libcerror.h"
+#include "libsmraw_libcthreads.h"
+#include "libsmraw_pool_policy.h"
+
+/* Creates a pool policy
+ * The pool policy limits the number of open handles of a file IO pool and,
+ * when the limit is reached, closes the handle that was least frequently accessed recently
+ * so that frequently accessed (hot) handles are kept open
+ * Make sure the value pool_policy is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_pool_policy_initialize(
+     libsmraw_pool_policy_t **pool_policy,
+     int number_of_entries,
+     int maximum_number_of_open_handles,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_pool_policy_initialize";
+	int entry_index       = 0;
+
+	if( pool_policy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool policy.",
+		 function );
+
+		return( -1 );
+	}
+	if( *pool_policy != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid pool policy value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_entries <= 0 )
+	 || ( (size_t) number_of_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libsmraw_pool_policy_entry_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_open_handles < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of open handles value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	*pool_policy = memory_allocate_structure(
+	                libsmraw_pool_policy_t );
+
+	if( *pool_policy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create pool policy.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *pool_policy,
+	     0,
+	     sizeof( libsmraw_pool_policy_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear pool policy.",
+		 function );
+
+		memory_free(
+		 *pool_policy );
+
+		*pool_policy = NULL;
+
+		return( -1 );
+	}
+	( *pool_policy )->entries = (libsmraw_pool_policy_entry_t *) memory_allocate(
+	                                                              sizeof( libsmraw_pool_policy_entry_t ) * (size_t) number_of_entries );
+
+	if( ( *pool_policy )->entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *pool_policy )->entries,
+	     0,
+	     sizeof( libsmraw_pool_policy_entry_t ) * (size_t) number_of_entries ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entries.",
+		 function );
+
+		goto on_error;
+	}
+	( *pool_policy )->open_entries = (int *) memory_allocate(
+	                                          sizeof( int ) * (size_t) number_of_entries );
+
+	if( ( *pool_policy )->open_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create open entries.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		( *pool_policy )->entries[ entry_index ].open_index = -1;
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *pool_policy )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *pool_policy )->released_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create released condition.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *pool_policy )->number_of_entries              = number_of_entries;
+	( *pool_policy )->maximum_number_of_open_handles = maximum_number_of_open_handles;
+	( *pool_policy )->access_flags                   = access_flags;
+
+	/* The access counts are halved at least once for every time all entries could have been accessed,
+	 * which keeps the cost of aging constant per access
+	 */
+	( *pool_policy )->aging_interval = (uint64_t) number_of_entries;
+
+	if( ( *pool_policy )->aging_interval < LIBSMRAW_POOL_POLICY_MINIMUM_AGING_INTERVAL )
+	{
+		( *pool_policy )->aging_interval = LIBSMRAW_POOL_POLICY_MINIMUM_AGING_INTERVAL;
+	}
+	return( 1 );
+
+on_error:
+	if( *pool_policy != NULL )
+	{
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+		if( ( *pool_policy )->mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *pool_policy )->mutex ),
+			 NULL );
+		}
+#endif
+		if( ( *pool_policy )->open_entries != NULL )
+		{
+			memory_free(
+			 ( *pool_policy )->open_entries );
+		}
+		if( ( *pool_policy )->entries != NULL )
+		{
+			memory_free(
+			 ( *pool_policy )->entries );
+		}
+		memory_free(
+		 *pool_policy );
+
+		*pool_policy = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a pool policy
+ * The handles opened by the pool policy are not closed
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_pool_policy_free(
+     libsmraw_pool_policy_t **pool_policy,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_pool_policy_free";
+	int result            = 1;
+
+	if( pool_policy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool policy.",
+		 function );
+
+		return( -1 );
+	}
+	if( *pool_policy != NULL )
+	{
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+		if( libcthreads_condition_free(
+		     &( ( *pool_policy )->released_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free released condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( ( *pool_policy )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 ( *pool_policy )->open_entries );
+
+		memory_free(
+		 ( *pool_policy )->entries );
+
+		memory_free(
+		 *pool_policy );
+
+		*pool_policy = NULL;
+	}
+	return( result );
+}
+
+/* Sets the maximum number of open handles
+ * A value of 0 represents an unlimited number of open handles
+ * If the number of open handles exceeds the maximum, handles are closed on the next acquire
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_pool_policy_set_maximum_number_of_open_handles(
+     libsmraw_pool_policy_t *pool_policy,
+     int maximum_number_of_open_handles,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_pool_policy_set_maximum_number_of_open_handles";
+
+	if( pool_policy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool policy.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_open_handles < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of open handles value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     pool_policy->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	pool_policy->maximum_number_of_open_handles = maximum_number_of_open_handles;
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     pool_policy->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Registers an access of an entry
+ * The access counts of all entries are halved every aging interval
+ * so that entries that were frequently accessed in the past do not stay open forever
+ * The caller must hold the mutex
+ */
+void libsmraw_pool_policy_access_entry(
+      libsmraw_pool_policy_t *pool_policy,
+      int entry )
+{
+	int entry_index = 0;
+
+	pool_policy->access_time += 1;
+
+	if( ( pool_policy->access_time % pool_policy->aging_interval ) == 0 )
+	{
+		for( entry_index = 0;
+		     entry_index < pool_policy->number_of_entries;
+		     entry_index++ )
+		{
+			pool_policy->entries[ entry_index ].access_count >>= 1;
+		}
+	}
+	if( pool_policy->entries[ entry ].access_count < UINT32_MAX )
+	{
+		pool_policy->entries[ entry ].access_count += 1;
+	}
+	pool_policy->entries[ entry ].last_access_time = pool_policy->access_time;
+}
+
+/* Determines the open entry to close to make room for another entry
+ * This is the open entry with the lowest access count, or if equal, the least recently accessed,
+ * of the open entries that are not in use
+ * The caller must hold the mutex
+ * Returns the open index of the candidate or -1 if there are no open entries that are not in use
+ */
+int libsmraw_pool_policy_get_eviction_candidate(
+     libsmraw_pool_policy_t *pool_policy )
+{
+	libsmraw_pool_policy_entry_t *candidate_entry = NULL;
+	libsmraw_pool_policy_entry_t *policy_entry    = NULL;
+	int candidate_open_index                      = -1;
+	int open_index                                = 0;
+
+	for( open_index = 0;
+	     open_index < pool_policy->number_of_open_entries;
+	     open_index++ )
+	{
+		policy_entry = &( pool_policy->entries[ pool_policy->open_entries[ open_index ] ] );
+
+		if( policy_entry->use_count > 0 )
+		{
+			continue;
+		}
+		if( ( candidate_entry == NULL )
+		 || ( policy_entry->access_count < candidate_entry->access_count )
+		 || ( ( policy_entry->access_count == candidate_entry->access_count )
+		  &&  ( policy_entry->last_access_time < candidate_entry->last_access_time ) ) )
+		{
+			candidate_entry      = policy_entry;
+			candidate_open_index = open_index;
+		}
+	}
+	return( candidate_open_index );
+}
+
+/* Closes an open entry
+ * The caller must hold the mutex
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_pool_policy_close_entry(
+     libsmraw_pool_policy_t *pool_policy,
+     libbfio_pool_t *file_io_pool,
+     int open_index,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libsmraw_pool_policy_close_entry";
+	int entry                        = 0;
+	int last_entry                   = 0;
+	int result                       = 0;
+
+	if( ( open_index < 0 )
+	 || ( open_index >= pool_policy->number_of_open_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid open index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	entry = pool_policy->open_entries[ open_index ];
+
+	if( libbfio_pool_get_handle(
+	     file_io_pool,
+	     entry,
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file IO handle: %d from pool.",
+		 function,
+		 entry );
+
+		return( -1 );
+	}
+	/* The handle could have been closed outside of the pool policy
+	 */
+	result = libbfio_handle_is_open(
+	          file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if file IO handle: %d is open.",
+		 function,
+		 entry );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libbfio_pool_close(
+		     file_io_pool,
+		     entry,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle: %d.",
+			 function,
+			 entry );
+
+			return( -1 );
+		}
+		pool_policy->number_of_closes += 1;
+	}
+	/* Move the last open entry into the place of the closed entry
+	 */
+	last_entry = pool_policy->open_entries[ pool_policy->number_of_open_entries - 1 ];
+
+	pool_policy->open_entries[ open_index ]       = last_entry;
+	pool_policy->entries[ last_entry ].open_index = open_index;
+	pool_policy->entries[ entry ].open_index      = -1;
+	pool_policy->number_of_open_entries          -= 1;
+
+	return( 1 );
+}
+
+/* Acquires an entry before it is accessed
+ * Opens the handle of the entry if necessary and closes other handles
+ * if the maximum number of open handles would otherwise be exceeded
+ * The entry is in use, and not closed, until it is released
+ * If all open entries are in use this function waits for an entry to be released
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_pool_policy_acquire(
+     libsmraw_pool_policy_t *pool_policy,
+     libbfio_pool_t *file_io_pool,
+     int entry,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libsmraw_pool_policy_acquire";
+	int open_index                   = 0;
+	int result                       = 0;
+
+	if( pool_policy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool policy.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry < 0 )
+	 || ( entry >= pool_policy->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     pool_policy->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	libsmraw_pool_policy_access_entry(
+	 pool_policy,
+	 entry );
+
+	if( pool_policy->entries[ entry ].open_index != -1 )
+	{
+		pool_policy->number_of_hits += 1;
+	}
+	else
+	{
+		/* The entry can be opened by another thread while waiting for an entry to be released
+		 */
+		while( ( pool_policy->entries[ entry ].open_index == -1 )
+		    && ( pool_policy->maximum_number_of_open_handles > 0 )
+		    && ( pool_policy->number_of_open_entries >= pool_policy->maximum_number_of_open_handles ) )
+		{
+			open_index = libsmraw_pool_policy_get_eviction_candidate(
+			              pool_policy );
+
+			if( open_index == -1 )
+			{
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+				if( libcthreads_condition_wait(
+				     pool_policy->released_condition,
+				     pool_policy->mutex,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to wait for released condition.",
+					 function );
+
+					goto on_error;
+				}
+				continue;
+#else
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: all open entries are in use.",
+				 function );
+
+				goto on_error;
+#endif
+			}
+			if( libsmraw_pool_policy_close_entry(
+			     pool_policy,
+			     file_io_pool,
+			     open_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to close least frequently accessed entry.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( pool_policy->entries[ entry ].open_index != -1 )
+		{
+			pool_policy->number_of_hits += 1;
+		}
+	}
+	if( pool_policy->entries[ entry ].open_index == -1 )
+	{
+		if( libbfio_pool_get_handle(
+		     file_io_pool,
+		     entry,
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file IO handle: %d from pool.",
+			 function,
+			 entry );
+
+			goto on_error;
+		}
+		/* The handle could have been opened outside of the pool policy,
+		 * for example to determine the size of the segment file
+		 */
+		result = libbfio_handle_is_open(
+		          file_io_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if file IO handle: %d is open.",
+			 function,
+			 entry );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( libbfio_pool_open(
+			     file_io_pool,
+			     entry,
+			     pool_policy->access_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open file IO handle: %d.",
+				 function,
+				 entry );
+
+				goto on_error;
+			}
+			pool_policy->number_of_opens += 1;
+		}
+		else
+		{
+			pool_policy->number_of_hits += 1;
+		}
+		pool_policy->open_entries[ pool_policy->number_of_open_entries ] = entry;
+		pool_policy->entries[ entry ].open_index                         = pool_policy->number_of_open_entries;
+		pool_policy->number_of_open_entries                             += 1;
+	}
+	pool_policy->entries[ entry ].use_count += 1;
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     pool_policy->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 pool_policy->mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Releases an entry that was acquired after it was accessed
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_pool_policy_release(
+     libsmraw_pool_policy_t *pool_policy,
+     int entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_pool_policy_release";
+	int result            = 1;
+
+	if( pool_policy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool policy.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry < 0 )
+	 || ( entry >= pool_policy->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     pool_policy->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( pool_policy->entries[ entry ].use_count <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry: %d - not in use.",
+		 function,
+		 entry );
+
+		result = -1;
+	}
+	else
+	{
+		pool_policy->entries[ entry ].use_count -= 1;
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+		if( pool_policy->entries[ entry ].use_count == 0 )
+		{
+			if( libcthreads_condition_broadcast(
+			     pool_policy->released_condition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to broadcast released condition.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     pool_policy->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Adds the entries of which the handle is open to the open entries
+ * This is used for handles that were opened before the pool policy was created,
+ * handles that would exceed the maximum number of open handles are closed
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_pool_policy_add_open_entries(
+     libsmraw_pool_policy_t *pool_policy,
+     libbfio_pool_t *file_io_pool,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libsmraw_pool_policy_add_open_entries";
+	int entry                        = 0;
+	int result                       = 0;
+
+	if( pool_policy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool policy.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     pool_policy->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	for( entry = 0;
+	     entry < pool_policy->number_of_entries;
+	     entry++ )
+	{
+		if( pool_policy->entries[ entry ].open_index != -1 )
+		{
+			continue;
+		}
+		if( libbfio_pool_get_handle(
+		     file_io_pool,
+		     entry,
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file IO handle: %d from pool.",
+			 function,
+			 entry );
+
+			goto on_error;
+		}
+		result = libbfio_handle_is_open(
+		          file_io_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if file IO handle: %d is open.",
+			 function,
+			 entry );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		if( ( pool_policy->maximum_number_of_open_handles > 0 )
+		 && ( pool_policy->number_of_open_entries >= pool_policy->maximum_number_of_open_handles ) )
+		{
+			if( libbfio_pool_close(
+			     file_io_pool,
+			     entry,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close file IO handle: %d.",
+				 function,
+				 entry );
+
+				goto on_error;
+			}
+			pool_policy->number_of_closes += 1;
+		}
+		else
+		{
+			pool_policy->open_entries[ pool_policy->number_of_open_entries ] = entry;
+			pool_policy->entries[ entry ].open_index                         = pool_policy->number_of_open_entries;
+			pool_policy->number_of_open_entries                             += 1;
+		}
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     pool_policy->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 pool_policy->mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the pool policy statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_pool_policy_get_statistics(
+     libsmraw_pool_policy_t *pool_policy,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_opens,
+     uint64_t *number_of_closes,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_pool_policy_get_statistics";
+
+	if( pool_policy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool policy.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_hits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of hits.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_opens == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of opens.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_closes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of closes.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     pool_policy->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_hits   = pool_policy->number_of_hits;
+	*number_of_opens  = pool_policy->number_of_opens;
+	*number_of_closes = pool_policy->number_of_closes;
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     pool_policy->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
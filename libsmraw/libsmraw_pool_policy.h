@@ -0,0 +1,178 @@
+/*
+ * File IO pool policy functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSMRAW_POOL_POLICY_H )
+#define _LIBSMRAW_POOL_POLICY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsmraw_libbfio.h"
+#include "libsmraw_libcerror.h"
+#include "libsmraw_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The minimum number of accesses after which the access counts are halved
+ */
+#define LIBSMRAW_POOL_POLICY_MINIMUM_AGING_INTERVAL	1024
+
+typedef struct libsmraw_pool_policy_entry libsmraw_pool_policy_entry_t;
+
+struct libsmraw_pool_policy_entry
+{
+	/* The access count, halved periodically so that it reflects
+	 * how frequently the entry was accessed recently
+	 */
+	uint32_t access_count;
+
+	/* The time of the last access
+	 */
+	uint64_t last_access_time;
+
+	/* The index in the open entries or -1 if not open
+	 */
+	int open_index;
+
+	/* The number of accesses in progress, an entry that is in use is not closed
+	 */
+	int use_count;
+};
+
+typedef struct libsmraw_pool_policy libsmraw_pool_policy_t;
+
+struct libsmraw_pool_policy
+{
+	/* The maximum number of open handles
+	 */
+	int maximum_number_of_open_handles;
+
+	/* The access flags used to open the handles
+	 */
+	int access_flags;
+
+	/* The entries
+	 */
+	libsmraw_pool_policy_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The indexes of the open entries
+	 */
+	int *open_entries;
+
+	/* The number of open entries
+	 */
+	int number_of_open_entries;
+
+	/* The access time, which is incremented on every access
+	 */
+	uint64_t access_time;
+
+	/* The number of accesses after which the access counts are halved
+	 */
+	uint64_t aging_interval;
+
+	/* The number of accesses of an entry that was already open
+	 */
+	uint64_t number_of_hits;
+
+	/* The number of handles opened
+	 */
+	uint64_t number_of_opens;
+
+	/* The number of handles closed
+	 */
+	uint64_t number_of_closes;
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition that is signalled when an entry is no longer in use
+	 */
+	libcthreads_condition_t *released_condition;
+#endif
+};
+
+int libsmraw_pool_policy_initialize(
+     libsmraw_pool_policy_t **pool_policy,
+     int number_of_entries,
+     int maximum_number_of_open_handles,
+     int access_flags,
+     libcerror_error_t **error );
+
+int libsmraw_pool_policy_free(
+     libsmraw_pool_policy_t **pool_policy,
+     libcerror_error_t **error );
+
+int libsmraw_pool_policy_set_maximum_number_of_open_handles(
+     libsmraw_pool_policy_t *pool_policy,
+     int maximum_number_of_open_handles,
+     libcerror_error_t **error );
+
+void libsmraw_pool_policy_access_entry(
+      libsmraw_pool_policy_t *pool_policy,
+      int entry );
+
+int libsmraw_pool_policy_get_eviction_candidate(
+     libsmraw_pool_policy_t *pool_policy );
+
+int libsmraw_pool_policy_close_entry(
+     libsmraw_pool_policy_t *pool_policy,
+     libbfio_pool_t *file_io_pool,
+     int open_index,
+     libcerror_error_t **error );
+
+int libsmraw_pool_policy_acquire(
+     libsmraw_pool_policy_t *pool_policy,
+     libbfio_pool_t *file_io_pool,
+     int entry,
+     libcerror_error_t **error );
+
+int libsmraw_pool_policy_release(
+     libsmraw_pool_policy_t *pool_policy,
+     int entry,
+     libcerror_error_t **error );
+
+int libsmraw_pool_policy_add_open_entries(
+     libsmraw_pool_policy_t *pool_policy,
+     libbfio_pool_t *file_io_pool,
+     libcerror_error_t **error );
+
+int libsmraw_pool_policy_get_statistics(
+     libsmraw_pool_policy_t *pool_policy,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_opens,
+     uint64_t *number_of_closes,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSMRAW_POOL_POLICY_H ) */
+
@@ -0,0 +1,625 @@
+/*
+ * Read-ahead functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libsmraw_direct_file.h"
+#include "libsmraw_libcerror.h"
+#include "libsmraw_libcthreads.h"
+#include "libsmraw_read_ahead.h"
+#include "libsmraw_read_queue.h"
+#include "libsmraw_types.h"
+
+/* Creates a read-ahead
+ * The prefetch function is called from the prefetch thread and can read less data than requested
+ * Make sure the value read_ahead is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_read_ahead_initialize(
+     libsmraw_read_ahead_t **read_ahead,
+     size_t window_size,
+     ssize_t (*read_function)(
+                intptr_t *data_handle,
+                void *buffer,
+                size_t buffer_size,
+                off64_t offset,
+                libcerror_error_t **error ),
+     ssize_t (*prefetch_function)(
+                intptr_t *data_handle,
+                void *buffer,
+                size_t buffer_size,
+                off64_t offset,
+                libcerror_error_t **error ),
+     intptr_t *data_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_read_ahead_initialize";
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_ahead != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid read-ahead value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( window_size == 0 )
+	 || ( window_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid window size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read function.",
+		 function );
+
+		return( -1 );
+	}
+	if( prefetch_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid prefetch function.",
+		 function );
+
+		return( -1 );
+	}
+	*read_ahead = memory_allocate_structure(
+	               libsmraw_read_ahead_t );
+
+	if( *read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read-ahead.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *read_ahead,
+	     0,
+	     sizeof( libsmraw_read_ahead_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read-ahead.",
+		 function );
+
+		memory_free(
+		 *read_ahead );
+
+		*read_ahead = NULL;
+
+		return( -1 );
+	}
+	( *read_ahead )->data = (uint8_t *) libsmraw_direct_file_allocate_buffer(
+	                                     sizeof( uint8_t ) * window_size );
+
+	if( ( *read_ahead )->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	( *read_ahead )->prefetch_data = (uint8_t *) libsmraw_direct_file_allocate_buffer(
+	                                              sizeof( uint8_t ) * window_size );
+
+	if( ( *read_ahead )->prefetch_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create prefetch data.",
+		 function );
+
+		goto on_error;
+	}
+	/* A single thread is sufficient since at most one prefetch is pending
+	 */
+	if( libsmraw_read_queue_initialize(
+	     &( ( *read_ahead )->read_queue ),
+	     1,
+	     prefetch_function,
+	     data_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read queue.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *read_ahead )->window_size   = window_size;
+	( *read_ahead )->read_function = read_function;
+	( *read_ahead )->data_handle   = data_handle;
+
+	return( 1 );
+
+on_error:
+	if( *read_ahead != NULL )
+	{
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+		if( ( *read_ahead )->prefetch_data != NULL )
+		{
+			memory_free(
+			 ( *read_ahead )->prefetch_data );
+		}
+#endif
+		if( ( *read_ahead )->data != NULL )
+		{
+			memory_free(
+			 ( *read_ahead )->data );
+		}
+		memory_free(
+		 *read_ahead );
+
+		*read_ahead = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a read-ahead
+ * This waits for a pending prefetch to complete
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_read_ahead_free(
+     libsmraw_read_ahead_t **read_ahead,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_read_ahead_free";
+	int result            = 1;
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_ahead != NULL )
+	{
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+		if( libsmraw_read_queue_free(
+		     &( ( *read_ahead )->read_queue ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read queue.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 ( *read_ahead )->prefetch_data );
+#endif
+		memory_free(
+		 ( *read_ahead )->data );
+
+		memory_free(
+		 *read_ahead );
+
+		*read_ahead = NULL;
+	}
+	return( result );
+}
+
+/* Reads data at a specific offset
+ * Sequential reads are served from the read-ahead window, other reads are passed through
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libsmraw_read_ahead_read_buffer(
+         libsmraw_read_ahead_t *read_ahead,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         size64_t media_size,
+         libcerror_error_t **error )
+{
+	static char *function = "libsmraw_read_ahead_read_buffer";
+	size_t buffer_offset  = 0;
+	size_t data_offset    = 0;
+	size_t read_size      = 0;
+	ssize_t read_count    = 0;
+	uint8_t is_sequential = 0;
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset == read_ahead->sequential_offset )
+	{
+		is_sequential = 1;
+	}
+	while( buffer_offset < buffer_size )
+	{
+		if( (size64_t) offset >= media_size )
+		{
+			break;
+		}
+		if( ( offset >= read_ahead->data_offset )
+		 && ( offset < ( read_ahead->data_offset + (off64_t) read_ahead->data_size ) ) )
+		{
+			data_offset = (size_t) ( offset - read_ahead->data_offset );
+			read_size   = read_ahead->data_size - data_offset;
+
+			if( read_size > ( buffer_size - buffer_offset ) )
+			{
+				read_size = buffer_size - buffer_offset;
+			}
+			if( memory_copy(
+			     &( buffer[ buffer_offset ] ),
+			     &( read_ahead->data[ data_offset ] ),
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy data.",
+				 function );
+
+				return( -1 );
+			}
+			offset        += (off64_t) read_size;
+			buffer_offset += read_size;
+
+			continue;
+		}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+		if( read_ahead->prefetch_pending != 0 )
+		{
+			if( libsmraw_read_ahead_wait_for_prefetch(
+			     read_ahead,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to wait for prefetch.",
+				 function );
+
+				return( -1 );
+			}
+			continue;
+		}
+#endif
+		read_size = buffer_size - buffer_offset;
+
+		/* Non-sequential reads and reads that are larger than the window
+		 * are read directly into the buffer
+		 */
+		if( ( is_sequential == 0 )
+		 || ( read_size >= read_ahead->window_size ) )
+		{
+			read_count = read_ahead->read_function(
+			              read_ahead->data_handle,
+			              &( buffer[ buffer_offset ] ),
+			              read_size,
+			              offset,
+			              error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 offset,
+				 offset );
+
+				return( -1 );
+			}
+			offset        += (off64_t) read_count;
+			buffer_offset += (size_t) read_count;
+
+			break;
+		}
+		read_size = read_ahead->window_size;
+
+		if( (size64_t) read_size > ( media_size - (size64_t) offset ) )
+		{
+			read_size = (size_t) ( media_size - (size64_t) offset );
+		}
+		read_ahead->data_size = 0;
+
+		read_count = read_ahead->read_function(
+		              read_ahead->data_handle,
+		              read_ahead->data,
+		              read_size,
+		              offset,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read window at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			return( -1 );
+		}
+		if( read_count == 0 )
+		{
+			break;
+		}
+		read_ahead->data_offset = offset;
+		read_ahead->data_size   = (size_t) read_count;
+	}
+	read_ahead->sequential_offset = offset;
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( ( is_sequential != 0 )
+	 && ( read_ahead->prefetch_pending == 0 ) )
+	{
+		if( libsmraw_read_ahead_start_prefetch(
+		     read_ahead,
+		     media_size,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to start prefetch.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( (ssize_t) buffer_offset );
+}
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+
+/* Waits for a pending prefetch to complete
+ * If the prefetch was successful its data becomes the read-ahead window
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_read_ahead_wait_for_prefetch(
+     libsmraw_read_ahead_t *read_ahead,
+     libcerror_error_t **error )
+{
+	uint8_t *data         = NULL;
+	static char *function = "libsmraw_read_ahead_wait_for_prefetch";
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_ahead->prefetch_pending == 0 )
+	{
+		return( 1 );
+	}
+	if( libsmraw_read_queue_wait(
+	     read_ahead->read_queue,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to wait for read queue.",
+		 function );
+
+		return( -1 );
+	}
+	read_ahead->prefetch_pending = 0;
+
+	/* A failed prefetch is ignored, the subsequent read will report the error
+	 */
+	if( read_ahead->prefetch_read_request.read_count > 0 )
+	{
+		data                      = read_ahead->data;
+		read_ahead->data          = read_ahead->prefetch_data;
+		read_ahead->prefetch_data = data;
+
+		read_ahead->data_offset = read_ahead->prefetch_read_request.offset;
+		read_ahead->data_size   = (size_t) read_ahead->prefetch_read_request.read_count;
+	}
+	return( 1 );
+}
+
+/* Starts prefetching the window that follows the current one in the background
+ * Returns 1 if successful, 0 if there is nothing to prefetch or -1 on error
+ */
+int libsmraw_read_ahead_start_prefetch(
+     libsmraw_read_ahead_t *read_ahead,
+     size64_t media_size,
+     libcerror_error_t **error )
+{
+	static char *function   = "libsmraw_read_ahead_start_prefetch";
+	off64_t prefetch_offset = 0;
+	size_t prefetch_size    = 0;
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_ahead->prefetch_pending != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid read-ahead - prefetch already pending.",
+		 function );
+
+		return( -1 );
+	}
+	prefetch_offset = read_ahead->data_offset + (off64_t) read_ahead->data_size;
+
+	/* The window is stale when the last read bypassed it
+	 */
+	if( ( read_ahead->sequential_offset < read_ahead->data_offset )
+	 || ( read_ahead->sequential_offset > prefetch_offset ) )
+	{
+		prefetch_offset = read_ahead->sequential_offset;
+	}
+	if( (size64_t) prefetch_offset >= media_size )
+	{
+		return( 0 );
+	}
+	prefetch_size = read_ahead->window_size;
+
+	if( (size64_t) prefetch_size > ( media_size - (size64_t) prefetch_offset ) )
+	{
+		prefetch_size = (size_t) ( media_size - (size64_t) prefetch_offset );
+	}
+	read_ahead->prefetch_read_request.offset      = prefetch_offset;
+	read_ahead->prefetch_read_request.buffer      = read_ahead->prefetch_data;
+	read_ahead->prefetch_read_request.buffer_size = prefetch_size;
+	read_ahead->prefetch_read_request.read_count  = 0;
+
+	if( libsmraw_read_queue_push(
+	     read_ahead->read_queue,
+	     &( read_ahead->prefetch_read_request ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push prefetch read request onto read queue.",
+		 function );
+
+		return( -1 );
+	}
+	read_ahead->prefetch_pending = 1;
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT ) */
+
@@ -0,0 +1,141 @@
+/*
+ * Read-ahead functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSMRAW_READ_AHEAD_H )
+#define _LIBSMRAW_READ_AHEAD_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsmraw_libcerror.h"
+#include "libsmraw_libcthreads.h"
+#include "libsmraw_read_queue.h"
+#include "libsmraw_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libsmraw_read_ahead libsmraw_read_ahead_t;
+
+struct libsmraw_read_ahead
+{
+	/* The window size
+	 */
+	size_t window_size;
+
+	/* The data handle
+	 */
+	intptr_t *data_handle;
+
+	/* The read function
+	 */
+	ssize_t (*read_function)(
+	           intptr_t *data_handle,
+	           void *buffer,
+	           size_t buffer_size,
+	           off64_t offset,
+	           libcerror_error_t **error );
+
+	/* The window data
+	 */
+	uint8_t *data;
+
+	/* The offset of the window data
+	 */
+	off64_t data_offset;
+
+	/* The size of the window data
+	 */
+	size_t data_size;
+
+	/* The offset at which the next sequential read is expected
+	 */
+	off64_t sequential_offset;
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	/* The prefetch data
+	 */
+	uint8_t *prefetch_data;
+
+	/* The prefetch read request
+	 */
+	libsmraw_read_request_t prefetch_read_request;
+
+	/* Value to indicate a prefetch read request is pending
+	 */
+	uint8_t prefetch_pending;
+
+	/* The read queue used to prefetch in the background
+	 */
+	libsmraw_read_queue_t *read_queue;
+#endif
+};
+
+int libsmraw_read_ahead_initialize(
+     libsmraw_read_ahead_t **read_ahead,
+     size_t window_size,
+     ssize_t (*read_function)(
+                intptr_t *data_handle,
+                void *buffer,
+                size_t buffer_size,
+                off64_t offset,
+                libcerror_error_t **error ),
+     ssize_t (*prefetch_function)(
+                intptr_t *data_handle,
+                void *buffer,
+                size_t buffer_size,
+                off64_t offset,
+                libcerror_error_t **error ),
+     intptr_t *data_handle,
+     libcerror_error_t **error );
+
+int libsmraw_read_ahead_free(
+     libsmraw_read_ahead_t **read_ahead,
+     libcerror_error_t **error );
+
+ssize_t libsmraw_read_ahead_read_buffer(
+         libsmraw_read_ahead_t *read_ahead,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         size64_t media_size,
+         libcerror_error_t **error );
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+
+int libsmraw_read_ahead_wait_for_prefetch(
+     libsmraw_read_ahead_t *read_ahead,
+     libcerror_error_t **error );
+
+int libsmraw_read_ahead_start_prefetch(
+     libsmraw_read_ahead_t *read_ahead,
+     size64_t media_size,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSMRAW_READ_AHEAD_H ) */
+
@@ -0,0 +1,517 @@
+/*
+ * Read queue functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libsmraw_definitions.h"
+#include "libsmraw_libcerror.h"
+#include "libsmraw_libcthreads.h"
+#include "libsmraw_read_queue.h"
+#include "libsmraw_types.h"
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+
+/* Creates a read queue
+ * Make sure the value read_queue is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_read_queue_initialize(
+     libsmraw_read_queue_t **read_queue,
+     int number_of_threads,
+     ssize_t (*read_function)(
+                intptr_t *data_handle,
+                void *buffer,
+                size_t buffer_size,
+                off64_t offset,
+                libcerror_error_t **error ),
+     intptr_t *data_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_read_queue_initialize";
+
+	if( read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_queue != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid read queue value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of threads value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read function.",
+		 function );
+
+		return( -1 );
+	}
+	*read_queue = memory_allocate_structure(
+	               libsmraw_read_queue_t );
+
+	if( *read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read queue.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *read_queue,
+	     0,
+	     sizeof( libsmraw_read_queue_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read queue.",
+		 function );
+
+		memory_free(
+		 *read_queue );
+
+		*read_queue = NULL;
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_initialize(
+	     &( ( *read_queue )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *read_queue )->completed_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create completed condition.",
+		 function );
+
+		goto on_error;
+	}
+	( *read_queue )->read_function = read_function;
+	( *read_queue )->data_handle   = data_handle;
+
+	if( libcthreads_thread_pool_create(
+	     &( ( *read_queue )->thread_pool ),
+	     NULL,
+	     number_of_threads,
+	     LIBSMRAW_MAXIMUM_NUMBER_OF_QUEUED_READ_REQUESTS,
+	     (int (*)(intptr_t *, void *)) &libsmraw_read_queue_process_read_request,
+	     (void *) *read_queue,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *read_queue != NULL )
+	{
+		if( ( *read_queue )->completed_condition != NULL )
+		{
+			libcthreads_condition_free(
+			 &( ( *read_queue )->completed_condition ),
+			 NULL );
+		}
+		if( ( *read_queue )->mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *read_queue )->mutex ),
+			 NULL );
+		}
+		memory_free(
+		 *read_queue );
+
+		*read_queue = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a read queue
+ * This waits for the pending read requests to complete
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_read_queue_free(
+     libsmraw_read_queue_t **read_queue,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_read_queue_free";
+	int result            = 1;
+
+	if( read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_queue != NULL )
+	{
+		if( ( *read_queue )->thread_pool != NULL )
+		{
+			if( libcthreads_thread_pool_join(
+			     &( ( *read_queue )->thread_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libcthreads_condition_free(
+		     &( ( *read_queue )->completed_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free completed condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( ( *read_queue )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *read_queue );
+
+		*read_queue = NULL;
+	}
+	return( result );
+}
+
+/* Processes a read request
+ * Callback function for the thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_read_queue_process_read_request(
+     libsmraw_read_request_t *read_request,
+     libsmraw_read_queue_t *read_queue )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "libsmraw_read_queue_process_read_request";
+	ssize_t read_count       = 0;
+	int result               = 1;
+
+	if( read_request == NULL )
+	{
+		return( -1 );
+	}
+	if( read_queue == NULL )
+	{
+		read_request->read_count = -1;
+
+		return( -1 );
+	}
+	read_count = read_queue->read_function(
+	              read_queue->data_handle,
+	              read_request->buffer,
+	              read_request->buffer_size,
+	              read_request->offset,
+	              &error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_free(
+		 &error );
+
+		read_count = -1;
+		result     = -1;
+	}
+	if( libcthreads_mutex_grab(
+	     read_queue->mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		read_request->read_count = -1;
+
+		return( -1 );
+	}
+	read_request->read_count = read_count;
+
+	read_queue->number_of_pending_read_requests -= 1;
+
+	if( libcthreads_condition_broadcast(
+	     read_queue->completed_condition,
+	     &error ) != 1 )
+	{
+		libcerror_error_free(
+		 &error );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     read_queue->mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_free(
+		 &error );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Pushes a read request onto the queue
+ * The read request must remain valid until it has completed
+ * This function blocks when the maximum number of queued read requests is reached
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_read_queue_push(
+     libsmraw_read_queue_t *read_queue,
+     libsmraw_read_request_t *read_request,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_read_queue_push";
+
+	if( read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read request.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     read_queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	read_request->read_count = 0;
+
+	read_queue->number_of_pending_read_requests += 1;
+
+	if( libcthreads_mutex_release(
+	     read_queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_thread_pool_push(
+	     read_queue->thread_pool,
+	     (intptr_t *) read_request,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push read request onto thread pool queue.",
+		 function );
+
+		if( libcthreads_mutex_grab(
+		     read_queue->mutex,
+		     NULL ) == 1 )
+		{
+			read_queue->number_of_pending_read_requests -= 1;
+
+			libcthreads_mutex_release(
+			 read_queue->mutex,
+			 NULL );
+		}
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Waits until all pending read requests have completed
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_read_queue_wait(
+     libsmraw_read_queue_t *read_queue,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_read_queue_wait";
+	int result            = 1;
+
+	if( read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     read_queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( read_queue->number_of_pending_read_requests > 0 )
+	{
+		if( libcthreads_condition_wait(
+		     read_queue->completed_condition,
+		     read_queue->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for completed condition.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     read_queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT ) */
+
@@ -0,0 +1,108 @@
+/*
+ * Read queue functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSMRAW_READ_QUEUE_H )
+#define _LIBSMRAW_READ_QUEUE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsmraw_libcerror.h"
+#include "libsmraw_libcthreads.h"
+#include "libsmraw_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+
+typedef struct libsmraw_read_queue libsmraw_read_queue_t;
+
+struct libsmraw_read_queue
+{
+	/* The data handle
+	 */
+	intptr_t *data_handle;
+
+	/* The read function
+	 */
+	ssize_t (*read_function)(
+	           intptr_t *data_handle,
+	           void *buffer,
+	           size_t buffer_size,
+	           off64_t offset,
+	           libcerror_error_t **error );
+
+	/* The number of pending read requests
+	 */
+	int number_of_pending_read_requests;
+
+	/* The thread pool
+	 */
+	libcthreads_thread_pool_t *thread_pool;
+
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition signalled when a read request has completed
+	 */
+	libcthreads_condition_t *completed_condition;
+};
+
+int libsmraw_read_queue_initialize(
+     libsmraw_read_queue_t **read_queue,
+     int number_of_threads,
+     ssize_t (*read_function)(
+                intptr_t *data_handle,
+                void *buffer,
+                size_t buffer_size,
+                off64_t offset,
+                libcerror_error_t **error ),
+     intptr_t *data_handle,
+     libcerror_error_t **error );
+
+int libsmraw_read_queue_free(
+     libsmraw_read_queue_t **read_queue,
+     libcerror_error_t **error );
+
+int libsmraw_read_queue_process_read_request(
+     libsmraw_read_request_t *read_request,
+     libsmraw_read_queue_t *read_queue );
+
+int libsmraw_read_queue_push(
+     libsmraw_read_queue_t *read_queue,
+     libsmraw_read_request_t *read_request,
+     libcerror_error_t **error );
+
+int libsmraw_read_queue_wait(
+     libsmraw_read_queue_t *read_queue,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSMRAW_READ_QUEUE_H ) */
+
@@ -0,0 +1,764 @@
+/*
+ * Segment table functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libsmraw_definitions.h"
+#include "libsmraw_libcerror.h"
+#include "libsmraw_libcthreads.h"
+#include "libsmraw_segment_table.h"
+
+/* Creates a segment table
+ * Make sure the value segment_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_segment_table_initialize(
+     libsmraw_segment_table_t **segment_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_segment_table_initialize";
+
+	if( segment_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *segment_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid segment table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*segment_table = memory_allocate_structure(
+	                  libsmraw_segment_table_t );
+
+	if( *segment_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create segment table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *segment_table,
+	     0,
+	     sizeof( libsmraw_segment_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear segment table.",
+		 function );
+
+		goto on_error;
+	}
+	( *segment_table )->segment_offsets = (off64_t *) memory_allocate(
+	                                                   sizeof( off64_t ) );
+
+	if( ( *segment_table )->segment_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create segment offsets.",
+		 function );
+
+		goto on_error;
+	}
+	( *segment_table )->segment_offsets[ 0 ] = 0;
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *segment_table )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *segment_table != NULL )
+	{
+		if( ( *segment_table )->segment_offsets != NULL )
+		{
+			memory_free(
+			 ( *segment_table )->segment_offsets );
+		}
+		memory_free(
+		 *segment_table );
+
+		*segment_table = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a segment table
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_segment_table_free(
+     libsmraw_segment_table_t **segment_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_segment_table_free";
+	int result            = 1;
+
+	if( segment_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *segment_table != NULL )
+	{
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *segment_table )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( ( *segment_table )->segment_flags != NULL )
+		{
+			memory_free(
+			 ( *segment_table )->segment_flags );
+		}
+		memory_free(
+		 ( *segment_table )->segment_offsets );
+
+		memory_free(
+		 *segment_table );
+
+		*segment_table = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves the number of segments
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_segment_table_get_number_of_segments(
+     libsmraw_segment_table_t *segment_table,
+     int *number_of_segments,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_segment_table_get_number_of_segments";
+
+	if( segment_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment table.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_segments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of segments.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_segments = segment_table->number_of_segments;
+
+	return( 1 );
+}
+
+/* Retrieves the size of all segments
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_segment_table_get_size(
+     libsmraw_segment_table_t *segment_table,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_segment_table_get_size";
+
+	if( segment_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment table.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	*size = (size64_t) segment_table->segment_offsets[ segment_table->number_of_segments ];
+
+	return( 1 );
+}
+
+/* Appends a segment
+ * The segment flags are LIBSMRAW_SEGMENT_FLAG_SIZE_INFERRED if the segment size was not determined from the segment file
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_segment_table_append_segment(
+     libsmraw_segment_table_t *segment_table,
+     size64_t segment_size,
+     uint8_t segment_flags,
+     libcerror_error_t **error )
+{
+	off64_t *reallocation            = NULL;
+	uint8_t *flags_reallocation      = NULL;
+	static char *function            = "libsmraw_segment_table_append_segment";
+	size64_t previous_segment_size   = 0;
+	off64_t segment_offset           = 0;
+	int number_of_allocated_segments = 0;
+
+	if( segment_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment table.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_table->number_of_segments >= ( INT_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid segment table - number of segments value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	segment_offset = segment_table->segment_offsets[ segment_table->number_of_segments ];
+
+	if( segment_size > (size64_t) ( INT64_MAX - segment_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid segment size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_table->number_of_segments >= segment_table->number_of_allocated_segments )
+	{
+		/* Grow the segment offsets exponentially to keep appending amortized constant time
+		 */
+		if( segment_table->number_of_allocated_segments == 0 )
+		{
+			number_of_allocated_segments = 64;
+		}
+		else if( segment_table->number_of_allocated_segments > ( ( INT_MAX - 1 ) / 2 ) )
+		{
+			number_of_allocated_segments = INT_MAX - 1;
+		}
+		else
+		{
+			number_of_allocated_segments = segment_table->number_of_allocated_segments * 2;
+		}
+		if( ( sizeof( off64_t ) * ( (size_t) number_of_allocated_segments + 1 ) ) > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: invalid segment offsets size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = (off64_t *) memory_reallocate(
+		                            segment_table->segment_offsets,
+		                            sizeof( off64_t ) * ( (size_t) number_of_allocated_segments + 1 ) );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize segment offsets.",
+			 function );
+
+			return( -1 );
+		}
+		segment_table->segment_offsets = reallocation;
+
+		flags_reallocation = (uint8_t *) memory_reallocate(
+		                                  segment_table->segment_flags,
+		                                  sizeof( uint8_t ) * (size_t) number_of_allocated_segments );
+
+		if( flags_reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize segment flags.",
+			 function );
+
+			return( -1 );
+		}
+		segment_table->segment_flags                = flags_reallocation;
+		segment_table->number_of_allocated_segments = number_of_allocated_segments;
+	}
+	/* The segments have a uniform size when all segments, except the last,
+	 * have the size of the first segment and the last segment is not larger
+	 */
+	if( segment_table->number_of_segments == 0 )
+	{
+		segment_table->uniform_segment_size = segment_size;
+	}
+	else if( segment_table->uniform_segment_size != 0 )
+	{
+		previous_segment_size = (size64_t) ( segment_offset - segment_table->segment_offsets[ segment_table->number_of_segments - 1 ] );
+
+		if( ( previous_segment_size != segment_table->uniform_segment_size )
+		 || ( segment_size > segment_table->uniform_segment_size ) )
+		{
+			segment_table->uniform_segment_size = 0;
+		}
+	}
+	if( ( segment_flags & LIBSMRAW_SEGMENT_FLAG_SIZE_INFERRED ) != 0 )
+	{
+		segment_table->has_inferred_segment_sizes = 1;
+	}
+	segment_table->segment_flags[ segment_table->number_of_segments ] = segment_flags;
+
+	segment_table->number_of_segments += 1;
+
+	segment_table->segment_offsets[ segment_table->number_of_segments ] = segment_offset + (off64_t) segment_size;
+
+	return( 1 );
+}
+
+/* Retrieves the flags of a specific segment
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_segment_table_get_segment_flags(
+     libsmraw_segment_table_t *segment_table,
+     int segment_index,
+     uint8_t *segment_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_segment_table_get_segment_flags";
+
+	if( segment_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( segment_index < 0 )
+	 || ( segment_index >= segment_table->number_of_segments ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segment index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment flags.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     segment_table->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*segment_flags = segment_table->segment_flags[ segment_index ];
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     segment_table->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the flags of a specific segment
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_segment_table_set_segment_flags(
+     libsmraw_segment_table_t *segment_table,
+     int segment_index,
+     uint8_t segment_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_segment_table_set_segment_flags";
+
+	if( segment_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( segment_index < 0 )
+	 || ( segment_index >= segment_table->number_of_segments ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segment index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     segment_table->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	segment_table->segment_flags[ segment_index ] = segment_flags;
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     segment_table->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Verifies the inferred size of a specific segment against the size of its segment file
+ * The segment flags are checked and updated while holding the mutex,
+ * so that concurrent readers can verify the same segment
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_segment_table_verify_segment_size(
+     libsmraw_segment_table_t *segment_table,
+     int segment_index,
+     size64_t segment_file_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_segment_table_verify_segment_size";
+	size64_t segment_size = 0;
+	int result            = 1;
+
+	if( segment_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( segment_index < 0 )
+	 || ( segment_index >= segment_table->number_of_segments ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segment index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     segment_table->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( segment_table->segment_flags[ segment_index ] & LIBSMRAW_SEGMENT_FLAG_SIZE_INFERRED ) != 0 )
+	{
+		segment_size = (size64_t) ( segment_table->segment_offsets[ segment_index + 1 ] - segment_table->segment_offsets[ segment_index ] );
+
+		if( segment_file_size != segment_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: size of segment file: %d does not match inferred size.",
+			 function,
+			 segment_index );
+
+			result = -1;
+		}
+		else
+		{
+			segment_table->segment_flags[ segment_index ] &= ~( LIBSMRAW_SEGMENT_FLAG_SIZE_INFERRED );
+		}
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     segment_table->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the segment that contains a specific offset
+ * The segment is determined by division when the segments have a uniform size
+ * and by a binary search of the segment offsets otherwise
+ * Returns 1 if successful, 0 if the offset is beyond the end of the last segment or -1 on error
+ */
+int libsmraw_segment_table_get_segment_at_offset(
+     libsmraw_segment_table_t *segment_table,
+     off64_t offset,
+     int *segment_index,
+     off64_t *segment_data_offset,
+     size64_t *segment_size,
+     libcerror_error_t **error )
+{
+	static char *function  = "libsmraw_segment_table_get_segment_at_offset";
+	int maximum_index      = 0;
+	int middle_index       = 0;
+	int minimum_index      = 0;
+	int safe_segment_index = 0;
+
+	if( segment_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment table.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment index.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment size.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset >= segment_table->segment_offsets[ segment_table->number_of_segments ] )
+	{
+		return( 0 );
+	}
+	if( segment_table->uniform_segment_size != 0 )
+	{
+		safe_segment_index = (int) ( (size64_t) offset / segment_table->uniform_segment_size );
+	}
+	else
+	{
+		/* Find the last segment that starts at or before the offset,
+		 * which skips empty segments
+		 */
+		minimum_index = 0;
+		maximum_index = segment_table->number_of_segments - 1;
+
+		while( minimum_index < maximum_index )
+		{
+			middle_index = minimum_index + ( ( maximum_index - minimum_index + 1 ) / 2 );
+
+			if( segment_table->segment_offsets[ middle_index ] <= offset )
+			{
+				minimum_index = middle_index;
+			}
+			else
+			{
+				maximum_index = middle_index - 1;
+			}
+		}
+		safe_segment_index = minimum_index;
+	}
+	*segment_index       = safe_segment_index;
+	*segment_data_offset = offset - segment_table->segment_offsets[ safe_segment_index ];
+	*segment_size        = (size64_t) ( segment_table->segment_offsets[ safe_segment_index + 1 ] - segment_table->segment_offsets[ safe_segment_index ] );
+
+	return( 1 );
+}
+
@@ -0,0 +1,127 @@
+/*
+ * Segment table functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSMRAW_SEGMENT_TABLE_H )
+#define _LIBSMRAW_SEGMENT_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsmraw_libcerror.h"
+#include "libsmraw_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libsmraw_segment_table libsmraw_segment_table_t;
+
+struct libsmraw_segment_table
+{
+	/* The segment offsets, contains the start offset of every segment
+	 * followed by the end offset of the last segment
+	 */
+	off64_t *segment_offsets;
+
+	/* The number of segments
+	 */
+	int number_of_segments;
+
+	/* The number of allocated segments
+	 */
+	int number_of_allocated_segments;
+
+	/* The size shared by all segments, where the last segment can be smaller,
+	 * 0 if the segments differ in size
+	 */
+	size64_t uniform_segment_size;
+
+	/* The segment flags
+	 */
+	uint8_t *segment_flags;
+
+	/* Value to indicate the size of one or more segments was inferred
+	 */
+	uint8_t has_inferred_segment_sizes;
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	/* The mutex that protects the segment flags
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libsmraw_segment_table_initialize(
+     libsmraw_segment_table_t **segment_table,
+     libcerror_error_t **error );
+
+int libsmraw_segment_table_free(
+     libsmraw_segment_table_t **segment_table,
+     libcerror_error_t **error );
+
+int libsmraw_segment_table_get_number_of_segments(
+     libsmraw_segment_table_t *segment_table,
+     int *number_of_segments,
+     libcerror_error_t **error );
+
+int libsmraw_segment_table_get_size(
+     libsmraw_segment_table_t *segment_table,
+     size64_t *size,
+     libcerror_error_t **error );
+
+int libsmraw_segment_table_append_segment(
+     libsmraw_segment_table_t *segment_table,
+     size64_t segment_size,
+     uint8_t segment_flags,
+     libcerror_error_t **error );
+
+int libsmraw_segment_table_get_segment_flags(
+     libsmraw_segment_table_t *segment_table,
+     int segment_index,
+     uint8_t *segment_flags,
+     libcerror_error_t **error );
+
+int libsmraw_segment_table_set_segment_flags(
+     libsmraw_segment_table_t *segment_table,
+     int segment_index,
+     uint8_t segment_flags,
+     libcerror_error_t **error );
+
+int libsmraw_segment_table_verify_segment_size(
+     libsmraw_segment_table_t *segment_table,
+     int segment_index,
+     size64_t segment_file_size,
+     libcerror_error_t **error );
+
+int libsmraw_segment_table_get_segment_at_offset(
+     libsmraw_segment_table_t *segment_table,
+     off64_t offset,
+     int *segment_index,
+     off64_t *segment_data_offset,
+     size64_t *segment_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSMRAW_SEGMENT_TABLE_H ) */
+
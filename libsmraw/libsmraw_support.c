@@ -26,9 +26,11 @@
 #include <wide_string.h>
 
 #include "libsmraw_definitions.h"
+#include "libsmraw_directory_listing.h"
 #include "libsmraw_libbfio.h"
 #include "libsmraw_libcerror.h"
 #include "libsmraw_libclocale.h"
+#include "libsmraw_manifest.h"
 #include "libsmraw_support.h"
 
 #if !defined( HAVE_LOCAL_LIBSMRAW )
@@ -190,10 +192,13 @@ int libsmraw_glob_append_segment_file(
 
 /* Determines if a segment file exists
  * The segment filename is made up from the prefix and the suffix
+ * If a directory listing is provided the segment file is looked up in the listing first
+ * and only accessed if the listing does not contain it
  * Returns 1 if segment file exists, 0 if not or -1 on error
  */
 int libsmraw_glob_exists_segment_file(
      libbfio_handle_t *file_io_handle,
+     libsmraw_directory_listing_t *directory_listing,
      const char *prefix,
      size_t prefix_length,
      const char *suffix,
@@ -331,47 +336,339 @@ int libsmraw_glob_exists_segment_file(
 		}
 		safe_segment_filename[ prefix_length + suffix_length ] = 0;
 	}
-	if( libbfio_file_set_name(
-	     file_io_handle,
-	     safe_segment_filename,
-	     safe_segment_filename_size - 1,
+	if( directory_listing != NULL )
+	{
+		result = libsmraw_directory_listing_has_entry(
+		          directory_listing,
+		          safe_segment_filename,
+		          safe_segment_filename_size - 1,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if directory listing contains file: %s.",
+			 function,
+			 safe_segment_filename );
+
+			goto on_error;
+		}
+	}
+	if( result == 0 )
+	{
+		if( libbfio_file_set_name(
+		     file_io_handle,
+		     safe_segment_filename,
+		     safe_segment_filename_size - 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set name in file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		result = libbfio_handle_exists(
+			  file_io_handle,
+			  error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: unable to determine if file: %s exists.",
+			 function,
+			 safe_segment_filename );
+
+			goto on_error;
+		}
+	}
+	*segment_filename      = safe_segment_filename;
+	*segment_filename_size = safe_segment_filename_size;
+
+	return( result );
+
+on_error:
+	if( safe_segment_filename != NULL )
+	{
+		memory_free(
+		 safe_segment_filename );
+	}
+	return( -1 );
+}
+
+/* Appends the remaining segment files recorded in the manifest of the first segment file
+ * The segment files are only appended if they are all contained in the directory listing
+ * Returns 1 if successful, 0 if no usable manifest was found or -1 on error
+ */
+int libsmraw_glob_append_manifest_segment_files(
+     libsmraw_directory_listing_t *directory_listing,
+     const char *segment_filename,
+     size_t segment_filename_length,
+     uint8_t naming_schema,
+     int maximum_number_of_segment_files,
+     char **filenames[],
+     int *number_of_filenames,
+     libcerror_error_t **error )
+{
+	libsmraw_manifest_t *manifest         = NULL;
+	char *manifest_filename               = NULL;
+	char *manifest_segment_filename       = NULL;
+	static char *function                 = "libsmraw_glob_append_manifest_segment_files";
+	size_t manifest_filename_size         = 0;
+	size_t manifest_segment_filename_size = 0;
+	int result                            = 0;
+	int segment_index                     = 0;
+
+	if( directory_listing == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory listing.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( filenames == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filenames.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_filenames == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of filenames.",
+		 function );
+
+		return( -1 );
+	}
+	/* Without a directory listing the manifest cannot be validated without accessing the segment files
+	 */
+	if( ( directory_listing->number_of_entries == 0 )
+	 || ( segment_filename_length <= 4 ) )
+	{
+		return( 0 );
+	}
+	if( libsmraw_manifest_create_filename(
+	     &manifest_filename,
+	     &manifest_filename_size,
+	     segment_filename,
+	     segment_filename_length,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set name in file IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create manifest filename.",
 		 function );
 
 		goto on_error;
 	}
-	result = libbfio_handle_exists(
-		  file_io_handle,
-		  error );
+	if( libsmraw_manifest_initialize(
+	     &manifest,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create manifest.",
+		 function );
+
+		goto on_error;
+	}
+	result = libsmraw_manifest_read(
+	          manifest,
+	          manifest_filename,
+	          error );
 
 	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_GENERIC,
-		 "%s: unable to determine if file: %s exists.",
-		 function,
-		 safe_segment_filename );
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read manifest.",
+		 function );
 
 		goto on_error;
 	}
-	*segment_filename      = safe_segment_filename;
-	*segment_filename_size = safe_segment_filename_size;
+	if( result != 0 )
+	{
+		if( ( manifest->number_of_segments < 2 )
+		 || ( manifest->number_of_segments > maximum_number_of_segment_files ) )
+		{
+			result = 0;
+		}
+		else if( ( manifest->naming_schema != LIBSMRAW_SEGMENT_FILE_NAMING_SCHEMA_UNKNOWN )
+		      && ( manifest->naming_schema != naming_schema ) )
+		{
+			result = 0;
+		}
+	}
+	/* The first segment file in the manifest must be the segment file being globbed
+	 */
+	if( result != 0 )
+	{
+		if( libsmraw_manifest_get_segment_filename(
+		     manifest,
+		     0,
+		     segment_filename,
+		     segment_filename_length,
+		     &manifest_segment_filename,
+		     &manifest_segment_filename_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment filename: 0 from manifest.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( manifest_segment_filename_size != ( segment_filename_length + 1 ) )
+		 || ( narrow_string_compare(
+		       manifest_segment_filename,
+		       segment_filename,
+		       segment_filename_length ) != 0 ) )
+		{
+			result = 0;
+		}
+		memory_free(
+		 manifest_segment_filename );
+
+		manifest_segment_filename = NULL;
+	}
+	for( segment_index = 1;
+	     ( result != 0 ) && ( segment_index < manifest->number_of_segments );
+	     segment_index++ )
+	{
+		result = libsmraw_directory_listing_has_entry(
+		          directory_listing,
+		          manifest->segments[ segment_index ].name,
+		          manifest->segments[ segment_index ].name_size - 1,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if directory listing contains segment file: %d.",
+			 function,
+			 segment_index );
+
+			goto on_error;
+		}
+	}
+	for( segment_index = 1;
+	     ( result != 0 ) && ( segment_index < manifest->number_of_segments );
+	     segment_index++ )
+	{
+		if( libsmraw_manifest_get_segment_filename(
+		     manifest,
+		     segment_index,
+		     segment_filename,
+		     segment_filename_length,
+		     &manifest_segment_filename,
+		     &manifest_segment_filename_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment filename: %d from manifest.",
+			 function,
+			 segment_index );
+
+			goto on_error;
+		}
+		if( libsmraw_glob_append_segment_file(
+		     filenames,
+		     number_of_filenames,
+		     manifest_segment_filename,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append segment filename.",
+			 function );
+
+			goto on_error;
+		}
+		manifest_segment_filename = NULL;
+	}
+	if( libsmraw_manifest_free(
+	     &manifest,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free manifest.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 manifest_filename );
 
 	return( result );
 
 on_error:
-	if( safe_segment_filename != NULL )
+	if( manifest_segment_filename != NULL )
 	{
 		memory_free(
-		 safe_segment_filename );
+		 manifest_segment_filename );
+	}
+	if( manifest != NULL )
+	{
+		libsmraw_manifest_free(
+		 &manifest,
+		 NULL );
+	}
+	if( manifest_filename != NULL )
+	{
+		memory_free(
+		 manifest_filename );
 	}
 	return( -1 );
 }
@@ -570,6 +867,7 @@ int libsmraw_glob_determine_naming_schema(
 }
 
 /* Globs the files according to common (split) RAW naming schemas
+ * The segment filenames are matched against a single listing of the directory if supported
  * Make sure the value filenames is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
  */
@@ -598,7 +896,8 @@ int libsmraw_glob(
 		NULL
 	};
 
-	libbfio_handle_t *file_io_handle    = NULL;
+	libbfio_handle_t *file_io_handle                = NULL;
+	libsmraw_directory_listing_t *directory_listing = NULL;
 	char *identifier                    = NULL;
 	char *segment_filename              = NULL;
 	char *segment_filename_copy         = NULL;
@@ -667,6 +966,36 @@ int libsmraw_glob(
 	}
 	*number_of_filenames = 0;
 
+	if( libsmraw_directory_listing_initialize(
+	     &directory_listing,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory listing.",
+		 function );
+
+		goto on_error;
+	}
+	/* If the directory cannot be read the segment files are accessed individually
+	 */
+	if( libsmraw_directory_listing_read(
+	     directory_listing,
+	     filename,
+	     filename_length,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read directory listing.",
+		 function );
+
+		goto on_error;
+	}
 	if( libbfio_file_initialize(
 	     &file_io_handle,
 	     error ) != 1 )
@@ -684,6 +1013,7 @@ int libsmraw_glob(
 	 */
 	result = libsmraw_glob_exists_segment_file(
 		  file_io_handle,
+		  directory_listing,
 		  filename,
 		  filename_length,
 		  NULL,
@@ -730,6 +1060,7 @@ int libsmraw_glob(
 
 			result = libsmraw_glob_exists_segment_file(
 				  file_io_handle,
+				  directory_listing,
 				  filename,
 				  filename_length,
 				  suffix,
@@ -760,6 +1091,14 @@ int libsmraw_glob(
 			memory_free(
 			 segment_filename );
 		}
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+
+		libsmraw_directory_listing_free(
+		 &directory_listing,
+		 NULL );
+
 		return( 1 );
 	}
 	if( libsmraw_glob_append_segment_file(
@@ -1034,6 +1373,38 @@ int libsmraw_glob(
 		}
 		segment_filename_copy_length = segment_filename_copy_size - 1;
 
+		/* The segment files recorded in a manifest do not need to be looked up individually,
+		 * the search continues after the last recorded segment file to find segment files
+		 * that were added afterwards
+		 */
+		if( allow_identifier_expansion == 0 )
+		{
+			result = libsmraw_glob_append_manifest_segment_files(
+			          directory_listing,
+			          segment_filename_copy,
+			          segment_filename_copy_length,
+			          naming_schema,
+			          maximum_segment_file_identifier - segment_file_identifier + 1,
+			          filenames,
+			          number_of_filenames,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append segment filenames from manifest.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				segment_file_identifier += *number_of_filenames - 1;
+			}
+		}
 		while( *number_of_filenames < INT_MAX )
 		{
 			if( ( segment_file_identifier + 1 ) > maximum_segment_file_identifier )
@@ -1123,6 +1494,7 @@ int libsmraw_glob(
 
 			result = libsmraw_glob_exists_segment_file(
 				  file_io_handle,
+				  directory_listing,
 				  segment_filename_copy,
 				  segment_filename_copy_length,
 				  NULL,
@@ -1202,6 +1574,19 @@ int libsmraw_glob(
 
 		goto on_error;
 	}
+	if( libsmraw_directory_listing_free(
+	     &directory_listing,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free directory listing.",
+		 function );
+
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
@@ -1232,6 +1617,12 @@ on_error:
 		 &file_io_handle,
 		 NULL );
 	}
+	if( directory_listing != NULL )
+	{
+		libsmraw_directory_listing_free(
+		 &directory_listing,
+		 NULL );
+	}
 	return( -1 );
 }
 
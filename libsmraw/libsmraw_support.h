@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libsmraw_directory_listing.h"
 #include "libsmraw_extern.h"
 #include "libsmraw_libbfio.h"
 #include "libsmraw_libcerror.h"
@@ -71,6 +72,7 @@ int libsmraw_glob_append_segment_file(
 
 int libsmraw_glob_exists_segment_file(
      libbfio_handle_t *file_io_handle,
+     libsmraw_directory_listing_t *directory_listing,
      const char *prefix,
      size_t prefix_length,
      const char *suffix,
@@ -79,6 +81,16 @@ int libsmraw_glob_exists_segment_file(
      size_t *segment_filename_size,
      libcerror_error_t **error );
 
+int libsmraw_glob_append_manifest_segment_files(
+     libsmraw_directory_listing_t *directory_listing,
+     const char *segment_filename,
+     size_t segment_filename_length,
+     uint8_t naming_schema,
+     int maximum_number_of_segment_files,
+     char **filenames[],
+     int *number_of_filenames,
+     libcerror_error_t **error );
+
 int libsmraw_glob_determine_naming_schema(
      const char *suffix,
      size_t suffix_length,
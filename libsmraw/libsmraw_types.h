@@ -34,13 +34,39 @@
 /* The following type definitions hide internal data structures
  */
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
+typedef struct libsmraw_data_view {}	libsmraw_data_view_t;
 typedef struct libsmraw_handle {}	libsmraw_handle_t;
 
 #else
+typedef intptr_t libsmraw_data_view_t;
 typedef intptr_t libsmraw_handle_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
 
+/* The read request definition used for batched reads
+ */
+typedef struct libsmraw_read_request libsmraw_read_request_t;
+
+struct libsmraw_read_request
+{
+	/* The (media) offset
+	 */
+	off64_t offset;
+
+	/* The buffer
+	 */
+	void *buffer;
+
+	/* The buffer size
+	 */
+	size_t buffer_size;
+
+	/* The number of bytes read or -1 on error
+	 * set when the read request has completed
+	 */
+	ssize_t read_count;
+};
+
 #endif /* defined( HAVE_LOCAL_LIBSMRAW ) */
 
 #endif /* !defined( _LIBSMRAW_INTERNAL_TYPES_H ) */
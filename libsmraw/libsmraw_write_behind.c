@@ -0,0 +1,1086 @@
+/*
+ * Write-behind functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libsmraw_definitions.h"
+#include "libsmraw_direct_file.h"
+#include "libsmraw_libcerror.h"
+#include "libsmraw_libcthreads.h"
+#include "libsmraw_write_behind.h"
+
+/* Creates a write-behind
+ * Make sure the value write_behind is referencing, is set to NULL
+ * When the number of buffers is not 0 and multi-threading is supported the buffered data
+ * is written by a writer thread, otherwise it is written synchronously
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_write_behind_initialize(
+     libsmraw_write_behind_t **write_behind,
+     size_t buffer_size,
+     size64_t boundary_size,
+     int number_of_buffers,
+     ssize_t (*write_function)(
+                intptr_t *data_handle,
+                const uint8_t *buffer,
+                size_t buffer_size,
+                libcerror_error_t **error ),
+     intptr_t *data_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_write_behind_initialize";
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	int buffer_index      = 0;
+#endif
+
+	if( write_behind == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write-behind.",
+		 function );
+
+		return( -1 );
+	}
+	if( *write_behind != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid write-behind value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_buffers < 0 )
+	 || ( number_of_buffers > LIBSMRAW_MAXIMUM_WRITE_QUEUE_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of buffers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( write_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write function.",
+		 function );
+
+		return( -1 );
+	}
+	*write_behind = memory_allocate_structure(
+	                 libsmraw_write_behind_t );
+
+	if( *write_behind == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create write-behind.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *write_behind,
+	     0,
+	     sizeof( libsmraw_write_behind_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear write-behind.",
+		 function );
+
+		memory_free(
+		 *write_behind );
+
+		*write_behind = NULL;
+
+		return( -1 );
+	}
+	( *write_behind )->buffer_size    = buffer_size;
+	( *write_behind )->boundary_size  = boundary_size;
+	( *write_behind )->write_function = write_function;
+	( *write_behind )->data_handle    = data_handle;
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( number_of_buffers > 0 )
+	{
+		( *write_behind )->buffers = (libsmraw_write_behind_buffer_t *) memory_allocate(
+		                                                                 sizeof( libsmraw_write_behind_buffer_t ) * number_of_buffers );
+
+		if( ( *write_behind )->buffers == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create buffers.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     ( *write_behind )->buffers,
+		     0,
+		     sizeof( libsmraw_write_behind_buffer_t ) * number_of_buffers ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear buffers.",
+			 function );
+
+			memory_free(
+			 ( *write_behind )->buffers );
+
+			( *write_behind )->buffers = NULL;
+
+			goto on_error;
+		}
+		( *write_behind )->number_of_buffers = number_of_buffers;
+
+		for( buffer_index = 0;
+		     buffer_index < number_of_buffers;
+		     buffer_index++ )
+		{
+			( *write_behind )->buffers[ buffer_index ].data = (uint8_t *) libsmraw_direct_file_allocate_buffer(
+			                                                               sizeof( uint8_t ) * buffer_size );
+
+			if( ( *write_behind )->buffers[ buffer_index ].data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create buffer: %d data.",
+				 function,
+				 buffer_index );
+
+				goto on_error;
+			}
+		}
+		if( libcthreads_mutex_initialize(
+		     &( ( *write_behind )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create mutex.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_condition_initialize(
+		     &( ( *write_behind )->written_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create written condition.",
+			 function );
+
+			goto on_error;
+		}
+		/* A single writer thread guarantees the buffers are written in order
+		 */
+		if( libcthreads_thread_pool_create(
+		     &( ( *write_behind )->thread_pool ),
+		     NULL,
+		     1,
+		     number_of_buffers,
+		     (int (*)(intptr_t *, void *)) &libsmraw_write_behind_write_queued_buffer,
+		     (void *) *write_behind,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		( *write_behind )->data = ( *write_behind )->buffers[ 0 ].data;
+
+		return( 1 );
+	}
+#endif /* defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT ) */
+
+	( *write_behind )->data = (uint8_t *) libsmraw_direct_file_allocate_buffer(
+	                                       sizeof( uint8_t ) * buffer_size );
+
+	if( ( *write_behind )->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *write_behind != NULL )
+	{
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+		if( ( *write_behind )->written_condition != NULL )
+		{
+			libcthreads_condition_free(
+			 &( ( *write_behind )->written_condition ),
+			 NULL );
+		}
+		if( ( *write_behind )->mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *write_behind )->mutex ),
+			 NULL );
+		}
+		if( ( *write_behind )->buffers != NULL )
+		{
+			for( buffer_index = 0;
+			     buffer_index < number_of_buffers;
+			     buffer_index++ )
+			{
+				if( ( *write_behind )->buffers[ buffer_index ].data != NULL )
+				{
+					memory_free(
+					 ( *write_behind )->buffers[ buffer_index ].data );
+				}
+			}
+			memory_free(
+			 ( *write_behind )->buffers );
+		}
+#endif
+		memory_free(
+		 *write_behind );
+
+		*write_behind = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a write-behind
+ * This waits for the writer thread to write the queued buffers,
+ * buffered data that was not queued or flushed is discarded
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_write_behind_free(
+     libsmraw_write_behind_t **write_behind,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_write_behind_free";
+	int result            = 1;
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	int buffer_index      = 0;
+#endif
+
+	if( write_behind == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write-behind.",
+		 function );
+
+		return( -1 );
+	}
+	if( *write_behind != NULL )
+	{
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+		if( ( *write_behind )->buffers != NULL )
+		{
+			if( libcthreads_thread_pool_join(
+			     &( ( *write_behind )->thread_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread pool.",
+				 function );
+
+				result = -1;
+			}
+			if( libcthreads_condition_free(
+			     &( ( *write_behind )->written_condition ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free written condition.",
+				 function );
+
+				result = -1;
+			}
+			if( libcthreads_mutex_free(
+			     &( ( *write_behind )->mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mutex.",
+				 function );
+
+				result = -1;
+			}
+			for( buffer_index = 0;
+			     buffer_index < ( *write_behind )->number_of_buffers;
+			     buffer_index++ )
+			{
+				memory_free(
+				 ( *write_behind )->buffers[ buffer_index ].data );
+			}
+			memory_free(
+			 ( *write_behind )->buffers );
+		}
+		else
+#endif
+		{
+			memory_free(
+			 ( *write_behind )->data );
+		}
+		memory_free(
+		 *write_behind );
+
+		*write_behind = NULL;
+	}
+	return( result );
+}
+
+/* Determines the number of bytes from an offset up to the next buffer size aligned offset
+ * or boundary, whichever comes first
+ * Returns the fill size
+ */
+size_t libsmraw_write_behind_get_fill_size(
+        libsmraw_write_behind_t *write_behind,
+        off64_t offset )
+{
+	size64_t boundary_remainder = 0;
+	size_t fill_size            = 0;
+
+	fill_size = write_behind->buffer_size
+	          - (size_t) ( (size64_t) offset % write_behind->buffer_size );
+
+	if( write_behind->boundary_size > 0 )
+	{
+		boundary_remainder = write_behind->boundary_size
+		                   - ( (size64_t) offset % write_behind->boundary_size );
+
+		if( boundary_remainder < (size64_t) fill_size )
+		{
+			fill_size = (size_t) boundary_remainder;
+		}
+	}
+	return( fill_size );
+}
+
+/* Writes data at a specific offset
+ * The offset must continue where the previous write ended while data is buffered
+ * Data is buffered up to the next buffer size aligned offset or boundary, writes that
+ * cover this range entirely are passed through without copying unless the data is
+ * written by the writer thread
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t libsmraw_write_behind_write_buffer(
+         libsmraw_write_behind_t *write_behind,
+         const uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function       = "libsmraw_write_behind_write_buffer";
+	size64_t boundary_remainder = 0;
+	size_t buffer_offset        = 0;
+	size_t remaining_size       = 0;
+	size_t write_size           = 0;
+	size_t aligned_size         = 0;
+	ssize_t write_count         = 0;
+
+	if( write_behind == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write-behind.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( write_behind->data_size > 0 )
+	 && ( offset != ( write_behind->data_offset + (off64_t) write_behind->data_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds - not contiguous with buffered data.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_offset < buffer_size )
+	{
+		remaining_size = buffer_size - buffer_offset;
+
+		if( write_behind->data_size == 0 )
+		{
+			write_behind->data_offset = offset;
+			write_behind->fill_size   = libsmraw_write_behind_get_fill_size(
+			                             write_behind,
+			                             offset );
+
+			if( ( remaining_size >= write_behind->fill_size )
+			 && ( write_behind->number_of_buffers == 0 ) )
+			{
+				/* Pass the caller data through up to the last buffer size aligned offset
+				 * it covers, without crossing a boundary
+				 */
+				write_size   = write_behind->fill_size;
+				aligned_size = remaining_size - write_size;
+
+				if( write_behind->boundary_size > 0 )
+				{
+					boundary_remainder = write_behind->boundary_size
+					                   - ( (size64_t) offset % write_behind->boundary_size );
+
+					if( ( boundary_remainder - write_size ) < (size64_t) aligned_size )
+					{
+						aligned_size = (size_t) ( boundary_remainder - write_size );
+					}
+				}
+				write_size += aligned_size - ( aligned_size % write_behind->buffer_size );
+
+				write_count = write_behind->write_function(
+				               write_behind->data_handle,
+				               &( buffer[ buffer_offset ] ),
+				               write_size,
+				               error );
+
+				if( write_count != (ssize_t) write_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+					 function,
+					 offset,
+					 offset );
+
+					return( -1 );
+				}
+				buffer_offset += write_size;
+				offset        += (off64_t) write_size;
+
+				write_behind->data_offset = offset;
+
+				continue;
+			}
+		}
+		write_size = write_behind->fill_size - write_behind->data_size;
+
+		if( write_size > remaining_size )
+		{
+			write_size = remaining_size;
+		}
+		if( memory_copy(
+		     &( write_behind->data[ write_behind->data_size ] ),
+		     &( buffer[ buffer_offset ] ),
+		     write_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data.",
+			 function );
+
+			return( -1 );
+		}
+		write_behind->data_size += write_size;
+		buffer_offset           += write_size;
+		offset                  += (off64_t) write_size;
+
+		if( write_behind->data_size == write_behind->fill_size )
+		{
+			if( libsmraw_write_behind_write_data(
+			     write_behind,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write buffered data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	write_behind->current_offset = offset;
+
+	return( (ssize_t) buffer_size );
+}
+
+/* Writes the buffered data
+ * The buffered data is queued when it is written by the writer thread
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_write_behind_write_data(
+     libsmraw_write_behind_t *write_behind,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_write_behind_write_data";
+	ssize_t write_count   = 0;
+
+	if( write_behind == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write-behind.",
+		 function );
+
+		return( -1 );
+	}
+	if( write_behind->data_size == 0 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( write_behind->buffers != NULL )
+	{
+		if( libsmraw_write_behind_queue_data(
+		     write_behind,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to queue data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 write_behind->data_offset,
+			 write_behind->data_offset );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+#endif
+	write_count = write_behind->write_function(
+	               write_behind->data_handle,
+	               write_behind->data,
+	               write_behind->data_size,
+	               error );
+
+	if( write_count != (ssize_t) write_behind->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 write_behind->data_offset,
+		 write_behind->data_offset );
+
+		return( -1 );
+	}
+	write_behind->data_offset += (off64_t) write_behind->data_size;
+	write_behind->data_size    = 0;
+
+	return( 1 );
+}
+
+/* Writes the buffered data and waits until the writer thread has written the queued buffers
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_write_behind_flush(
+     libsmraw_write_behind_t *write_behind,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_write_behind_flush";
+
+	if( write_behind == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write-behind.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmraw_write_behind_write_data(
+	     write_behind,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write buffered data.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	if( write_behind->buffers != NULL )
+	{
+		if( libsmraw_write_behind_wait(
+		     write_behind,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to wait for queued buffers to be written.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( 1 );
+}
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+
+/* Writes a queued buffer
+ * Callback function for the thread pool of the writer thread
+ * The writer thread does not hold the read/write lock of the handle, instead every handle
+ * function that uses the file IO pool or segments stream flushes the write-behind first
+ * Once a write failed the remaining queued buffers are not written
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_write_behind_write_queued_buffer(
+     libsmraw_write_behind_buffer_t *buffer,
+     libsmraw_write_behind_t *write_behind )
+{
+	libcerror_error_t *error = NULL;
+	ssize_t write_count      = 0;
+	uint8_t write_failed     = 0;
+	int result               = 1;
+
+	if( buffer == NULL )
+	{
+		return( -1 );
+	}
+	if( write_behind == NULL )
+	{
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     write_behind->mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_free(
+		 &error );
+
+		return( -1 );
+	}
+	write_failed = write_behind->write_failed;
+
+	if( libcthreads_mutex_release(
+	     write_behind->mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_free(
+		 &error );
+
+		return( -1 );
+	}
+	if( write_failed == 0 )
+	{
+		write_count = write_behind->write_function(
+		               write_behind->data_handle,
+		               buffer->data,
+		               buffer->data_size,
+		               &error );
+
+		if( write_count != (ssize_t) buffer->data_size )
+		{
+			libcerror_error_free(
+			 &error );
+
+			result = -1;
+		}
+	}
+	if( libcthreads_mutex_grab(
+	     write_behind->mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_free(
+		 &error );
+
+		return( -1 );
+	}
+	if( ( result != 1 )
+	 && ( write_behind->write_failed == 0 ) )
+	{
+		write_behind->write_failed        = 1;
+		write_behind->write_failed_offset = buffer->data_offset;
+	}
+	buffer->is_pending = 0;
+
+	if( libcthreads_condition_broadcast(
+	     write_behind->written_condition,
+	     &error ) != 1 )
+	{
+		libcerror_error_free(
+		 &error );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     write_behind->mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_free(
+		 &error );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Queues the buffered data onto the writer thread and continues with the next buffer
+ * This function blocks until the writer thread has written the previous data of the next buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_write_behind_queue_data(
+     libsmraw_write_behind_t *write_behind,
+     libcerror_error_t **error )
+{
+	libsmraw_write_behind_buffer_t *buffer = NULL;
+	static char *function                  = "libsmraw_write_behind_queue_data";
+	int result                             = 1;
+
+	if( write_behind == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write-behind.",
+		 function );
+
+		return( -1 );
+	}
+	if( write_behind->buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid write-behind - missing buffers.",
+		 function );
+
+		return( -1 );
+	}
+	buffer = &( write_behind->buffers[ write_behind->buffer_index ] );
+
+	/* The buffer is not shared with the writer thread until it is pushed
+	 */
+	buffer->data_offset = write_behind->data_offset;
+	buffer->data_size   = write_behind->data_size;
+	buffer->is_pending  = 1;
+
+	if( libcthreads_thread_pool_push(
+	     write_behind->thread_pool,
+	     (intptr_t *) buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push buffer onto thread pool queue.",
+		 function );
+
+		buffer->is_pending = 0;
+
+		return( -1 );
+	}
+	write_behind->data_offset += (off64_t) write_behind->data_size;
+	write_behind->data_size    = 0;
+
+	write_behind->buffer_index += 1;
+
+	if( write_behind->buffer_index >= write_behind->number_of_buffers )
+	{
+		write_behind->buffer_index = 0;
+	}
+	buffer = &( write_behind->buffers[ write_behind->buffer_index ] );
+
+	if( libcthreads_mutex_grab(
+	     write_behind->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer->is_pending != 0 )
+	{
+		if( libcthreads_condition_wait(
+		     write_behind->written_condition,
+		     write_behind->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for written condition.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+	}
+	/* A failed write of a previously queued buffer is reported here
+	 */
+	if( ( result == 1 )
+	 && ( write_behind->write_failed != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 write_behind->write_failed_offset,
+		 write_behind->write_failed_offset );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     write_behind->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	write_behind->data = buffer->data;
+
+	return( result );
+}
+
+/* Waits until the writer thread has written all queued buffers
+ * Returns 1 if successful or -1 on error
+ */
+int libsmraw_write_behind_wait(
+     libsmraw_write_behind_t *write_behind,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmraw_write_behind_wait";
+	int buffer_index      = 0;
+	int result            = 1;
+
+	if( write_behind == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write-behind.",
+		 function );
+
+		return( -1 );
+	}
+	if( write_behind->buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid write-behind - missing buffers.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     write_behind->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_index < write_behind->number_of_buffers )
+	{
+		if( write_behind->buffers[ buffer_index ].is_pending == 0 )
+		{
+			buffer_index++;
+
+			continue;
+		}
+		if( libcthreads_condition_wait(
+		     write_behind->written_condition,
+		     write_behind->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for written condition.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+	}
+	if( ( result == 1 )
+	 && ( write_behind->write_failed != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 write_behind->write_failed_offset,
+		 write_behind->write_failed_offset );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     write_behind->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT ) */
+
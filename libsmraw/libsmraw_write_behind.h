@@ -0,0 +1,196 @@
+/*
+ * Write-behind functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSMRAW_WRITE_BEHIND_H )
+#define _LIBSMRAW_WRITE_BEHIND_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsmraw_libcerror.h"
+#include "libsmraw_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+
+typedef struct libsmraw_write_behind_buffer libsmraw_write_behind_buffer_t;
+
+struct libsmraw_write_behind_buffer
+{
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The offset of the data
+	 */
+	off64_t data_offset;
+
+	/* The size of the data
+	 */
+	size_t data_size;
+
+	/* Value to indicate the buffer is queued or being written
+	 */
+	uint8_t is_pending;
+};
+
+#endif /* defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT ) */
+
+typedef struct libsmraw_write_behind libsmraw_write_behind_t;
+
+struct libsmraw_write_behind
+{
+	/* The buffer size
+	 */
+	size_t buffer_size;
+
+	/* The boundary size, where 0 represents no boundary
+	 */
+	size64_t boundary_size;
+
+	/* The data handle
+	 */
+	intptr_t *data_handle;
+
+	/* The write function
+	 */
+	ssize_t (*write_function)(
+	           intptr_t *data_handle,
+	           const uint8_t *buffer,
+	           size_t buffer_size,
+	           libcerror_error_t **error );
+
+	/* The buffered data
+	 */
+	uint8_t *data;
+
+	/* The offset of the buffered data
+	 */
+	off64_t data_offset;
+
+	/* The size of the buffered data
+	 */
+	size_t data_size;
+
+	/* The size at which the buffered data is written
+	 */
+	size_t fill_size;
+
+	/* The offset at which the next write is expected
+	 */
+	off64_t current_offset;
+
+	/* The number of buffers written by the writer thread, 0 if writes are synchronous
+	 */
+	int number_of_buffers;
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+	/* The buffers written by the writer thread
+	 */
+	libsmraw_write_behind_buffer_t *buffers;
+
+	/* The index of the buffer that is being filled
+	 */
+	int buffer_index;
+
+	/* The thread pool with the writer thread
+	 */
+	libcthreads_thread_pool_t *thread_pool;
+
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition signalled when a buffer has been written
+	 */
+	libcthreads_condition_t *written_condition;
+
+	/* Value to indicate a write by the writer thread failed
+	 */
+	uint8_t write_failed;
+
+	/* The offset of the data of the failed write
+	 */
+	off64_t write_failed_offset;
+#endif
+};
+
+int libsmraw_write_behind_initialize(
+     libsmraw_write_behind_t **write_behind,
+     size_t buffer_size,
+     size64_t boundary_size,
+     int number_of_buffers,
+     ssize_t (*write_function)(
+                intptr_t *data_handle,
+                const uint8_t *buffer,
+                size_t buffer_size,
+                libcerror_error_t **error ),
+     intptr_t *data_handle,
+     libcerror_error_t **error );
+
+int libsmraw_write_behind_free(
+     libsmraw_write_behind_t **write_behind,
+     libcerror_error_t **error );
+
+size_t libsmraw_write_behind_get_fill_size(
+        libsmraw_write_behind_t *write_behind,
+        off64_t offset );
+
+ssize_t libsmraw_write_behind_write_buffer(
+         libsmraw_write_behind_t *write_behind,
+         const uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+int libsmraw_write_behind_write_data(
+     libsmraw_write_behind_t *write_behind,
+     libcerror_error_t **error );
+
+int libsmraw_write_behind_flush(
+     libsmraw_write_behind_t *write_behind,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+
+int libsmraw_write_behind_write_queued_buffer(
+     libsmraw_write_behind_buffer_t *buffer,
+     libsmraw_write_behind_t *write_behind );
+
+int libsmraw_write_behind_queue_data(
+     libsmraw_write_behind_t *write_behind,
+     libcerror_error_t **error );
+
+int libsmraw_write_behind_wait(
+     libsmraw_write_behind_t *write_behind,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSMRAW_WRITE_BEHIND_H ) */
+
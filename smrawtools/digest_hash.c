@@ -20,10 +20,24 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
 #include <types.h>
 
+#if defined( _MSC_VER )
+#include <intrin.h>
+#elif defined( __x86_64__ ) || defined( __i386__ )
+#include <cpuid.h>
+#endif
+
 #include "digest_hash.h"
 #include "smrawtools_libcerror.h"
+#include "smrawtools_libhmac.h"
+#include "smrawtools_unused.h"
+
+#if defined( DIGEST_HASH_HAVE_X86_INTRINSICS )
+#include <immintrin.h>
+#endif
 
 /* Converts the digest hash to a printable string
  * Returns 1 if successful or -1 on error
@@ -127,3 +141,2222 @@ int digest_hash_copy_to_string(
 	return( 1 );
 }
 
+
+/* Converts a printable string to the digest hash
+ * The string should consist of 2 hexadecimal characters per digest hash digit
+ * Returns 1 if successful or -1 on error
+ */
+int digest_hash_copy_from_string(
+     uint8_t *digest_hash,
+     size_t digest_hash_size,
+     const char *string,
+     size_t string_length,
+     libcerror_error_t **error )
+{
+	static char *function       = "digest_hash_copy_from_string";
+	size_t digest_hash_iterator = 0;
+	size_t string_iterator      = 0;
+	uint8_t digest_digit        = 0;
+	uint8_t nibble_iterator     = 0;
+	char character              = 0;
+
+	if( digest_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest_hash_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid digest hash size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_length != ( 2 * digest_hash_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( digest_hash_iterator = 0;
+	     digest_hash_iterator < digest_hash_size;
+	     digest_hash_iterator++ )
+	{
+		digest_hash[ digest_hash_iterator ] = 0;
+
+		for( nibble_iterator = 0;
+		     nibble_iterator < 2;
+		     nibble_iterator++ )
+		{
+			character = string[ string_iterator++ ];
+
+			if( ( character >= '0' )
+			 && ( character <= '9' ) )
+			{
+				digest_digit = (uint8_t) ( character - '0' );
+			}
+			else if( ( character >= 'a' )
+			      && ( character <= 'f' ) )
+			{
+				digest_digit = (uint8_t) ( character - 'a' + 10 );
+			}
+			else if( ( character >= 'A' )
+			      && ( character <= 'F' ) )
+			{
+				digest_digit = (uint8_t) ( character - 'A' + 10 );
+			}
+			else
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported character in string at index: %" PRIzu ".",
+				 function,
+				 string_iterator - 1 );
+
+				return( -1 );
+			}
+			digest_hash[ digest_hash_iterator ] <<= 4;
+			digest_hash[ digest_hash_iterator ]  |= digest_digit;
+		}
+	}
+	return( 1 );
+}
+
+#if defined( DIGEST_HASH_HAVE_X86_INTRINSICS )
+
+/* Retrieves the CPU identification registers of a specific leaf
+ * The registers are stored in the order: EAX, EBX, ECX, EDX
+ */
+void digest_hash_cpuid(
+      uint32_t leaf,
+      uint32_t sub_leaf,
+      uint32_t *registers )
+{
+#if defined( _MSC_VER )
+	int cpu_information[ 4 ];
+
+	__cpuidex(
+	 cpu_information,
+	 (int) leaf,
+	 (int) sub_leaf );
+
+	registers[ 0 ] = (uint32_t) cpu_information[ 0 ];
+	registers[ 1 ] = (uint32_t) cpu_information[ 1 ];
+	registers[ 2 ] = (uint32_t) cpu_information[ 2 ];
+	registers[ 3 ] = (uint32_t) cpu_information[ 3 ];
+#else
+	__cpuid_count(
+	 leaf,
+	 sub_leaf,
+	 registers[ 0 ],
+	 registers[ 1 ],
+	 registers[ 2 ],
+	 registers[ 3 ] );
+#endif
+}
+
+#endif /* defined( DIGEST_HASH_HAVE_X86_INTRINSICS ) */
+
+/* The CPU features, determined on first use
+ * The value is stored with a single write and does not change once determined
+ */
+static volatile uint32_t digest_hash_cpu_features = 0;
+
+/* Determines the CPU features used by the digest hash backends
+ * CPUID is only executed on the first call, subsequent calls return the cached value
+ * Returns the CPU features
+ */
+uint32_t digest_hash_get_cpu_features(
+          void )
+{
+	uint32_t cpu_features = 0;
+
+#if defined( DIGEST_HASH_HAVE_X86_INTRINSICS )
+	uint32_t leaf1_registers[ 4 ];
+	uint32_t leaf7_registers[ 4 ];
+
+	uint64_t extended_control_register = 0;
+
+#if !defined( _MSC_VER )
+	uint32_t extended_control_register_lower = 0;
+	uint32_t extended_control_register_upper = 0;
+#endif
+#endif /* defined( DIGEST_HASH_HAVE_X86_INTRINSICS ) */
+
+	cpu_features = digest_hash_cpu_features;
+
+	if( ( cpu_features & DIGEST_HASH_CPU_FEATURES_DETERMINED ) != 0 )
+	{
+		return( cpu_features & ~( (uint32_t) DIGEST_HASH_CPU_FEATURES_DETERMINED ) );
+	}
+	cpu_features = 0;
+
+#if defined( DIGEST_HASH_HAVE_X86_INTRINSICS )
+	digest_hash_cpuid(
+	 0,
+	 0,
+	 leaf1_registers );
+
+	if( leaf1_registers[ 0 ] >= 7 )
+	{
+		digest_hash_cpuid(
+		 1,
+		 0,
+		 leaf1_registers );
+
+		digest_hash_cpuid(
+		 7,
+		 0,
+		 leaf7_registers );
+
+		/* The SHA extensions are used together with SSSE3 and SSE4.1
+		 */
+		if( ( ( leaf1_registers[ 2 ] & 0x00000200UL ) != 0 )
+		 && ( ( leaf1_registers[ 2 ] & 0x00080000UL ) != 0 )
+		 && ( ( leaf7_registers[ 1 ] & 0x20000000UL ) != 0 ) )
+		{
+			cpu_features |= DIGEST_HASH_CPU_FEATURE_SHA_NI;
+		}
+		/* AVX2 also requires the operating system to save the YMM registers
+		 */
+		if( ( ( leaf1_registers[ 2 ] & 0x08000000UL ) != 0 )
+		 && ( ( leaf1_registers[ 2 ] & 0x10000000UL ) != 0 )
+		 && ( ( leaf7_registers[ 1 ] & 0x00000020UL ) != 0 ) )
+		{
+#if defined( _MSC_VER )
+			extended_control_register = (uint64_t) _xgetbv( 0 );
+#else
+			__asm__ __volatile__ (
+			 "xgetbv"
+			 : "=a" ( extended_control_register_lower ), "=d" ( extended_control_register_upper )
+			 : "c" ( 0 ) );
+
+			extended_control_register = ( (uint64_t) extended_control_register_upper << 32 ) | extended_control_register_lower;
+#endif
+			if( ( extended_control_register & 0x00000006UL ) == 0x00000006UL )
+			{
+				cpu_features |= DIGEST_HASH_CPU_FEATURE_AVX2;
+			}
+		}
+	}
+#endif /* defined( DIGEST_HASH_HAVE_X86_INTRINSICS ) */
+
+	digest_hash_cpu_features = cpu_features | DIGEST_HASH_CPU_FEATURES_DETERMINED;
+
+	return( cpu_features );
+}
+
+/* Determines if a backend is supported by the compiler and the CPU
+ * Returns 1 if supported or 0 if not
+ */
+int digest_hash_backend_is_supported(
+     int backend )
+{
+	uint32_t cpu_features = 0;
+
+	switch( backend )
+	{
+		case DIGEST_HASH_BACKEND_DEFAULT:
+		case DIGEST_HASH_BACKEND_GENERIC:
+			return( 1 );
+
+		case DIGEST_HASH_BACKEND_SHA_NI:
+			cpu_features = digest_hash_get_cpu_features();
+
+			if( ( cpu_features & DIGEST_HASH_CPU_FEATURE_SHA_NI ) != 0 )
+			{
+				return( 1 );
+			}
+			break;
+
+		case DIGEST_HASH_BACKEND_AVX2:
+			cpu_features = digest_hash_get_cpu_features();
+
+			if( ( cpu_features & DIGEST_HASH_CPU_FEATURE_AVX2 ) != 0 )
+			{
+				return( 1 );
+			}
+			break;
+
+		default:
+			break;
+	}
+	return( 0 );
+}
+
+/* Determines the SHA1 backend that is selected by default
+ * The SHA-NI backend is only selected when libhmac does not use libcrypto
+ * Returns the backend
+ */
+int digest_hash_sha1_get_default_backend(
+     void )
+{
+#if defined( DIGEST_HASH_LIBHMAC_SHA1_IS_PORTABLE )
+	if( digest_hash_backend_is_supported(
+	     DIGEST_HASH_BACKEND_SHA_NI ) != 0 )
+	{
+		return( DIGEST_HASH_BACKEND_SHA_NI );
+	}
+#endif
+	return( DIGEST_HASH_BACKEND_GENERIC );
+}
+
+/* Creates a SHA1 context using the default backend
+ * Make sure the value context is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int digest_hash_sha1_initialize(
+     digest_hash_sha1_context_t **context,
+     libcerror_error_t **error )
+{
+	return( digest_hash_sha1_initialize_with_backend(
+	         context,
+	         DIGEST_HASH_BACKEND_DEFAULT,
+	         error ) );
+}
+
+/* Creates a SHA1 context using a specific backend
+ * Make sure the value context is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int digest_hash_sha1_initialize_with_backend(
+     digest_hash_sha1_context_t **context,
+     int backend,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_hash_sha1_initialize_with_backend";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( backend == DIGEST_HASH_BACKEND_DEFAULT )
+	{
+		backend = digest_hash_sha1_get_default_backend();
+	}
+	if( ( ( backend != DIGEST_HASH_BACKEND_GENERIC )
+	  &&  ( backend != DIGEST_HASH_BACKEND_SHA_NI ) )
+	 || ( digest_hash_backend_is_supported(
+	       backend ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported backend: %d.",
+		 function,
+		 backend );
+
+		return( -1 );
+	}
+	*context = memory_allocate_structure(
+	            digest_hash_sha1_context_t );
+
+	if( *context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create context.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *context,
+	     0,
+	     sizeof( digest_hash_sha1_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear context.",
+		 function );
+
+		goto on_error;
+	}
+	if( backend == DIGEST_HASH_BACKEND_GENERIC )
+	{
+		if( libhmac_sha1_initialize(
+		     &( ( *context )->libhmac_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create libhmac context.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		( *context )->hash_values[ 0 ] = 0x67452301UL;
+		( *context )->hash_values[ 1 ] = 0xefcdab89UL;
+		( *context )->hash_values[ 2 ] = 0x98badcfeUL;
+		( *context )->hash_values[ 3 ] = 0x10325476UL;
+		( *context )->hash_values[ 4 ] = 0xc3d2e1f0UL;
+	}
+	( *context )->backend = backend;
+
+	return( 1 );
+
+on_error:
+	if( *context != NULL )
+	{
+		memory_free(
+		 *context );
+
+		*context = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a SHA1 context
+ * Returns 1 if successful or -1 on error
+ */
+int digest_hash_sha1_free(
+     digest_hash_sha1_context_t **context,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_hash_sha1_free";
+	int result            = 1;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		if( ( *context )->libhmac_context != NULL )
+		{
+			if( libhmac_sha1_free(
+			     &( ( *context )->libhmac_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free libhmac context.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *context );
+
+		*context = NULL;
+	}
+	return( result );
+}
+
+/* Hashes whole blocks using the backend of the SHA1 context
+ */
+void digest_hash_sha1_transform_blocks(
+      digest_hash_sha1_context_t *context,
+      const uint8_t *buffer,
+      size_t number_of_blocks )
+{
+#if defined( DIGEST_HASH_HAVE_X86_INTRINSICS )
+	/* The SHA-NI backend is the only SHA1 backend that does not use libhmac
+	 */
+	digest_hash_sha1_ni_transform(
+	 context->hash_values,
+	 buffer,
+	 number_of_blocks );
+#else
+	SMRAWTOOLS_UNREFERENCED_PARAMETER( context )
+	SMRAWTOOLS_UNREFERENCED_PARAMETER( buffer )
+	SMRAWTOOLS_UNREFERENCED_PARAMETER( number_of_blocks )
+#endif
+}
+
+/* Updates a SHA1 context
+ * Returns 1 if successful or -1 on error
+ */
+int digest_hash_sha1_update(
+     digest_hash_sha1_context_t *context,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function   = "digest_hash_sha1_update";
+	size_t buffer_offset    = 0;
+	size_t copy_size        = 0;
+	size_t number_of_blocks = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( context->backend == DIGEST_HASH_BACKEND_GENERIC )
+	{
+		if( libhmac_sha1_update(
+		     context->libhmac_context,
+		     buffer,
+		     size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update libhmac context.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( context->block_size > 0 )
+	{
+		copy_size = DIGEST_HASH_BLOCK_SIZE - context->block_size;
+
+		if( copy_size > size )
+		{
+			copy_size = size;
+		}
+		if( memory_copy(
+		     &( context->block[ context->block_size ] ),
+		     buffer,
+		     copy_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to block.",
+			 function );
+
+			return( -1 );
+		}
+		context->block_size += copy_size;
+		buffer_offset        = copy_size;
+
+		if( context->block_size == DIGEST_HASH_BLOCK_SIZE )
+		{
+			digest_hash_sha1_transform_blocks(
+			 context,
+			 context->block,
+			 1 );
+
+			context->block_size = 0;
+		}
+	}
+	number_of_blocks = ( size - buffer_offset ) / DIGEST_HASH_BLOCK_SIZE;
+
+	if( number_of_blocks > 0 )
+	{
+		digest_hash_sha1_transform_blocks(
+		 context,
+		 &( buffer[ buffer_offset ] ),
+		 number_of_blocks );
+
+		buffer_offset += number_of_blocks * DIGEST_HASH_BLOCK_SIZE;
+	}
+	if( buffer_offset < size )
+	{
+		if( memory_copy(
+		     context->block,
+		     &( buffer[ buffer_offset ] ),
+		     size - buffer_offset ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to block.",
+			 function );
+
+			return( -1 );
+		}
+		context->block_size = size - buffer_offset;
+	}
+	context->hash_count += size;
+
+	return( 1 );
+}
+
+/* Finalizes a SHA1 context
+ * Returns 1 if successful or -1 on error
+ */
+int digest_hash_sha1_finalize(
+     digest_hash_sha1_context_t *context,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	uint8_t padding[ 2 * DIGEST_HASH_BLOCK_SIZE ];
+
+	static char *function = "digest_hash_sha1_finalize";
+	uint64_t bit_count    = 0;
+	size_t padding_size   = 0;
+	int value_index       = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( hash_size < (size_t) LIBHMAC_SHA1_HASH_SIZE )
+	 || ( hash_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid hash size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( context->backend == DIGEST_HASH_BACKEND_GENERIC )
+	{
+		if( libhmac_sha1_finalize(
+		     context->libhmac_context,
+		     hash,
+		     hash_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize libhmac context.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	/* The padding consists of the remaining data, a 1-bit, 0-bits and the 64-bit
+	 * big-endian number of bits hashed and fills 1 or 2 blocks
+	 */
+	padding_size = DIGEST_HASH_BLOCK_SIZE;
+
+	if( context->block_size >= ( DIGEST_HASH_BLOCK_SIZE - 8 ) )
+	{
+		padding_size += DIGEST_HASH_BLOCK_SIZE;
+	}
+	if( memory_set(
+	     padding,
+	     0,
+	     padding_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear padding.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     padding,
+	     context->block,
+	     context->block_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy block to padding.",
+		 function );
+
+		return( -1 );
+	}
+	padding[ context->block_size ] = 0x80;
+
+	bit_count = context->hash_count * 8;
+
+	byte_stream_copy_from_uint64_big_endian(
+	 &( padding[ padding_size - 8 ] ),
+	 bit_count );
+
+	digest_hash_sha1_transform_blocks(
+	 context,
+	 padding,
+	 padding_size / DIGEST_HASH_BLOCK_SIZE );
+
+	for( value_index = 0;
+	     value_index < 5;
+	     value_index++ )
+	{
+		byte_stream_copy_from_uint32_big_endian(
+		 &( hash[ value_index * 4 ] ),
+		 context->hash_values[ value_index ] );
+	}
+	context->block_size = 0;
+
+	return( 1 );
+}
+
+#if defined( DIGEST_HASH_HAVE_X86_INTRINSICS )
+
+/* Calculates 4 SHA1 rounds using the SHA extensions
+ */
+#define DIGEST_HASH_SHA1_NI_ROUNDS( e_input, e_output, message, function_index ) \
+	e_input  = _mm_sha1nexte_epu32( e_input, message ); \
+	e_output = abcd; \
+	abcd     = _mm_sha1rnds4_epu32( abcd, e_input, function_index );
+
+/* Hashes whole blocks using the SHA extensions
+ */
+DIGEST_HASH_TARGET_SHA_NI \
+void digest_hash_sha1_ni_transform(
+      uint32_t *hash_values,
+      const uint8_t *buffer,
+      size_t number_of_blocks )
+{
+	__m128i abcd              = _mm_setzero_si128();
+	__m128i abcd_save         = _mm_setzero_si128();
+	__m128i byte_order_mask   = _mm_set_epi64x( 0x0001020304050607ULL, 0x08090a0b0c0d0e0fULL );
+	__m128i e0                = _mm_setzero_si128();
+	__m128i e0_save           = _mm_setzero_si128();
+	__m128i e1                = _mm_setzero_si128();
+	__m128i message0          = _mm_setzero_si128();
+	__m128i message1          = _mm_setzero_si128();
+	__m128i message2          = _mm_setzero_si128();
+	__m128i message3          = _mm_setzero_si128();
+
+	abcd = _mm_loadu_si128(
+	        (const __m128i *) hash_values );
+
+	abcd = _mm_shuffle_epi32(
+	        abcd,
+	        0x1b );
+
+	e0 = _mm_set_epi32(
+	      (int) hash_values[ 4 ],
+	      0,
+	      0,
+	      0 );
+
+	while( number_of_blocks > 0 )
+	{
+		abcd_save = abcd;
+		e0_save   = e0;
+
+		message0 = _mm_shuffle_epi8(
+		            _mm_loadu_si128( (const __m128i *) &( buffer[ 0 ] ) ),
+		            byte_order_mask );
+
+		message1 = _mm_shuffle_epi8(
+		            _mm_loadu_si128( (const __m128i *) &( buffer[ 16 ] ) ),
+		            byte_order_mask );
+
+		message2 = _mm_shuffle_epi8(
+		            _mm_loadu_si128( (const __m128i *) &( buffer[ 32 ] ) ),
+		            byte_order_mask );
+
+		message3 = _mm_shuffle_epi8(
+		            _mm_loadu_si128( (const __m128i *) &( buffer[ 48 ] ) ),
+		            byte_order_mask );
+
+		/* Rounds 0 - 3
+		 */
+		e0   = _mm_add_epi32( e0, message0 );
+		e1   = abcd;
+		abcd = _mm_sha1rnds4_epu32( abcd, e0, 0 );
+
+		/* Rounds 4 - 7
+		 */
+		DIGEST_HASH_SHA1_NI_ROUNDS( e1, e0, message1, 0 )
+		message0 = _mm_sha1msg1_epu32( message0, message1 );
+
+		/* Rounds 8 - 11
+		 */
+		DIGEST_HASH_SHA1_NI_ROUNDS( e0, e1, message2, 0 )
+		message1 = _mm_sha1msg1_epu32( message1, message2 );
+		message0 = _mm_xor_si128( message0, message2 );
+
+		/* Rounds 12 - 15
+		 */
+		DIGEST_HASH_SHA1_NI_ROUNDS( e1, e0, message3, 0 )
+		message0 = _mm_sha1msg2_epu32( message0, message3 );
+		message2 = _mm_sha1msg1_epu32( message2, message3 );
+		message1 = _mm_xor_si128( message1, message3 );
+
+		/* Rounds 16 - 19
+		 */
+		DIGEST_HASH_SHA1_NI_ROUNDS( e0, e1, message0, 0 )
+		message1 = _mm_sha1msg2_epu32( message1, message0 );
+		message3 = _mm_sha1msg1_epu32( message3, message0 );
+		message2 = _mm_xor_si128( message2, message0 );
+
+		/* Rounds 20 - 23
+		 */
+		DIGEST_HASH_SHA1_NI_ROUNDS( e1, e0, message1, 1 )
+		message2 = _mm_sha1msg2_epu32( message2, message1 );
+		message0 = _mm_sha1msg1_epu32( message0, message1 );
+		message3 = _mm_xor_si128( message3, message1 );
+
+		/* Rounds 24 - 27
+		 */
+		DIGEST_HASH_SHA1_NI_ROUNDS( e0, e1, message2, 1 )
+		message3 = _mm_sha1msg2_epu32( message3, message2 );
+		message1 = _mm_sha1msg1_epu32( message1, message2 );
+		message0 = _mm_xor_si128( message0, message2 );
+
+		/* Rounds 28 - 31
+		 */
+		DIGEST_HASH_SHA1_NI_ROUNDS( e1, e0, message3, 1 )
+		message0 = _mm_sha1msg2_epu32( message0, message3 );
+		message2 = _mm_sha1msg1_epu32( message2, message3 );
+		message1 = _mm_xor_si128( message1, message3 );
+
+		/* Rounds 32 - 35
+		 */
+		DIGEST_HASH_SHA1_NI_ROUNDS( e0, e1, message0, 1 )
+		message1 = _mm_sha1msg2_epu32( message1, message0 );
+		message3 = _mm_sha1msg1_epu32( message3, message0 );
+		message2 = _mm_xor_si128( message2, message0 );
+
+		/* Rounds 36 - 39
+		 */
+		DIGEST_HASH_SHA1_NI_ROUNDS( e1, e0, message1, 1 )
+		message2 = _mm_sha1msg2_epu32( message2, message1 );
+		message0 = _mm_sha1msg1_epu32( message0, message1 );
+		message3 = _mm_xor_si128( message3, message1 );
+
+		/* Rounds 40 - 43
+		 */
+		DIGEST_HASH_SHA1_NI_ROUNDS( e0, e1, message2, 2 )
+		message3 = _mm_sha1msg2_epu32( message3, message2 );
+		message1 = _mm_sha1msg1_epu32( message1, message2 );
+		message0 = _mm_xor_si128( message0, message2 );
+
+		/* Rounds 44 - 47
+		 */
+		DIGEST_HASH_SHA1_NI_ROUNDS( e1, e0, message3, 2 )
+		message0 = _mm_sha1msg2_epu32( message0, message3 );
+		message2 = _mm_sha1msg1_epu32( message2, message3 );
+		message1 = _mm_xor_si128( message1, message3 );
+
+		/* Rounds 48 - 51
+		 */
+		DIGEST_HASH_SHA1_NI_ROUNDS( e0, e1, message0, 2 )
+		message1 = _mm_sha1msg2_epu32( message1, message0 );
+		message3 = _mm_sha1msg1_epu32( message3, message0 );
+		message2 = _mm_xor_si128( message2, message0 );
+
+		/* Rounds 52 - 55
+		 */
+		DIGEST_HASH_SHA1_NI_ROUNDS( e1, e0, message1, 2 )
+		message2 = _mm_sha1msg2_epu32( message2, message1 );
+		message0 = _mm_sha1msg1_epu32( message0, message1 );
+		message3 = _mm_xor_si128( message3, message1 );
+
+		/* Rounds 56 - 59
+		 */
+		DIGEST_HASH_SHA1_NI_ROUNDS( e0, e1, message2, 2 )
+		message3 = _mm_sha1msg2_epu32( message3, message2 );
+		message1 = _mm_sha1msg1_epu32( message1, message2 );
+		message0 = _mm_xor_si128( message0, message2 );
+
+		/* Rounds 60 - 63
+		 */
+		DIGEST_HASH_SHA1_NI_ROUNDS( e1, e0, message3, 3 )
+		message0 = _mm_sha1msg2_epu32( message0, message3 );
+		message2 = _mm_sha1msg1_epu32( message2, message3 );
+		message1 = _mm_xor_si128( message1, message3 );
+
+		/* Rounds 64 - 67
+		 */
+		DIGEST_HASH_SHA1_NI_ROUNDS( e0, e1, message0, 3 )
+		message1 = _mm_sha1msg2_epu32( message1, message0 );
+		message3 = _mm_sha1msg1_epu32( message3, message0 );
+		message2 = _mm_xor_si128( message2, message0 );
+
+		/* Rounds 68 - 71
+		 */
+		DIGEST_HASH_SHA1_NI_ROUNDS( e1, e0, message1, 3 )
+		message2 = _mm_sha1msg2_epu32( message2, message1 );
+		message3 = _mm_xor_si128( message3, message1 );
+
+		/* Rounds 72 - 75
+		 */
+		DIGEST_HASH_SHA1_NI_ROUNDS( e0, e1, message2, 3 )
+		message3 = _mm_sha1msg2_epu32( message3, message2 );
+
+		/* Rounds 76 - 79
+		 */
+		DIGEST_HASH_SHA1_NI_ROUNDS( e1, e0, message3, 3 )
+
+		e0   = _mm_sha1nexte_epu32( e0, e0_save );
+		abcd = _mm_add_epi32( abcd, abcd_save );
+
+		buffer           += DIGEST_HASH_BLOCK_SIZE;
+		number_of_blocks -= 1;
+	}
+	abcd = _mm_shuffle_epi32(
+	        abcd,
+	        0x1b );
+
+	_mm_storeu_si128(
+	 (__m128i *) hash_values,
+	 abcd );
+
+	hash_values[ 4 ] = (uint32_t) _mm_extract_epi32(
+	                               e0,
+	                               3 );
+}
+
+#endif /* defined( DIGEST_HASH_HAVE_X86_INTRINSICS ) */
+
+/* The SHA256 round constants
+ */
+const uint32_t digest_hash_sha256_round_constants[ 64 ] = {
+	0x428a2f98UL, 0x71374491UL, 0xb5c0fbcfUL, 0xe9b5dba5UL, 0x3956c25bUL, 0x59f111f1UL, 0x923f82a4UL, 0xab1c5ed5UL,
+	0xd807aa98UL, 0x12835b01UL, 0x243185beUL, 0x550c7dc3UL, 0x72be5d74UL, 0x80deb1feUL, 0x9bdc06a7UL, 0xc19bf174UL,
+	0xe49b69c1UL, 0xefbe4786UL, 0x0fc19dc6UL, 0x240ca1ccUL, 0x2de92c6fUL, 0x4a7484aaUL, 0x5cb0a9dcUL, 0x76f988daUL,
+	0x983e5152UL, 0xa831c66dUL, 0xb00327c8UL, 0xbf597fc7UL, 0xc6e00bf3UL, 0xd5a79147UL, 0x06ca6351UL, 0x14292967UL,
+	0x27b70a85UL, 0x2e1b2138UL, 0x4d2c6dfcUL, 0x53380d13UL, 0x650a7354UL, 0x766a0abbUL, 0x81c2c92eUL, 0x92722c85UL,
+	0xa2bfe8a1UL, 0xa81a664bUL, 0xc24b8b70UL, 0xc76c51a3UL, 0xd192e819UL, 0xd6990624UL, 0xf40e3585UL, 0x106aa070UL,
+	0x19a4c116UL, 0x1e376c08UL, 0x2748774cUL, 0x34b0bcb5UL, 0x391c0cb3UL, 0x4ed8aa4aUL, 0x5b9cca4fUL, 0x682e6ff3UL,
+	0x748f82eeUL, 0x78a5636fUL, 0x84c87814UL, 0x8cc70208UL, 0x90befffaUL, 0xa4506cebUL, 0xbef9a3f7UL, 0xc67178f2UL };
+
+/* The SHA256 initial hash values
+ */
+const uint32_t digest_hash_sha256_initial_hash_values[ 8 ] = {
+	0x6a09e667UL, 0xbb67ae85UL, 0x3c6ef372UL, 0xa54ff53aUL, 0x510e527fUL, 0x9b05688cUL, 0x1f83d9abUL, 0x5be0cd19UL };
+
+/* Determines the SHA256 backend that is selected by default
+ * The SHA-NI backend is only selected when libhmac does not use libcrypto
+ * Returns the backend
+ */
+int digest_hash_sha256_get_default_backend(
+     void )
+{
+#if defined( DIGEST_HASH_LIBHMAC_SHA256_IS_PORTABLE )
+	if( digest_hash_backend_is_supported(
+	     DIGEST_HASH_BACKEND_SHA_NI ) != 0 )
+	{
+		return( DIGEST_HASH_BACKEND_SHA_NI );
+	}
+#endif
+	return( DIGEST_HASH_BACKEND_GENERIC );
+}
+
+/* Determines if hashing multiple buffers in parallel is preferred over hashing them one by one
+ * Multi-buffer hashing using AVX2 is slower in aggregate than libcrypto and the SHA extensions,
+ * hence it is only preferred when libhmac does not use libcrypto, AVX2 is supported and
+ * the SHA extensions are not
+ * Returns 1 if preferred or 0 if not
+ */
+int digest_hash_sha256_multi_buffer_is_preferred(
+     void )
+{
+#if defined( DIGEST_HASH_LIBHMAC_SHA256_IS_PORTABLE )
+	uint32_t cpu_features = digest_hash_get_cpu_features();
+
+	if( ( ( cpu_features & DIGEST_HASH_CPU_FEATURE_AVX2 ) != 0 )
+	 && ( ( cpu_features & DIGEST_HASH_CPU_FEATURE_SHA_NI ) == 0 ) )
+	{
+		return( 1 );
+	}
+#endif
+	return( 0 );
+}
+
+/* Creates a SHA256 context using the default backend
+ * Make sure the value context is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int digest_hash_sha256_initialize(
+     digest_hash_sha256_context_t **context,
+     libcerror_error_t **error )
+{
+	return( digest_hash_sha256_initialize_with_backend(
+	         context,
+	         DIGEST_HASH_BACKEND_DEFAULT,
+	         error ) );
+}
+
+/* Creates a SHA256 context that can be updated by digest_hash_sha256_multi_buffer_update
+ * The context uses the AVX2 backend if supported and the default backend otherwise
+ * Make sure the value context is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int digest_hash_sha256_initialize_multi_buffer(
+     digest_hash_sha256_context_t **context,
+     libcerror_error_t **error )
+{
+	int backend = DIGEST_HASH_BACKEND_DEFAULT;
+
+	if( digest_hash_backend_is_supported(
+	     DIGEST_HASH_BACKEND_AVX2 ) != 0 )
+	{
+		backend = DIGEST_HASH_BACKEND_AVX2;
+	}
+	return( digest_hash_sha256_initialize_with_backend(
+	         context,
+	         backend,
+	         error ) );
+}
+
+/* Creates a SHA256 context using a specific backend
+ * The AVX2 backend only hashes buffers in parallel in digest_hash_sha256_multi_buffer_update
+ * otherwise it uses the portable implementation
+ * Make sure the value context is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int digest_hash_sha256_initialize_with_backend(
+     digest_hash_sha256_context_t **context,
+     int backend,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_hash_sha256_initialize_with_backend";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( backend == DIGEST_HASH_BACKEND_DEFAULT )
+	{
+		backend = digest_hash_sha256_get_default_backend();
+	}
+	if( ( ( backend != DIGEST_HASH_BACKEND_GENERIC )
+	  &&  ( backend != DIGEST_HASH_BACKEND_SHA_NI )
+	  &&  ( backend != DIGEST_HASH_BACKEND_AVX2 ) )
+	 || ( digest_hash_backend_is_supported(
+	       backend ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported backend: %d.",
+		 function,
+		 backend );
+
+		return( -1 );
+	}
+	*context = memory_allocate_structure(
+	            digest_hash_sha256_context_t );
+
+	if( *context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create context.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *context,
+	     0,
+	     sizeof( digest_hash_sha256_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear context.",
+		 function );
+
+		goto on_error;
+	}
+	if( backend == DIGEST_HASH_BACKEND_GENERIC )
+	{
+		if( libhmac_sha256_initialize(
+		     &( ( *context )->libhmac_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create libhmac context.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else if( memory_copy(
+	          ( *context )->hash_values,
+	          digest_hash_sha256_initial_hash_values,
+	          sizeof( uint32_t ) * 8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy initial hash values.",
+		 function );
+
+		goto on_error;
+	}
+	( *context )->backend = backend;
+
+	return( 1 );
+
+on_error:
+	if( *context != NULL )
+	{
+		memory_free(
+		 *context );
+
+		*context = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a SHA256 context
+ * Returns 1 if successful or -1 on error
+ */
+int digest_hash_sha256_free(
+     digest_hash_sha256_context_t **context,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_hash_sha256_free";
+	int result            = 1;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		if( ( *context )->libhmac_context != NULL )
+		{
+			if( libhmac_sha256_free(
+			     &( ( *context )->libhmac_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free libhmac context.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *context );
+
+		*context = NULL;
+	}
+	return( result );
+}
+
+#define DIGEST_HASH_ROTATE_RIGHT( value, number_of_bits ) \
+	( ( ( value ) >> ( number_of_bits ) ) | ( ( value ) << ( 32 - ( number_of_bits ) ) ) )
+
+/* Hashes whole blocks using the portable implementation
+ */
+void digest_hash_sha256_transform(
+      uint32_t *hash_values,
+      const uint8_t *buffer,
+      size_t number_of_blocks )
+{
+	uint32_t message_schedule[ 64 ];
+	uint32_t state[ 8 ];
+
+	uint32_t sigma0           = 0;
+	uint32_t sigma1           = 0;
+	uint32_t temporary_value1 = 0;
+	uint32_t temporary_value2 = 0;
+	int round_index           = 0;
+	int value_index           = 0;
+
+	while( number_of_blocks > 0 )
+	{
+		for( round_index = 0;
+		     round_index < 16;
+		     round_index++ )
+		{
+			byte_stream_copy_to_uint32_big_endian(
+			 &( buffer[ round_index * 4 ] ),
+			 message_schedule[ round_index ] );
+		}
+		for( round_index = 16;
+		     round_index < 64;
+		     round_index++ )
+		{
+			sigma0 = DIGEST_HASH_ROTATE_RIGHT( message_schedule[ round_index - 15 ], 7 )
+			       ^ DIGEST_HASH_ROTATE_RIGHT( message_schedule[ round_index - 15 ], 18 )
+			       ^ ( message_schedule[ round_index - 15 ] >> 3 );
+
+			sigma1 = DIGEST_HASH_ROTATE_RIGHT( message_schedule[ round_index - 2 ], 17 )
+			       ^ DIGEST_HASH_ROTATE_RIGHT( message_schedule[ round_index - 2 ], 19 )
+			       ^ ( message_schedule[ round_index - 2 ] >> 10 );
+
+			message_schedule[ round_index ] = message_schedule[ round_index - 16 ] + sigma0
+			                                + message_schedule[ round_index - 7 ] + sigma1;
+		}
+		for( value_index = 0;
+		     value_index < 8;
+		     value_index++ )
+		{
+			state[ value_index ] = hash_values[ value_index ];
+		}
+		for( round_index = 0;
+		     round_index < 64;
+		     round_index++ )
+		{
+			sigma1 = DIGEST_HASH_ROTATE_RIGHT( state[ 4 ], 6 )
+			       ^ DIGEST_HASH_ROTATE_RIGHT( state[ 4 ], 11 )
+			       ^ DIGEST_HASH_ROTATE_RIGHT( state[ 4 ], 25 );
+
+			temporary_value1 = state[ 7 ] + sigma1
+			                 + ( ( state[ 4 ] & state[ 5 ] ) ^ ( ~( state[ 4 ] ) & state[ 6 ] ) )
+			                 + digest_hash_sha256_round_constants[ round_index ]
+			                 + message_schedule[ round_index ];
+
+			sigma0 = DIGEST_HASH_ROTATE_RIGHT( state[ 0 ], 2 )
+			       ^ DIGEST_HASH_ROTATE_RIGHT( state[ 0 ], 13 )
+			       ^ DIGEST_HASH_ROTATE_RIGHT( state[ 0 ], 22 );
+
+			temporary_value2 = sigma0
+			                 + ( ( state[ 0 ] & state[ 1 ] ) ^ ( state[ 0 ] & state[ 2 ] ) ^ ( state[ 1 ] & state[ 2 ] ) );
+
+			state[ 7 ] = state[ 6 ];
+			state[ 6 ] = state[ 5 ];
+			state[ 5 ] = state[ 4 ];
+			state[ 4 ] = state[ 3 ] + temporary_value1;
+			state[ 3 ] = state[ 2 ];
+			state[ 2 ] = state[ 1 ];
+			state[ 1 ] = state[ 0 ];
+			state[ 0 ] = temporary_value1 + temporary_value2;
+		}
+		for( value_index = 0;
+		     value_index < 8;
+		     value_index++ )
+		{
+			hash_values[ value_index ] += state[ value_index ];
+		}
+		buffer           += DIGEST_HASH_BLOCK_SIZE;
+		number_of_blocks -= 1;
+	}
+}
+
+/* Hashes whole blocks using the backend of the SHA256 context
+ */
+void digest_hash_sha256_transform_blocks(
+      digest_hash_sha256_context_t *context,
+      const uint8_t *buffer,
+      size_t number_of_blocks )
+{
+#if defined( DIGEST_HASH_HAVE_X86_INTRINSICS )
+	if( context->backend == DIGEST_HASH_BACKEND_SHA_NI )
+	{
+		digest_hash_sha256_ni_transform(
+		 context->hash_values,
+		 buffer,
+		 number_of_blocks );
+
+		return;
+	}
+#endif
+	digest_hash_sha256_transform(
+	 context->hash_values,
+	 buffer,
+	 number_of_blocks );
+}
+/* Updates a SHA256 context
+ * Returns 1 if successful or -1 on error
+ */
+int digest_hash_sha256_update(
+     digest_hash_sha256_context_t *context,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function   = "digest_hash_sha256_update";
+	size_t buffer_offset    = 0;
+	size_t copy_size        = 0;
+	size_t number_of_blocks = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( context->backend == DIGEST_HASH_BACKEND_GENERIC )
+	{
+		if( libhmac_sha256_update(
+		     context->libhmac_context,
+		     buffer,
+		     size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update libhmac context.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( context->block_size > 0 )
+	{
+		copy_size = DIGEST_HASH_BLOCK_SIZE - context->block_size;
+
+		if( copy_size > size )
+		{
+			copy_size = size;
+		}
+		if( memory_copy(
+		     &( context->block[ context->block_size ] ),
+		     buffer,
+		     copy_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to block.",
+			 function );
+
+			return( -1 );
+		}
+		context->block_size += copy_size;
+		buffer_offset        = copy_size;
+
+		if( context->block_size == DIGEST_HASH_BLOCK_SIZE )
+		{
+			digest_hash_sha256_transform_blocks(
+			 context,
+			 context->block,
+			 1 );
+
+			context->block_size = 0;
+		}
+	}
+	number_of_blocks = ( size - buffer_offset ) / DIGEST_HASH_BLOCK_SIZE;
+
+	if( number_of_blocks > 0 )
+	{
+		digest_hash_sha256_transform_blocks(
+		 context,
+		 &( buffer[ buffer_offset ] ),
+		 number_of_blocks );
+
+		buffer_offset += number_of_blocks * DIGEST_HASH_BLOCK_SIZE;
+	}
+	if( buffer_offset < size )
+	{
+		if( memory_copy(
+		     context->block,
+		     &( buffer[ buffer_offset ] ),
+		     size - buffer_offset ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to block.",
+			 function );
+
+			return( -1 );
+		}
+		context->block_size = size - buffer_offset;
+	}
+	context->hash_count += size;
+
+	return( 1 );
+}
+
+/* Updates multiple SHA256 contexts, each with its own buffer
+ * If all contexts use the AVX2 backend the whole blocks of the buffers are hashed in parallel,
+ * otherwise the contexts are updated one by one
+ * Returns 1 if successful or -1 on error
+ */
+int digest_hash_sha256_multi_buffer_update(
+     digest_hash_sha256_context_t **contexts,
+     const uint8_t **buffers,
+     const size_t *sizes,
+     int number_of_contexts,
+     libcerror_error_t **error )
+{
+	size_t buffer_offsets[ DIGEST_HASH_MAXIMUM_NUMBER_OF_LANES ];
+
+#if defined( DIGEST_HASH_HAVE_X86_INTRINSICS )
+	uint32_t unused_hash_values[ 8 ];
+
+	const uint8_t *lane_buffers[ DIGEST_HASH_MAXIMUM_NUMBER_OF_LANES ];
+	uint32_t *lane_hash_values[ DIGEST_HASH_MAXIMUM_NUMBER_OF_LANES ];
+	int lane_context_indexes[ DIGEST_HASH_MAXIMUM_NUMBER_OF_LANES ];
+
+	size_t copy_size                  = 0;
+	size_t lane_number_of_blocks      = 0;
+	size_t number_of_blocks           = 0;
+	int lane_index                    = 0;
+	int number_of_lanes               = 0;
+	int use_multi_buffer              = 0;
+#endif
+	static char *function             = "digest_hash_sha256_multi_buffer_update";
+	int context_index                 = 0;
+
+	if( contexts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid contexts.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffers.",
+		 function );
+
+		return( -1 );
+	}
+	if( sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_contexts <= 0 )
+	 || ( number_of_contexts > DIGEST_HASH_MAXIMUM_NUMBER_OF_LANES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of contexts value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( context_index = 0;
+	     context_index < number_of_contexts;
+	     context_index++ )
+	{
+		if( ( contexts[ context_index ] == NULL )
+		 || ( buffers[ context_index ] == NULL )
+		 || ( sizes[ context_index ] > (size_t) SSIZE_MAX ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid context, buffer or size: %d.",
+			 function,
+			 context_index );
+
+			return( -1 );
+		}
+		buffer_offsets[ context_index ] = 0;
+	}
+#if defined( DIGEST_HASH_HAVE_X86_INTRINSICS )
+	if( number_of_contexts > 1 )
+	{
+		use_multi_buffer = 1;
+
+		for( context_index = 0;
+		     context_index < number_of_contexts;
+		     context_index++ )
+		{
+			if( contexts[ context_index ]->backend != DIGEST_HASH_BACKEND_AVX2 )
+			{
+				use_multi_buffer = 0;
+
+				break;
+			}
+		}
+	}
+	if( use_multi_buffer != 0 )
+	{
+		/* Complete the partial blocks first so that every lane starts at a block boundary
+		 */
+		for( context_index = 0;
+		     context_index < number_of_contexts;
+		     context_index++ )
+		{
+			if( contexts[ context_index ]->block_size == 0 )
+			{
+				continue;
+			}
+			copy_size = DIGEST_HASH_BLOCK_SIZE - contexts[ context_index ]->block_size;
+
+			if( copy_size > sizes[ context_index ] )
+			{
+				copy_size = sizes[ context_index ];
+			}
+			if( digest_hash_sha256_update(
+			     contexts[ context_index ],
+			     buffers[ context_index ],
+			     copy_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update context: %d.",
+				 function,
+				 context_index );
+
+				return( -1 );
+			}
+			buffer_offsets[ context_index ] = copy_size;
+		}
+		/* Hash the whole blocks in parallel as long as at least 2 buffers have whole blocks remaining,
+		 * unused lanes hash the data of the first lane into unused hash values
+		 */
+		do
+		{
+			number_of_blocks = 0;
+			number_of_lanes  = 0;
+
+			for( context_index = 0;
+			     context_index < number_of_contexts;
+			     context_index++ )
+			{
+				lane_number_of_blocks = ( sizes[ context_index ] - buffer_offsets[ context_index ] ) / DIGEST_HASH_BLOCK_SIZE;
+
+				if( lane_number_of_blocks == 0 )
+				{
+					continue;
+				}
+				if( ( number_of_blocks == 0 )
+				 || ( lane_number_of_blocks < number_of_blocks ) )
+				{
+					number_of_blocks = lane_number_of_blocks;
+				}
+				lane_context_indexes[ number_of_lanes++ ] = context_index;
+			}
+			if( number_of_lanes < 2 )
+			{
+				break;
+			}
+			for( lane_index = 0;
+			     lane_index < DIGEST_HASH_MAXIMUM_NUMBER_OF_LANES;
+			     lane_index++ )
+			{
+				if( lane_index < number_of_lanes )
+				{
+					context_index = lane_context_indexes[ lane_index ];
+
+					lane_hash_values[ lane_index ] = contexts[ context_index ]->hash_values;
+				}
+				else
+				{
+					context_index = lane_context_indexes[ 0 ];
+
+					lane_hash_values[ lane_index ] = unused_hash_values;
+				}
+				lane_buffers[ lane_index ] = &( ( buffers[ context_index ] )[ buffer_offsets[ context_index ] ] );
+			}
+			digest_hash_sha256_avx2_transform(
+			 lane_hash_values,
+			 lane_buffers,
+			 number_of_blocks );
+
+			for( lane_index = 0;
+			     lane_index < number_of_lanes;
+			     lane_index++ )
+			{
+				context_index = lane_context_indexes[ lane_index ];
+
+				buffer_offsets[ context_index ]        += number_of_blocks * DIGEST_HASH_BLOCK_SIZE;
+				contexts[ context_index ]->hash_count += number_of_blocks * DIGEST_HASH_BLOCK_SIZE;
+			}
+		}
+		while( number_of_lanes >= 2 );
+	}
+#endif /* defined( DIGEST_HASH_HAVE_X86_INTRINSICS ) */
+
+	/* Hash the remaining data one buffer at a time
+	 */
+	for( context_index = 0;
+	     context_index < number_of_contexts;
+	     context_index++ )
+	{
+		if( buffer_offsets[ context_index ] >= sizes[ context_index ] )
+		{
+			continue;
+		}
+		if( digest_hash_sha256_update(
+		     contexts[ context_index ],
+		     &( ( buffers[ context_index ] )[ buffer_offsets[ context_index ] ] ),
+		     sizes[ context_index ] - buffer_offsets[ context_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update context: %d.",
+			 function,
+			 context_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Finalizes a SHA256 context
+ * Returns 1 if successful or -1 on error
+ */
+int digest_hash_sha256_finalize(
+     digest_hash_sha256_context_t *context,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	uint8_t padding[ 2 * DIGEST_HASH_BLOCK_SIZE ];
+
+	static char *function = "digest_hash_sha256_finalize";
+	uint64_t bit_count    = 0;
+	size_t padding_size   = 0;
+	int value_index       = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( hash_size < (size_t) LIBHMAC_SHA256_HASH_SIZE )
+	 || ( hash_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid hash size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( context->backend == DIGEST_HASH_BACKEND_GENERIC )
+	{
+		if( libhmac_sha256_finalize(
+		     context->libhmac_context,
+		     hash,
+		     hash_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize libhmac context.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	/* The padding consists of the remaining data, a 1-bit, 0-bits and the 64-bit
+	 * big-endian number of bits hashed and fills 1 or 2 blocks
+	 */
+	padding_size = DIGEST_HASH_BLOCK_SIZE;
+
+	if( context->block_size >= ( DIGEST_HASH_BLOCK_SIZE - 8 ) )
+	{
+		padding_size += DIGEST_HASH_BLOCK_SIZE;
+	}
+	if( memory_set(
+	     padding,
+	     0,
+	     padding_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear padding.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     padding,
+	     context->block,
+	     context->block_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy block to padding.",
+		 function );
+
+		return( -1 );
+	}
+	padding[ context->block_size ] = 0x80;
+
+	bit_count = context->hash_count * 8;
+
+	byte_stream_copy_from_uint64_big_endian(
+	 &( padding[ padding_size - 8 ] ),
+	 bit_count );
+
+	digest_hash_sha256_transform_blocks(
+	 context,
+	 padding,
+	 padding_size / DIGEST_HASH_BLOCK_SIZE );
+
+	for( value_index = 0;
+	     value_index < 8;
+	     value_index++ )
+	{
+		byte_stream_copy_from_uint32_big_endian(
+		 &( hash[ value_index * 4 ] ),
+		 context->hash_values[ value_index ] );
+	}
+	context->block_size = 0;
+
+	return( 1 );
+}
+
+
+#if defined( DIGEST_HASH_HAVE_X86_INTRINSICS )
+
+/* Calculates 4 SHA256 rounds using the SHA extensions
+ */
+#define DIGEST_HASH_SHA256_NI_ROUNDS( message, round_index ) \
+	message_value = _mm_add_epi32( message, _mm_loadu_si128( (const __m128i *) &( digest_hash_sha256_round_constants[ round_index ] ) ) ); \
+	state1        = _mm_sha256rnds2_epu32( state1, state0, message_value ); \
+	message_value = _mm_shuffle_epi32( message_value, 0x0e ); \
+	state0        = _mm_sha256rnds2_epu32( state0, state1, message_value );
+
+/* Calculates the next 4 words of the SHA256 message schedule using the SHA extensions
+ */
+#define DIGEST_HASH_SHA256_NI_SCHEDULE( next_message, message, previous_message ) \
+	next_message = _mm_add_epi32( next_message, _mm_alignr_epi8( message, previous_message, 4 ) ); \
+	next_message = _mm_sha256msg2_epu32( next_message, message );
+
+/* Hashes whole blocks using the SHA extensions
+ */
+DIGEST_HASH_TARGET_SHA_NI \
+void digest_hash_sha256_ni_transform(
+      uint32_t *hash_values,
+      const uint8_t *buffer,
+      size_t number_of_blocks )
+{
+	__m128i byte_order_mask = _mm_set_epi64x( 0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL );
+	__m128i message0        = _mm_setzero_si128();
+	__m128i message1        = _mm_setzero_si128();
+	__m128i message2        = _mm_setzero_si128();
+	__m128i message3        = _mm_setzero_si128();
+	__m128i message_value   = _mm_setzero_si128();
+	__m128i state0          = _mm_setzero_si128();
+	__m128i state0_save     = _mm_setzero_si128();
+	__m128i state1          = _mm_setzero_si128();
+	__m128i state1_save     = _mm_setzero_si128();
+	int round_index         = 0;
+
+	/* The SHA extensions store the state as ABEF and CDGH
+	 */
+	message_value = _mm_loadu_si128(
+	                 (const __m128i *) &( hash_values[ 0 ] ) );
+
+	state1 = _mm_loadu_si128(
+	          (const __m128i *) &( hash_values[ 4 ] ) );
+
+	message_value = _mm_shuffle_epi32(
+	                 message_value,
+	                 0xb1 );
+
+	state1 = _mm_shuffle_epi32(
+	          state1,
+	          0x1b );
+
+	state0 = _mm_alignr_epi8(
+	          message_value,
+	          state1,
+	          8 );
+
+	state1 = _mm_blend_epi16(
+	          state1,
+	          message_value,
+	          0xf0 );
+
+	while( number_of_blocks > 0 )
+	{
+		state0_save = state0;
+		state1_save = state1;
+
+		message0 = _mm_shuffle_epi8(
+		            _mm_loadu_si128( (const __m128i *) &( buffer[ 0 ] ) ),
+		            byte_order_mask );
+
+		message1 = _mm_shuffle_epi8(
+		            _mm_loadu_si128( (const __m128i *) &( buffer[ 16 ] ) ),
+		            byte_order_mask );
+
+		message2 = _mm_shuffle_epi8(
+		            _mm_loadu_si128( (const __m128i *) &( buffer[ 32 ] ) ),
+		            byte_order_mask );
+
+		message3 = _mm_shuffle_epi8(
+		            _mm_loadu_si128( (const __m128i *) &( buffer[ 48 ] ) ),
+		            byte_order_mask );
+
+		/* Rounds 0 - 15
+		 */
+		DIGEST_HASH_SHA256_NI_ROUNDS( message0, 0 )
+
+		DIGEST_HASH_SHA256_NI_ROUNDS( message1, 4 )
+		message0 = _mm_sha256msg1_epu32( message0, message1 );
+
+		DIGEST_HASH_SHA256_NI_ROUNDS( message2, 8 )
+		message1 = _mm_sha256msg1_epu32( message1, message2 );
+
+		DIGEST_HASH_SHA256_NI_ROUNDS( message3, 12 )
+		DIGEST_HASH_SHA256_NI_SCHEDULE( message0, message3, message2 )
+		message2 = _mm_sha256msg1_epu32( message2, message3 );
+
+		/* Rounds 16 - 47
+		 */
+		for( round_index = 16;
+		     round_index < 48;
+		     round_index += 16 )
+		{
+			DIGEST_HASH_SHA256_NI_ROUNDS( message0, round_index )
+			DIGEST_HASH_SHA256_NI_SCHEDULE( message1, message0, message3 )
+			message3 = _mm_sha256msg1_epu32( message3, message0 );
+
+			DIGEST_HASH_SHA256_NI_ROUNDS( message1, round_index + 4 )
+			DIGEST_HASH_SHA256_NI_SCHEDULE( message2, message1, message0 )
+			message0 = _mm_sha256msg1_epu32( message0, message1 );
+
+			DIGEST_HASH_SHA256_NI_ROUNDS( message2, round_index + 8 )
+			DIGEST_HASH_SHA256_NI_SCHEDULE( message3, message2, message1 )
+			message1 = _mm_sha256msg1_epu32( message1, message2 );
+
+			DIGEST_HASH_SHA256_NI_ROUNDS( message3, round_index + 12 )
+			DIGEST_HASH_SHA256_NI_SCHEDULE( message0, message3, message2 )
+			message2 = _mm_sha256msg1_epu32( message2, message3 );
+		}
+		/* Rounds 48 - 63
+		 */
+		DIGEST_HASH_SHA256_NI_ROUNDS( message0, 48 )
+		DIGEST_HASH_SHA256_NI_SCHEDULE( message1, message0, message3 )
+		message3 = _mm_sha256msg1_epu32( message3, message0 );
+
+		DIGEST_HASH_SHA256_NI_ROUNDS( message1, 52 )
+		DIGEST_HASH_SHA256_NI_SCHEDULE( message2, message1, message0 )
+
+		DIGEST_HASH_SHA256_NI_ROUNDS( message2, 56 )
+		DIGEST_HASH_SHA256_NI_SCHEDULE( message3, message2, message1 )
+
+		DIGEST_HASH_SHA256_NI_ROUNDS( message3, 60 )
+
+		state0 = _mm_add_epi32( state0, state0_save );
+		state1 = _mm_add_epi32( state1, state1_save );
+
+		buffer           += DIGEST_HASH_BLOCK_SIZE;
+		number_of_blocks -= 1;
+	}
+	message_value = _mm_shuffle_epi32(
+	                 state0,
+	                 0x1b );
+
+	state1 = _mm_shuffle_epi32(
+	          state1,
+	          0xb1 );
+
+	state0 = _mm_blend_epi16(
+	          message_value,
+	          state1,
+	          0xf0 );
+
+	state1 = _mm_alignr_epi8(
+	          state1,
+	          message_value,
+	          8 );
+
+	_mm_storeu_si128(
+	 (__m128i *) &( hash_values[ 0 ] ),
+	 state0 );
+
+	_mm_storeu_si128(
+	 (__m128i *) &( hash_values[ 4 ] ),
+	 state1 );
+}
+
+#define DIGEST_HASH_AVX2_ROTATE_RIGHT( value, number_of_bits ) \
+	_mm256_or_si256( _mm256_srli_epi32( value, number_of_bits ), _mm256_slli_epi32( value, 32 - ( number_of_bits ) ) )
+
+/* Hashes whole blocks of 8 buffers in parallel using AVX2
+ * Every 32-bit element of the AVX2 registers contains the value of one of the buffers
+ */
+DIGEST_HASH_TARGET_AVX2 \
+void digest_hash_sha256_avx2_transform(
+      uint32_t **hash_values,
+      const uint8_t **buffers,
+      size_t number_of_blocks )
+{
+	__m256i message_schedule[ 16 ];
+	__m256i saved_state[ 8 ];
+	__m256i state[ 8 ];
+	__m256i unpacked_values[ 8 ];
+	__m256i words[ 8 ];
+
+	uint32_t lane_values[ DIGEST_HASH_MAXIMUM_NUMBER_OF_LANES ];
+
+	__m256i byte_order_mask  = _mm256_set_epi8(
+	                            12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3,
+	                            12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3 );
+	__m256i sigma0           = _mm256_setzero_si256();
+	__m256i sigma1           = _mm256_setzero_si256();
+	__m256i temporary_value1 = _mm256_setzero_si256();
+	__m256i temporary_value2 = _mm256_setzero_si256();
+	size_t block_offset      = 0;
+	int lane_index           = 0;
+	int round_index          = 0;
+	int value_index          = 0;
+	int word_index           = 0;
+
+	for( value_index = 0;
+	     value_index < 8;
+	     value_index++ )
+	{
+		state[ value_index ] = _mm256_set_epi32(
+		                        (int) hash_values[ 7 ][ value_index ],
+		                        (int) hash_values[ 6 ][ value_index ],
+		                        (int) hash_values[ 5 ][ value_index ],
+		                        (int) hash_values[ 4 ][ value_index ],
+		                        (int) hash_values[ 3 ][ value_index ],
+		                        (int) hash_values[ 2 ][ value_index ],
+		                        (int) hash_values[ 1 ][ value_index ],
+		                        (int) hash_values[ 0 ][ value_index ] );
+	}
+	while( number_of_blocks > 0 )
+	{
+		/* Transpose the 8 words of 8 buffers so that every register contains the same word of every buffer
+		 */
+		for( word_index = 0;
+		     word_index < 16;
+		     word_index += 8 )
+		{
+			for( lane_index = 0;
+			     lane_index < DIGEST_HASH_MAXIMUM_NUMBER_OF_LANES;
+			     lane_index++ )
+			{
+				words[ lane_index ] = _mm256_loadu_si256(
+				                       (const __m256i *) &( ( buffers[ lane_index ] )[ block_offset + ( word_index * 4 ) ] ) );
+			}
+			for( lane_index = 0;
+			     lane_index < DIGEST_HASH_MAXIMUM_NUMBER_OF_LANES;
+			     lane_index += 2 )
+			{
+				unpacked_values[ lane_index ]     = _mm256_unpacklo_epi32( words[ lane_index ], words[ lane_index + 1 ] );
+				unpacked_values[ lane_index + 1 ] = _mm256_unpackhi_epi32( words[ lane_index ], words[ lane_index + 1 ] );
+			}
+			for( lane_index = 0;
+			     lane_index < DIGEST_HASH_MAXIMUM_NUMBER_OF_LANES;
+			     lane_index += 4 )
+			{
+				words[ lane_index ]     = _mm256_unpacklo_epi64( unpacked_values[ lane_index ], unpacked_values[ lane_index + 2 ] );
+				words[ lane_index + 1 ] = _mm256_unpackhi_epi64( unpacked_values[ lane_index ], unpacked_values[ lane_index + 2 ] );
+				words[ lane_index + 2 ] = _mm256_unpacklo_epi64( unpacked_values[ lane_index + 1 ], unpacked_values[ lane_index + 3 ] );
+				words[ lane_index + 3 ] = _mm256_unpackhi_epi64( unpacked_values[ lane_index + 1 ], unpacked_values[ lane_index + 3 ] );
+			}
+			for( lane_index = 0;
+			     lane_index < 4;
+			     lane_index++ )
+			{
+				message_schedule[ word_index + lane_index ] = _mm256_shuffle_epi8(
+				                                               _mm256_permute2x128_si256( words[ lane_index ], words[ lane_index + 4 ], 0x20 ),
+				                                               byte_order_mask );
+
+				message_schedule[ word_index + lane_index + 4 ] = _mm256_shuffle_epi8(
+				                                                   _mm256_permute2x128_si256( words[ lane_index ], words[ lane_index + 4 ], 0x31 ),
+				                                                   byte_order_mask );
+			}
+		}
+		for( value_index = 0;
+		     value_index < 8;
+		     value_index++ )
+		{
+			saved_state[ value_index ] = state[ value_index ];
+		}
+		for( round_index = 0;
+		     round_index < 64;
+		     round_index++ )
+		{
+			/* The message schedule is calculated in place using the last 16 words
+			 */
+			if( round_index >= 16 )
+			{
+				word_index = ( round_index - 15 ) & 0x0f;
+
+				sigma0 = _mm256_xor_si256(
+				          _mm256_xor_si256(
+				           DIGEST_HASH_AVX2_ROTATE_RIGHT( message_schedule[ word_index ], 7 ),
+				           DIGEST_HASH_AVX2_ROTATE_RIGHT( message_schedule[ word_index ], 18 ) ),
+				          _mm256_srli_epi32( message_schedule[ word_index ], 3 ) );
+
+				word_index = ( round_index - 2 ) & 0x0f;
+
+				sigma1 = _mm256_xor_si256(
+				          _mm256_xor_si256(
+				           DIGEST_HASH_AVX2_ROTATE_RIGHT( message_schedule[ word_index ], 17 ),
+				           DIGEST_HASH_AVX2_ROTATE_RIGHT( message_schedule[ word_index ], 19 ) ),
+				          _mm256_srli_epi32( message_schedule[ word_index ], 10 ) );
+
+				message_schedule[ round_index & 0x0f ] = _mm256_add_epi32(
+				                                          _mm256_add_epi32( message_schedule[ round_index & 0x0f ], sigma0 ),
+				                                          _mm256_add_epi32( message_schedule[ ( round_index - 7 ) & 0x0f ], sigma1 ) );
+			}
+			sigma1 = _mm256_xor_si256(
+			          _mm256_xor_si256(
+			           DIGEST_HASH_AVX2_ROTATE_RIGHT( state[ 4 ], 6 ),
+			           DIGEST_HASH_AVX2_ROTATE_RIGHT( state[ 4 ], 11 ) ),
+			          DIGEST_HASH_AVX2_ROTATE_RIGHT( state[ 4 ], 25 ) );
+
+			temporary_value1 = _mm256_add_epi32(
+			                    _mm256_add_epi32( state[ 7 ], sigma1 ),
+			                    _mm256_xor_si256(
+			                     _mm256_and_si256( state[ 4 ], state[ 5 ] ),
+			                     _mm256_andnot_si256( state[ 4 ], state[ 6 ] ) ) );
+
+			temporary_value1 = _mm256_add_epi32(
+			                    temporary_value1,
+			                    _mm256_add_epi32(
+			                     _mm256_set1_epi32( (int) digest_hash_sha256_round_constants[ round_index ] ),
+			                     message_schedule[ round_index & 0x0f ] ) );
+
+			sigma0 = _mm256_xor_si256(
+			          _mm256_xor_si256(
+			           DIGEST_HASH_AVX2_ROTATE_RIGHT( state[ 0 ], 2 ),
+			           DIGEST_HASH_AVX2_ROTATE_RIGHT( state[ 0 ], 13 ) ),
+			          DIGEST_HASH_AVX2_ROTATE_RIGHT( state[ 0 ], 22 ) );
+
+			temporary_value2 = _mm256_add_epi32(
+			                    sigma0,
+			                    _mm256_or_si256(
+			                     _mm256_and_si256( state[ 0 ], state[ 1 ] ),
+			                     _mm256_and_si256( state[ 2 ], _mm256_or_si256( state[ 0 ], state[ 1 ] ) ) ) );
+
+			state[ 7 ] = state[ 6 ];
+			state[ 6 ] = state[ 5 ];
+			state[ 5 ] = state[ 4 ];
+			state[ 4 ] = _mm256_add_epi32( state[ 3 ], temporary_value1 );
+			state[ 3 ] = state[ 2 ];
+			state[ 2 ] = state[ 1 ];
+			state[ 1 ] = state[ 0 ];
+			state[ 0 ] = _mm256_add_epi32( temporary_value1, temporary_value2 );
+		}
+		for( value_index = 0;
+		     value_index < 8;
+		     value_index++ )
+		{
+			state[ value_index ] = _mm256_add_epi32( state[ value_index ], saved_state[ value_index ] );
+		}
+		block_offset     += DIGEST_HASH_BLOCK_SIZE;
+		number_of_blocks -= 1;
+	}
+	for( value_index = 0;
+	     value_index < 8;
+	     value_index++ )
+	{
+		_mm256_storeu_si256(
+		 (__m256i *) lane_values,
+		 state[ value_index ] );
+
+		for( lane_index = 0;
+		     lane_index < DIGEST_HASH_MAXIMUM_NUMBER_OF_LANES;
+		     lane_index++ )
+		{
+			hash_values[ lane_index ][ value_index ] = lane_values[ lane_index ];
+		}
+	}
+}
+
+#endif /* defined( DIGEST_HASH_HAVE_X86_INTRINSICS ) */
@@ -26,11 +26,132 @@
 #include <types.h>
 
 #include "smrawtools_libcerror.h"
+#include "smrawtools_libhmac.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+/* The SHA-NI and AVX2 backends require compiler support for the x86 intrinsics
+ */
+#if ( defined( __x86_64__ ) || defined( __i386__ ) ) \
+ && ( defined( __clang__ ) || ( __GNUC__ > 4 ) || ( ( __GNUC__ == 4 ) && ( __GNUC_MINOR__ >= 9 ) ) )
+#define DIGEST_HASH_HAVE_X86_INTRINSICS
+#define DIGEST_HASH_TARGET_SHA_NI	__attribute__ (( target( "sse4.1,sha" ) ))
+#define DIGEST_HASH_TARGET_AVX2		__attribute__ (( target( "avx2" ) ))
+
+#elif defined( _MSC_VER ) && ( _MSC_VER >= 1900 ) && ( defined( _M_X64 ) || defined( _M_IX86 ) )
+#define DIGEST_HASH_HAVE_X86_INTRINSICS
+#define DIGEST_HASH_TARGET_SHA_NI
+#define DIGEST_HASH_TARGET_AVX2
+
+#endif
+
+/* libhmac uses libcrypto (OpenSSL) when available, which is as fast as or faster than
+ * the SHA-NI backend, hence the SHA-NI backend is only selected by default when libhmac
+ * uses its portable implementation. A shared libhmac is assumed to use libcrypto.
+ */
+#if defined( HAVE_LOCAL_LIBHMAC ) && !defined( HAVE_EVP_SHA1 ) && !defined( HAVE_OPENSSL_SHA_H )
+#define DIGEST_HASH_LIBHMAC_SHA1_IS_PORTABLE
+#endif
+
+#if defined( HAVE_LOCAL_LIBHMAC ) && !defined( HAVE_EVP_SHA256 ) && !defined( HAVE_OPENSSL_SHA_H )
+#define DIGEST_HASH_LIBHMAC_SHA256_IS_PORTABLE
+#endif
+
+#define DIGEST_HASH_BLOCK_SIZE				64
+
+/* The number of buffers hashed in parallel by the AVX2 multi-buffer backend
+ */
+#define DIGEST_HASH_MAXIMUM_NUMBER_OF_LANES		8
+
+enum DIGEST_HASH_BACKENDS
+{
+	/* The backend is selected at run-time based on the CPU features and the libhmac implementation
+	 */
+	DIGEST_HASH_BACKEND_DEFAULT			= 0,
+
+	/* The libhmac implementation
+	 */
+	DIGEST_HASH_BACKEND_GENERIC			= 1,
+
+	/* The SHA extensions (SHA-NI)
+	 */
+	DIGEST_HASH_BACKEND_SHA_NI			= 2,
+
+	/* Multi-buffer hashing using AVX2, where independent buffers are hashed in parallel lanes
+	 */
+	DIGEST_HASH_BACKEND_AVX2			= 3
+};
+
+enum DIGEST_HASH_CPU_FEATURES
+{
+	DIGEST_HASH_CPU_FEATURE_SHA_NI			= 0x00000001UL,
+	DIGEST_HASH_CPU_FEATURE_AVX2			= 0x00000002UL,
+
+	/* Flag to indicate the CPU features were determined
+	 */
+	DIGEST_HASH_CPU_FEATURES_DETERMINED		= 0x80000000UL
+};
+
+typedef struct digest_hash_sha1_context digest_hash_sha1_context_t;
+
+struct digest_hash_sha1_context
+{
+	/* The backend
+	 */
+	int backend;
+
+	/* The libhmac context, used by the generic backend
+	 */
+	libhmac_sha1_context_t *libhmac_context;
+
+	/* The hash values
+	 */
+	uint32_t hash_values[ 5 ];
+
+	/* The number of bytes hashed
+	 */
+	uint64_t hash_count;
+
+	/* The block that contains the data that does not fill a whole block
+	 */
+	uint8_t block[ DIGEST_HASH_BLOCK_SIZE ];
+
+	/* The size of the data in the block
+	 */
+	size_t block_size;
+};
+
+typedef struct digest_hash_sha256_context digest_hash_sha256_context_t;
+
+struct digest_hash_sha256_context
+{
+	/* The backend
+	 */
+	int backend;
+
+	/* The libhmac context, used by the generic backend
+	 */
+	libhmac_sha256_context_t *libhmac_context;
+
+	/* The hash values
+	 */
+	uint32_t hash_values[ 8 ];
+
+	/* The number of bytes hashed
+	 */
+	uint64_t hash_count;
+
+	/* The block that contains the data that does not fill a whole block
+	 */
+	uint8_t block[ DIGEST_HASH_BLOCK_SIZE ];
+
+	/* The size of the data in the block
+	 */
+	size_t block_size;
+};
+
 int digest_hash_copy_to_string(
      const uint8_t *digest_hash,
      size_t digest_hash_size,
@@ -38,6 +159,136 @@ int digest_hash_copy_to_string(
      size_t string_size,
      libcerror_error_t **error );
 
+int digest_hash_copy_from_string(
+     uint8_t *digest_hash,
+     size_t digest_hash_size,
+     const char *string,
+     size_t string_length,
+     libcerror_error_t **error );
+
+#if defined( DIGEST_HASH_HAVE_X86_INTRINSICS )
+
+void digest_hash_cpuid(
+      uint32_t leaf,
+      uint32_t sub_leaf,
+      uint32_t *registers );
+
+#endif /* defined( DIGEST_HASH_HAVE_X86_INTRINSICS ) */
+
+uint32_t digest_hash_get_cpu_features(
+          void );
+
+int digest_hash_backend_is_supported(
+     int backend );
+
+int digest_hash_sha1_get_default_backend(
+     void );
+
+int digest_hash_sha1_initialize(
+     digest_hash_sha1_context_t **context,
+     libcerror_error_t **error );
+
+int digest_hash_sha1_initialize_with_backend(
+     digest_hash_sha1_context_t **context,
+     int backend,
+     libcerror_error_t **error );
+
+int digest_hash_sha1_free(
+     digest_hash_sha1_context_t **context,
+     libcerror_error_t **error );
+
+void digest_hash_sha1_transform_blocks(
+      digest_hash_sha1_context_t *context,
+      const uint8_t *buffer,
+      size_t number_of_blocks );
+
+int digest_hash_sha1_update(
+     digest_hash_sha1_context_t *context,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error );
+
+int digest_hash_sha1_finalize(
+     digest_hash_sha1_context_t *context,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error );
+
+#if defined( DIGEST_HASH_HAVE_X86_INTRINSICS )
+
+void digest_hash_sha1_ni_transform(
+      uint32_t *hash_values,
+      const uint8_t *buffer,
+      size_t number_of_blocks );
+
+#endif /* defined( DIGEST_HASH_HAVE_X86_INTRINSICS ) */
+
+int digest_hash_sha256_get_default_backend(
+     void );
+
+int digest_hash_sha256_multi_buffer_is_preferred(
+     void );
+
+int digest_hash_sha256_initialize(
+     digest_hash_sha256_context_t **context,
+     libcerror_error_t **error );
+
+int digest_hash_sha256_initialize_multi_buffer(
+     digest_hash_sha256_context_t **context,
+     libcerror_error_t **error );
+
+int digest_hash_sha256_initialize_with_backend(
+     digest_hash_sha256_context_t **context,
+     int backend,
+     libcerror_error_t **error );
+
+int digest_hash_sha256_free(
+     digest_hash_sha256_context_t **context,
+     libcerror_error_t **error );
+
+void digest_hash_sha256_transform(
+      uint32_t *hash_values,
+      const uint8_t *buffer,
+      size_t number_of_blocks );
+
+void digest_hash_sha256_transform_blocks(
+      digest_hash_sha256_context_t *context,
+      const uint8_t *buffer,
+      size_t number_of_blocks );
+
+int digest_hash_sha256_update(
+     digest_hash_sha256_context_t *context,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error );
+
+int digest_hash_sha256_multi_buffer_update(
+     digest_hash_sha256_context_t **contexts,
+     const uint8_t **buffers,
+     const size_t *sizes,
+     int number_of_contexts,
+     libcerror_error_t **error );
+
+int digest_hash_sha256_finalize(
+     digest_hash_sha256_context_t *context,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error );
+
+#if defined( DIGEST_HASH_HAVE_X86_INTRINSICS )
+
+void digest_hash_sha256_ni_transform(
+      uint32_t *hash_values,
+      const uint8_t *buffer,
+      size_t number_of_blocks );
+
+void digest_hash_sha256_avx2_transform(
+      uint32_t **hash_values,
+      const uint8_t **buffers,
+      size_t number_of_blocks );
+
+#endif /* defined( DIGEST_HASH_HAVE_X86_INTRINSICS ) */
+
 #if defined( __cplusplus )
 }
 #endif
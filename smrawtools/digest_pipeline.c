@@ -0,0 +1,937 @@
+/*
+ * Digest pipeline
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "digest_pipeline.h"
+#include "smrawtools_libcerror.h"
+#include "smrawtools_libcthreads.h"
+#include "storage_media_buffer.h"
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Creates a digest pipeline
+ * The digest pipeline calculates multiple digests in parallel, where every worker thread
+ * updates its digests with the buffers in the order in which they were pushed
+ * Make sure the value digest_pipeline is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int digest_pipeline_initialize(
+     digest_pipeline_t **digest_pipeline,
+     int number_of_buffers,
+     size_t buffer_size,
+     int maximum_number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_pipeline_initialize";
+	int buffer_index      = 0;
+
+	if( digest_pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( *digest_pipeline != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid digest pipeline value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_buffers <= 0 )
+	 || ( (size_t) number_of_buffers > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( digest_pipeline_buffer_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of buffers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_threads <= 0 )
+	 || ( maximum_number_of_threads > DIGEST_PIPELINE_MAXIMUM_NUMBER_OF_DIGESTS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*digest_pipeline = memory_allocate_structure(
+	                    digest_pipeline_t );
+
+	if( *digest_pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create digest pipeline.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *digest_pipeline,
+	     0,
+	     sizeof( digest_pipeline_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear digest pipeline.",
+		 function );
+
+		memory_free(
+		 *digest_pipeline );
+
+		*digest_pipeline = NULL;
+
+		return( -1 );
+	}
+	( *digest_pipeline )->buffers = (digest_pipeline_buffer_t *) memory_allocate(
+	                                                              sizeof( digest_pipeline_buffer_t ) * (size_t) number_of_buffers );
+
+	if( ( *digest_pipeline )->buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffers.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *digest_pipeline )->buffers,
+	     0,
+	     sizeof( digest_pipeline_buffer_t ) * (size_t) number_of_buffers ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buffers.",
+		 function );
+
+		memory_free(
+		 ( *digest_pipeline )->buffers );
+
+		( *digest_pipeline )->buffers = NULL;
+
+		goto on_error;
+	}
+	( *digest_pipeline )->number_of_buffers = number_of_buffers;
+
+	for( buffer_index = 0;
+	     buffer_index < number_of_buffers;
+	     buffer_index++ )
+	{
+		if( storage_media_buffer_initialize(
+		     &( ( *digest_pipeline )->buffers[ buffer_index ].storage_media_buffer ),
+		     buffer_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create storage media buffer: %d.",
+			 function,
+			 buffer_index );
+
+			goto on_error;
+		}
+	}
+	( *digest_pipeline )->workers = (digest_pipeline_worker_t *) memory_allocate(
+	                                                              sizeof( digest_pipeline_worker_t ) * (size_t) maximum_number_of_threads );
+
+	if( ( *digest_pipeline )->workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create workers.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *digest_pipeline )->workers,
+	     0,
+	     sizeof( digest_pipeline_worker_t ) * (size_t) maximum_number_of_threads ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear workers.",
+		 function );
+
+		goto on_error;
+	}
+	( *digest_pipeline )->maximum_number_of_workers = maximum_number_of_threads;
+
+	if( libcthreads_mutex_initialize(
+	     &( ( *digest_pipeline )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *digest_pipeline )->processed_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create processed condition.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *digest_pipeline != NULL )
+	{
+		digest_pipeline_free(
+		 digest_pipeline,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a digest pipeline
+ * This stops the worker threads if necessary
+ * Returns 1 if successful or -1 on error
+ */
+int digest_pipeline_free(
+     digest_pipeline_t **digest_pipeline,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_pipeline_free";
+	int buffer_index      = 0;
+	int result            = 1;
+
+	if( digest_pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( *digest_pipeline != NULL )
+	{
+		if( ( *digest_pipeline )->workers_started != 0 )
+		{
+			if( digest_pipeline_stop(
+			     *digest_pipeline,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to stop workers.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *digest_pipeline )->processed_condition != NULL )
+		{
+			if( libcthreads_condition_free(
+			     &( ( *digest_pipeline )->processed_condition ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free processed condition.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *digest_pipeline )->mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *digest_pipeline )->mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *digest_pipeline )->workers != NULL )
+		{
+			memory_free(
+			 ( *digest_pipeline )->workers );
+		}
+		if( ( *digest_pipeline )->buffers != NULL )
+		{
+			for( buffer_index = 0;
+			     buffer_index < ( *digest_pipeline )->number_of_buffers;
+			     buffer_index++ )
+			{
+				if( ( *digest_pipeline )->buffers[ buffer_index ].storage_media_buffer == NULL )
+				{
+					continue;
+				}
+				if( storage_media_buffer_free(
+				     &( ( *digest_pipeline )->buffers[ buffer_index ].storage_media_buffer ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free storage media buffer: %d.",
+					 function,
+					 buffer_index );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 ( *digest_pipeline )->buffers );
+		}
+		memory_free(
+		 *digest_pipeline );
+
+		*digest_pipeline = NULL;
+	}
+	return( result );
+}
+
+/* Appends a digest to the digest pipeline
+ * The digests are distributed over the worker threads in a round-robin fashion
+ * The context must remain valid until the digest pipeline was stopped
+ * Returns 1 if successful or -1 on error
+ */
+int digest_pipeline_append_digest(
+     digest_pipeline_t *digest_pipeline,
+     int (*update_function)(
+            intptr_t *context,
+            const uint8_t *buffer,
+            size_t size,
+            libcerror_error_t **error ),
+     intptr_t *context,
+     libcerror_error_t **error )
+{
+	digest_pipeline_worker_t *worker = NULL;
+	static char *function            = "digest_pipeline_append_digest";
+	int worker_index                 = 0;
+
+	if( digest_pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest_pipeline->workers_started != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid digest pipeline - workers already started.",
+		 function );
+
+		return( -1 );
+	}
+	if( update_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid update function.",
+		 function );
+
+		return( -1 );
+	}
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest_pipeline->number_of_digests >= DIGEST_PIPELINE_MAXIMUM_NUMBER_OF_DIGESTS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of digests value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	worker_index = digest_pipeline->number_of_digests % digest_pipeline->maximum_number_of_workers;
+
+	worker = &( digest_pipeline->workers[ worker_index ] );
+
+	worker->update_functions[ worker->number_of_digests ] = update_function;
+	worker->contexts[ worker->number_of_digests ]         = context;
+
+	worker->number_of_digests += 1;
+
+	digest_pipeline->number_of_digests += 1;
+
+	return( 1 );
+}
+
+/* Starts the worker threads of the digest pipeline
+ * Returns 1 if successful or -1 on error
+ */
+int digest_pipeline_start(
+     digest_pipeline_t *digest_pipeline,
+     libcerror_error_t **error )
+{
+	digest_pipeline_worker_t *worker = NULL;
+	static char *function            = "digest_pipeline_start";
+	int worker_index                 = 0;
+
+	if( digest_pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest_pipeline->workers_started != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid digest pipeline - workers already started.",
+		 function );
+
+		return( -1 );
+	}
+	digest_pipeline->workers_started = 1;
+
+	for( worker_index = 0;
+	     worker_index < digest_pipeline->maximum_number_of_workers;
+	     worker_index++ )
+	{
+		worker = &( digest_pipeline->workers[ worker_index ] );
+
+		if( worker->number_of_digests == 0 )
+		{
+			break;
+		}
+		worker->digest_pipeline = digest_pipeline;
+
+		/* A single thread per worker guarantees the buffers are processed in order
+		 */
+		if( libcthreads_thread_pool_create(
+		     &( worker->thread_pool ),
+		     NULL,
+		     1,
+		     digest_pipeline->number_of_buffers,
+		     (int (*)(intptr_t *, void *)) &digest_pipeline_process_buffer,
+		     (void *) worker,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+		digest_pipeline->number_of_workers += 1;
+	}
+	return( 1 );
+
+on_error:
+	digest_pipeline_stop(
+	 digest_pipeline,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Processes a buffer
+ * Callback function for the thread pool of a worker
+ * Returns 1 if successful or -1 on error
+ */
+int digest_pipeline_process_buffer(
+     digest_pipeline_buffer_t *pipeline_buffer,
+     digest_pipeline_worker_t *worker )
+{
+	libcerror_error_t *error = NULL;
+	int digest_index         = 0;
+	int result               = 1;
+
+	if( pipeline_buffer == NULL )
+	{
+		return( -1 );
+	}
+	if( worker == NULL )
+	{
+		return( -1 );
+	}
+	for( digest_index = 0;
+	     digest_index < worker->number_of_digests;
+	     digest_index++ )
+	{
+		if( worker->update_functions[ digest_index ](
+		     worker->contexts[ digest_index ],
+		     pipeline_buffer->data,
+		     pipeline_buffer->data_size,
+		     &error ) != 1 )
+		{
+			libcerror_error_free(
+			 &error );
+
+			result = -1;
+		}
+	}
+	if( libcthreads_mutex_grab(
+	     worker->digest_pipeline->mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_free(
+		 &error );
+
+		return( -1 );
+	}
+	if( result != 1 )
+	{
+		worker->digest_pipeline->update_failed = 1;
+	}
+	pipeline_buffer->number_of_pending_workers -= 1;
+
+	if( libcthreads_condition_broadcast(
+	     worker->digest_pipeline->processed_condition,
+	     &error ) != 1 )
+	{
+		libcerror_error_free(
+		 &error );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     worker->digest_pipeline->mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_free(
+		 &error );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Retrieves the next buffer to fill
+ * This function blocks until the workers have processed the previous data of the buffer
+ * Returns 1 if successful or -1 on error
+ */
+int digest_pipeline_get_buffer(
+     digest_pipeline_t *digest_pipeline,
+     storage_media_buffer_t **storage_media_buffer,
+     libcerror_error_t **error )
+{
+	digest_pipeline_buffer_t *pipeline_buffer = NULL;
+	static char *function                     = "digest_pipeline_get_buffer";
+	int result                                = 1;
+
+	if( digest_pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( storage_media_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid storage media buffer.",
+		 function );
+
+		return( -1 );
+	}
+	pipeline_buffer = &( digest_pipeline->buffers[ digest_pipeline->next_buffer_index ] );
+
+	if( libcthreads_mutex_grab(
+	     digest_pipeline->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( pipeline_buffer->number_of_pending_workers > 0 )
+	{
+		if( libcthreads_condition_wait(
+		     digest_pipeline->processed_condition,
+		     digest_pipeline->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for processed condition.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     digest_pipeline->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( result == 1 )
+	{
+		*storage_media_buffer = pipeline_buffer->storage_media_buffer;
+	}
+	return( result );
+}
+
+/* Pushes the data of the buffer retrieved by digest_pipeline_get_buffer onto the workers
+ * The data must be contained in the storage media buffer of the buffer
+ * Returns 1 if successful or -1 on error
+ */
+int digest_pipeline_push_buffer(
+     digest_pipeline_t *digest_pipeline,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	digest_pipeline_buffer_t *pipeline_buffer = NULL;
+	static char *function                     = "digest_pipeline_push_buffer";
+	int number_of_unpushed_workers            = 0;
+	int worker_index                          = 0;
+
+	if( digest_pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	pipeline_buffer = &( digest_pipeline->buffers[ digest_pipeline->next_buffer_index ] );
+
+	/* The buffer is not shared with the workers until it is pushed
+	 */
+	pipeline_buffer->data                      = data;
+	pipeline_buffer->data_size                 = data_size;
+	pipeline_buffer->number_of_pending_workers = digest_pipeline->number_of_workers;
+
+	digest_pipeline->next_buffer_index += 1;
+
+	if( digest_pipeline->next_buffer_index >= digest_pipeline->number_of_buffers )
+	{
+		digest_pipeline->next_buffer_index = 0;
+	}
+	for( worker_index = 0;
+	     worker_index < digest_pipeline->number_of_workers;
+	     worker_index++ )
+	{
+		if( libcthreads_thread_pool_push(
+		     digest_pipeline->workers[ worker_index ].thread_pool,
+		     (intptr_t *) pipeline_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push buffer onto thread pool: %d queue.",
+			 function,
+			 worker_index );
+
+			number_of_unpushed_workers = digest_pipeline->number_of_workers - worker_index;
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( libcthreads_mutex_grab(
+	     digest_pipeline->mutex,
+	     NULL ) == 1 )
+	{
+		pipeline_buffer->number_of_pending_workers -= number_of_unpushed_workers;
+		digest_pipeline->update_failed             = 1;
+
+		libcthreads_mutex_release(
+		 digest_pipeline->mutex,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Waits until the workers have processed all pushed buffers
+ * Returns 1 if successful or -1 on error
+ */
+int digest_pipeline_wait(
+     digest_pipeline_t *digest_pipeline,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_pipeline_wait";
+	int buffer_index      = 0;
+	int result            = 1;
+
+	if( digest_pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     digest_pipeline->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_index < digest_pipeline->number_of_buffers )
+	{
+		if( digest_pipeline->buffers[ buffer_index ].number_of_pending_workers == 0 )
+		{
+			buffer_index++;
+
+			continue;
+		}
+		if( libcthreads_condition_wait(
+		     digest_pipeline->processed_condition,
+		     digest_pipeline->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for processed condition.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+	}
+	if( ( result == 1 )
+	 && ( digest_pipeline->update_failed != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to update digest hash(es).",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     digest_pipeline->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Stops the worker threads of the digest pipeline
+ * The workers process the pushed buffers before they stop
+ * Returns 1 if successful or -1 on error
+ */
+int digest_pipeline_stop(
+     digest_pipeline_t *digest_pipeline,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_pipeline_stop";
+	int result            = 1;
+	int worker_index      = 0;
+
+	if( digest_pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	for( worker_index = 0;
+	     worker_index < digest_pipeline->number_of_workers;
+	     worker_index++ )
+	{
+		if( digest_pipeline->workers[ worker_index ].thread_pool == NULL )
+		{
+			continue;
+		}
+		if( libcthreads_thread_pool_join(
+		     &( digest_pipeline->workers[ worker_index ].thread_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool: %d.",
+			 function,
+			 worker_index );
+
+			result = -1;
+		}
+	}
+	digest_pipeline->number_of_workers = 0;
+	digest_pipeline->workers_started   = 0;
+
+	return( result );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
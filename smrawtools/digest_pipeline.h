@@ -0,0 +1,194 @@
+/*
+ * Digest pipeline
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _DIGEST_PIPELINE_H )
+#define _DIGEST_PIPELINE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "smrawtools_libcerror.h"
+#include "smrawtools_libcthreads.h"
+#include "storage_media_buffer.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+#define DIGEST_PIPELINE_MAXIMUM_NUMBER_OF_DIGESTS	8
+
+typedef struct digest_pipeline digest_pipeline_t;
+
+typedef struct digest_pipeline_buffer digest_pipeline_buffer_t;
+
+struct digest_pipeline_buffer
+{
+	/* The storage media buffer
+	 */
+	storage_media_buffer_t *storage_media_buffer;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The number of workers that have not yet processed the buffer
+	 */
+	int number_of_pending_workers;
+};
+
+typedef struct digest_pipeline_worker digest_pipeline_worker_t;
+
+struct digest_pipeline_worker
+{
+	/* The digest pipeline
+	 */
+	digest_pipeline_t *digest_pipeline;
+
+	/* The digest update functions
+	 */
+	int (*update_functions[ DIGEST_PIPELINE_MAXIMUM_NUMBER_OF_DIGESTS ])(
+	       intptr_t *context,
+	       const uint8_t *buffer,
+	       size_t size,
+	       libcerror_error_t **error );
+
+	/* The digest contexts
+	 */
+	intptr_t *contexts[ DIGEST_PIPELINE_MAXIMUM_NUMBER_OF_DIGESTS ];
+
+	/* The number of digests
+	 */
+	int number_of_digests;
+
+	/* The thread pool
+	 */
+	libcthreads_thread_pool_t *thread_pool;
+};
+
+struct digest_pipeline
+{
+	/* The buffers
+	 */
+	digest_pipeline_buffer_t *buffers;
+
+	/* The number of buffers
+	 */
+	int number_of_buffers;
+
+	/* The index of the next buffer to fill
+	 */
+	int next_buffer_index;
+
+	/* The workers
+	 */
+	digest_pipeline_worker_t *workers;
+
+	/* The maximum number of workers
+	 */
+	int maximum_number_of_workers;
+
+	/* The number of workers with at least one digest
+	 */
+	int number_of_workers;
+
+	/* The number of digests
+	 */
+	int number_of_digests;
+
+	/* Value to indicate the workers were started
+	 */
+	uint8_t workers_started;
+
+	/* Value to indicate a digest update failed
+	 */
+	uint8_t update_failed;
+
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition signalled when a buffer has been processed
+	 */
+	libcthreads_condition_t *processed_condition;
+};
+
+int digest_pipeline_initialize(
+     digest_pipeline_t **digest_pipeline,
+     int number_of_buffers,
+     size_t buffer_size,
+     int maximum_number_of_threads,
+     libcerror_error_t **error );
+
+int digest_pipeline_free(
+     digest_pipeline_t **digest_pipeline,
+     libcerror_error_t **error );
+
+int digest_pipeline_append_digest(
+     digest_pipeline_t *digest_pipeline,
+     int (*update_function)(
+            intptr_t *context,
+            const uint8_t *buffer,
+            size_t size,
+            libcerror_error_t **error ),
+     intptr_t *context,
+     libcerror_error_t **error );
+
+int digest_pipeline_start(
+     digest_pipeline_t *digest_pipeline,
+     libcerror_error_t **error );
+
+int digest_pipeline_process_buffer(
+     digest_pipeline_buffer_t *pipeline_buffer,
+     digest_pipeline_worker_t *worker );
+
+int digest_pipeline_get_buffer(
+     digest_pipeline_t *digest_pipeline,
+     storage_media_buffer_t **storage_media_buffer,
+     libcerror_error_t **error );
+
+int digest_pipeline_push_buffer(
+     digest_pipeline_t *digest_pipeline,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int digest_pipeline_wait(
+     digest_pipeline_t *digest_pipeline,
+     libcerror_error_t **error );
+
+int digest_pipeline_stop(
+     digest_pipeline_t *digest_pipeline,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _DIGEST_PIPELINE_H ) */
+
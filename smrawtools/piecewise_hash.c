@@ -0,0 +1,863 @@
+/*
+ * Piecewise digest hash
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "piecewise_hash.h"
+#include "smrawtools_libcerror.h"
+
+#define PIECEWISE_HASH_NUMBER_OF_ALLOCATED_CHUNKS	64
+
+/* Creates a piecewise hash
+ * Make sure the value piecewise_hash is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int piecewise_hash_initialize(
+     piecewise_hash_t **piecewise_hash,
+     size64_t chunk_size,
+     size_t hash_size,
+     int (*initialize_function)(
+            intptr_t **context,
+            libcerror_error_t **error ),
+     int (*update_function)(
+            intptr_t *context,
+            const uint8_t *buffer,
+            size_t size,
+            libcerror_error_t **error ),
+     int (*finalize_function)(
+            intptr_t *context,
+            uint8_t *hash,
+            size_t hash_size,
+            libcerror_error_t **error ),
+     int (*free_function)(
+            intptr_t **context,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	static char *function = "piecewise_hash_initialize";
+
+	if( piecewise_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid piecewise hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( *piecewise_hash != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid piecewise hash value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid chunk size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( hash_size == 0 )
+	 || ( hash_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / PIECEWISE_HASH_NUMBER_OF_ALLOCATED_CHUNKS ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid hash size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( initialize_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid initialize function.",
+		 function );
+
+		return( -1 );
+	}
+	if( update_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid update function.",
+		 function );
+
+		return( -1 );
+	}
+	if( finalize_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid finalize function.",
+		 function );
+
+		return( -1 );
+	}
+	if( free_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid free function.",
+		 function );
+
+		return( -1 );
+	}
+	*piecewise_hash = memory_allocate_structure(
+	                   piecewise_hash_t );
+
+	if( *piecewise_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create piecewise hash.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *piecewise_hash,
+	     0,
+	     sizeof( piecewise_hash_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear piecewise hash.",
+		 function );
+
+		goto on_error;
+	}
+	( *piecewise_hash )->hashes = (uint8_t *) memory_allocate(
+	                                           hash_size * PIECEWISE_HASH_NUMBER_OF_ALLOCATED_CHUNKS );
+
+	if( ( *piecewise_hash )->hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hashes.",
+		 function );
+
+		goto on_error;
+	}
+	( *piecewise_hash )->chunk_size                 = chunk_size;
+	( *piecewise_hash )->hash_size                  = hash_size;
+	( *piecewise_hash )->initialize_function        = initialize_function;
+	( *piecewise_hash )->update_function            = update_function;
+	( *piecewise_hash )->finalize_function          = finalize_function;
+	( *piecewise_hash )->free_function              = free_function;
+	( *piecewise_hash )->number_of_allocated_chunks = PIECEWISE_HASH_NUMBER_OF_ALLOCATED_CHUNKS;
+
+	return( 1 );
+
+on_error:
+	if( *piecewise_hash != NULL )
+	{
+		memory_free(
+		 *piecewise_hash );
+
+		*piecewise_hash = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a piecewise hash
+ * Returns 1 if successful or -1 on error
+ */
+int piecewise_hash_free(
+     piecewise_hash_t **piecewise_hash,
+     libcerror_error_t **error )
+{
+	static char *function = "piecewise_hash_free";
+	int result            = 1;
+
+	if( piecewise_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid piecewise hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( *piecewise_hash != NULL )
+	{
+		if( ( *piecewise_hash )->context != NULL )
+		{
+			if( ( *piecewise_hash )->free_function(
+			     &( ( *piecewise_hash )->context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free context.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 ( *piecewise_hash )->hashes );
+
+		memory_free(
+		 *piecewise_hash );
+
+		*piecewise_hash = NULL;
+	}
+	return( result );
+}
+
+/* Sets the multi-buffer functions
+ * The multi-buffer functions allow the data of multiple chunks to be hashed in parallel
+ * Returns 1 if successful or -1 on error
+ */
+int piecewise_hash_set_multi_buffer_functions(
+     piecewise_hash_t *piecewise_hash,
+     int (*initialize_function)(
+            intptr_t **context,
+            libcerror_error_t **error ),
+     int (*update_function)(
+            intptr_t **contexts,
+            const uint8_t **buffers,
+            const size_t *sizes,
+            int number_of_contexts,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	static char *function = "piecewise_hash_set_multi_buffer_functions";
+
+	if( piecewise_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid piecewise hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( initialize_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid initialize function.",
+		 function );
+
+		return( -1 );
+	}
+	if( update_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid update function.",
+		 function );
+
+		return( -1 );
+	}
+	piecewise_hash->multi_buffer_initialize_function = initialize_function;
+	piecewise_hash->multi_buffer_update_function     = update_function;
+
+	return( 1 );
+}
+
+/* Updates the piecewise hash
+ * The chunk digest hash is finalized every time the data of a chunk is complete
+ * Returns 1 if successful or -1 on error
+ */
+int piecewise_hash_update(
+     piecewise_hash_t *piecewise_hash,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "piecewise_hash_update";
+	size64_t update_size  = 0;
+	size_t buffer_offset  = 0;
+
+	if( piecewise_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid piecewise hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_offset < buffer_size )
+	{
+		if( piecewise_hash->context == NULL )
+		{
+			if( piecewise_hash->initialize_function(
+			     &( piecewise_hash->context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to initialize context.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		update_size = piecewise_hash->chunk_size - piecewise_hash->chunk_data_size;
+
+		if( update_size > (size64_t) ( buffer_size - buffer_offset ) )
+		{
+			update_size = (size64_t) ( buffer_size - buffer_offset );
+		}
+		if( piecewise_hash->update_function(
+		     piecewise_hash->context,
+		     &( buffer[ buffer_offset ] ),
+		     (size_t) update_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update context.",
+			 function );
+
+			return( -1 );
+		}
+		buffer_offset                   += (size_t) update_size;
+		piecewise_hash->chunk_data_size += update_size;
+		piecewise_hash->data_size       += update_size;
+
+		if( piecewise_hash->chunk_data_size == piecewise_hash->chunk_size )
+		{
+			if( piecewise_hash_finalize_chunk(
+			     piecewise_hash,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to finalize chunk: %" PRIu64 ".",
+				 function,
+				 piecewise_hash->number_of_chunks );
+
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Resizes the hashes so that they can hold at least one more chunk
+ * Returns 1 if successful or -1 on error
+ */
+int piecewise_hash_resize_hashes(
+     piecewise_hash_t *piecewise_hash,
+     libcerror_error_t **error )
+{
+	void *reallocation                  = NULL;
+	static char *function               = "piecewise_hash_resize_hashes";
+	uint64_t number_of_allocated_chunks = 0;
+
+	if( piecewise_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid piecewise hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( piecewise_hash->number_of_chunks >= piecewise_hash->number_of_allocated_chunks )
+	{
+		number_of_allocated_chunks = piecewise_hash->number_of_allocated_chunks * 2;
+
+		if( number_of_allocated_chunks > (uint64_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / piecewise_hash->hash_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated chunks value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = memory_reallocate(
+		                piecewise_hash->hashes,
+		                piecewise_hash->hash_size * (size_t) number_of_allocated_chunks );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize hashes.",
+			 function );
+
+			return( -1 );
+		}
+		piecewise_hash->hashes                     = (uint8_t *) reallocation;
+		piecewise_hash->number_of_allocated_chunks = number_of_allocated_chunks;
+	}
+	return( 1 );
+}
+
+/* Finalizes the digest hash of the current chunk
+ * Returns 1 if successful or -1 on error
+ */
+int piecewise_hash_finalize_chunk(
+     piecewise_hash_t *piecewise_hash,
+     libcerror_error_t **error )
+{
+	static char *function = "piecewise_hash_finalize_chunk";
+
+	if( piecewise_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid piecewise hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( piecewise_hash->context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid piecewise hash - missing context.",
+		 function );
+
+		return( -1 );
+	}
+	if( piecewise_hash_resize_hashes(
+	     piecewise_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( piecewise_hash->finalize_function(
+	     piecewise_hash->context,
+	     &( piecewise_hash->hashes[ piecewise_hash->number_of_chunks * piecewise_hash->hash_size ] ),
+	     piecewise_hash->hash_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize context.",
+		 function );
+
+		return( -1 );
+	}
+	if( piecewise_hash->free_function(
+	     &( piecewise_hash->context ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free context.",
+		 function );
+
+		return( -1 );
+	}
+	piecewise_hash->chunk_data_size   = 0;
+	piecewise_hash->number_of_chunks += 1;
+
+	return( 1 );
+}
+
+/* Finalizes the piecewise hash
+ * The digest hash of the last chunk is finalized when it contains data
+ * Returns 1 if successful or -1 on error
+ */
+int piecewise_hash_finalize(
+     piecewise_hash_t *piecewise_hash,
+     libcerror_error_t **error )
+{
+	static char *function = "piecewise_hash_finalize";
+
+	if( piecewise_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid piecewise hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( piecewise_hash->chunk_data_size > 0 )
+	{
+		if( piecewise_hash_finalize_chunk(
+		     piecewise_hash,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize last chunk.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Appends a stored digest hash of a chunk
+ * Only the last chunk can be smaller than the chunk size
+ * Returns 1 if successful or -1 on error
+ */
+int piecewise_hash_append_chunk(
+     piecewise_hash_t *piecewise_hash,
+     const uint8_t *hash,
+     size_t hash_size,
+     size64_t chunk_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "piecewise_hash_append_chunk";
+
+	if( piecewise_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid piecewise hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( piecewise_hash->context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid piecewise hash - context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( piecewise_hash->data_size != ( piecewise_hash->number_of_chunks * piecewise_hash->chunk_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid piecewise hash - last chunk is smaller than chunk size.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_size != piecewise_hash->hash_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid hash size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_data_size == 0 )
+	 || ( chunk_data_size > piecewise_hash->chunk_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( piecewise_hash_resize_hashes(
+	     piecewise_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( piecewise_hash->hashes[ piecewise_hash->number_of_chunks * piecewise_hash->hash_size ] ),
+	     hash,
+	     hash_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy hash.",
+		 function );
+
+		return( -1 );
+	}
+	piecewise_hash->data_size        += chunk_data_size;
+	piecewise_hash->number_of_chunks += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the number of finalized chunks
+ * Returns 1 if successful or -1 on error
+ */
+int piecewise_hash_get_number_of_chunks(
+     piecewise_hash_t *piecewise_hash,
+     uint64_t *number_of_chunks,
+     libcerror_error_t **error )
+{
+	static char *function = "piecewise_hash_get_number_of_chunks";
+
+	if( piecewise_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid piecewise hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of chunks.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_chunks = piecewise_hash->number_of_chunks;
+
+	return( 1 );
+}
+
+/* Retrieves the offset, size and digest hash of a specific finalized chunk
+ * Returns 1 if successful or -1 on error
+ */
+int piecewise_hash_get_chunk(
+     piecewise_hash_t *piecewise_hash,
+     uint64_t chunk_index,
+     off64_t *chunk_offset,
+     size64_t *chunk_size,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	static char *function = "piecewise_hash_get_chunk";
+	size64_t safe_offset  = 0;
+
+	if( piecewise_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid piecewise hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_index >= piecewise_hash->number_of_chunks )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk size.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_size < piecewise_hash->hash_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid hash size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	safe_offset = chunk_index * piecewise_hash->chunk_size;
+
+	if( memory_copy(
+	     hash,
+	     &( piecewise_hash->hashes[ chunk_index * piecewise_hash->hash_size ] ),
+	     piecewise_hash->hash_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy hash.",
+		 function );
+
+		return( -1 );
+	}
+	*chunk_offset = (off64_t) safe_offset;
+	*chunk_size   = piecewise_hash->data_size - safe_offset;
+
+	if( *chunk_size > piecewise_hash->chunk_size )
+	{
+		*chunk_size = piecewise_hash->chunk_size;
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,200 @@
+/*
+ * Piecewise digest hash
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _PIECEWISE_HASH_H )
+#define _PIECEWISE_HASH_H
+
+#include <common.h>
+#include <types.h>
+
+#include "smrawtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct piecewise_hash piecewise_hash_t;
+
+struct piecewise_hash
+{
+	/* The chunk size
+	 */
+	size64_t chunk_size;
+
+	/* The digest hash size
+	 */
+	size_t hash_size;
+
+	/* The digest initialize function
+	 */
+	int (*initialize_function)(
+	       intptr_t **context,
+	       libcerror_error_t **error );
+
+	/* The digest update function
+	 */
+	int (*update_function)(
+	       intptr_t *context,
+	       const uint8_t *buffer,
+	       size_t size,
+	       libcerror_error_t **error );
+
+	/* The digest finalize function
+	 */
+	int (*finalize_function)(
+	       intptr_t *context,
+	       uint8_t *hash,
+	       size_t hash_size,
+	       libcerror_error_t **error );
+
+	/* The digest free function
+	 */
+	int (*free_function)(
+	       intptr_t **context,
+	       libcerror_error_t **error );
+
+	/* The digest multi-buffer initialize function
+	 * This function is optional and creates contexts that can be passed to the multi-buffer update function
+	 */
+	int (*multi_buffer_initialize_function)(
+	       intptr_t **context,
+	       libcerror_error_t **error );
+
+	/* The digest multi-buffer update function
+	 * This function is optional and updates multiple contexts in parallel, each with its own buffer
+	 */
+	int (*multi_buffer_update_function)(
+	       intptr_t **contexts,
+	       const uint8_t **buffers,
+	       const size_t *sizes,
+	       int number_of_contexts,
+	       libcerror_error_t **error );
+
+	/* The digest context of the current chunk
+	 */
+	intptr_t *context;
+
+	/* The size of the data hashed in the current chunk
+	 */
+	size64_t chunk_data_size;
+
+	/* The size of the data hashed in all chunks
+	 */
+	size64_t data_size;
+
+	/* The digest hashes of the finalized chunks
+	 */
+	uint8_t *hashes;
+
+	/* The number of finalized chunks
+	 */
+	uint64_t number_of_chunks;
+
+	/* The number of chunks the hashes were allocated for
+	 */
+	uint64_t number_of_allocated_chunks;
+};
+
+int piecewise_hash_initialize(
+     piecewise_hash_t **piecewise_hash,
+     size64_t chunk_size,
+     size_t hash_size,
+     int (*initialize_function)(
+            intptr_t **context,
+            libcerror_error_t **error ),
+     int (*update_function)(
+            intptr_t *context,
+            const uint8_t *buffer,
+            size_t size,
+            libcerror_error_t **error ),
+     int (*finalize_function)(
+            intptr_t *context,
+            uint8_t *hash,
+            size_t hash_size,
+            libcerror_error_t **error ),
+     int (*free_function)(
+            intptr_t **context,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+int piecewise_hash_free(
+     piecewise_hash_t **piecewise_hash,
+     libcerror_error_t **error );
+
+int piecewise_hash_set_multi_buffer_functions(
+     piecewise_hash_t *piecewise_hash,
+     int (*initialize_function)(
+            intptr_t **context,
+            libcerror_error_t **error ),
+     int (*update_function)(
+            intptr_t **contexts,
+            const uint8_t **buffers,
+            const size_t *sizes,
+            int number_of_contexts,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+int piecewise_hash_update(
+     piecewise_hash_t *piecewise_hash,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int piecewise_hash_resize_hashes(
+     piecewise_hash_t *piecewise_hash,
+     libcerror_error_t **error );
+
+int piecewise_hash_finalize_chunk(
+     piecewise_hash_t *piecewise_hash,
+     libcerror_error_t **error );
+
+int piecewise_hash_finalize(
+     piecewise_hash_t *piecewise_hash,
+     libcerror_error_t **error );
+
+int piecewise_hash_append_chunk(
+     piecewise_hash_t *piecewise_hash,
+     const uint8_t *hash,
+     size_t hash_size,
+     size64_t chunk_data_size,
+     libcerror_error_t **error );
+
+int piecewise_hash_get_number_of_chunks(
+     piecewise_hash_t *piecewise_hash,
+     uint64_t *number_of_chunks,
+     libcerror_error_t **error );
+
+int piecewise_hash_get_chunk(
+     piecewise_hash_t *piecewise_hash,
+     uint64_t chunk_index,
+     off64_t *chunk_offset,
+     size64_t *chunk_size,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PIECEWISE_HASH_H ) */
+
@@ -0,0 +1,1412 @@
+/*
+ * Piecewise hash verifier
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "piecewise_hash.h"
+#include "piecewise_verifier.h"
+#include "smrawtools_libcerror.h"
+#include "smrawtools_libcthreads.h"
+
+#define PIECEWISE_VERIFIER_MAXIMUM_HASH_SIZE		64
+#define PIECEWISE_VERIFIER_LANE_BUFFER_ALIGNMENT	64
+
+/* Creates a piecewise verifier
+ * Make sure the value piecewise_verifier is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int piecewise_verifier_initialize(
+     piecewise_verifier_t **piecewise_verifier,
+     size64_t media_size,
+     size_t buffer_size,
+     ssize_t (*read_function)(
+                intptr_t *data_handle,
+                void *buffer,
+                size_t buffer_size,
+                off64_t offset,
+                libcerror_error_t **error ),
+     intptr_t *data_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "piecewise_verifier_initialize";
+
+	if( piecewise_verifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid piecewise verifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( *piecewise_verifier != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid piecewise verifier value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read function.",
+		 function );
+
+		return( -1 );
+	}
+	*piecewise_verifier = memory_allocate_structure(
+	                       piecewise_verifier_t );
+
+	if( *piecewise_verifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create piecewise verifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *piecewise_verifier,
+	     0,
+	     sizeof( piecewise_verifier_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear piecewise verifier.",
+		 function );
+
+		memory_free(
+		 *piecewise_verifier );
+
+		*piecewise_verifier = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *piecewise_verifier )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *piecewise_verifier )->media_size    = media_size;
+	( *piecewise_verifier )->buffer_size   = buffer_size;
+	( *piecewise_verifier )->read_function = read_function;
+	( *piecewise_verifier )->data_handle   = data_handle;
+
+	return( 1 );
+
+on_error:
+	if( *piecewise_verifier != NULL )
+	{
+		memory_free(
+		 *piecewise_verifier );
+
+		*piecewise_verifier = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a piecewise verifier
+ * The stored piecewise hashes are not freed
+ * Returns 1 if successful or -1 on error
+ */
+int piecewise_verifier_free(
+     piecewise_verifier_t **piecewise_verifier,
+     libcerror_error_t **error )
+{
+	static char *function = "piecewise_verifier_free";
+	int result            = 1;
+
+	if( piecewise_verifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid piecewise verifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( *piecewise_verifier != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *piecewise_verifier )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *piecewise_verifier );
+
+		*piecewise_verifier = NULL;
+	}
+	return( result );
+}
+
+/* Signals the piecewise verifier to abort
+ * Returns 1 if successful or -1 on error
+ */
+int piecewise_verifier_signal_abort(
+     piecewise_verifier_t *piecewise_verifier,
+     libcerror_error_t **error )
+{
+	static char *function = "piecewise_verifier_signal_abort";
+
+	if( piecewise_verifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid piecewise verifier.",
+		 function );
+
+		return( -1 );
+	}
+	piecewise_verifier->abort = 1;
+
+	return( 1 );
+}
+
+/* Appends the stored piecewise hashes of a digest type to verify against
+ * The stored piecewise hashes must cover the entire media and are not owned by the piecewise verifier
+ * Returns 1 if successful or -1 on error
+ */
+int piecewise_verifier_append_digest(
+     piecewise_verifier_t *piecewise_verifier,
+     piecewise_hash_t *stored_hashes,
+     libcerror_error_t **error )
+{
+	static char *function = "piecewise_verifier_append_digest";
+
+	if( piecewise_verifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid piecewise verifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( piecewise_verifier->number_of_digests >= PIECEWISE_VERIFIER_MAXIMUM_NUMBER_OF_DIGESTS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid piecewise verifier - number of digests value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( stored_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stored hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( stored_hashes->hash_size > PIECEWISE_VERIFIER_MAXIMUM_HASH_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid stored hashes - hash size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( stored_hashes->data_size != piecewise_verifier->media_size )
+	 || ( stored_hashes->context != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid stored hashes - data size: %" PRIu64 " does not match media size: %" PRIu64 ".",
+		 function,
+		 stored_hashes->data_size,
+		 piecewise_verifier->media_size );
+
+		return( -1 );
+	}
+	if( ( piecewise_verifier->number_of_digests > 0 )
+	 && ( stored_hashes->chunk_size != piecewise_verifier->chunk_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid stored hashes - chunk size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	piecewise_verifier->stored_hashes[ piecewise_verifier->number_of_digests ] = stored_hashes;
+
+	piecewise_verifier->chunk_size        = stored_hashes->chunk_size;
+	piecewise_verifier->number_of_chunks  = stored_hashes->number_of_chunks;
+	piecewise_verifier->number_of_digests += 1;
+
+	return( 1 );
+}
+
+/* Sets the function that is called for every chunk that does not verify
+ * The report function is called with the mutex held, so reports are not interleaved
+ * Returns 1 if successful or -1 on error
+ */
+int piecewise_verifier_set_report_function(
+     piecewise_verifier_t *piecewise_verifier,
+     void (*report_function)(
+             intptr_t *report_handle,
+             off64_t chunk_offset,
+             size64_t chunk_size,
+             int chunk_status ),
+     intptr_t *report_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "piecewise_verifier_set_report_function";
+
+	if( piecewise_verifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid piecewise verifier.",
+		 function );
+
+		return( -1 );
+	}
+	piecewise_verifier->report_function = report_function;
+	piecewise_verifier->report_handle   = report_handle;
+
+	return( 1 );
+}
+
+/* Retrieves the index of the next chunk to verify
+ * Returns 1 if successful, 0 if no more chunks need to be verified or -1 on error
+ */
+int piecewise_verifier_get_next_chunk_index(
+     piecewise_verifier_t *piecewise_verifier,
+     uint64_t *chunk_index,
+     libcerror_error_t **error )
+{
+	static char *function = "piecewise_verifier_get_next_chunk_index";
+	int result            = 0;
+
+	if( piecewise_verifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid piecewise verifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk index.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     piecewise_verifier->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( piecewise_verifier->abort == 0 )
+	 && ( piecewise_verifier->worker_failed == 0 )
+	 && ( ( piecewise_verifier->fail_fast == 0 )
+	  ||  ( piecewise_verifier->number_of_corrupted_chunks == 0 ) )
+	 && ( piecewise_verifier->next_chunk_index < piecewise_verifier->number_of_chunks ) )
+	{
+		*chunk_index = piecewise_verifier->next_chunk_index;
+
+		piecewise_verifier->next_chunk_index += 1;
+
+		result = 1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     piecewise_verifier->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Verifies chunks against the stored piecewise hashes
+ * The buffer is divided in a lane per chunk, where the data of the lanes is hashed
+ * in parallel for the digests that provide multi-buffer functions
+ * A chunk that cannot be read is not considered an error but is indicated by its chunk status
+ * Returns 1 if successful or -1 on error
+ */
+int piecewise_verifier_verify_chunks(
+     piecewise_verifier_t *piecewise_verifier,
+     const uint64_t *chunk_indexes,
+     int number_of_chunks,
+     uint8_t *buffer,
+     size_t buffer_size,
+     int *chunk_statuses,
+     libcerror_error_t **error )
+{
+	uint8_t calculated_hash[ PIECEWISE_VERIFIER_MAXIMUM_HASH_SIZE ];
+	uint8_t stored_hash[ PIECEWISE_VERIFIER_MAXIMUM_HASH_SIZE ];
+
+	intptr_t *contexts[ PIECEWISE_VERIFIER_MAXIMUM_NUMBER_OF_DIGESTS ][ PIECEWISE_VERIFIER_MAXIMUM_NUMBER_OF_LANES ];
+	intptr_t *update_contexts[ PIECEWISE_VERIFIER_MAXIMUM_NUMBER_OF_LANES ];
+	const uint8_t *update_buffers[ PIECEWISE_VERIFIER_MAXIMUM_NUMBER_OF_LANES ];
+	size64_t remaining_sizes[ PIECEWISE_VERIFIER_MAXIMUM_NUMBER_OF_LANES ];
+	size_t read_sizes[ PIECEWISE_VERIFIER_MAXIMUM_NUMBER_OF_LANES ];
+	size_t update_sizes[ PIECEWISE_VERIFIER_MAXIMUM_NUMBER_OF_LANES ];
+	off64_t read_offsets[ PIECEWISE_VERIFIER_MAXIMUM_NUMBER_OF_LANES ];
+
+	piecewise_hash_t *stored_hashes = NULL;
+	libcerror_error_t *read_error   = NULL;
+	uint8_t *lane_buffer            = NULL;
+	static char *function           = "piecewise_verifier_verify_chunks";
+	size64_t chunk_data_size        = 0;
+	size64_t stored_chunk_size      = 0;
+	size_t lane_buffer_size         = 0;
+	size_t read_size                = 0;
+	ssize_t read_count              = 0;
+	off64_t chunk_offset            = 0;
+	off64_t stored_chunk_offset     = 0;
+	int digest_index                = 0;
+	int lane_index                  = 0;
+	int number_of_active_lanes      = 0;
+	int number_of_update_contexts   = 0;
+	int result                      = 1;
+
+	if( piecewise_verifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid piecewise verifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk indexes.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_chunks <= 0 )
+	 || ( number_of_chunks > PIECEWISE_VERIFIER_MAXIMUM_NUMBER_OF_LANES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of chunks value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( lane_index = 0;
+	     lane_index < number_of_chunks;
+	     lane_index++ )
+	{
+		if( chunk_indexes[ lane_index ] >= piecewise_verifier->number_of_chunks )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid chunk index: %d value out of bounds.",
+			 function,
+			 lane_index );
+
+			return( -1 );
+		}
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_statuses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk statuses.",
+		 function );
+
+		return( -1 );
+	}
+	lane_buffer_size = buffer_size / (size_t) number_of_chunks;
+
+	/* Keep the lane buffers a multiple of the digest block size so that
+	 * the lanes can be hashed in parallel without buffering partial blocks
+	 */
+	if( number_of_chunks > 1 )
+	{
+		lane_buffer_size -= lane_buffer_size % PIECEWISE_VERIFIER_LANE_BUFFER_ALIGNMENT;
+	}
+	if( lane_buffer_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid buffer size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     contexts,
+	     0,
+	     sizeof( intptr_t * ) * PIECEWISE_VERIFIER_MAXIMUM_NUMBER_OF_DIGESTS * PIECEWISE_VERIFIER_MAXIMUM_NUMBER_OF_LANES ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear contexts.",
+		 function );
+
+		return( -1 );
+	}
+	for( lane_index = 0;
+	     lane_index < number_of_chunks;
+	     lane_index++ )
+	{
+		chunk_offset    = (off64_t) ( chunk_indexes[ lane_index ] * piecewise_verifier->chunk_size );
+		chunk_data_size = piecewise_verifier->media_size - (size64_t) chunk_offset;
+
+		if( chunk_data_size > piecewise_verifier->chunk_size )
+		{
+			chunk_data_size = piecewise_verifier->chunk_size;
+		}
+		read_offsets[ lane_index ]    = chunk_offset;
+		remaining_sizes[ lane_index ] = chunk_data_size;
+		chunk_statuses[ lane_index ]  = PIECEWISE_VERIFIER_CHUNK_STATUS_MATCH;
+	}
+	for( digest_index = 0;
+	     digest_index < piecewise_verifier->number_of_digests;
+	     digest_index++ )
+	{
+		stored_hashes = piecewise_verifier->stored_hashes[ digest_index ];
+
+		for( lane_index = 0;
+		     lane_index < number_of_chunks;
+		     lane_index++ )
+		{
+			if( stored_hashes->multi_buffer_initialize_function != NULL )
+			{
+				result = stored_hashes->multi_buffer_initialize_function(
+				          &( contexts[ digest_index ][ lane_index ] ),
+				          error );
+			}
+			else
+			{
+				result = stored_hashes->initialize_function(
+				          &( contexts[ digest_index ][ lane_index ] ),
+				          error );
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to initialize context: %d of lane: %d.",
+				 function,
+				 digest_index,
+				 lane_index );
+
+				goto on_error;
+			}
+		}
+	}
+	do
+	{
+		number_of_active_lanes = 0;
+
+		for( lane_index = 0;
+		     lane_index < number_of_chunks;
+		     lane_index++ )
+		{
+			read_sizes[ lane_index ] = 0;
+
+			if( ( chunk_statuses[ lane_index ] != PIECEWISE_VERIFIER_CHUNK_STATUS_MATCH )
+			 || ( remaining_sizes[ lane_index ] == 0 ) )
+			{
+				continue;
+			}
+			read_size = lane_buffer_size;
+
+			if( remaining_sizes[ lane_index ] < (size64_t) read_size )
+			{
+				read_size = (size_t) remaining_sizes[ lane_index ];
+			}
+			read_count = piecewise_verifier->read_function(
+			              piecewise_verifier->data_handle,
+			              &( buffer[ lane_index * lane_buffer_size ] ),
+			              read_size,
+			              read_offsets[ lane_index ],
+			              &read_error );
+
+			/* A short read means part of the chunk is not available
+			 */
+			if( read_count != (ssize_t) read_size )
+			{
+				if( read_error != NULL )
+				{
+					libcerror_error_free(
+					 &read_error );
+				}
+				chunk_statuses[ lane_index ] = PIECEWISE_VERIFIER_CHUNK_STATUS_READ_ERROR;
+
+				continue;
+			}
+			read_sizes[ lane_index ] = read_size;
+
+			number_of_active_lanes++;
+		}
+		if( number_of_active_lanes == 0 )
+		{
+			break;
+		}
+		for( digest_index = 0;
+		     digest_index < piecewise_verifier->number_of_digests;
+		     digest_index++ )
+		{
+			stored_hashes = piecewise_verifier->stored_hashes[ digest_index ];
+
+			if( stored_hashes->multi_buffer_update_function != NULL )
+			{
+				number_of_update_contexts = 0;
+
+				for( lane_index = 0;
+				     lane_index < number_of_chunks;
+				     lane_index++ )
+				{
+					if( read_sizes[ lane_index ] == 0 )
+					{
+						continue;
+					}
+					update_contexts[ number_of_update_contexts ] = contexts[ digest_index ][ lane_index ];
+					update_buffers[ number_of_update_contexts ]  = &( buffer[ lane_index * lane_buffer_size ] );
+					update_sizes[ number_of_update_contexts ]    = read_sizes[ lane_index ];
+
+					number_of_update_contexts++;
+				}
+				if( stored_hashes->multi_buffer_update_function(
+				     update_contexts,
+				     update_buffers,
+				     update_sizes,
+				     number_of_update_contexts,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to update contexts: %d.",
+					 function,
+					 digest_index );
+
+					goto on_error;
+				}
+				continue;
+			}
+			for( lane_index = 0;
+			     lane_index < number_of_chunks;
+			     lane_index++ )
+			{
+				if( read_sizes[ lane_index ] == 0 )
+				{
+					continue;
+				}
+				lane_buffer = &( buffer[ lane_index * lane_buffer_size ] );
+
+				if( stored_hashes->update_function(
+				     contexts[ digest_index ][ lane_index ],
+				     lane_buffer,
+				     read_sizes[ lane_index ],
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to update context: %d of lane: %d.",
+					 function,
+					 digest_index,
+					 lane_index );
+
+					goto on_error;
+				}
+			}
+		}
+		for( lane_index = 0;
+		     lane_index < number_of_chunks;
+		     lane_index++ )
+		{
+			read_offsets[ lane_index ]    += (off64_t) read_sizes[ lane_index ];
+			remaining_sizes[ lane_index ] -= read_sizes[ lane_index ];
+		}
+	}
+	while( number_of_active_lanes > 0 );
+
+	result = 1;
+
+	for( lane_index = 0;
+	     lane_index < number_of_chunks;
+	     lane_index++ )
+	{
+		for( digest_index = 0;
+		     digest_index < piecewise_verifier->number_of_digests;
+		     digest_index++ )
+		{
+			stored_hashes = piecewise_verifier->stored_hashes[ digest_index ];
+
+			if( chunk_statuses[ lane_index ] == PIECEWISE_VERIFIER_CHUNK_STATUS_MATCH )
+			{
+				if( stored_hashes->finalize_function(
+				     contexts[ digest_index ][ lane_index ],
+				     calculated_hash,
+				     stored_hashes->hash_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to finalize context: %d of lane: %d.",
+					 function,
+					 digest_index,
+					 lane_index );
+
+					goto on_error;
+				}
+				if( piecewise_hash_get_chunk(
+				     stored_hashes,
+				     chunk_indexes[ lane_index ],
+				     &stored_chunk_offset,
+				     &stored_chunk_size,
+				     stored_hash,
+				     PIECEWISE_VERIFIER_MAXIMUM_HASH_SIZE,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve stored hash of chunk: %" PRIu64 ".",
+					 function,
+					 chunk_indexes[ lane_index ] );
+
+					goto on_error;
+				}
+				if( memory_compare(
+				     calculated_hash,
+				     stored_hash,
+				     stored_hashes->hash_size ) != 0 )
+				{
+					chunk_statuses[ lane_index ] = PIECEWISE_VERIFIER_CHUNK_STATUS_MISMATCH;
+				}
+			}
+			if( stored_hashes->free_function(
+			     &( contexts[ digest_index ][ lane_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free context: %d of lane: %d.",
+				 function,
+				 digest_index,
+				 lane_index );
+
+				result = -1;
+			}
+		}
+	}
+	return( result );
+
+on_error:
+	for( digest_index = 0;
+	     digest_index < piecewise_verifier->number_of_digests;
+	     digest_index++ )
+	{
+		for( lane_index = 0;
+		     lane_index < number_of_chunks;
+		     lane_index++ )
+		{
+			if( contexts[ digest_index ][ lane_index ] != NULL )
+			{
+				piecewise_verifier->stored_hashes[ digest_index ]->free_function(
+				 &( contexts[ digest_index ][ lane_index ] ),
+				 NULL );
+			}
+		}
+	}
+	return( -1 );
+}
+
+/* Verifies a chunk against the stored piecewise hashes
+ * A chunk that cannot be read is not considered an error but is indicated by the chunk status
+ * Returns 1 if successful or -1 on error
+ */
+int piecewise_verifier_verify_chunk(
+     piecewise_verifier_t *piecewise_verifier,
+     uint64_t chunk_index,
+     uint8_t *buffer,
+     size_t buffer_size,
+     int *chunk_status,
+     libcerror_error_t **error )
+{
+	static char *function = "piecewise_verifier_verify_chunk";
+
+	if( piecewise_verifier_verify_chunks(
+	     piecewise_verifier,
+	     &chunk_index,
+	     1,
+	     buffer,
+	     buffer_size,
+	     chunk_status,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to verify chunk: %" PRIu64 ".",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Completes the verification of a chunk
+ * A chunk that does not verify is reported unless abort was signalled
+ * Returns 1 if successful or -1 on error
+ */
+int piecewise_verifier_complete_chunk(
+     piecewise_verifier_t *piecewise_verifier,
+     uint64_t chunk_index,
+     int chunk_status,
+     libcerror_error_t **error )
+{
+	static char *function    = "piecewise_verifier_complete_chunk";
+	size64_t chunk_data_size = 0;
+	off64_t chunk_offset     = 0;
+
+	if( piecewise_verifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid piecewise verifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_index >= piecewise_verifier->number_of_chunks )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_offset    = (off64_t) ( chunk_index * piecewise_verifier->chunk_size );
+	chunk_data_size = piecewise_verifier->media_size - (size64_t) chunk_offset;
+
+	if( chunk_data_size > piecewise_verifier->chunk_size )
+	{
+		chunk_data_size = piecewise_verifier->chunk_size;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     piecewise_verifier->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* After abort was signalled a chunk can be incomplete without being corrupted
+	 */
+	if( piecewise_verifier->abort == 0 )
+	{
+		piecewise_verifier->number_of_verified_chunks += 1;
+		piecewise_verifier->verified_size             += chunk_data_size;
+
+		if( chunk_status != PIECEWISE_VERIFIER_CHUNK_STATUS_MATCH )
+		{
+			piecewise_verifier->number_of_corrupted_chunks += 1;
+
+			if( piecewise_verifier->report_function != NULL )
+			{
+				piecewise_verifier->report_function(
+				 piecewise_verifier->report_handle,
+				 chunk_offset,
+				 chunk_data_size,
+				 chunk_status );
+			}
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     piecewise_verifier->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Verifies chunks until no more chunks need to be verified
+ * Returns 1 if successful or -1 on error
+ */
+int piecewise_verifier_process_chunks(
+     piecewise_verifier_t *piecewise_verifier,
+     libcerror_error_t **error )
+{
+	uint64_t chunk_indexes[ PIECEWISE_VERIFIER_MAXIMUM_NUMBER_OF_LANES ];
+	int chunk_statuses[ PIECEWISE_VERIFIER_MAXIMUM_NUMBER_OF_LANES ];
+
+	uint8_t *buffer       = NULL;
+	static char *function = "piecewise_verifier_process_chunks";
+	int digest_index      = 0;
+	int lane_index        = 0;
+	int number_of_chunks  = 0;
+	int number_of_lanes   = 1;
+	int result            = 0;
+
+	if( piecewise_verifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid piecewise verifier.",
+		 function );
+
+		return( -1 );
+	}
+	/* Multiple chunks are verified at the same time when a digest can hash them in parallel
+	 */
+	for( digest_index = 0;
+	     digest_index < piecewise_verifier->number_of_digests;
+	     digest_index++ )
+	{
+		if( piecewise_verifier->stored_hashes[ digest_index ]->multi_buffer_update_function != NULL )
+		{
+			number_of_lanes = PIECEWISE_VERIFIER_MAXIMUM_NUMBER_OF_LANES;
+		}
+	}
+	if( piecewise_verifier->buffer_size < ( (size_t) PIECEWISE_VERIFIER_MAXIMUM_NUMBER_OF_LANES * PIECEWISE_VERIFIER_LANE_BUFFER_ALIGNMENT ) )
+	{
+		number_of_lanes = 1;
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * piecewise_verifier->buffer_size );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	do
+	{
+		for( number_of_chunks = 0;
+		     number_of_chunks < number_of_lanes;
+		     number_of_chunks++ )
+		{
+			result = piecewise_verifier_get_next_chunk_index(
+			          piecewise_verifier,
+			          &( chunk_indexes[ number_of_chunks ] ),
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve next chunk index.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+		}
+		if( number_of_chunks == 0 )
+		{
+			break;
+		}
+		if( piecewise_verifier_verify_chunks(
+		     piecewise_verifier,
+		     chunk_indexes,
+		     number_of_chunks,
+		     buffer,
+		     piecewise_verifier->buffer_size,
+		     chunk_statuses,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to verify chunks starting with: %" PRIu64 ".",
+			 function,
+			 chunk_indexes[ 0 ] );
+
+			goto on_error;
+		}
+		for( lane_index = 0;
+		     lane_index < number_of_chunks;
+		     lane_index++ )
+		{
+			if( piecewise_verifier_complete_chunk(
+			     piecewise_verifier,
+			     chunk_indexes[ lane_index ],
+			     chunk_statuses[ lane_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to complete chunk: %" PRIu64 ".",
+				 function,
+				 chunk_indexes[ lane_index ] );
+
+				goto on_error;
+			}
+		}
+	}
+	while( result == 1 );
+
+	memory_free(
+	 buffer );
+
+	return( 1 );
+
+on_error:
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Verifies chunks until no more chunks need to be verified
+ * Callback function for the piecewise verifier threads
+ * Returns 1 if successful or -1 on error
+ */
+int piecewise_verifier_worker(
+     piecewise_verifier_t *piecewise_verifier )
+{
+	libcerror_error_t *error = NULL;
+
+	if( piecewise_verifier == NULL )
+	{
+		return( -1 );
+	}
+	if( piecewise_verifier_process_chunks(
+	     piecewise_verifier,
+	     &error ) == 1 )
+	{
+		return( 1 );
+	}
+	libcerror_error_free(
+	 &error );
+
+	/* Stop the other workers, the failure is reported by piecewise_verifier_run
+	 */
+	if( libcthreads_mutex_grab(
+	     piecewise_verifier->mutex,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	piecewise_verifier->worker_failed = 1;
+
+	libcthreads_mutex_release(
+	 piecewise_verifier->mutex,
+	 NULL );
+
+	return( -1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Verifies all chunks against the stored piecewise hashes
+ * The chunks are verified by multiple threads if multi-threading is supported
+ * and the number of threads is greater than 0
+ * Returns 1 if successful or -1 on error
+ */
+int piecewise_verifier_run(
+     piecewise_verifier_t *piecewise_verifier,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function = "piecewise_verifier_run";
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_t *threads[ PIECEWISE_VERIFIER_MAXIMUM_NUMBER_OF_THREADS ];
+
+	int result            = 1;
+	int thread_index      = 0;
+#endif
+
+	if( piecewise_verifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid piecewise verifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( piecewise_verifier->number_of_digests == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid piecewise verifier - missing digests.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of threads value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( (uint64_t) number_of_threads > piecewise_verifier->number_of_chunks )
+	{
+		number_of_threads = (int) piecewise_verifier->number_of_chunks;
+	}
+	if( number_of_threads > PIECEWISE_VERIFIER_MAXIMUM_NUMBER_OF_THREADS )
+	{
+		number_of_threads = PIECEWISE_VERIFIER_MAXIMUM_NUMBER_OF_THREADS;
+	}
+	if( number_of_threads > 1 )
+	{
+		if( memory_set(
+		     threads,
+		     0,
+		     sizeof( libcthreads_thread_t * ) * PIECEWISE_VERIFIER_MAXIMUM_NUMBER_OF_THREADS ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear threads.",
+			 function );
+
+			return( -1 );
+		}
+		/* Every thread reads and hashes whole chunks, so chunks in different
+		 * segment files are read concurrently
+		 */
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
+		{
+			if( libcthreads_thread_create(
+			     &( threads[ thread_index ] ),
+			     NULL,
+			     (int (*)(void *)) &piecewise_verifier_worker,
+			     (void *) piecewise_verifier,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create thread: %d.",
+				 function,
+				 thread_index );
+
+				/* Stop the threads that were already created
+				 */
+				if( libcthreads_mutex_grab(
+				     piecewise_verifier->mutex,
+				     NULL ) == 1 )
+				{
+					piecewise_verifier->worker_failed = 1;
+
+					libcthreads_mutex_release(
+					 piecewise_verifier->mutex,
+					 NULL );
+				}
+				result = -1;
+
+				break;
+			}
+		}
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
+		{
+			if( threads[ thread_index ] == NULL )
+			{
+				continue;
+			}
+			if( libcthreads_thread_join(
+			     &( threads[ thread_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread: %d.",
+				 function,
+				 thread_index );
+
+				result = -1;
+			}
+		}
+		if( result != 1 )
+		{
+			return( -1 );
+		}
+		if( piecewise_verifier->worker_failed != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to verify chunks in worker thread.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	if( piecewise_verifier_process_chunks(
+	     piecewise_verifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to verify chunks.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of chunks that did not verify
+ * Returns 1 if successful or -1 on error
+ */
+int piecewise_verifier_get_number_of_corrupted_chunks(
+     piecewise_verifier_t *piecewise_verifier,
+     uint64_t *number_of_corrupted_chunks,
+     libcerror_error_t **error )
+{
+	static char *function = "piecewise_verifier_get_number_of_corrupted_chunks";
+
+	if( piecewise_verifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid piecewise verifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_corrupted_chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of corrupted chunks.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_corrupted_chunks = piecewise_verifier->number_of_corrupted_chunks;
+
+	return( 1 );
+}
+
@@ -0,0 +1,226 @@
+/*
+ * Piecewise hash verifier
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _PIECEWISE_VERIFIER_H )
+#define _PIECEWISE_VERIFIER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "piecewise_hash.h"
+#include "smrawtools_libcerror.h"
+#include "smrawtools_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define PIECEWISE_VERIFIER_MAXIMUM_NUMBER_OF_DIGESTS	3
+#define PIECEWISE_VERIFIER_MAXIMUM_NUMBER_OF_THREADS	32
+#define PIECEWISE_VERIFIER_MAXIMUM_NUMBER_OF_LANES	8
+
+enum PIECEWISE_VERIFIER_CHUNK_STATUSES
+{
+	PIECEWISE_VERIFIER_CHUNK_STATUS_MATCH		= 0,
+	PIECEWISE_VERIFIER_CHUNK_STATUS_MISMATCH	= 1,
+	PIECEWISE_VERIFIER_CHUNK_STATUS_READ_ERROR	= 2
+};
+
+typedef struct piecewise_verifier piecewise_verifier_t;
+
+struct piecewise_verifier
+{
+	/* The media size
+	 */
+	size64_t media_size;
+
+	/* The buffer size
+	 */
+	size_t buffer_size;
+
+	/* The data handle
+	 */
+	intptr_t *data_handle;
+
+	/* The read function
+	 */
+	ssize_t (*read_function)(
+	           intptr_t *data_handle,
+	           void *buffer,
+	           size_t buffer_size,
+	           off64_t offset,
+	           libcerror_error_t **error );
+
+	/* The stored piecewise hashes, one per digest type
+	 */
+	piecewise_hash_t *stored_hashes[ PIECEWISE_VERIFIER_MAXIMUM_NUMBER_OF_DIGESTS ];
+
+	/* The number of digests
+	 */
+	int number_of_digests;
+
+	/* The chunk size
+	 */
+	size64_t chunk_size;
+
+	/* The number of chunks
+	 */
+	uint64_t number_of_chunks;
+
+	/* The report handle
+	 */
+	intptr_t *report_handle;
+
+	/* The function called for every chunk that does not verify
+	 */
+	void (*report_function)(
+	        intptr_t *report_handle,
+	        off64_t chunk_offset,
+	        size64_t chunk_size,
+	        int chunk_status );
+
+	/* Value to indicate verification should stop at the first chunk that does not verify
+	 */
+	uint8_t fail_fast;
+
+	/* The index of the next chunk to verify
+	 */
+	uint64_t next_chunk_index;
+
+	/* The number of chunks verified
+	 */
+	uint64_t number_of_verified_chunks;
+
+	/* The number of chunks that did not verify
+	 */
+	uint64_t number_of_corrupted_chunks;
+
+	/* The size of the data verified
+	 */
+	size64_t verified_size;
+
+	/* Value to indicate a worker failed
+	 */
+	uint8_t worker_failed;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int piecewise_verifier_initialize(
+     piecewise_verifier_t **piecewise_verifier,
+     size64_t media_size,
+     size_t buffer_size,
+     ssize_t (*read_function)(
+                intptr_t *data_handle,
+                void *buffer,
+                size_t buffer_size,
+                off64_t offset,
+                libcerror_error_t **error ),
+     intptr_t *data_handle,
+     libcerror_error_t **error );
+
+int piecewise_verifier_free(
+     piecewise_verifier_t **piecewise_verifier,
+     libcerror_error_t **error );
+
+int piecewise_verifier_signal_abort(
+     piecewise_verifier_t *piecewise_verifier,
+     libcerror_error_t **error );
+
+int piecewise_verifier_append_digest(
+     piecewise_verifier_t *piecewise_verifier,
+     piecewise_hash_t *stored_hashes,
+     libcerror_error_t **error );
+
+int piecewise_verifier_set_report_function(
+     piecewise_verifier_t *piecewise_verifier,
+     void (*report_function)(
+             intptr_t *report_handle,
+             off64_t chunk_offset,
+             size64_t chunk_size,
+             int chunk_status ),
+     intptr_t *report_handle,
+     libcerror_error_t **error );
+
+int piecewise_verifier_get_next_chunk_index(
+     piecewise_verifier_t *piecewise_verifier,
+     uint64_t *chunk_index,
+     libcerror_error_t **error );
+
+int piecewise_verifier_verify_chunks(
+     piecewise_verifier_t *piecewise_verifier,
+     const uint64_t *chunk_indexes,
+     int number_of_chunks,
+     uint8_t *buffer,
+     size_t buffer_size,
+     int *chunk_statuses,
+     libcerror_error_t **error );
+
+int piecewise_verifier_verify_chunk(
+     piecewise_verifier_t *piecewise_verifier,
+     uint64_t chunk_index,
+     uint8_t *buffer,
+     size_t buffer_size,
+     int *chunk_status,
+     libcerror_error_t **error );
+
+int piecewise_verifier_complete_chunk(
+     piecewise_verifier_t *piecewise_verifier,
+     uint64_t chunk_index,
+     int chunk_status,
+     libcerror_error_t **error );
+
+int piecewise_verifier_process_chunks(
+     piecewise_verifier_t *piecewise_verifier,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int piecewise_verifier_worker(
+     piecewise_verifier_t *piecewise_verifier );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int piecewise_verifier_run(
+     piecewise_verifier_t *piecewise_verifier,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+int piecewise_verifier_get_number_of_corrupted_chunks(
+     piecewise_verifier_t *piecewise_verifier,
+     uint64_t *number_of_corrupted_chunks,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PIECEWISE_VERIFIER_H ) */
+
@@ -118,13 +118,20 @@ int main( int argc, char * const argv[] )
 		"Use smrawverify to verify data stored in the storage media (split) RAW image file format.";
 
 	smrawtools_option_t options[ ] = {
-		{ 'd', "digest_type", "calculate additional digest (hash) types besides md5, options: sha1, sha256" },
+		{ 'c', "chunk_size", "calculate the digest (hash) types for every chunk of chunk_size bytes in addition to the entire data, where segment represents the segment file size, requires -w" },
+		{ 'd', "digest_type", "calculate additional digest (hash) types besides md5 and the digest (hash) types stored in the information file, options: sha1, sha256" },
+		{ 'f', NULL, "fail fast, stop verifying the stored piecewise digest (hash) types at the first corrupted chunk" },
 		{ 'h', NULL, "shows this help" },
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		{ 'j', "threads", "specify the number of threads used to calculate the digest (hash) types in parallel with reading, where 0 represents single-threaded mode (default is 4)" },
+#endif
 		{ 'l', "log_file", "logs verification errors and the digest (hash) to a file" },
-		{ 'p', "buffer_size", "specify the process buffer size (default is the 32768)" },
+		{ 'p', "buffer_size", "specify the process buffer size (default is determined from the optimal I/O size and segment size of the input)" },
 		{ 'q', NULL, "quiet shows minimal status information" },
+		{ 'r', "piecewise_file", "verify every chunk against the digest (hash) types stored in a file written with -w, instead of calculating the digest (hash) types of the entire data, the chunks are verified in parallel" },
 		{ 'v', NULL, "verbose output to stderr, while smrawmount will remain running in the foreground" },
 		{ 'V', NULL, "print version" },
+		{ 'w', "piecewise_file", "write the digest (hash) types of every chunk calculated with -c to a file" },
 		{ 0, "image", "first or all files of a set of (split) RAW image segment files" },
 	};
 	system_character_t options_string[ 32 ];
@@ -138,15 +145,21 @@ int main( int argc, char * const argv[] )
 	log_handle_t *log_handle                           = NULL;
 	system_character_t *log_filename                   = NULL;
 	system_character_t *option_additional_digest_types = NULL;
+	system_character_t *option_number_of_threads       = NULL;
+	system_character_t *option_piecewise_chunk_size    = NULL;
 	system_character_t *option_process_buffer_size     = NULL;
+	system_character_t *piecewise_filename             = NULL;
 	system_character_t *program                        = _SYSTEM_STRING( "smrawverify" );
+	system_character_t *stored_piecewise_filename      = NULL;
 	system_integer_t option                            = 0;
 	uint8_t calculate_md5                              = 1;
+	uint8_t fail_fast                                  = 0;
 	uint8_t print_status_information                   = 1;
 	uint8_t verbose                                    = 0;
 	int number_of_filenames                            = 0;
 	int number_of_options                              = (int) ( sizeof( options ) / sizeof( smrawtools_option_t ) );
 	int result                                         = 0;
+	int write_result                                   = 0;
 
 #if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
 	_setmode( _fileno( stdout ), _O_BINARY );
@@ -218,11 +231,21 @@ int main( int argc, char * const argv[] )
 
 				goto on_error;
 
+			case (system_integer_t) 'c':
+				option_piecewise_chunk_size = optarg;
+
+				break;
+
 			case (system_integer_t) 'd':
 				option_additional_digest_types = optarg;
 
 				break;
 
+			case (system_integer_t) 'f':
+				fail_fast = 1;
+
+				break;
+
 			case (system_integer_t) 'h':
 				smrawtools_getopt_usage_fprint(
 				 stdout,
@@ -233,6 +256,13 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_SUCCESS );
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+			case (system_integer_t) 'j':
+				option_number_of_threads = optarg;
+
+				break;
+
+#endif
 			case (system_integer_t) 'l':
 				log_filename = optarg;
 
@@ -248,6 +278,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'r':
+				stored_piecewise_filename = optarg;
+
+				break;
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
@@ -258,6 +293,11 @@ int main( int argc, char * const argv[] )
 				 stdout );
 
 				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'w':
+				piecewise_filename = optarg;
+
+				break;
 		}
 	}
 	if( optind == argc )
@@ -322,9 +362,77 @@ int main( int argc, char * const argv[] )
 
 			fprintf(
 			 stderr,
-			 "Unsupported process buffer size defaulting to: 32768.\n" );
+			 "Unsupported process buffer size defaulting to: automatic.\n" );
+		}
+	}
+	if( option_number_of_threads != NULL )
+	{
+		result = verification_handle_set_number_of_threads(
+			  smrawverify_verification_handle,
+			  option_number_of_threads,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of threads.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of threads defaulting to: 4.\n" );
 		}
 	}
+	if( option_piecewise_chunk_size != NULL )
+	{
+		result = verification_handle_set_piecewise_chunk_size(
+			  smrawverify_verification_handle,
+			  option_piecewise_chunk_size,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set piecewise chunk size.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported piecewise chunk size.\n" );
+
+			goto on_error;
+		}
+	}
+	/* The piecewise hash values are not written to stdout since it contains the status information
+	 */
+	if( ( option_piecewise_chunk_size != NULL )
+	 && ( piecewise_filename == NULL ) )
+	{
+		fprintf(
+		 stderr,
+		 "Missing piecewise file to write the piecewise hash values to.\n" );
+
+		goto on_error;
+	}
+	if( ( option_piecewise_chunk_size != NULL )
+	 && ( stored_piecewise_filename != NULL ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to calculate and verify piecewise hash values at the same time.\n" );
+
+		goto on_error;
+	}
+	smrawverify_verification_handle->fail_fast = fail_fast;
+
 	if( option_additional_digest_types != NULL )
 	{
 		result = verification_handle_set_additional_digest_types(
@@ -341,6 +449,21 @@ int main( int argc, char * const argv[] )
 			goto on_error;
 		}
 	}
+	if( stored_piecewise_filename != NULL )
+	{
+		if( verification_handle_read_piecewise_hashes(
+		     smrawverify_verification_handle,
+		     stored_piecewise_filename,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read piecewise hash values from file: %" PRIs_SYSTEM ".\n",
+			 stored_piecewise_filename );
+
+			goto on_error;
+		}
+	}
 #if !defined( HAVE_GLOB_H )
 	if( smrawtools_glob_initialize(
 	     &glob,
@@ -420,6 +543,23 @@ int main( int argc, char * const argv[] )
 		goto on_error;
 	}
 #endif
+	if( stored_piecewise_filename == NULL )
+	{
+		/* Unless additional digest types were requested only the digest types
+		 * stored in the information file are calculated
+		 */
+		if( verification_handle_get_stored_integrity_hash_values(
+		     smrawverify_verification_handle,
+		     (uint8_t) ( option_additional_digest_types == NULL ),
+		     &error ) == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to retrieve stored hash values.\n" );
+
+			goto on_error;
+		}
+	}
 	if( log_filename != NULL )
 	{
 		if( log_handle_initialize(
@@ -445,13 +585,23 @@ int main( int argc, char * const argv[] )
 			goto on_error;
 		}
 	}
-	result = verification_handle_verify_input(
-		  smrawverify_verification_handle,
-		  print_status_information,
-		  log_handle,
-		  &error );
-
-	if( result != 1 )
+	if( stored_piecewise_filename != NULL )
+	{
+		result = verification_handle_verify_piecewise_hashes(
+			  smrawverify_verification_handle,
+			  print_status_information,
+			  log_handle,
+			  &error );
+	}
+	else
+	{
+		result = verification_handle_verify_input(
+			  smrawverify_verification_handle,
+			  print_status_information,
+			  log_handle,
+			  &error );
+	}
+	if( result == -1 )
 	{
 		fprintf(
 		 stderr,
@@ -462,6 +612,28 @@ int main( int argc, char * const argv[] )
 		libcerror_error_free(
 		 &error );
 	}
+	else if( ( option_piecewise_chunk_size != NULL )
+	      && ( smrawverify_abort == 0 ) )
+	{
+		write_result = verification_handle_write_piecewise_hashes(
+		                smrawverify_verification_handle,
+		                piecewise_filename,
+		                &error );
+
+		if( write_result != 1 )
+		{
+			result = -1;
+
+			fprintf(
+			 stderr,
+			 "Unable to write piecewise hash values.\n" );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
 	if( log_handle != NULL )
 	{
 		if( log_handle_close(
@@ -20,18 +20,27 @@
  */
 
 #include <common.h>
+#include <file_stream.h>
 #include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
 #include <wide_string.h>
 
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
 #include "byte_size_string.h"
 #include "digest_hash.h"
+#include "digest_pipeline.h"
 #include "log_handle.h"
+#include "piecewise_hash.h"
+#include "piecewise_verifier.h"
 #include "process_status.h"
 #include "smrawtools_libcerror.h"
 #include "smrawtools_libcsplit.h"
+#include "smrawtools_libcthreads.h"
 #include "smrawtools_libhmac.h"
 #include "smrawtools_libsmraw.h"
 #include "smrawtools_system_split_string.h"
@@ -42,6 +51,9 @@
 #define VERIFICATION_HANDLE_VALUE_IDENTIFIER_SIZE	32
 #define VERIFICATION_HANDLE_NOTIFY_STREAM		stdout
 
+#define VERIFICATION_HANDLE_PIECEWISE_HASHES_LINE_SIZE		256
+#define VERIFICATION_HANDLE_MAXIMUM_NUMBER_OF_PIECEWISE_COLUMNS	5
+
 /* Creates a verification handle
  * Make sure the value verification_handle is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -158,6 +170,12 @@ int verification_handle_initialize(
 	( *verification_handle )->calculate_md5 = calculate_md5;
 	( *verification_handle )->notify_stream = VERIFICATION_HANDLE_NOTIFY_STREAM;
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* By default the digests are calculated in worker threads so that reading and hashing overlap
+	 */
+	( *verification_handle )->number_of_threads = VERIFICATION_HANDLE_DEFAULT_NUMBER_OF_THREADS;
+#endif
+
 	return( 1 );
 
 on_error:
@@ -247,7 +265,7 @@ int verification_handle_free(
 		}
 		if( ( *verification_handle )->sha1_context != NULL )
 		{
-			if( libhmac_sha1_free(
+			if( digest_hash_sha1_free(
 			     &( ( *verification_handle )->sha1_context ),
 			     error ) != 1 )
 			{
@@ -268,7 +286,7 @@ int verification_handle_free(
 		}
 		if( ( *verification_handle )->sha256_context != NULL )
 		{
-			if( libhmac_sha256_free(
+			if( digest_hash_sha256_free(
 			     &( ( *verification_handle )->sha256_context ),
 			     error ) != 1 )
 			{
@@ -287,6 +305,102 @@ int verification_handle_free(
 			memory_free(
 			 ( *verification_handle )->calculated_sha256_hash_string );
 		}
+		if( ( *verification_handle )->piecewise_md5 != NULL )
+		{
+			if( piecewise_hash_free(
+			     &( ( *verification_handle )->piecewise_md5 ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free piecewise MD5 hashes.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *verification_handle )->piecewise_sha1 != NULL )
+		{
+			if( piecewise_hash_free(
+			     &( ( *verification_handle )->piecewise_sha1 ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free piecewise SHA1 hashes.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *verification_handle )->piecewise_sha256 != NULL )
+		{
+			if( piecewise_hash_free(
+			     &( ( *verification_handle )->piecewise_sha256 ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free piecewise SHA256 hashes.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *verification_handle )->stored_piecewise_md5 != NULL )
+		{
+			if( piecewise_hash_free(
+			     &( ( *verification_handle )->stored_piecewise_md5 ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free stored piecewise MD5 hashes.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *verification_handle )->stored_piecewise_sha1 != NULL )
+		{
+			if( piecewise_hash_free(
+			     &( ( *verification_handle )->stored_piecewise_sha1 ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free stored piecewise SHA1 hashes.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *verification_handle )->stored_piecewise_sha256 != NULL )
+		{
+			if( piecewise_hash_free(
+			     &( ( *verification_handle )->stored_piecewise_sha256 ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free stored piecewise SHA256 hashes.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 *verification_handle );
 
@@ -331,6 +445,22 @@ int verification_handle_signal_abort(
 			return( -1 );
 		}
 	}
+	if( verification_handle->piecewise_verifier != NULL )
+	{
+		if( piecewise_verifier_signal_abort(
+		     verification_handle->piecewise_verifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal piecewise verifier to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	verification_handle->abort = 1;
 
 	return( 1 );
@@ -349,6 +479,10 @@ int verification_handle_open_input(
 	static char *function                   = "verification_handle_open_input";
 	size_t first_filename_length            = 0;
 
+#if defined( HAVE_SYS_STAT_H ) && defined( HAVE_STAT ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	struct stat file_statistics;
+#endif
+
 	if( verification_handle == NULL )
 	{
 		libcerror_error_set(
@@ -414,6 +548,38 @@ int verification_handle_open_input(
 		}
 		filenames = (system_character_t * const *) libsmraw_filenames;
 	}
+	/* The input is read sequentially, read-ahead prevents stalls at segment file boundaries
+	 */
+	if( libsmraw_handle_set_read_ahead_size(
+	     verification_handle->input_handle,
+	     VERIFICATION_HANDLE_READ_AHEAD_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set read-ahead size.",
+		 function );
+
+		goto on_error;
+	}
+	/* The input is read only once, there is no need to keep it in the page cache
+	 */
+	if( libsmraw_handle_set_access_pattern(
+	     verification_handle->input_handle,
+	     LIBSMRAW_ACCESS_PATTERN_FLAG_SEQUENTIAL | LIBSMRAW_ACCESS_PATTERN_FLAG_NO_REUSE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set access pattern.",
+		 function );
+
+		goto on_error;
+	}
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 	if( libsmraw_handle_open_wide(
 	     verification_handle->input_handle,
@@ -439,6 +605,22 @@ int verification_handle_open_input(
 
 		goto on_error;
 	}
+	verification_handle->optimal_io_size = 0;
+
+#if defined( HAVE_SYS_STAT_H ) && defined( HAVE_STAT ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	/* The preferred I/O block size of the first segment file is used to determine
+	 * the default process buffer size, failing to retrieve it is not considered an error
+	 */
+	if( stat(
+	     filenames[ 0 ],
+	     &file_statistics ) == 0 )
+	{
+		if( file_statistics.st_blksize > 0 )
+		{
+			verification_handle->optimal_io_size = (size_t) file_statistics.st_blksize;
+		}
+	}
+#endif
 	if( libsmraw_filenames != NULL )
 	{
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -656,7 +838,7 @@ int verification_handle_initialize_integrity_hash(
 	}
 	if( verification_handle->calculate_sha1 != 0 )
 	{
-		if( libhmac_sha1_initialize(
+		if( digest_hash_sha1_initialize(
 		     &( verification_handle->sha1_context ),
 		     error ) != 1 )
 		{
@@ -673,7 +855,7 @@ int verification_handle_initialize_integrity_hash(
 	}
 	if( verification_handle->calculate_sha256 != 0 )
 	{
-		if( libhmac_sha256_initialize(
+		if( digest_hash_sha256_initialize(
 		     &( verification_handle->sha256_context ),
 		     error ) != 1 )
 		{
@@ -693,7 +875,7 @@ int verification_handle_initialize_integrity_hash(
 on_error:
 	if( verification_handle->sha1_context != NULL )
 	{
-		libhmac_sha1_free(
+		digest_hash_sha1_free(
 		 &( verification_handle->sha1_context ),
 		 NULL );
 	}
@@ -771,7 +953,7 @@ int verification_handle_update_integrity_hash(
 	}
 	if( verification_handle->calculate_sha1 != 0 )
 	{
-		if( libhmac_sha1_update(
+		if( digest_hash_sha1_update(
 		     verification_handle->sha1_context,
 		     buffer,
 		     buffer_size,
@@ -789,7 +971,7 @@ int verification_handle_update_integrity_hash(
 	}
 	if( verification_handle->calculate_sha256 != 0 )
 	{
-		if( libhmac_sha256_update(
+		if( digest_hash_sha256_update(
 		     verification_handle->sha256_context,
 		     buffer,
 		     buffer_size,
@@ -805,6 +987,60 @@ int verification_handle_update_integrity_hash(
 			return( -1 );
 		}
 	}
+	if( verification_handle->piecewise_md5 != NULL )
+	{
+		if( piecewise_hash_update(
+		     verification_handle->piecewise_md5,
+		     buffer,
+		     buffer_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update piecewise MD5 digest hashes.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( verification_handle->piecewise_sha1 != NULL )
+	{
+		if( piecewise_hash_update(
+		     verification_handle->piecewise_sha1,
+		     buffer,
+		     buffer_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update piecewise SHA1 digest hashes.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( verification_handle->piecewise_sha256 != NULL )
+	{
+		if( piecewise_hash_update(
+		     verification_handle->piecewise_sha256,
+		     buffer,
+		     buffer_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update piecewise SHA256 digest hashes.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	return( 1 );
 }
 
@@ -815,10 +1051,6 @@ int verification_handle_finalize_integrity_hash(
      verification_handle_t *verification_handle,
      libcerror_error_t **error )
 {
-	uint8_t calculated_md5_hash[ LIBHMAC_MD5_HASH_SIZE ];
-	uint8_t calculated_sha1_hash[ LIBHMAC_SHA1_HASH_SIZE ];
-	uint8_t calculated_sha256_hash[ LIBHMAC_SHA256_HASH_SIZE ];
-
 	static char *function = "verification_handle_finalize_integrity_hash";
 
 	if( verification_handle == NULL )
@@ -847,7 +1079,7 @@ int verification_handle_finalize_integrity_hash(
 		}
 		if( libhmac_md5_finalize(
 		     verification_handle->md5_context,
-		     calculated_md5_hash,
+		     verification_handle->calculated_md5_hash,
 		     LIBHMAC_MD5_HASH_SIZE,
 		     error ) != 1 )
 		{
@@ -874,7 +1106,7 @@ int verification_handle_finalize_integrity_hash(
 			return( -1 );
 		}
 		if( digest_hash_copy_to_string(
-		     calculated_md5_hash,
+		     verification_handle->calculated_md5_hash,
 		     LIBHMAC_MD5_HASH_SIZE,
 		     verification_handle->calculated_md5_hash_string,
 		     33,
@@ -903,9 +1135,9 @@ int verification_handle_finalize_integrity_hash(
 
 			return( -1 );
 		}
-		if( libhmac_sha1_finalize(
+		if( digest_hash_sha1_finalize(
 		     verification_handle->sha1_context,
-		     calculated_sha1_hash,
+		     verification_handle->calculated_sha1_hash,
 		     LIBHMAC_SHA1_HASH_SIZE,
 		     error ) != 1 )
 		{
@@ -918,7 +1150,7 @@ int verification_handle_finalize_integrity_hash(
 
 			return( -1 );
 		}
-		if( libhmac_sha1_free(
+		if( digest_hash_sha1_free(
 		     &( verification_handle->sha1_context ),
 		     error ) != 1 )
 		{
@@ -932,7 +1164,7 @@ int verification_handle_finalize_integrity_hash(
 			return( -1 );
 		}
 		if( digest_hash_copy_to_string(
-		     calculated_sha1_hash,
+		     verification_handle->calculated_sha1_hash,
 		     LIBHMAC_SHA1_HASH_SIZE,
 		     verification_handle->calculated_sha1_hash_string,
 		     41,
@@ -961,9 +1193,9 @@ int verification_handle_finalize_integrity_hash(
 
 			return( -1 );
 		}
-		if( libhmac_sha256_finalize(
+		if( digest_hash_sha256_finalize(
 		     verification_handle->sha256_context,
-		     calculated_sha256_hash,
+		     verification_handle->calculated_sha256_hash,
 		     LIBHMAC_SHA256_HASH_SIZE,
 		     error ) != 1 )
 		{
@@ -976,7 +1208,7 @@ int verification_handle_finalize_integrity_hash(
 
 			return( -1 );
 		}
-		if( libhmac_sha256_free(
+		if( digest_hash_sha256_free(
 		     &( verification_handle->sha256_context ),
 		     error ) != 1 )
 		{
@@ -990,7 +1222,7 @@ int verification_handle_finalize_integrity_hash(
 			return( -1 );
 		}
 		if( digest_hash_copy_to_string(
-		     calculated_sha256_hash,
+		     verification_handle->calculated_sha256_hash,
 		     LIBHMAC_SHA256_HASH_SIZE,
 		     verification_handle->calculated_sha256_hash_string,
 		     65,
@@ -1006,30 +1238,67 @@ int verification_handle_finalize_integrity_hash(
 			return( -1 );
 		}
 	}
+	if( verification_handle->piecewise_md5 != NULL )
+	{
+		if( piecewise_hash_finalize(
+		     verification_handle->piecewise_md5,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize piecewise MD5 digest hashes.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( verification_handle->piecewise_sha1 != NULL )
+	{
+		if( piecewise_hash_finalize(
+		     verification_handle->piecewise_sha1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize piecewise SHA1 digest hashes.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( verification_handle->piecewise_sha256 != NULL )
+	{
+		if( piecewise_hash_finalize(
+		     verification_handle->piecewise_sha256,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize piecewise SHA256 digest hashes.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	return( 1 );
 }
 
-/* Verifies the input
- * Returns 1 if successful, 0 if not or -1 on error
+/* Compares the calculated integrity hash(es) with the hash(es) stored in the information file
+ * Only the digest hashes that are stored are compared
+ * Returns 1 if the digest hashes match, 0 if not or -1 on error
  */
-int verification_handle_verify_input(
+int verification_handle_compare_integrity_hash(
      verification_handle_t *verification_handle,
-     uint8_t print_status_information,
-     log_handle_t *log_handle,
      libcerror_error_t **error )
 {
-	process_status_t *process_status             = NULL;
-	storage_media_buffer_t *storage_media_buffer = NULL;
-	uint8_t *data                                = NULL;
-	static char *function                        = "verification_handle_verify_input";
-	size64_t media_size                          = 0;
-	size64_t verify_count                        = 0;
-	size_t data_size                             = 0;
-	size_t process_buffer_size                   = 0;
-	size_t read_size                             = 0;
-	ssize_t process_count                        = 0;
-	ssize_t read_count                           = 0;
-	int status                                   = PROCESS_STATUS_COMPLETED;
+	static char *function = "verification_handle_compare_integrity_hash";
+	int result            = 1;
 
 	if( verification_handle == NULL )
 	{
@@ -1042,408 +1311,527 @@ int verification_handle_verify_input(
 
 		return( -1 );
 	}
-	if( verification_handle->process_buffer_size > (size_t) SSIZE_MAX )
+	if( verification_handle->stored_md5_hash_set != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid process buffer size value exceeds maximum.",
-		 function );
+		if( verification_handle->calculate_md5 == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid verification handle - missing calculated MD5 hash.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
+		if( memory_compare(
+		     verification_handle->calculated_md5_hash,
+		     verification_handle->stored_md5_hash,
+		     LIBHMAC_MD5_HASH_SIZE ) != 0 )
+		{
+			result = 0;
+		}
 	}
-	if( libsmraw_handle_get_media_size(
-	     verification_handle->input_handle,
-	     &media_size,
-	     error ) != 1 )
+	if( verification_handle->stored_sha1_hash_set != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve media size.",
-		 function );
+		if( verification_handle->calculate_sha1 == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid verification handle - missing calculated SHA1 hash.",
+			 function );
 
-		goto on_error;
+			return( -1 );
+		}
+		if( memory_compare(
+		     verification_handle->calculated_sha1_hash,
+		     verification_handle->stored_sha1_hash,
+		     LIBHMAC_SHA1_HASH_SIZE ) != 0 )
+		{
+			result = 0;
+		}
 	}
-	if( verification_handle->process_buffer_size == 0 )
-	{
-		process_buffer_size = 32768;
-	}
-	else
+	if( verification_handle->stored_sha256_hash_set != 0 )
 	{
-		process_buffer_size = verification_handle->process_buffer_size;
+		if( verification_handle->calculate_sha256 == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid verification handle - missing calculated SHA256 hash.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_compare(
+		     verification_handle->calculated_sha256_hash,
+		     verification_handle->stored_sha256_hash,
+		     LIBHMAC_SHA256_HASH_SIZE ) != 0 )
+		{
+			result = 0;
+		}
 	}
-	if( storage_media_buffer_initialize(
-	     &storage_media_buffer,
-	     process_buffer_size,
-	     error ) != 1 )
+	return( result );
+}
+
+/* Creates the piecewise hash of a specific digest type
+ * Make sure the value piecewise_hash is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_initialize_piecewise_hash(
+     piecewise_hash_t **piecewise_hash,
+     int digest_type,
+     size64_t chunk_size,
+     libcerror_error_t **error )
+{
+	static char *function = "verification_handle_initialize_piecewise_hash";
+	int result            = 0;
+
+	switch( digest_type )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create storage media buffer.",
-		 function );
+		case VERIFICATION_HANDLE_DIGEST_TYPE_MD5:
+			result = piecewise_hash_initialize(
+			          piecewise_hash,
+			          chunk_size,
+			          LIBHMAC_MD5_HASH_SIZE,
+			          (int (*)(intptr_t **, libcerror_error_t **)) &libhmac_md5_initialize,
+			          (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &libhmac_md5_update,
+			          (int (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) &libhmac_md5_finalize,
+			          (int (*)(intptr_t **, libcerror_error_t **)) &libhmac_md5_free,
+			          error );
+			break;
 
-		goto on_error;
+		case VERIFICATION_HANDLE_DIGEST_TYPE_SHA1:
+			result = piecewise_hash_initialize(
+			          piecewise_hash,
+			          chunk_size,
+			          LIBHMAC_SHA1_HASH_SIZE,
+			          (int (*)(intptr_t **, libcerror_error_t **)) &digest_hash_sha1_initialize,
+			          (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &digest_hash_sha1_update,
+			          (int (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) &digest_hash_sha1_finalize,
+			          (int (*)(intptr_t **, libcerror_error_t **)) &digest_hash_sha1_free,
+			          error );
+			break;
+
+		case VERIFICATION_HANDLE_DIGEST_TYPE_SHA256:
+			result = piecewise_hash_initialize(
+			          piecewise_hash,
+			          chunk_size,
+			          LIBHMAC_SHA256_HASH_SIZE,
+			          (int (*)(intptr_t **, libcerror_error_t **)) &digest_hash_sha256_initialize,
+			          (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &digest_hash_sha256_update,
+			          (int (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) &digest_hash_sha256_finalize,
+			          (int (*)(intptr_t **, libcerror_error_t **)) &digest_hash_sha256_free,
+			          error );
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported digest type: %d.",
+			 function,
+			 digest_type );
+
+			return( -1 );
 	}
-	if( verification_handle_initialize_integrity_hash(
-	     verification_handle,
-	     error ) != 1 )
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to initialize integrity hash(es).",
+		 "%s: unable to create piecewise hash.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( process_status_initialize(
-	     &process_status,
-	     _SYSTEM_STRING( "Verify" ),
-	     _SYSTEM_STRING( "verified" ),
-	     _SYSTEM_STRING( "Read" ),
-	     verification_handle->notify_stream,
-	     print_status_information,
-	     error ) != 1 )
+	return( 1 );
+}
+
+/* Initializes the piecewise hash(es)
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_initialize_piecewise_hashes(
+     verification_handle_t *verification_handle,
+     size64_t media_size,
+     libcerror_error_t **error )
+{
+	static char *function = "verification_handle_initialize_piecewise_hashes";
+	size64_t chunk_size   = 0;
+
+	if( verification_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create process status.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( process_status_start(
-	     process_status,
-	     error ) != 1 )
+	if( ( verification_handle->piecewise_md5 != NULL )
+	 || ( verification_handle->piecewise_sha1 != NULL )
+	 || ( verification_handle->piecewise_sha256 != NULL ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to start process status.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid verification handle - piecewise hashes value already set.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	while( verify_count < media_size )
+	if( verification_handle->use_segment_size_as_piecewise_chunk_size != 0 )
 	{
-		read_size = process_buffer_size;
+		if( libsmraw_handle_get_maximum_segment_size(
+		     verification_handle->input_handle,
+		     &chunk_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve maximum segment size.",
+			 function );
 
-		if( ( media_size - verify_count ) < read_size )
+			goto on_error;
+		}
+		/* A single segment file without a maximum segment size is hashed as a single chunk
+		 */
+		if( chunk_size == 0 )
 		{
-			read_size = (size_t) ( media_size - verify_count );
+			chunk_size = media_size;
 		}
-		read_count = verification_handle_read_buffer(
-		              verification_handle,
-		              storage_media_buffer,
-		              read_size,
-		              error );
+	}
+	else
+	{
+		chunk_size = verification_handle->piecewise_chunk_size;
+	}
+	if( chunk_size == 0 )
+	{
+		return( 1 );
+	}
+	if( verification_handle->calculate_md5 != 0 )
+	{
+		if( verification_handle_initialize_piecewise_hash(
+		     &( verification_handle->piecewise_md5 ),
+		     VERIFICATION_HANDLE_DIGEST_TYPE_MD5,
+		     chunk_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create piecewise MD5 hashes.",
+			 function );
 
-		if( read_count < 0 )
+			goto on_error;
+		}
+	}
+	if( verification_handle->calculate_sha1 != 0 )
+	{
+		if( verification_handle_initialize_piecewise_hash(
+		     &( verification_handle->piecewise_sha1 ),
+		     VERIFICATION_HANDLE_DIGEST_TYPE_SHA1,
+		     chunk_size,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			"%s: unable to read data.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create piecewise SHA1 hashes.",
 			 function );
 
 			goto on_error;
 		}
-		if( read_count == 0 )
+	}
+	if( verification_handle->calculate_sha256 != 0 )
+	{
+		if( verification_handle_initialize_piecewise_hash(
+		     &( verification_handle->piecewise_sha256 ),
+		     VERIFICATION_HANDLE_DIGEST_TYPE_SHA256,
+		     chunk_size,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unexpected end of data.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create piecewise SHA256 hashes.",
 			 function );
 
 			goto on_error;
 		}
-		process_count = verification_handle_prepare_read_buffer(
-		                 verification_handle,
-		                 storage_media_buffer,
-		                 error );
+	}
+	return( 1 );
 
-		if( process_count < 0 )
+on_error:
+	if( verification_handle->piecewise_sha1 != NULL )
+	{
+		piecewise_hash_free(
+		 &( verification_handle->piecewise_sha1 ),
+		 NULL );
+	}
+	if( verification_handle->piecewise_md5 != NULL )
+	{
+		piecewise_hash_free(
+		 &( verification_handle->piecewise_md5 ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Creates a digest pipeline that updates the integrity hash(es) in worker threads
+ * Make sure the value digest_pipeline is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_initialize_digest_pipeline(
+     verification_handle_t *verification_handle,
+     digest_pipeline_t **digest_pipeline,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function         = "verification_handle_initialize_digest_pipeline";
+	int maximum_number_of_threads = 0;
+	int number_of_digests         = 0;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->calculate_md5 != 0 )
+	{
+		number_of_digests++;
+	}
+	if( verification_handle->calculate_sha1 != 0 )
+	{
+		number_of_digests++;
+	}
+	if( verification_handle->calculate_sha256 != 0 )
+	{
+		number_of_digests++;
+	}
+	if( verification_handle->piecewise_md5 != NULL )
+	{
+		number_of_digests++;
+	}
+	if( verification_handle->piecewise_sha1 != NULL )
+	{
+		number_of_digests++;
+	}
+	if( verification_handle->piecewise_sha256 != NULL )
+	{
+		number_of_digests++;
+	}
+	/* Every digest is calculated by a single thread, since the data must be hashed in order
+	 */
+	maximum_number_of_threads = verification_handle->number_of_threads;
+
+	if( maximum_number_of_threads > number_of_digests )
+	{
+		maximum_number_of_threads = number_of_digests;
+	}
+	if( maximum_number_of_threads <= 0 )
+	{
+		maximum_number_of_threads = 1;
+	}
+	if( digest_pipeline_initialize(
+	     digest_pipeline,
+	     VERIFICATION_HANDLE_NUMBER_OF_PIPELINE_BUFFERS,
+	     buffer_size,
+	     maximum_number_of_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create digest pipeline.",
+		 function );
+
+		goto on_error;
+	}
+	if( verification_handle->calculate_md5 != 0 )
+	{
+		if( digest_pipeline_append_digest(
+		     *digest_pipeline,
+		     (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &libhmac_md5_update,
+		     (intptr_t *) verification_handle->md5_context,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			"%s: unable to prepare buffer after read.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append MD5 digest to digest pipeline.",
 			 function );
 
 			goto on_error;
 		}
-		if( process_count > (ssize_t) read_size )
+	}
+	if( verification_handle->calculate_sha1 != 0 )
+	{
+		if( digest_pipeline_append_digest(
+		     *digest_pipeline,
+		     (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &digest_hash_sha1_update,
+		     (intptr_t *) verification_handle->sha1_context,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: more bytes read than requested.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append SHA1 digest to digest pipeline.",
 			 function );
 
 			goto on_error;
 		}
-		verify_count += (size64_t) process_count;
-
-		if( storage_media_buffer_get_data(
-		     storage_media_buffer,
-		     &data,
-		     &data_size,
+	}
+	if( verification_handle->calculate_sha256 != 0 )
+	{
+		if( digest_pipeline_append_digest(
+		     *digest_pipeline,
+		     (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &digest_hash_sha256_update,
+		     (intptr_t *) verification_handle->sha256_context,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine storage media buffer data.",
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append SHA256 digest to digest pipeline.",
 			 function );
 
 			goto on_error;
 		}
-		if( verification_handle_update_integrity_hash(
-		     verification_handle,
-		     data,
-		     process_count,
+	}
+	if( verification_handle->piecewise_md5 != NULL )
+	{
+		if( digest_pipeline_append_digest(
+		     *digest_pipeline,
+		     (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &piecewise_hash_update,
+		     (intptr_t *) verification_handle->piecewise_md5,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to update integrity hash(es).",
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append piecewise MD5 digest to digest pipeline.",
 			 function );
 
 			goto on_error;
 		}
-		if( process_status_update(
-		     process_status,
-		     verify_count,
-		     media_size,
+	}
+	if( verification_handle->piecewise_sha1 != NULL )
+	{
+		if( digest_pipeline_append_digest(
+		     *digest_pipeline,
+		     (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &piecewise_hash_update,
+		     (intptr_t *) verification_handle->piecewise_sha1,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to update process status.",
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append piecewise SHA1 digest to digest pipeline.",
 			 function );
 
 			goto on_error;
 		}
-		if( verification_handle->abort != 0 )
+	}
+	if( verification_handle->piecewise_sha256 != NULL )
+	{
+		if( digest_pipeline_append_digest(
+		     *digest_pipeline,
+		     (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &piecewise_hash_update,
+		     (intptr_t *) verification_handle->piecewise_sha256,
+		     error ) != 1 )
 		{
-			break;
-		}
-  	}
-	if( storage_media_buffer_free(
-	     &storage_media_buffer,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free storage media buffer.",
-		 function );
-
-		goto on_error;
-	}
-	if( verification_handle_finalize_integrity_hash(
-	     verification_handle,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to finalize integrity hash(es).",
-		 function );
-
-		goto on_error;
-	}
-	if( verification_handle->abort != 0 )
-	{
-		status = PROCESS_STATUS_ABORTED;
-	}
-	if( process_status_stop(
-	     process_status,
-	     verify_count,
-	     status,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to stop process status.",
-		 function );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append piecewise SHA256 digest to digest pipeline.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
 	}
-	if( process_status_free(
-	     &process_status,
+	if( digest_pipeline_start(
+	     *digest_pipeline,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free process status.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to start digest pipeline.",
 		 function );
 
 		goto on_error;
 	}
-	if( verification_handle->abort == 0 )
-	{
-		if( verification_handle_hash_values_fprint(
-		     verification_handle,
-		     verification_handle->notify_stream,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-			 "%s: unable to print hash values.",
-			 function );
-
-			goto on_error;
-		}
-		fprintf(
-		 verification_handle->notify_stream,
-		 "\n" );
-
-		if( log_handle != NULL )
-		{
-			if( verification_handle_hash_values_fprint(
-			     verification_handle,
-			     log_handle->log_stream,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-				 "%s: unable to print hash values in log handle.",
-				 function );
-
-				goto on_error;
-			}
-		}
-	}
-/* TODO use the information file to retrieve the stored hashes */
 	return( 1 );
 
 on_error:
-	if( process_status != NULL )
-	{
-		process_status_stop(
-		 process_status,
-		 verify_count,
-		 PROCESS_STATUS_FAILED,
-		 NULL );
-		process_status_free(
-		 &process_status,
-		 NULL );
-	}
-	if( storage_media_buffer != NULL )
+	if( *digest_pipeline != NULL )
 	{
-		storage_media_buffer_free(
-		 &storage_media_buffer,
+		digest_pipeline_free(
+		 digest_pipeline,
 		 NULL );
 	}
 	return( -1 );
 }
 
-/* Sets the process buffer size
- * Returns 1 if successful, 0 if unsupported value or -1 on error
- */
-int verification_handle_set_process_buffer_size(
-     verification_handle_t *verification_handle,
-     const system_character_t *string,
-     libcerror_error_t **error )
-{
-	static char *function  = "verification_handle_set_process_buffer_size";
-	size_t string_length   = 0;
-	uint64_t size_variable = 0;
-	int result             = 0;
-
-	if( verification_handle == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid verification handle.",
-		 function );
-
-		return( -1 );
-	}
-	string_length = system_string_length(
-	                 string );
-
-	result = byte_size_string_convert(
-	          string,
-	          string_length,
-	          &size_variable,
-	          error );
-
-	if( result == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine process buffer size.",
-		 function );
-
-		return( -1 );
-	}
-	else if( result != 0 )
-	{
-		if( size_variable > (uint64_t) SSIZE_MAX )
-		{
-			result = 0;
-		}
-		else
-		{
-			verification_handle->process_buffer_size = (size_t) size_variable;
-		}
-	}
-	return( result );
-}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
 
-/* Sets the additional digest types
- * Returns 1 if successful or -1 on error
+/* Verifies the input
+ * Returns 1 if successful, 0 if not or -1 on error
  */
-int verification_handle_set_additional_digest_types(
+int verification_handle_verify_input(
      verification_handle_t *verification_handle,
-     const system_character_t *string,
+     uint8_t print_status_information,
+     log_handle_t *log_handle,
      libcerror_error_t **error )
 {
-	system_character_t *string_segment     = NULL;
-	system_split_string_t *string_elements = NULL;
-	static char *function                  = "verification_handle_set_additional_digest_types";
-	size_t string_length                   = 0;
-	size_t string_segment_size             = 0;
-	uint8_t calculate_sha1                 = 0;
-	uint8_t calculate_sha256               = 0;
-	int number_of_segments                 = 0;
-	int result                             = 0;
-	int segment_index                      = 0;
+	process_status_t *process_status             = NULL;
+	storage_media_buffer_t *storage_media_buffer = NULL;
+	uint8_t *data                                = NULL;
+	static char *function                        = "verification_handle_verify_input";
+	size64_t media_size                          = 0;
+	size64_t verify_count                        = 0;
+	size_t data_size                             = 0;
+	size_t process_buffer_size                   = 0;
+	size_t read_ahead_size                       = 0;
+	size_t read_size                             = 0;
+	ssize_t process_count                        = 0;
+	ssize_t read_count                           = 0;
+	int result                                   = 0;
+	int status                                   = PROCESS_STATUS_COMPLETED;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	digest_pipeline_t *digest_pipeline           = NULL;
+#endif
 
 	if( verification_handle == NULL )
 	{
@@ -1456,285 +1844,2804 @@ int verification_handle_set_additional_digest_types(
 
 		return( -1 );
 	}
-	string_length = system_string_length(
-	                 string );
-
-	if( system_string_split(
-	     string,
-	     string_length + 1,
-	     (system_character_t) ',',
-	     &string_elements,
-	     error ) != 1 )
+	if( verification_handle->process_buffer_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to split string.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid process buffer size value exceeds maximum.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( system_split_string_get_number_of_segments(
-	     string_elements,
-	     &number_of_segments,
+	if( libsmraw_handle_get_media_size(
+	     verification_handle->input_handle,
+	     &media_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of segments.",
+		 "%s: unable to retrieve media size.",
 		 function );
 
 		goto on_error;
 	}
-	for( segment_index = 0;
-	     segment_index < number_of_segments;
-	     segment_index++ )
+	if( verification_handle->process_buffer_size == 0 )
 	{
-		if( system_split_string_get_segment_by_index(
-		     string_elements,
-		     segment_index,
-		     &string_segment,
-		     &string_segment_size,
+		if( verification_handle_determine_process_buffer_size(
+		     verification_handle,
+		     media_size,
+		     &process_buffer_size,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve string segment: %d.",
-			 function,
-			 segment_index );
+			 "%s: unable to determine process buffer size.",
+			 function );
 
 			goto on_error;
 		}
-		if( string_segment == NULL )
+	}
+	else
+	{
+		process_buffer_size = verification_handle->process_buffer_size;
+	}
+	/* Make sure the read-ahead window spans multiple process buffers so that the next buffer
+	 * is prefetched in the background while the current buffer is being processed
+	 */
+	read_ahead_size = process_buffer_size * 2;
+
+	if( read_ahead_size > VERIFICATION_HANDLE_READ_AHEAD_SIZE )
+	{
+		if( read_ahead_size > VERIFICATION_HANDLE_MAXIMUM_READ_AHEAD_SIZE )
+		{
+			read_ahead_size = VERIFICATION_HANDLE_MAXIMUM_READ_AHEAD_SIZE;
+		}
+		if( libsmraw_handle_set_read_ahead_size(
+		     verification_handle->input_handle,
+		     read_ahead_size,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing string segment: %d.",
-			 function,
-			 segment_index );
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set read-ahead size.",
+			 function );
 
 			goto on_error;
 		}
-		if( string_segment_size == 5 )
-		{
-			if( system_string_compare(
-			     string_segment,
+	}
+	if( verification_handle_initialize_integrity_hash(
+	     verification_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize integrity hash(es).",
+		 function );
+
+		goto on_error;
+	}
+	if( ( verification_handle->piecewise_chunk_size != 0 )
+	 || ( verification_handle->use_segment_size_as_piecewise_chunk_size != 0 ) )
+	{
+		if( verification_handle_initialize_piecewise_hashes(
+		     verification_handle,
+		     media_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize piecewise hash(es).",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( verification_handle->number_of_threads > 0 )
+	{
+		if( verification_handle_initialize_digest_pipeline(
+		     verification_handle,
+		     &digest_pipeline,
+		     process_buffer_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize digest pipeline.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+#endif
+	if( storage_media_buffer_initialize(
+	     &storage_media_buffer,
+	     process_buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create storage media buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( process_status_initialize(
+	     &process_status,
+	     _SYSTEM_STRING( "Verify" ),
+	     _SYSTEM_STRING( "verified" ),
+	     _SYSTEM_STRING( "Read" ),
+	     verification_handle->notify_stream,
+	     print_status_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create process status.",
+		 function );
+
+		goto on_error;
+	}
+	if( process_status_start(
+	     process_status,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start process status.",
+		 function );
+
+		goto on_error;
+	}
+	while( verify_count < media_size )
+	{
+		read_size = process_buffer_size;
+
+		if( ( media_size - verify_count ) < read_size )
+		{
+			read_size = (size_t) ( media_size - verify_count );
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( digest_pipeline != NULL )
+		{
+			/* This blocks until the digest workers have released the buffer
+			 */
+			if( digest_pipeline_get_buffer(
+			     digest_pipeline,
+			     &storage_media_buffer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve buffer from digest pipeline.",
+				 function );
+
+				goto on_error;
+			}
+		}
+#endif
+		read_count = verification_handle_read_buffer(
+		              verification_handle,
+		              storage_media_buffer,
+		              read_size,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			"%s: unable to read data.",
+			 function );
+
+			goto on_error;
+		}
+		if( read_count == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unexpected end of data.",
+			 function );
+
+			goto on_error;
+		}
+		process_count = verification_handle_prepare_read_buffer(
+		                 verification_handle,
+		                 storage_media_buffer,
+		                 error );
+
+		if( process_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			"%s: unable to prepare buffer after read.",
+			 function );
+
+			goto on_error;
+		}
+		if( process_count > (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: more bytes read than requested.",
+			 function );
+
+			goto on_error;
+		}
+		verify_count += (size64_t) process_count;
+
+		if( storage_media_buffer_get_data(
+		     storage_media_buffer,
+		     &data,
+		     &data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine storage media buffer data.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( digest_pipeline != NULL )
+		{
+			result = digest_pipeline_push_buffer(
+			          digest_pipeline,
+			          data,
+			          (size_t) process_count,
+			          error );
+		}
+		else
+#endif
+		{
+			result = verification_handle_update_integrity_hash(
+			          verification_handle,
+			          data,
+			          process_count,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to update integrity hash(es).",
+			 function );
+
+			goto on_error;
+		}
+		if( process_status_update(
+		     process_status,
+		     verify_count,
+		     media_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update process status.",
+			 function );
+
+			goto on_error;
+		}
+		if( verification_handle->abort != 0 )
+		{
+			break;
+		}
+  	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( digest_pipeline != NULL )
+	{
+		/* The storage media buffers are owned by the digest pipeline
+		 */
+		storage_media_buffer = NULL;
+
+		if( digest_pipeline_wait(
+		     digest_pipeline,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to update integrity hash(es).",
+			 function );
+
+			goto on_error;
+		}
+		if( digest_pipeline_free(
+		     &digest_pipeline,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free digest pipeline.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+#endif
+	if( storage_media_buffer_free(
+	     &storage_media_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free storage media buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( verification_handle_finalize_integrity_hash(
+	     verification_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize integrity hash(es).",
+		 function );
+
+		goto on_error;
+	}
+	if( verification_handle->abort != 0 )
+	{
+		status = PROCESS_STATUS_ABORTED;
+	}
+	if( process_status_stop(
+	     process_status,
+	     verify_count,
+	     status,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to stop process status.",
+		 function );
+
+		goto on_error;
+	}
+	if( process_status_free(
+	     &process_status,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free process status.",
+		 function );
+
+		goto on_error;
+	}
+	result = 1;
+
+	if( verification_handle->abort == 0 )
+	{
+		if( verification_handle_hash_values_fprint(
+		     verification_handle,
+		     verification_handle->notify_stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print hash values.",
+			 function );
+
+			goto on_error;
+		}
+		if( log_handle != NULL )
+		{
+			if( verification_handle_hash_values_fprint(
+			     verification_handle,
+			     log_handle->log_stream,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print hash values in log handle.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( ( verification_handle->stored_md5_hash_set != 0 )
+		 || ( verification_handle->stored_sha1_hash_set != 0 )
+		 || ( verification_handle->stored_sha256_hash_set != 0 ) )
+		{
+			result = verification_handle_compare_integrity_hash(
+			          verification_handle,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare integrity hash(es).",
+				 function );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				fprintf(
+				 verification_handle->notify_stream,
+				 "Stored hash verification:\t\tpassed\n" );
+
+				log_handle_printf(
+				 log_handle,
+				 "Stored hash verification:\t\tpassed\n" );
+			}
+			else
+			{
+				fprintf(
+				 verification_handle->notify_stream,
+				 "Stored hash verification:\t\tfailed\n" );
+
+				log_handle_printf(
+				 log_handle,
+				 "Stored hash verification:\t\tfailed\n" );
+			}
+		}
+		fprintf(
+		 verification_handle->notify_stream,
+		 "\n" );
+	}
+	return( result );
+
+on_error:
+	if( process_status != NULL )
+	{
+		process_status_stop(
+		 process_status,
+		 verify_count,
+		 PROCESS_STATUS_FAILED,
+		 NULL );
+		process_status_free(
+		 &process_status,
+		 NULL );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( digest_pipeline != NULL )
+	{
+		storage_media_buffer = NULL;
+
+		digest_pipeline_free(
+		 &digest_pipeline,
+		 NULL );
+	}
+#endif
+	if( storage_media_buffer != NULL )
+	{
+		storage_media_buffer_free(
+		 &storage_media_buffer,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Determines the default process buffer size
+ * The process buffer size is a multiple of the optimal I/O size of the input and,
+ * where possible, a divisor of the segment file size so that reads do not straddle
+ * segment file boundaries
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_determine_process_buffer_size(
+     verification_handle_t *verification_handle,
+     size64_t media_size,
+     size_t *process_buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function        = "verification_handle_determine_process_buffer_size";
+	size64_t segment_size        = 0;
+	size_t buffer_size           = 0;
+	size_t candidate_buffer_size = 0;
+	size_t optimal_io_size       = 0;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( process_buffer_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid process buffer size.",
+		 function );
+
+		return( -1 );
+	}
+	optimal_io_size = verification_handle->optimal_io_size;
+
+	if( ( optimal_io_size == 0 )
+	 || ( optimal_io_size > (size_t) VERIFICATION_HANDLE_MAXIMUM_DEFAULT_PROCESS_BUFFER_SIZE ) )
+	{
+		optimal_io_size = VERIFICATION_HANDLE_DEFAULT_OPTIMAL_IO_SIZE;
+	}
+	buffer_size = VERIFICATION_HANDLE_DEFAULT_PROCESS_BUFFER_SIZE;
+
+	/* Devices with a large optimal I/O size, such as RAID volumes, benefit
+	 * from reading multiple optimal I/O blocks at once
+	 */
+	if( buffer_size < ( optimal_io_size * 4 ) )
+	{
+		buffer_size = optimal_io_size * 4;
+	}
+	if( buffer_size > (size_t) VERIFICATION_HANDLE_MAXIMUM_DEFAULT_PROCESS_BUFFER_SIZE )
+	{
+		buffer_size = VERIFICATION_HANDLE_MAXIMUM_DEFAULT_PROCESS_BUFFER_SIZE;
+	}
+	buffer_size -= buffer_size % optimal_io_size;
+
+	if( verification_handle->input_handle != NULL )
+	{
+		if( libsmraw_handle_get_maximum_segment_size(
+		     verification_handle->input_handle,
+		     &segment_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve maximum segment size.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* Use a smaller buffer size if it divides the segment file size and is not too small
+	 */
+	if( segment_size > 0 )
+	{
+		candidate_buffer_size = buffer_size;
+
+		while( ( ( segment_size % candidate_buffer_size ) != 0 )
+		    && ( ( candidate_buffer_size / 2 ) >= (size_t) VERIFICATION_HANDLE_MINIMUM_DEFAULT_PROCESS_BUFFER_SIZE )
+		    && ( ( ( candidate_buffer_size / 2 ) % optimal_io_size ) == 0 ) )
+		{
+			candidate_buffer_size /= 2;
+		}
+		if( ( segment_size % candidate_buffer_size ) == 0 )
+		{
+			buffer_size = candidate_buffer_size;
+		}
+	}
+	if( ( media_size > 0 )
+	 && ( media_size < (size64_t) buffer_size ) )
+	{
+		buffer_size = (size_t) media_size;
+	}
+	*process_buffer_size = buffer_size;
+
+	return( 1 );
+}
+
+/* Sets the process buffer size
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int verification_handle_set_process_buffer_size(
+     verification_handle_t *verification_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function  = "verification_handle_set_process_buffer_size";
+	size_t string_length   = 0;
+	uint64_t size_variable = 0;
+	int result             = 0;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	result = byte_size_string_convert(
+	          string,
+	          string_length,
+	          &size_variable,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine process buffer size.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( size_variable > (uint64_t) SSIZE_MAX )
+		{
+			result = 0;
+		}
+		else
+		{
+			verification_handle->process_buffer_size = (size_t) size_variable;
+		}
+	}
+	return( result );
+}
+
+/* Sets the piecewise chunk size
+ * The string either contains a size or "segment" to use the segment file size
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int verification_handle_set_piecewise_chunk_size(
+     verification_handle_t *verification_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function  = "verification_handle_set_piecewise_chunk_size";
+	size_t string_length   = 0;
+	uint64_t size_variable = 0;
+	int result             = 0;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( string_length == 7 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "segment" ),
+		     7 ) == 0 )
+		{
+			verification_handle->piecewise_chunk_size                     = 0;
+			verification_handle->use_segment_size_as_piecewise_chunk_size = 1;
+
+			return( 1 );
+		}
+	}
+	result = byte_size_string_convert(
+	          string,
+	          string_length,
+	          &size_variable,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine piecewise chunk size.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( size_variable == 0 )
+		{
+			result = 0;
+		}
+		else
+		{
+			verification_handle->piecewise_chunk_size                     = (size64_t) size_variable;
+			verification_handle->use_segment_size_as_piecewise_chunk_size = 0;
+		}
+	}
+	return( result );
+}
+
+/* Sets the number of threads
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int verification_handle_set_number_of_threads(
+     verification_handle_t *verification_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "verification_handle_set_number_of_threads";
+	size_t string_index   = 0;
+	size_t string_length  = 0;
+	int number_of_threads = 0;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( string_length == 0 )
+	{
+		return( 0 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			return( 0 );
+		}
+		number_of_threads *= 10;
+		number_of_threads += (int) ( string[ string_index ] - (system_character_t) '0' );
+
+		if( number_of_threads > VERIFICATION_HANDLE_MAXIMUM_NUMBER_OF_THREADS )
+		{
+			return( 0 );
+		}
+	}
+	verification_handle->number_of_threads = number_of_threads;
+
+	return( 1 );
+}
+
+/* Sets the additional digest types
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_set_additional_digest_types(
+     verification_handle_t *verification_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	system_character_t *string_segment     = NULL;
+	system_split_string_t *string_elements = NULL;
+	static char *function                  = "verification_handle_set_additional_digest_types";
+	size_t string_length                   = 0;
+	size_t string_segment_size             = 0;
+	uint8_t calculate_sha1                 = 0;
+	uint8_t calculate_sha256               = 0;
+	int number_of_segments                 = 0;
+	int result                             = 0;
+	int segment_index                      = 0;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( system_string_split(
+	     string,
+	     string_length + 1,
+	     (system_character_t) ',',
+	     &string_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to split string.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_split_string_get_number_of_segments(
+	     string_elements,
+	     &number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of segments.",
+		 function );
+
+		goto on_error;
+	}
+	for( segment_index = 0;
+	     segment_index < number_of_segments;
+	     segment_index++ )
+	{
+		if( system_split_string_get_segment_by_index(
+		     string_elements,
+		     segment_index,
+		     &string_segment,
+		     &string_segment_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve string segment: %d.",
+			 function,
+			 segment_index );
+
+			goto on_error;
+		}
+		if( string_segment == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing string segment: %d.",
+			 function,
+			 segment_index );
+
+			goto on_error;
+		}
+		if( string_segment_size == 5 )
+		{
+			if( system_string_compare(
+			     string_segment,
 			     _SYSTEM_STRING( "sha1" ),
 			     4 ) == 0 )
 			{
-				calculate_sha1 = 1;
+				calculate_sha1 = 1;
+			}
+			else if( system_string_compare(
+			          string_segment,
+			          _SYSTEM_STRING( "SHA1" ),
+			          4 ) == 0 )
+			{
+				calculate_sha1 = 1;
+			}
+		}
+		else if( string_segment_size == 6 )
+		{
+			if( system_string_compare(
+			     string_segment,
+			     _SYSTEM_STRING( "sha-1" ),
+			     5 ) == 0 )
+			{
+				calculate_sha1 = 1;
+			}
+			else if( system_string_compare(
+			          string_segment,
+			          _SYSTEM_STRING( "sha_1" ),
+			          5 ) == 0 )
+			{
+				calculate_sha1 = 1;
+			}
+			else if( system_string_compare(
+			          string_segment,
+			          _SYSTEM_STRING( "SHA-1" ),
+			          5 ) == 0 )
+			{
+				calculate_sha1 = 1;
+			}
+			else if( system_string_compare(
+			          string_segment,
+			          _SYSTEM_STRING( "SHA_1" ),
+			          5 ) == 0 )
+			{
+				calculate_sha1 = 1;
+			}
+		}
+		else if( string_segment_size == 7 )
+		{
+			if( system_string_compare(
+			     string_segment,
+			     _SYSTEM_STRING( "sha256" ),
+			     6 ) == 0 )
+			{
+				calculate_sha256 = 1;
+			}
+			else if( system_string_compare(
+			          string_segment,
+			          _SYSTEM_STRING( "SHA256" ),
+			          6 ) == 0 )
+			{
+				calculate_sha256 = 1;
+			}
+		}
+		else if( string_segment_size == 8 )
+		{
+			if( system_string_compare(
+			     string_segment,
+			     _SYSTEM_STRING( "sha-256" ),
+			     7 ) == 0 )
+			{
+				calculate_sha256 = 1;
+			}
+			else if( system_string_compare(
+			          string_segment,
+			          _SYSTEM_STRING( "sha_256" ),
+			          7 ) == 0 )
+			{
+				calculate_sha256 = 1;
+			}
+			else if( system_string_compare(
+			          string_segment,
+			          _SYSTEM_STRING( "SHA-256" ),
+			          7 ) == 0 )
+			{
+				calculate_sha256 = 1;
+			}
+			else if( system_string_compare(
+			          string_segment,
+			          _SYSTEM_STRING( "SHA_256" ),
+			          7 ) == 0 )
+			{
+				calculate_sha256 = 1;
+			}
+		}
+	}
+	if( ( calculate_sha1 != 0 )
+	 && ( verification_handle->calculate_sha1 == 0 ) )
+	{
+		verification_handle->calculated_sha1_hash_string = system_string_allocate(
+		                                                    41 );
+
+		if( verification_handle->calculated_sha1_hash_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create calculated SHA1 digest hash string.",
+			 function );
+
+			goto on_error;
+		}
+		verification_handle->calculate_sha1 = 1;
+	}
+	if( ( calculate_sha256 != 0 )
+	 && ( verification_handle->calculate_sha256 == 0 ) )
+	{
+		verification_handle->calculated_sha256_hash_string = system_string_allocate(
+		                                                      65 );
+
+		if( verification_handle->calculated_sha256_hash_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create calculated SHA256 digest hash string.",
+			 function );
+
+			goto on_error;
+		}
+		verification_handle->calculate_sha256 = 1;
+	}
+	if( system_split_string_free(
+	     &string_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free split string.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( string_elements != NULL )
+	{
+		system_split_string_free(
+		 &string_elements,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves a digest hash stored in the information file
+ * The identifier is matched without case sensitivity
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int verification_handle_get_stored_integrity_hash_value(
+     verification_handle_t *verification_handle,
+     const char *identifier,
+     size_t identifier_length,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	uint8_t hash_value_identifier[ VERIFICATION_HANDLE_VALUE_IDENTIFIER_SIZE ];
+	uint8_t hash_value[ 129 ];
+
+	static char *function               = "verification_handle_get_stored_integrity_hash_value";
+	size_t hash_value_identifier_size   = 0;
+	size_t hash_value_length            = 0;
+	int hash_value_index                = 0;
+	int number_of_integrity_hash_values = 0;
+	int result                          = 0;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( identifier_length == 0 )
+	 || ( identifier_length >= VERIFICATION_HANDLE_VALUE_IDENTIFIER_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid identifier length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmraw_handle_get_number_of_integrity_hash_values(
+	     verification_handle->input_handle,
+	     &number_of_integrity_hash_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of integrity hash values.",
+		 function );
+
+		return( -1 );
+	}
+	/* The case of the identifiers in the information file depends on the tool
+	 * that wrote it, hence the identifier is looked up without case sensitivity
+	 */
+	for( hash_value_index = 0;
+	     hash_value_index < number_of_integrity_hash_values;
+	     hash_value_index++ )
+	{
+		if( libsmraw_handle_get_integrity_hash_value_identifier_size(
+		     verification_handle->input_handle,
+		     hash_value_index,
+		     &hash_value_identifier_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve integrity hash value: %d identifier size.",
+			 function,
+			 hash_value_index );
+
+			return( -1 );
+		}
+		if( hash_value_identifier_size != ( identifier_length + 1 ) )
+		{
+			continue;
+		}
+		if( libsmraw_handle_get_integrity_hash_value_identifier(
+		     verification_handle->input_handle,
+		     hash_value_index,
+		     hash_value_identifier,
+		     VERIFICATION_HANDLE_VALUE_IDENTIFIER_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve integrity hash value: %d identifier.",
+			 function,
+			 hash_value_index );
+
+			return( -1 );
+		}
+		if( narrow_string_compare_no_case(
+		     (char *) hash_value_identifier,
+		     identifier,
+		     identifier_length ) == 0 )
+		{
+			break;
+		}
+	}
+	if( hash_value_index >= number_of_integrity_hash_values )
+	{
+		return( 0 );
+	}
+	result = libsmraw_handle_get_utf8_integrity_hash_value(
+	          verification_handle->input_handle,
+	          hash_value_identifier,
+	          identifier_length,
+	          hash_value,
+	          129,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve integrity hash value: %s.",
+		 function,
+		 identifier );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	hash_value_length = narrow_string_length(
+	                     (char *) hash_value );
+
+	/* An empty value means the digest hash was not stored
+	 */
+	if( hash_value_length == 0 )
+	{
+		return( 0 );
+	}
+	if( digest_hash_copy_from_string(
+	     hash,
+	     hash_size,
+	     (char *) hash_value,
+	     hash_value_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to copy integrity hash value: %s.",
+		 function,
+		 identifier );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the digest hashes stored in the information file
+ * The digest types that are stored are calculated, if calculate_stored_only is set
+ * the digest types that are not stored are no longer calculated
+ * Returns 1 if successful, 0 if no digest hashes are stored or -1 on error
+ */
+int verification_handle_get_stored_integrity_hash_values(
+     verification_handle_t *verification_handle,
+     uint8_t calculate_stored_only,
+     libcerror_error_t **error )
+{
+	static char *function = "verification_handle_get_stored_integrity_hash_values";
+	int result            = 0;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = verification_handle_get_stored_integrity_hash_value(
+	          verification_handle,
+	          "md5",
+	          3,
+	          verification_handle->stored_md5_hash,
+	          LIBHMAC_MD5_HASH_SIZE,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve stored MD5 hash.",
+		 function );
+
+		return( -1 );
+	}
+	verification_handle->stored_md5_hash_set = (uint8_t) result;
+
+	result = verification_handle_get_stored_integrity_hash_value(
+	          verification_handle,
+	          "sha1",
+	          4,
+	          verification_handle->stored_sha1_hash,
+	          LIBHMAC_SHA1_HASH_SIZE,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve stored SHA1 hash.",
+		 function );
+
+		return( -1 );
+	}
+	verification_handle->stored_sha1_hash_set = (uint8_t) result;
+
+	result = verification_handle_get_stored_integrity_hash_value(
+	          verification_handle,
+	          "sha256",
+	          6,
+	          verification_handle->stored_sha256_hash,
+	          LIBHMAC_SHA256_HASH_SIZE,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve stored SHA256 hash.",
+		 function );
+
+		return( -1 );
+	}
+	verification_handle->stored_sha256_hash_set = (uint8_t) result;
+
+	if( ( verification_handle->stored_md5_hash_set == 0 )
+	 && ( verification_handle->stored_sha1_hash_set == 0 )
+	 && ( verification_handle->stored_sha256_hash_set == 0 ) )
+	{
+		return( 0 );
+	}
+	if( ( verification_handle->stored_md5_hash_set != 0 )
+	 && ( verification_handle->calculate_md5 == 0 ) )
+	{
+		verification_handle->calculated_md5_hash_string = system_string_allocate(
+		                                                   33 );
+
+		if( verification_handle->calculated_md5_hash_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create calculated MD5 digest hash string.",
+			 function );
+
+			return( -1 );
+		}
+		verification_handle->calculate_md5 = 1;
+	}
+	else if( ( calculate_stored_only != 0 )
+	      && ( verification_handle->stored_md5_hash_set == 0 )
+	      && ( verification_handle->calculate_md5 != 0 ) )
+	{
+		memory_free(
+		 verification_handle->calculated_md5_hash_string );
+
+		verification_handle->calculated_md5_hash_string = NULL;
+		verification_handle->calculate_md5              = 0;
+	}
+	if( ( verification_handle->stored_sha1_hash_set != 0 )
+	 && ( verification_handle->calculate_sha1 == 0 ) )
+	{
+		verification_handle->calculated_sha1_hash_string = system_string_allocate(
+		                                                    41 );
+
+		if( verification_handle->calculated_sha1_hash_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create calculated SHA1 digest hash string.",
+			 function );
+
+			return( -1 );
+		}
+		verification_handle->calculate_sha1 = 1;
+	}
+	else if( ( calculate_stored_only != 0 )
+	      && ( verification_handle->stored_sha1_hash_set == 0 )
+	      && ( verification_handle->calculate_sha1 != 0 ) )
+	{
+		memory_free(
+		 verification_handle->calculated_sha1_hash_string );
+
+		verification_handle->calculated_sha1_hash_string = NULL;
+		verification_handle->calculate_sha1              = 0;
+	}
+	if( ( verification_handle->stored_sha256_hash_set != 0 )
+	 && ( verification_handle->calculate_sha256 == 0 ) )
+	{
+		verification_handle->calculated_sha256_hash_string = system_string_allocate(
+		                                                      65 );
+
+		if( verification_handle->calculated_sha256_hash_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create calculated SHA256 digest hash string.",
+			 function );
+
+			return( -1 );
+		}
+		verification_handle->calculate_sha256 = 1;
+	}
+	else if( ( calculate_stored_only != 0 )
+	      && ( verification_handle->stored_sha256_hash_set == 0 )
+	      && ( verification_handle->calculate_sha256 != 0 ) )
+	{
+		memory_free(
+		 verification_handle->calculated_sha256_hash_string );
+
+		verification_handle->calculated_sha256_hash_string = NULL;
+		verification_handle->calculate_sha256              = 0;
+	}
+	return( 1 );
+}
+
+/* Print the hash values to a stream
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_hash_values_fprint(
+     verification_handle_t *verification_handle,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	system_character_t hash_string[ 65 ];
+
+	static char *function = "verification_handle_hash_values_fprint";
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->stored_md5_hash_set != 0 )
+	{
+		if( digest_hash_copy_to_string(
+		     verification_handle->stored_md5_hash,
+		     LIBHMAC_MD5_HASH_SIZE,
+		     hash_string,
+		     65,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set stored MD5 hash string.",
+			 function );
+
+			return( -1 );
+		}
+		fprintf(
+		 stream,
+		 "MD5 hash stored in file:\t\t%" PRIs_SYSTEM "\n",
+		 hash_string );
+	}
+	if( verification_handle->calculate_md5 != 0 )
+	{
+		fprintf(
+		 stream,
+		 "MD5 hash calculated over data:\t\t%" PRIs_SYSTEM "\n",
+		 verification_handle->calculated_md5_hash_string );
+	}
+	if( verification_handle->stored_sha1_hash_set != 0 )
+	{
+		if( digest_hash_copy_to_string(
+		     verification_handle->stored_sha1_hash,
+		     LIBHMAC_SHA1_HASH_SIZE,
+		     hash_string,
+		     65,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set stored SHA1 hash string.",
+			 function );
+
+			return( -1 );
+		}
+		fprintf(
+		 stream,
+		 "SHA1 hash stored in file:\t\t%" PRIs_SYSTEM "\n",
+		 hash_string );
+	}
+	if( verification_handle->calculate_sha1 != 0 )
+	{
+		fprintf(
+		 stream,
+		 "SHA1 hash calculated over data:\t\t%" PRIs_SYSTEM "\n",
+		 verification_handle->calculated_sha1_hash_string );
+	}
+	if( verification_handle->stored_sha256_hash_set != 0 )
+	{
+		if( digest_hash_copy_to_string(
+		     verification_handle->stored_sha256_hash,
+		     LIBHMAC_SHA256_HASH_SIZE,
+		     hash_string,
+		     65,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set stored SHA256 hash string.",
+			 function );
+
+			return( -1 );
+		}
+		fprintf(
+		 stream,
+		 "SHA256 hash stored in file:\t\t%" PRIs_SYSTEM "\n",
+		 hash_string );
+	}
+	if( verification_handle->calculate_sha256 != 0 )
+	{
+		fprintf(
+		 stream,
+		 "SHA256 hash calculated over data:\t%" PRIs_SYSTEM "\n",
+		 verification_handle->calculated_sha256_hash_string );
+	}
+	return( 1 );
+}
+
+/* Prints the piecewise hash values to a stream
+ * Every line contains the offset and size of a chunk followed by the digest hashes,
+ * where the first line contains the column names
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_piecewise_hashes_fprint(
+     verification_handle_t *verification_handle,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	system_character_t hash_string[ 65 ];
+	uint8_t hash[ LIBHMAC_SHA256_HASH_SIZE ];
+
+	piecewise_hash_t *piecewise_hashes[ 3 ];
+
+	const char *column_names[ 3 ] = { "md5", "sha1", "sha256" };
+	static char *function         = "verification_handle_piecewise_hashes_fprint";
+	size64_t chunk_size           = 0;
+	off64_t chunk_offset          = 0;
+	uint64_t chunk_index          = 0;
+	uint64_t number_of_chunks     = 0;
+	uint8_t print_chunk_offset    = 0;
+	int piecewise_hash_index      = 0;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	piecewise_hashes[ 0 ] = verification_handle->piecewise_md5;
+	piecewise_hashes[ 1 ] = verification_handle->piecewise_sha1;
+	piecewise_hashes[ 2 ] = verification_handle->piecewise_sha256;
+
+	fprintf(
+	 stream,
+	 "offset\tsize" );
+
+	for( piecewise_hash_index = 0;
+	     piecewise_hash_index < 3;
+	     piecewise_hash_index++ )
+	{
+		if( piecewise_hashes[ piecewise_hash_index ] == NULL )
+		{
+			continue;
+		}
+		if( piecewise_hash_get_number_of_chunks(
+		     piecewise_hashes[ piecewise_hash_index ],
+		     &number_of_chunks,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of chunks.",
+			 function );
+
+			return( -1 );
+		}
+		fprintf(
+		 stream,
+		 "\t%s",
+		 column_names[ piecewise_hash_index ] );
+	}
+	fprintf(
+	 stream,
+	 "\n" );
+
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		print_chunk_offset = 1;
+
+		for( piecewise_hash_index = 0;
+		     piecewise_hash_index < 3;
+		     piecewise_hash_index++ )
+		{
+			if( piecewise_hashes[ piecewise_hash_index ] == NULL )
+			{
+				continue;
 			}
-			else if( system_string_compare(
-			          string_segment,
-			          _SYSTEM_STRING( "SHA1" ),
-			          4 ) == 0 )
+			if( piecewise_hash_get_chunk(
+			     piecewise_hashes[ piecewise_hash_index ],
+			     chunk_index,
+			     &chunk_offset,
+			     &chunk_size,
+			     hash,
+			     LIBHMAC_SHA256_HASH_SIZE,
+			     error ) != 1 )
 			{
-				calculate_sha1 = 1;
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve chunk: %" PRIu64 ".",
+				 function,
+				 chunk_index );
+
+				return( -1 );
+			}
+			if( digest_hash_copy_to_string(
+			     hash,
+			     piecewise_hashes[ piecewise_hash_index ]->hash_size,
+			     hash_string,
+			     65,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to create hash string.",
+				 function );
+
+				return( -1 );
+			}
+			if( print_chunk_offset != 0 )
+			{
+				fprintf(
+				 stream,
+				 "%" PRIi64 "\t%" PRIu64 "",
+				 chunk_offset,
+				 chunk_size );
+
+				print_chunk_offset = 0;
 			}
+			fprintf(
+			 stream,
+			 "\t%" PRIs_SYSTEM "",
+			 hash_string );
+		}
+		fprintf(
+		 stream,
+		 "\n" );
+	}
+	return( 1 );
+}
+
+/* Writes the piecewise hash values to a file
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_write_piecewise_hashes(
+     verification_handle_t *verification_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	FILE *stream          = NULL;
+	static char *function = "verification_handle_write_piecewise_hashes";
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          filename,
+	          _SYSTEM_STRING( FILE_STREAM_OPEN_WRITE ) );
+#else
+	stream = file_stream_open(
+	          filename,
+	          FILE_STREAM_OPEN_WRITE );
+#endif
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle_piecewise_hashes_fprint(
+	     verification_handle,
+	     stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print piecewise hash values.",
+		 function );
+
+		file_stream_close(
+		 stream );
+
+		return( -1 );
+	}
+	if( file_stream_close(
+	     stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+
+/* Copies a decimal string to a 64-bit value
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_copy_decimal_string_to_64bit(
+     const char *string,
+     size_t string_length,
+     uint64_t *value_64bit,
+     libcerror_error_t **error )
+{
+	static char *function = "verification_handle_copy_decimal_string_to_64bit";
+	size_t string_index   = 0;
+	uint64_t safe_value   = 0;
+	uint8_t digit         = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_length == 0 )
+	 || ( string_length > 20 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_64bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 64-bit.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < '0' )
+		 || ( string[ string_index ] > '9' ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported character in string at index: %" PRIzu ".",
+			 function,
+			 string_index );
+
+			return( -1 );
 		}
-		else if( string_segment_size == 6 )
+		digit = (uint8_t) ( string[ string_index ] - '0' );
+
+		if( safe_value > ( ( UINT64_MAX - digit ) / 10 ) )
 		{
-			if( system_string_compare(
-			     string_segment,
-			     _SYSTEM_STRING( "sha-1" ),
-			     5 ) == 0 )
-			{
-				calculate_sha1 = 1;
-			}
-			else if( system_string_compare(
-			          string_segment,
-			          _SYSTEM_STRING( "sha_1" ),
-			          5 ) == 0 )
-			{
-				calculate_sha1 = 1;
-			}
-			else if( system_string_compare(
-			          string_segment,
-			          _SYSTEM_STRING( "SHA-1" ),
-			          5 ) == 0 )
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		safe_value = ( safe_value * 10 ) + digit;
+	}
+	*value_64bit = safe_value;
+
+	return( 1 );
+}
+
+/* Reads the stored piecewise hash values from a file
+ * The file is expected to be in the format written by verification_handle_write_piecewise_hashes
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_read_piecewise_hashes(
+     verification_handle_t *verification_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	char line[ VERIFICATION_HANDLE_PIECEWISE_HASHES_LINE_SIZE ];
+	uint8_t hash[ LIBHMAC_SHA256_HASH_SIZE ];
+
+	int column_digest_types[ VERIFICATION_HANDLE_MAXIMUM_NUMBER_OF_PIECEWISE_COLUMNS ];
+	piecewise_hash_t **stored_hashes[ 3 ];
+
+	libcsplit_narrow_split_string_t *line_elements = NULL;
+	FILE *stream                                   = NULL;
+	char *line_segment                             = NULL;
+	static char *function                          = "verification_handle_read_piecewise_hashes";
+	size_t line_length                             = 0;
+	size_t line_segment_size                       = 0;
+	uint64_t chunk_index                           = 0;
+	uint64_t chunk_offset                          = 0;
+	uint64_t chunk_size                            = 0;
+	uint64_t stored_chunk_size                     = 0;
+	int column_index                               = 0;
+	int digest_type                                = 0;
+	int line_number                                = 0;
+	int number_of_columns                          = 0;
+	int number_of_segments                         = 0;
+	int other_column_index                         = 0;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( verification_handle->stored_piecewise_md5 != NULL )
+	 || ( verification_handle->stored_piecewise_sha1 != NULL )
+	 || ( verification_handle->stored_piecewise_sha256 != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid verification handle - stored piecewise hashes value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	stored_hashes[ VERIFICATION_HANDLE_DIGEST_TYPE_MD5 ]    = &( verification_handle->stored_piecewise_md5 );
+	stored_hashes[ VERIFICATION_HANDLE_DIGEST_TYPE_SHA1 ]   = &( verification_handle->stored_piecewise_sha1 );
+	stored_hashes[ VERIFICATION_HANDLE_DIGEST_TYPE_SHA256 ] = &( verification_handle->stored_piecewise_sha256 );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          filename,
+	          _SYSTEM_STRING( FILE_STREAM_OPEN_READ ) );
+#else
+	stream = file_stream_open(
+	          filename,
+	          FILE_STREAM_OPEN_READ );
+#endif
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	while( file_stream_get_string(
+	        stream,
+	        line,
+	        VERIFICATION_HANDLE_PIECEWISE_HASHES_LINE_SIZE ) != NULL )
+	{
+		line_number++;
+
+		line_length = narrow_string_length(
+		               line );
+
+		if( ( line_length > 0 )
+		 && ( line[ line_length - 1 ] != '\n' )
+		 && ( file_stream_at_end(
+		       stream ) == 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: line: %d too long.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+		while( ( line_length > 0 )
+		    && ( ( line[ line_length - 1 ] == '\n' )
+		     ||  ( line[ line_length - 1 ] == '\r' ) ) )
+		{
+			line_length--;
+		}
+		if( line_length == 0 )
+		{
+			continue;
+		}
+		line[ line_length ] = 0;
+
+		if( libcsplit_narrow_string_split(
+		     line,
+		     line_length + 1,
+		     '\t',
+		     &line_elements,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to split line: %d.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+		if( libcsplit_narrow_split_string_get_number_of_segments(
+		     line_elements,
+		     &number_of_segments,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of segments of line: %d.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+		if( number_of_columns == 0 )
+		{
+			/* The first line contains the column names: offset, size and one or more digest types
+			 */
+			if( ( number_of_segments < 3 )
+			 || ( number_of_segments > VERIFICATION_HANDLE_MAXIMUM_NUMBER_OF_PIECEWISE_COLUMNS ) )
 			{
-				calculate_sha1 = 1;
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported number of columns: %d.",
+				 function,
+				 number_of_segments );
+
+				goto on_error;
 			}
-			else if( system_string_compare(
-			          string_segment,
-			          _SYSTEM_STRING( "SHA_1" ),
-			          5 ) == 0 )
+			for( column_index = 0;
+			     column_index < number_of_segments;
+			     column_index++ )
 			{
-				calculate_sha1 = 1;
+				if( libcsplit_narrow_split_string_get_segment_by_index(
+				     line_elements,
+				     column_index,
+				     &line_segment,
+				     &line_segment_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve column name: %d.",
+					 function,
+					 column_index );
+
+					goto on_error;
+				}
+				digest_type = -1;
+
+				if( line_segment == NULL )
+				{
+					line_segment_size = 0;
+				}
+				if( column_index == 0 )
+				{
+					if( ( line_segment_size == 7 )
+					 && ( narrow_string_compare(
+					       line_segment,
+					       "offset",
+					       6 ) == 0 ) )
+					{
+						continue;
+					}
+				}
+				else if( column_index == 1 )
+				{
+					if( ( line_segment_size == 5 )
+					 && ( narrow_string_compare(
+					       line_segment,
+					       "size",
+					       4 ) == 0 ) )
+					{
+						continue;
+					}
+				}
+				else if( ( line_segment_size == 4 )
+				      && ( narrow_string_compare(
+				            line_segment,
+				            "md5",
+				            3 ) == 0 ) )
+				{
+					digest_type = VERIFICATION_HANDLE_DIGEST_TYPE_MD5;
+				}
+				else if( ( line_segment_size == 5 )
+				      && ( narrow_string_compare(
+				            line_segment,
+				            "sha1",
+				            4 ) == 0 ) )
+				{
+					digest_type = VERIFICATION_HANDLE_DIGEST_TYPE_SHA1;
+				}
+				else if( ( line_segment_size == 7 )
+				      && ( narrow_string_compare(
+				            line_segment,
+				            "sha256",
+				            6 ) == 0 ) )
+				{
+					digest_type = VERIFICATION_HANDLE_DIGEST_TYPE_SHA256;
+				}
+				if( digest_type == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+					 "%s: unsupported column name: %d.",
+					 function,
+					 column_index );
+
+					goto on_error;
+				}
+				for( other_column_index = 2;
+				     other_column_index < column_index;
+				     other_column_index++ )
+				{
+					if( column_digest_types[ other_column_index ] == digest_type )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+						 "%s: duplicate column name: %d.",
+						 function,
+						 column_index );
+
+						goto on_error;
+					}
+				}
+				column_digest_types[ column_index ] = digest_type;
 			}
+			number_of_columns = number_of_segments;
 		}
-		else if( string_segment_size == 7 )
+		else
 		{
-			if( system_string_compare(
-			     string_segment,
-			     _SYSTEM_STRING( "sha256" ),
-			     6 ) == 0 )
+			if( number_of_segments != number_of_columns )
 			{
-				calculate_sha256 = 1;
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported number of columns in line: %d.",
+				 function,
+				 line_number );
+
+				goto on_error;
 			}
-			else if( system_string_compare(
-			          string_segment,
-			          _SYSTEM_STRING( "SHA256" ),
-			          6 ) == 0 )
+			for( column_index = 0;
+			     column_index < number_of_columns;
+			     column_index++ )
 			{
-				calculate_sha256 = 1;
+				if( libcsplit_narrow_split_string_get_segment_by_index(
+				     line_elements,
+				     column_index,
+				     &line_segment,
+				     &line_segment_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve column: %d of line: %d.",
+					 function,
+					 column_index,
+					 line_number );
+
+					goto on_error;
+				}
+				if( ( line_segment == NULL )
+				 || ( line_segment_size < 2 ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+					 "%s: missing column: %d of line: %d.",
+					 function,
+					 column_index,
+					 line_number );
+
+					goto on_error;
+				}
+				if( column_index == 0 )
+				{
+					if( verification_handle_copy_decimal_string_to_64bit(
+					     line_segment,
+					     line_segment_size - 1,
+					     &chunk_offset,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to determine offset of line: %d.",
+						 function,
+						 line_number );
+
+						goto on_error;
+					}
+				}
+				else if( column_index == 1 )
+				{
+					if( verification_handle_copy_decimal_string_to_64bit(
+					     line_segment,
+					     line_segment_size - 1,
+					     &chunk_size,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to determine size of line: %d.",
+						 function,
+						 line_number );
+
+						goto on_error;
+					}
+					/* The size of the first chunk is the chunk size
+					 */
+					if( chunk_index == 0 )
+					{
+						stored_chunk_size = chunk_size;
+					}
+					if( ( stored_chunk_size == 0 )
+					 || ( chunk_offset != ( chunk_index * stored_chunk_size ) ) )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+						 "%s: invalid offset or size of line: %d.",
+						 function,
+						 line_number );
+
+						goto on_error;
+					}
+				}
+				else
+				{
+					digest_type = column_digest_types[ column_index ];
+
+					if( *( stored_hashes[ digest_type ] ) == NULL )
+					{
+						if( verification_handle_initialize_piecewise_hash(
+						     stored_hashes[ digest_type ],
+						     digest_type,
+						     stored_chunk_size,
+						     error ) != 1 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+							 "%s: unable to create stored piecewise hashes.",
+							 function );
+
+							goto on_error;
+						}
+					}
+					if( digest_hash_copy_from_string(
+					     hash,
+					     ( *( stored_hashes[ digest_type ] ) )->hash_size,
+					     line_segment,
+					     line_segment_size - 1,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to determine digest hash in column: %d of line: %d.",
+						 function,
+						 column_index,
+						 line_number );
+
+						goto on_error;
+					}
+					if( piecewise_hash_append_chunk(
+					     *( stored_hashes[ digest_type ] ),
+					     hash,
+					     ( *( stored_hashes[ digest_type ] ) )->hash_size,
+					     (size64_t) chunk_size,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+						 "%s: unable to append chunk of line: %d.",
+						 function,
+						 line_number );
+
+						goto on_error;
+					}
+				}
 			}
+			chunk_index++;
 		}
-		else if( string_segment_size == 8 )
+		if( libcsplit_narrow_split_string_free(
+		     &line_elements,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free split line: %d.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+	}
+	if( chunk_index == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing chunks.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_stream_close(
+	     stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		stream = NULL;
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( line_elements != NULL )
+	{
+		libcsplit_narrow_split_string_free(
+		 &line_elements,
+		 NULL );
+	}
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	for( digest_type = 0;
+	     digest_type < 3;
+	     digest_type++ )
+	{
+		if( *( stored_hashes[ digest_type ] ) != NULL )
+		{
+			piecewise_hash_free(
+			 stored_hashes[ digest_type ],
+			 NULL );
+		}
+	}
+	return( -1 );
+}
+
+/* Reports a corrupted chunk
+ * Callback function for the piecewise verifier
+ */
+void verification_handle_report_corrupted_chunk(
+      verification_handle_t *verification_handle,
+      off64_t chunk_offset,
+      size64_t chunk_size,
+      int chunk_status )
+{
+	const char *chunk_status_string = "does not match stored digest hash";
+
+	if( verification_handle == NULL )
+	{
+		return;
+	}
+	if( chunk_status == PIECEWISE_VERIFIER_CHUNK_STATUS_READ_ERROR )
+	{
+		chunk_status_string = "could not be read";
+	}
+	fprintf(
+	 verification_handle->notify_stream,
+	 "Chunk at offset: %" PRIi64 " (0x%08" PRIx64 ") of size: %" PRIu64 " %s.\n",
+	 chunk_offset,
+	 chunk_offset,
+	 chunk_size,
+	 chunk_status_string );
+
+	if( verification_handle->log_handle != NULL )
+	{
+		log_handle_printf(
+		 verification_handle->log_handle,
+		 "Chunk at offset: %" PRIi64 " (0x%08" PRIx64 ") of size: %" PRIu64 " %s.\n",
+		 chunk_offset,
+		 chunk_offset,
+		 chunk_size,
+		 chunk_status_string );
+	}
+}
+
+/* Verifies the input against the stored piecewise hashes
+ * The chunks are verified in parallel, corrupted chunks are reported as they are found
+ * Returns 1 if all chunks verified, 0 if one or more chunks are corrupted or -1 on error
+ */
+int verification_handle_verify_piecewise_hashes(
+     verification_handle_t *verification_handle,
+     uint8_t print_status_information,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	piecewise_hash_t *stored_hashes[ 3 ];
+
+	process_status_t *process_status    = NULL;
+	static char *function               = "verification_handle_verify_piecewise_hashes";
+	size64_t media_size                 = 0;
+	size_t process_buffer_size          = 0;
+	uint64_t number_of_corrupted_chunks = 0;
+	int digest_type                     = 0;
+	int status                          = PROCESS_STATUS_COMPLETED;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->piecewise_verifier != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid verification handle - piecewise verifier value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->process_buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid process buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	stored_hashes[ VERIFICATION_HANDLE_DIGEST_TYPE_MD5 ]    = verification_handle->stored_piecewise_md5;
+	stored_hashes[ VERIFICATION_HANDLE_DIGEST_TYPE_SHA1 ]   = verification_handle->stored_piecewise_sha1;
+	stored_hashes[ VERIFICATION_HANDLE_DIGEST_TYPE_SHA256 ] = verification_handle->stored_piecewise_sha256;
+
+	if( libsmraw_handle_get_media_size(
+	     verification_handle->input_handle,
+	     &media_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve media size.",
+		 function );
+
+		goto on_error;
+	}
+	if( verification_handle->process_buffer_size == 0 )
+	{
+		if( verification_handle_determine_process_buffer_size(
+		     verification_handle,
+		     media_size,
+		     &process_buffer_size,
+		     error ) != 1 )
 		{
-			if( system_string_compare(
-			     string_segment,
-			     _SYSTEM_STRING( "sha-256" ),
-			     7 ) == 0 )
-			{
-				calculate_sha256 = 1;
-			}
-			else if( system_string_compare(
-			          string_segment,
-			          _SYSTEM_STRING( "sha_256" ),
-			          7 ) == 0 )
-			{
-				calculate_sha256 = 1;
-			}
-			else if( system_string_compare(
-			          string_segment,
-			          _SYSTEM_STRING( "SHA-256" ),
-			          7 ) == 0 )
-			{
-				calculate_sha256 = 1;
-			}
-			else if( system_string_compare(
-			          string_segment,
-			          _SYSTEM_STRING( "SHA_256" ),
-			          7 ) == 0 )
-			{
-				calculate_sha256 = 1;
-			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine process buffer size.",
+			 function );
+
+			goto on_error;
 		}
 	}
-	if( ( calculate_sha1 != 0 )
-	 && ( verification_handle->calculate_sha1 == 0 ) )
+	else
 	{
-		verification_handle->calculated_sha1_hash_string = system_string_allocate(
-		                                                    41 );
-
-		if( verification_handle->calculated_sha1_hash_string == NULL )
+		process_buffer_size = verification_handle->process_buffer_size;
+	}
+	/* When libhmac does not use libcrypto and SHA-NI is not supported the SHA256 digest
+	 * hashes of multiple chunks are calculated in parallel which is faster than calculating
+	 * them one chunk at a time
+	 */
+	if( ( stored_hashes[ VERIFICATION_HANDLE_DIGEST_TYPE_SHA256 ] != NULL )
+	 && ( digest_hash_sha256_multi_buffer_is_preferred() != 0 ) )
+	{
+		if( piecewise_hash_set_multi_buffer_functions(
+		     stored_hashes[ VERIFICATION_HANDLE_DIGEST_TYPE_SHA256 ],
+		     (int (*)(intptr_t **, libcerror_error_t **)) &digest_hash_sha256_initialize_multi_buffer,
+		     (int (*)(intptr_t **, const uint8_t **, const size_t *, int, libcerror_error_t **)) &digest_hash_sha256_multi_buffer_update,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create calculated SHA1 digest hash string.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set SHA256 multi-buffer functions.",
 			 function );
 
 			goto on_error;
 		}
-		verification_handle->calculate_sha1 = 1;
 	}
-	if( ( calculate_sha256 != 0 )
-	 && ( verification_handle->calculate_sha256 == 0 ) )
+	/* The chunks are read at specific offsets which allows multiple threads to read
+	 * from the input handle concurrently
+	 */
+	if( piecewise_verifier_initialize(
+	     &( verification_handle->piecewise_verifier ),
+	     media_size,
+	     process_buffer_size,
+	     (ssize_t (*)(intptr_t *, void *, size_t, off64_t, libcerror_error_t **)) &libsmraw_handle_read_buffer_at_offset,
+	     (intptr_t *) verification_handle->input_handle,
+	     error ) != 1 )
 	{
-		verification_handle->calculated_sha256_hash_string = system_string_allocate(
-		                                                      65 );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create piecewise verifier.",
+		 function );
 
-		if( verification_handle->calculated_sha256_hash_string == NULL )
+		goto on_error;
+	}
+	for( digest_type = 0;
+	     digest_type < 3;
+	     digest_type++ )
+	{
+		if( stored_hashes[ digest_type ] == NULL )
+		{
+			continue;
+		}
+		if( piecewise_verifier_append_digest(
+		     verification_handle->piecewise_verifier,
+		     stored_hashes[ digest_type ],
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create calculated SHA256 digest hash string.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append stored piecewise hashes: %d to verifier.",
+			 function,
+			 digest_type );
 
 			goto on_error;
 		}
-		verification_handle->calculate_sha256 = 1;
 	}
-	if( system_split_string_free(
-	     &string_elements,
+	if( piecewise_verifier_set_report_function(
+	     verification_handle->piecewise_verifier,
+	     (void (*)(intptr_t *, off64_t, size64_t, int)) &verification_handle_report_corrupted_chunk,
+	     (intptr_t *) verification_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free split string.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set report function.",
 		 function );
 
 		goto on_error;
 	}
-	return( result );
+	verification_handle->piecewise_verifier->fail_fast = verification_handle->fail_fast;
+	verification_handle->log_handle                    = log_handle;
 
-on_error:
-	if( string_elements != NULL )
+	if( process_status_initialize(
+	     &process_status,
+	     _SYSTEM_STRING( "Verify" ),
+	     _SYSTEM_STRING( "verified" ),
+	     _SYSTEM_STRING( "Read" ),
+	     verification_handle->notify_stream,
+	     print_status_information,
+	     error ) != 1 )
 	{
-		system_split_string_free(
-		 &string_elements,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create process status.",
+		 function );
+
+		goto on_error;
 	}
-	return( -1 );
-}
+	if( process_status_start(
+	     process_status,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start process status.",
+		 function );
 
-/* Print the hash values to a stream
- * Returns 1 if successful or -1 on error
- */
-int verification_handle_hash_values_fprint(
-     verification_handle_t *verification_handle,
-     FILE *stream,
-     libcerror_error_t **error )
-{
-	static char *function = "verification_handle_hash_values_fprint";
+		goto on_error;
+	}
+	if( piecewise_verifier_run(
+	     verification_handle->piecewise_verifier,
+	     verification_handle->number_of_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to verify chunks.",
+		 function );
 
-	if( verification_handle == NULL )
+		goto on_error;
+	}
+	if( piecewise_verifier_get_number_of_corrupted_chunks(
+	     verification_handle->piecewise_verifier,
+	     &number_of_corrupted_chunks,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid verification handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of corrupted chunks.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( stream == NULL )
+	if( verification_handle->abort != 0 )
+	{
+		status = PROCESS_STATUS_ABORTED;
+	}
+	if( process_status_stop(
+	     process_status,
+	     verification_handle->piecewise_verifier->verified_size,
+	     status,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid stream.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to stop process status.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( verification_handle->calculate_md5 != 0 )
+	if( process_status_free(
+	     &process_status,
+	     error ) != 1 )
 	{
-		fprintf(
-		 stream,
-		 "MD5 hash calculated over data:\t\t%" PRIs_SYSTEM "\n",
-		 verification_handle->calculated_md5_hash_string );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free process status.",
+		 function );
+
+		goto on_error;
 	}
-	if( verification_handle->calculate_sha1 != 0 )
+	if( verification_handle->abort == 0 )
 	{
 		fprintf(
-		 stream,
-		 "SHA1 hash calculated over data:\t\t%" PRIs_SYSTEM "\n",
-		 verification_handle->calculated_sha1_hash_string );
+		 verification_handle->notify_stream,
+		 "Chunks verified against stored digest hashes:\t%" PRIu64 " of %" PRIu64 "\n"
+		 "Corrupted chunks:\t\t\t\t%" PRIu64 "\n\n",
+		 verification_handle->piecewise_verifier->number_of_verified_chunks,
+		 verification_handle->piecewise_verifier->number_of_chunks,
+		 number_of_corrupted_chunks );
+
+		if( log_handle != NULL )
+		{
+			log_handle_printf(
+			 log_handle,
+			 "Chunks verified against stored digest hashes:\t%" PRIu64 " of %" PRIu64 "\n"
+			 "Corrupted chunks:\t\t\t\t%" PRIu64 "\n",
+			 verification_handle->piecewise_verifier->number_of_verified_chunks,
+			 verification_handle->piecewise_verifier->number_of_chunks,
+			 number_of_corrupted_chunks );
+		}
 	}
-	if( verification_handle->calculate_sha256 != 0 )
+	verification_handle->log_handle = NULL;
+
+	if( piecewise_verifier_free(
+	     &( verification_handle->piecewise_verifier ),
+	     error ) != 1 )
 	{
-		fprintf(
-		 stream,
-		 "SHA256 hash calculated over data:\t%" PRIs_SYSTEM "\n",
-		 verification_handle->calculated_sha256_hash_string );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free piecewise verifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_corrupted_chunks != 0 )
+	{
+		return( 0 );
 	}
 	return( 1 );
-}
 
+on_error:
+	if( process_status != NULL )
+	{
+		process_status_stop(
+		 process_status,
+		 0,
+		 PROCESS_STATUS_FAILED,
+		 NULL );
+		process_status_free(
+		 &process_status,
+		 NULL );
+	}
+	verification_handle->log_handle = NULL;
+
+	if( verification_handle->piecewise_verifier != NULL )
+	{
+		piecewise_verifier_free(
+		 &( verification_handle->piecewise_verifier ),
+		 NULL );
+	}
+	return( -1 );
+}
@@ -26,7 +26,10 @@
 #include <types.h>
 
 #include "digest_hash.h"
+#include "digest_pipeline.h"
 #include "log_handle.h"
+#include "piecewise_hash.h"
+#include "piecewise_verifier.h"
 #include "smrawtools_libcerror.h"
 #include "smrawtools_libsmraw.h"
 #include "smrawtools_libhmac.h"
@@ -36,12 +39,31 @@
 extern "C" {
 #endif
 
+#define VERIFICATION_HANDLE_READ_AHEAD_SIZE		( 4 * 1024 * 1024 )
+#define VERIFICATION_HANDLE_MAXIMUM_READ_AHEAD_SIZE	( 64 * 1024 * 1024 )
+
+#define VERIFICATION_HANDLE_DEFAULT_PROCESS_BUFFER_SIZE		( 1024 * 1024 )
+#define VERIFICATION_HANDLE_MINIMUM_DEFAULT_PROCESS_BUFFER_SIZE	( 64 * 1024 )
+#define VERIFICATION_HANDLE_MAXIMUM_DEFAULT_PROCESS_BUFFER_SIZE	( 16 * 1024 * 1024 )
+#define VERIFICATION_HANDLE_DEFAULT_OPTIMAL_IO_SIZE		512
+
+#define VERIFICATION_HANDLE_DEFAULT_NUMBER_OF_THREADS	4
+#define VERIFICATION_HANDLE_MAXIMUM_NUMBER_OF_THREADS	32
+#define VERIFICATION_HANDLE_NUMBER_OF_PIPELINE_BUFFERS	8
+
 enum VERIFICATION_HANDLE_INPUT_FORMATS
 {
 	VERIFICATION_HANDLE_INPUT_FORMAT_FILES	= (int) 'f',
 	VERIFICATION_HANDLE_INPUT_FORMAT_RAW	= (int) 'r'
 };
 
+enum VERIFICATION_HANDLE_DIGEST_TYPES
+{
+	VERIFICATION_HANDLE_DIGEST_TYPE_MD5	= 0,
+	VERIFICATION_HANDLE_DIGEST_TYPE_SHA1	= 1,
+	VERIFICATION_HANDLE_DIGEST_TYPE_SHA256	= 2
+};
+
 typedef struct verification_handle verification_handle_t;
 
 struct verification_handle
@@ -62,13 +84,25 @@ struct verification_handle
 	 */
 	system_character_t *calculated_md5_hash_string;
 
+	/* The calculated MD5 digest hash
+	 */
+	uint8_t calculated_md5_hash[ LIBHMAC_MD5_HASH_SIZE ];
+
+	/* The MD5 digest hash stored in the information file
+	 */
+	uint8_t stored_md5_hash[ LIBHMAC_MD5_HASH_SIZE ];
+
+	/* Value to indicate the stored MD5 digest hash is set
+	 */
+	uint8_t stored_md5_hash_set;
+
 	/* Value to indicate if the SHA1 digest hash should be calculated
 	 */
 	uint8_t calculate_sha1;
 
 	/* The SHA1 digest context
 	 */
-	libhmac_sha1_context_t *sha1_context;
+	digest_hash_sha1_context_t *sha1_context;
 
 	/* Value to indicate the SHA1 digest context was initialized
 	 */
@@ -78,13 +112,25 @@ struct verification_handle
 	 */
 	system_character_t *calculated_sha1_hash_string;
 
+	/* The calculated SHA1 digest hash
+	 */
+	uint8_t calculated_sha1_hash[ LIBHMAC_SHA1_HASH_SIZE ];
+
+	/* The SHA1 digest hash stored in the information file
+	 */
+	uint8_t stored_sha1_hash[ LIBHMAC_SHA1_HASH_SIZE ];
+
+	/* Value to indicate the stored SHA1 digest hash is set
+	 */
+	uint8_t stored_sha1_hash_set;
+
 	/* Value to indicate if the SHA256 digest hash should be calculated
 	 */
 	uint8_t calculate_sha256;
 
 	/* The SHA256 digest context
 	 */
-	libhmac_sha256_context_t *sha256_context;
+	digest_hash_sha256_context_t *sha256_context;
 
 	/* Value to indicate the SHA256 digest context was initialized
 	 */
@@ -94,6 +140,18 @@ struct verification_handle
 	 */
 	system_character_t *calculated_sha256_hash_string;
 
+	/* The calculated SHA256 digest hash
+	 */
+	uint8_t calculated_sha256_hash[ LIBHMAC_SHA256_HASH_SIZE ];
+
+	/* The SHA256 digest hash stored in the information file
+	 */
+	uint8_t stored_sha256_hash[ LIBHMAC_SHA256_HASH_SIZE ];
+
+	/* Value to indicate the stored SHA256 digest hash is set
+	 */
+	uint8_t stored_sha256_hash_set;
+
 	/* The libsmraw input handle
 	 */
 	libsmraw_handle_t *input_handle;
@@ -106,6 +164,58 @@ struct verification_handle
 	 */
 	size_t process_buffer_size;
 
+	/* The optimal I/O size of the input, where 0 represents unknown
+	 */
+	size_t optimal_io_size;
+
+	/* The piecewise chunk size, where 0 represents piecewise hashing is disabled
+	 */
+	size64_t piecewise_chunk_size;
+
+	/* Value to indicate the segment file size should be used as the piecewise chunk size
+	 */
+	uint8_t use_segment_size_as_piecewise_chunk_size;
+
+	/* The piecewise MD5 digest hashes
+	 */
+	piecewise_hash_t *piecewise_md5;
+
+	/* The piecewise SHA1 digest hashes
+	 */
+	piecewise_hash_t *piecewise_sha1;
+
+	/* The piecewise SHA256 digest hashes
+	 */
+	piecewise_hash_t *piecewise_sha256;
+
+	/* The stored piecewise MD5 digest hashes
+	 */
+	piecewise_hash_t *stored_piecewise_md5;
+
+	/* The stored piecewise SHA1 digest hashes
+	 */
+	piecewise_hash_t *stored_piecewise_sha1;
+
+	/* The stored piecewise SHA256 digest hashes
+	 */
+	piecewise_hash_t *stored_piecewise_sha256;
+
+	/* The piecewise verifier
+	 */
+	piecewise_verifier_t *piecewise_verifier;
+
+	/* Value to indicate the piecewise verification should stop at the first corrupted chunk
+	 */
+	uint8_t fail_fast;
+
+	/* The log handle used to report corrupted chunks
+	 */
+	log_handle_t *log_handle;
+
+	/* The number of threads, where 0 represents single-threaded mode
+	 */
+	int number_of_threads;
+
 	/* The notification output stream
 	 */
 	FILE *notify_stream;
@@ -163,22 +273,76 @@ int verification_handle_finalize_integrity_hash(
      verification_handle_t *verification_handle,
      libcerror_error_t **error );
 
+int verification_handle_compare_integrity_hash(
+     verification_handle_t *verification_handle,
+     libcerror_error_t **error );
+
+int verification_handle_initialize_piecewise_hash(
+     piecewise_hash_t **piecewise_hash,
+     int digest_type,
+     size64_t chunk_size,
+     libcerror_error_t **error );
+
+int verification_handle_initialize_piecewise_hashes(
+     verification_handle_t *verification_handle,
+     size64_t media_size,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int verification_handle_initialize_digest_pipeline(
+     verification_handle_t *verification_handle,
+     digest_pipeline_t **digest_pipeline,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 int verification_handle_verify_input(
      verification_handle_t *verification_handle,
      uint8_t print_status_information,
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
+int verification_handle_determine_process_buffer_size(
+     verification_handle_t *verification_handle,
+     size64_t media_size,
+     size_t *process_buffer_size,
+     libcerror_error_t **error );
+
 int verification_handle_set_process_buffer_size(
      verification_handle_t *verification_handle,
      const system_character_t *string,
      libcerror_error_t **error );
 
+int verification_handle_set_piecewise_chunk_size(
+     verification_handle_t *verification_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int verification_handle_set_number_of_threads(
+     verification_handle_t *verification_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
 int verification_handle_set_additional_digest_types(
      verification_handle_t *verification_handle,
      const system_character_t *string,
      libcerror_error_t **error );
 
+int verification_handle_get_stored_integrity_hash_value(
+     verification_handle_t *verification_handle,
+     const char *identifier,
+     size_t identifier_length,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error );
+
+int verification_handle_get_stored_integrity_hash_values(
+     verification_handle_t *verification_handle,
+     uint8_t calculate_stored_only,
+     libcerror_error_t **error );
+
 int verification_handle_append_read_error(
       verification_handle_t *verification_handle,
       off64_t start_offset,
@@ -190,6 +354,39 @@ int verification_handle_hash_values_fprint(
      FILE *stream,
      libcerror_error_t **error );
 
+int verification_handle_piecewise_hashes_fprint(
+     verification_handle_t *verification_handle,
+     FILE *stream,
+     libcerror_error_t **error );
+
+int verification_handle_write_piecewise_hashes(
+     verification_handle_t *verification_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int verification_handle_copy_decimal_string_to_64bit(
+     const char *string,
+     size_t string_length,
+     uint64_t *value_64bit,
+     libcerror_error_t **error );
+
+int verification_handle_read_piecewise_hashes(
+     verification_handle_t *verification_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+void verification_handle_report_corrupted_chunk(
+      verification_handle_t *verification_handle,
+      off64_t chunk_offset,
+      size64_t chunk_size,
+      int chunk_status );
+
+int verification_handle_verify_piecewise_hashes(
+     verification_handle_t *verification_handle,
+     uint8_t print_status_information,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
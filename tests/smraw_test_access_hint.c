@@ -0,0 +1,923 @@
+/*
+ * Library access_hint type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "smraw_test_libcerror.h"
+#include "smraw_test_libsmraw.h"
+#include "smraw_test_macros.h"
+#include "smraw_test_memory.h"
+#include "smraw_test_unused.h"
+
+#include "../libsmraw/libsmraw_access_hint.h"
+#include "../libsmraw/libsmraw_definitions.h"
+
+#if defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT )
+
+/* Tests the libsmraw_access_hint_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_access_hint_initialize(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libsmraw_access_hint_t *access_hint = NULL;
+	int result                          = 0;
+
+#if defined( HAVE_SMRAW_TEST_MEMORY )
+	int number_of_malloc_fail_tests     = 2;
+	int number_of_memset_fail_tests     = 1;
+	int test_number                     = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libsmraw_access_hint_initialize(
+	          &access_hint,
+	          LIBSMRAW_ACCESS_PATTERN_FLAG_SEQUENTIAL,
+	          LIBSMRAW_ACCESS_HINT_DEFAULT_MAXIMUM_NUMBER_OF_FILES,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "access_hint",
+	 access_hint );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_access_hint_free(
+	          &access_hint,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "access_hint",
+	 access_hint );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmraw_access_hint_initialize(
+	          NULL,
+	          LIBSMRAW_ACCESS_PATTERN_FLAG_SEQUENTIAL,
+	          LIBSMRAW_ACCESS_HINT_DEFAULT_MAXIMUM_NUMBER_OF_FILES,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_access_hint_initialize(
+	          &access_hint,
+	          LIBSMRAW_ACCESS_PATTERN_FLAG_SEQUENTIAL,
+	          0,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	access_hint = (libsmraw_access_hint_t *) 0x12345678UL;
+
+	result = libsmraw_access_hint_initialize(
+	          &access_hint,
+	          LIBSMRAW_ACCESS_PATTERN_FLAG_SEQUENTIAL,
+	          LIBSMRAW_ACCESS_HINT_DEFAULT_MAXIMUM_NUMBER_OF_FILES,
+	          &error );
+
+	access_hint = NULL;
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SMRAW_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsmraw_access_hint_initialize with malloc failing
+		 */
+		smraw_test_malloc_attempts_before_fail = test_number;
+
+		result = libsmraw_access_hint_initialize(
+		          &access_hint,
+		          LIBSMRAW_ACCESS_PATTERN_FLAG_SEQUENTIAL,
+		          LIBSMRAW_ACCESS_HINT_DEFAULT_MAXIMUM_NUMBER_OF_FILES,
+		          &error );
+
+		if( smraw_test_malloc_attempts_before_fail != -1 )
+		{
+			smraw_test_malloc_attempts_before_fail = -1;
+
+			if( access_hint != NULL )
+			{
+				libsmraw_access_hint_free(
+				 &access_hint,
+				 NULL );
+			}
+		}
+		else
+		{
+			SMRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SMRAW_TEST_ASSERT_IS_NULL(
+			 "access_hint",
+			 access_hint );
+
+			SMRAW_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsmraw_access_hint_initialize with memset failing
+		 */
+		smraw_test_memset_attempts_before_fail = test_number;
+
+		result = libsmraw_access_hint_initialize(
+		          &access_hint,
+		          LIBSMRAW_ACCESS_PATTERN_FLAG_SEQUENTIAL,
+		          LIBSMRAW_ACCESS_HINT_DEFAULT_MAXIMUM_NUMBER_OF_FILES,
+		          &error );
+
+		if( smraw_test_memset_attempts_before_fail != -1 )
+		{
+			smraw_test_memset_attempts_before_fail = -1;
+
+			if( access_hint != NULL )
+			{
+				libsmraw_access_hint_free(
+				 &access_hint,
+				 NULL );
+			}
+		}
+		else
+		{
+			SMRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SMRAW_TEST_ASSERT_IS_NULL(
+			 "access_hint",
+			 access_hint );
+
+			SMRAW_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SMRAW_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( access_hint != NULL )
+	{
+		libsmraw_access_hint_free(
+		 &access_hint,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_access_hint_free function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_access_hint_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libsmraw_access_hint_free(
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_access_hint_open function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_access_hint_open(
+     void )
+{
+	libsmraw_access_hint_file_t *access_hint_file = NULL;
+	libcerror_error_t *error                      = NULL;
+	libsmraw_access_hint_t *access_hint           = NULL;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libsmraw_access_hint_initialize(
+	          &access_hint,
+	          LIBSMRAW_ACCESS_PATTERN_FLAG_SEQUENTIAL,
+	          2,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "access_hint",
+	 access_hint );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsmraw_access_hint_open(
+	          access_hint,
+	          0,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	access_hint_file = libsmraw_access_hint_get_file(
+	                    access_hint,
+	                    0 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "access_hint_file",
+	 access_hint_file );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "access_hint_file->file_descriptor",
+	 access_hint_file->file_descriptor,
+	 -1 );
+
+	/* Test that a segment file that is already open is not opened again
+	 */
+	result = libsmraw_access_hint_open(
+	          access_hint,
+	          0,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "access_hint->number_of_files",
+	 access_hint->number_of_files,
+	 1 );
+
+	/* Test that the least recently used segment file is closed when the maximum number of files is reached
+	 */
+	result = libsmraw_access_hint_open(
+	          access_hint,
+	          1,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_access_hint_data_read(
+	          access_hint,
+	          0,
+	          0,
+	          512,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_access_hint_open(
+	          access_hint,
+	          2,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "access_hint->number_of_files",
+	 access_hint->number_of_files,
+	 2 );
+
+	access_hint_file = libsmraw_access_hint_get_file(
+	                    access_hint,
+	                    0 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "access_hint_file",
+	 access_hint_file );
+
+	access_hint_file = libsmraw_access_hint_get_file(
+	                    access_hint,
+	                    1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "access_hint_file",
+	 access_hint_file );
+
+	access_hint_file = libsmraw_access_hint_get_file(
+	                    access_hint,
+	                    2 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "access_hint_file",
+	 access_hint_file );
+
+	result = libsmraw_access_hint_close(
+	          access_hint,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "access_hint->number_of_files",
+	 access_hint->number_of_files,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libsmraw_access_hint_open(
+	          NULL,
+	          0,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_access_hint_open(
+	          access_hint,
+	          -1,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_access_hint_close(
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmraw_access_hint_free(
+	          &access_hint,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "access_hint",
+	 access_hint );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( access_hint != NULL )
+	{
+		libsmraw_access_hint_free(
+		 &access_hint,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_access_hint_set_access_pattern function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_access_hint_set_access_pattern(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libsmraw_access_hint_t *access_hint = NULL;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libsmraw_access_hint_initialize(
+	          &access_hint,
+	          LIBSMRAW_ACCESS_PATTERN_FLAG_SEQUENTIAL,
+	          LIBSMRAW_ACCESS_HINT_DEFAULT_MAXIMUM_NUMBER_OF_FILES,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "access_hint",
+	 access_hint );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsmraw_access_hint_set_access_pattern(
+	          access_hint,
+	          LIBSMRAW_ACCESS_PATTERN_FLAG_RANDOM | LIBSMRAW_ACCESS_PATTERN_FLAG_NO_REUSE,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT32(
+	 "access_hint->access_pattern_flags",
+	 access_hint->access_pattern_flags,
+	 (uint32_t) ( LIBSMRAW_ACCESS_PATTERN_FLAG_RANDOM | LIBSMRAW_ACCESS_PATTERN_FLAG_NO_REUSE ) );
+
+	/* Test error cases
+	 */
+	result = libsmraw_access_hint_set_access_pattern(
+	          NULL,
+	          LIBSMRAW_ACCESS_PATTERN_FLAG_SEQUENTIAL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmraw_access_hint_free(
+	          &access_hint,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "access_hint",
+	 access_hint );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( access_hint != NULL )
+	{
+		libsmraw_access_hint_free(
+		 &access_hint,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_access_hint_data_read function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_access_hint_data_read(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libsmraw_access_hint_t *access_hint = NULL;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libsmraw_access_hint_initialize(
+	          &access_hint,
+	          LIBSMRAW_ACCESS_PATTERN_FLAG_SEQUENTIAL | LIBSMRAW_ACCESS_PATTERN_FLAG_NO_REUSE,
+	          LIBSMRAW_ACCESS_HINT_DEFAULT_MAXIMUM_NUMBER_OF_FILES,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "access_hint",
+	 access_hint );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test data read without an open segment file
+	 */
+	result = libsmraw_access_hint_data_read(
+	          access_hint,
+	          0,
+	          0,
+	          512,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_access_hint_open(
+	          access_hint,
+	          0,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsmraw_access_hint_data_read(
+	          access_hint,
+	          0,
+	          0,
+	          512,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test data read of another segment file
+	 */
+	result = libsmraw_access_hint_data_read(
+	          access_hint,
+	          1,
+	          0,
+	          512,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmraw_access_hint_data_read(
+	          NULL,
+	          0,
+	          0,
+	          512,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_access_hint_data_read(
+	          access_hint,
+	          0,
+	          -1,
+	          512,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_access_hint_data_read(
+	          access_hint,
+	          0,
+	          0,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmraw_access_hint_free(
+	          &access_hint,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "access_hint",
+	 access_hint );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( access_hint != NULL )
+	{
+		libsmraw_access_hint_free(
+		 &access_hint,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SMRAW_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SMRAW_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SMRAW_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SMRAW_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SMRAW_TEST_UNREFERENCED_PARAMETER( argc )
+	SMRAW_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT )
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_access_hint_initialize",
+	 smraw_test_access_hint_initialize );
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_access_hint_free",
+	 smraw_test_access_hint_free );
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_access_hint_open",
+	 smraw_test_access_hint_open );
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_access_hint_set_access_pattern",
+	 smraw_test_access_hint_set_access_pattern );
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_access_hint_data_read",
+	 smraw_test_access_hint_data_read );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT ) */
+}
+
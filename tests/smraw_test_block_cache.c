@@ -0,0 +1,1365 @@
+/*
+ * Library block_cache type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "smraw_test_libcerror.h"
+#include "smraw_test_libsmraw.h"
+#include "smraw_test_macros.h"
+#include "smraw_test_memory.h"
+#include "smraw_test_unused.h"
+
+#include "../libsmraw/libsmraw_block_cache.h"
+#include "../libsmraw/libsmraw_definitions.h"
+
+#if defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT )
+
+#define SMRAW_TEST_BLOCK_CACHE_MEDIA_SIZE	1000
+
+/* The number of times the test read function was called
+ */
+int smraw_test_block_cache_number_of_reads = 0;
+
+/* Test read function that returns the low byte of the offset as data
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t smraw_test_block_cache_read_function(
+         intptr_t *data_handle SMRAW_TEST_ATTRIBUTE_UNUSED,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "smraw_test_block_cache_read_function";
+	size_t buffer_offset  = 0;
+
+	SMRAW_TEST_UNREFERENCED_PARAMETER( data_handle )
+
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	smraw_test_block_cache_number_of_reads++;
+
+	if( offset >= SMRAW_TEST_BLOCK_CACHE_MEDIA_SIZE )
+	{
+		return( 0 );
+	}
+	if( buffer_size > (size_t) ( SMRAW_TEST_BLOCK_CACHE_MEDIA_SIZE - offset ) )
+	{
+		buffer_size = (size_t) ( SMRAW_TEST_BLOCK_CACHE_MEDIA_SIZE - offset );
+	}
+	for( buffer_offset = 0;
+	     buffer_offset < buffer_size;
+	     buffer_offset++ )
+	{
+		( (uint8_t *) buffer )[ buffer_offset ] = (uint8_t) ( ( offset + buffer_offset ) & 0xff );
+	}
+	return( (ssize_t) buffer_size );
+}
+
+/* Tests the libsmraw_block_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_block_cache_initialize(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libsmraw_block_cache_t *block_cache = NULL;
+	int result                          = 0;
+
+#if defined( HAVE_SMRAW_TEST_MEMORY )
+	int number_of_malloc_fail_tests     = 2;
+	int test_number                     = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libsmraw_block_cache_initialize(
+	          &block_cache,
+	          1024,
+	          256,
+	          &smraw_test_block_cache_read_function,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "block_cache",
+	 block_cache );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_block_cache_free(
+	          &block_cache,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "block_cache",
+	 block_cache );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmraw_block_cache_initialize(
+	          NULL,
+	          1024,
+	          256,
+	          &smraw_test_block_cache_read_function,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	block_cache = (libsmraw_block_cache_t *) 0x12345678UL;
+
+	result = libsmraw_block_cache_initialize(
+	          &block_cache,
+	          1024,
+	          256,
+	          &smraw_test_block_cache_read_function,
+	          NULL,
+	          &error );
+
+	block_cache = NULL;
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_block_cache_initialize(
+	          &block_cache,
+	          1024,
+	          0,
+	          &smraw_test_block_cache_read_function,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_block_cache_initialize(
+	          &block_cache,
+	          128,
+	          256,
+	          &smraw_test_block_cache_read_function,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_block_cache_initialize(
+	          &block_cache,
+	          1024,
+	          256,
+	          NULL,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SMRAW_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsmraw_block_cache_initialize with malloc failing
+		 */
+		smraw_test_malloc_attempts_before_fail = test_number;
+
+		result = libsmraw_block_cache_initialize(
+		          &block_cache,
+		          1024,
+		          256,
+		          &smraw_test_block_cache_read_function,
+		          NULL,
+		          &error );
+
+		if( smraw_test_malloc_attempts_before_fail != -1 )
+		{
+			smraw_test_malloc_attempts_before_fail = -1;
+
+			if( block_cache != NULL )
+			{
+				libsmraw_block_cache_free(
+				 &block_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			SMRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SMRAW_TEST_ASSERT_IS_NULL(
+			 "block_cache",
+			 block_cache );
+
+			SMRAW_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SMRAW_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block_cache != NULL )
+	{
+		libsmraw_block_cache_free(
+		 &block_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_block_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_block_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libsmraw_block_cache_free(
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_block_cache_empty function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_block_cache_empty(
+     void )
+{
+	uint8_t buffer[ 16 ];
+
+	libcerror_error_t *error            = NULL;
+	libsmraw_block_cache_t *block_cache = NULL;
+	ssize_t read_count                  = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libsmraw_block_cache_initialize(
+	          &block_cache,
+	          1024,
+	          256,
+	          &smraw_test_block_cache_read_function,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "block_cache",
+	 block_cache );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libsmraw_block_cache_read_buffer(
+	              block_cache,
+	              buffer,
+	              16,
+	              0,
+	              &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsmraw_block_cache_empty(
+	          block_cache,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "block_cache->shards[ 0 ].number_of_blocks",
+	 block_cache->shards[ 0 ].number_of_blocks,
+	 0 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "block_cache->shards[ 0 ].most_recently_used",
+	 block_cache->shards[ 0 ].most_recently_used );
+
+	/* Test error cases
+	 */
+	result = libsmraw_block_cache_empty(
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmraw_block_cache_free(
+	          &block_cache,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "block_cache",
+	 block_cache );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block_cache != NULL )
+	{
+		libsmraw_block_cache_free(
+		 &block_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_block_cache_get_statistics function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_block_cache_get_statistics(
+     void )
+{
+	uint8_t buffer[ 16 ];
+
+	libcerror_error_t *error            = NULL;
+	libsmraw_block_cache_t *block_cache = NULL;
+	uint64_t number_of_evictions        = 0;
+	uint64_t number_of_hits             = 0;
+	uint64_t number_of_misses           = 0;
+	ssize_t read_count                  = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libsmraw_block_cache_initialize(
+	          &block_cache,
+	          1024,
+	          256,
+	          &smraw_test_block_cache_read_function,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "block_cache",
+	 block_cache );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libsmraw_block_cache_read_buffer(
+	              block_cache,
+	              buffer,
+	              16,
+	              0,
+	              &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
+
+	read_count = libsmraw_block_cache_read_buffer(
+	              block_cache,
+	              buffer,
+	              16,
+	              16,
+	              &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
+
+	/* Test regular cases
+	 */
+	result = libsmraw_block_cache_get_statistics(
+	          block_cache,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &number_of_evictions,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_hits",
+	 number_of_hits,
+	 (uint64_t) 1 );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_misses",
+	 number_of_misses,
+	 (uint64_t) 1 );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_evictions",
+	 number_of_evictions,
+	 (uint64_t) 0 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmraw_block_cache_get_statistics(
+	          NULL,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &number_of_evictions,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_block_cache_get_statistics(
+	          block_cache,
+	          NULL,
+	          &number_of_misses,
+	          &number_of_evictions,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_block_cache_get_statistics(
+	          block_cache,
+	          &number_of_hits,
+	          NULL,
+	          &number_of_evictions,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_block_cache_get_statistics(
+	          block_cache,
+	          &number_of_hits,
+	          &number_of_misses,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmraw_block_cache_free(
+	          &block_cache,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "block_cache",
+	 block_cache );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block_cache != NULL )
+	{
+		libsmraw_block_cache_free(
+		 &block_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_block_cache_read_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_block_cache_read_buffer(
+     void )
+{
+	uint8_t buffer[ 1024 ];
+
+	libcerror_error_t *error            = NULL;
+	libsmraw_block_cache_t *block_cache = NULL;
+	size_t buffer_offset                = 0;
+	ssize_t read_count                  = 0;
+	uint64_t number_of_evictions        = 0;
+	uint64_t number_of_hits             = 0;
+	uint64_t number_of_misses           = 0;
+	int number_of_reads                 = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 * 128 blocks of 4 bytes, which results in 2 blocks per shard
+	 */
+	result = libsmraw_block_cache_initialize(
+	          &block_cache,
+	          4 * 2 * LIBSMRAW_BLOCK_CACHE_NUMBER_OF_SHARDS,
+	          4,
+	          &smraw_test_block_cache_read_function,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "block_cache",
+	 block_cache );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "block_cache->number_of_shards",
+	 block_cache->number_of_shards,
+	 LIBSMRAW_BLOCK_CACHE_NUMBER_OF_SHARDS );
+
+	/* Test read that spans multiple blocks
+	 */
+	smraw_test_block_cache_number_of_reads = 0;
+
+	read_count = libsmraw_block_cache_read_buffer(
+	              block_cache,
+	              buffer,
+	              16,
+	              0,
+	              &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( buffer_offset = 0;
+	     buffer_offset < 16;
+	     buffer_offset++ )
+	{
+		SMRAW_TEST_ASSERT_EQUAL_UINT8(
+		 "buffer[ buffer_offset ]",
+		 buffer[ buffer_offset ],
+		 (uint8_t) buffer_offset );
+	}
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "smraw_test_block_cache_number_of_reads",
+	 smraw_test_block_cache_number_of_reads,
+	 4 );
+
+	/* Test read of cached blocks
+	 */
+	read_count = libsmraw_block_cache_read_buffer(
+	              block_cache,
+	              buffer,
+	              10,
+	              3,
+	              &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 10 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "buffer[ 0 ]",
+	 buffer[ 0 ],
+	 (uint8_t) 3 );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "smraw_test_block_cache_number_of_reads",
+	 smraw_test_block_cache_number_of_reads,
+	 4 );
+
+	result = libsmraw_block_cache_get_statistics(
+	          block_cache,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &number_of_evictions,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_hits",
+	 number_of_hits,
+	 (uint64_t) 4 );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_misses",
+	 number_of_misses,
+	 (uint64_t) 4 );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_evictions",
+	 number_of_evictions,
+	 (uint64_t) 0 );
+
+	/* Test that the least recently used block of a shard is evicted,
+	 * blocks 0, 64 and 128 map onto the same shard
+	 */
+	read_count = libsmraw_block_cache_read_buffer(
+	              block_cache,
+	              buffer,
+	              4,
+	              64 * 4,
+	              &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 4 );
+
+	read_count = libsmraw_block_cache_read_buffer(
+	              block_cache,
+	              buffer,
+	              4,
+	              0,
+	              &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 4 );
+
+	read_count = libsmraw_block_cache_read_buffer(
+	              block_cache,
+	              buffer,
+	              4,
+	              128 * 4,
+	              &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 4 );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "buffer[ 0 ]",
+	 buffer[ 0 ],
+	 (uint8_t) ( ( 128 * 4 ) & 0xff ) );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "smraw_test_block_cache_number_of_reads",
+	 smraw_test_block_cache_number_of_reads,
+	 6 );
+
+	result = libsmraw_block_cache_get_statistics(
+	          block_cache,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &number_of_evictions,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_evictions",
+	 number_of_evictions,
+	 (uint64_t) 1 );
+
+	number_of_reads = smraw_test_block_cache_number_of_reads;
+
+	read_count = libsmraw_block_cache_read_buffer(
+	              block_cache,
+	              buffer,
+	              4,
+	              0,
+	              &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 4 );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "smraw_test_block_cache_number_of_reads",
+	 smraw_test_block_cache_number_of_reads,
+	 number_of_reads );
+
+	read_count = libsmraw_block_cache_read_buffer(
+	              block_cache,
+	              buffer,
+	              4,
+	              64 * 4,
+	              &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 4 );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "smraw_test_block_cache_number_of_reads",
+	 smraw_test_block_cache_number_of_reads,
+	 number_of_reads + 1 );
+
+	/* Test read that spans more blocks than fit in the cache
+	 */
+	read_count = libsmraw_block_cache_read_buffer(
+	              block_cache,
+	              buffer,
+	              600,
+	              100,
+	              &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 600 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( buffer_offset = 0;
+	     buffer_offset < 600;
+	     buffer_offset++ )
+	{
+		SMRAW_TEST_ASSERT_EQUAL_UINT8(
+		 "buffer[ buffer_offset ]",
+		 buffer[ buffer_offset ],
+		 (uint8_t) ( ( 100 + buffer_offset ) & 0xff ) );
+	}
+	/* Test read of a partial last block and beyond the end of the data
+	 */
+	read_count = libsmraw_block_cache_read_buffer(
+	              block_cache,
+	              buffer,
+	              1024,
+	              998,
+	              &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 2 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "buffer[ 1 ]",
+	 buffer[ 1 ],
+	 (uint8_t) ( 999 & 0xff ) );
+
+	read_count = libsmraw_block_cache_read_buffer(
+	              block_cache,
+	              buffer,
+	              16,
+	              SMRAW_TEST_BLOCK_CACHE_MEDIA_SIZE,
+	              &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libsmraw_block_cache_read_buffer(
+	              block_cache,
+	              buffer,
+	              16,
+	              2048,
+	              &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libsmraw_block_cache_read_buffer(
+	              NULL,
+	              buffer,
+	              16,
+	              0,
+	              &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libsmraw_block_cache_read_buffer(
+	              block_cache,
+	              NULL,
+	              16,
+	              0,
+	              &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libsmraw_block_cache_read_buffer(
+	              block_cache,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              0,
+	              &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libsmraw_block_cache_read_buffer(
+	              block_cache,
+	              buffer,
+	              16,
+	              -1,
+	              &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmraw_block_cache_free(
+	          &block_cache,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "block_cache",
+	 block_cache );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block_cache != NULL )
+	{
+		libsmraw_block_cache_free(
+		 &block_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_block_cache_read_block function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_block_cache_read_block(
+     void )
+{
+	uint8_t buffer[ 256 ];
+
+	libcerror_error_t *error            = NULL;
+	libsmraw_block_cache_t *block_cache = NULL;
+	ssize_t read_count                  = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libsmraw_block_cache_initialize(
+	          &block_cache,
+	          512,
+	          256,
+	          &smraw_test_block_cache_read_function,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "block_cache",
+	 block_cache );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	read_count = libsmraw_block_cache_read_block(
+	              block_cache,
+	              1,
+	              8,
+	              buffer,
+	              248,
+	              &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 248 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "buffer[ 0 ]",
+	 buffer[ 0 ],
+	 (uint8_t) ( 264 & 0xff ) );
+
+	/* Test error cases
+	 */
+	read_count = libsmraw_block_cache_read_block(
+	              NULL,
+	              0,
+	              0,
+	              buffer,
+	              256,
+	              &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libsmraw_block_cache_read_block(
+	              block_cache,
+	              0,
+	              256,
+	              buffer,
+	              16,
+	              &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libsmraw_block_cache_read_block(
+	              block_cache,
+	              0,
+	              0,
+	              NULL,
+	              256,
+	              &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libsmraw_block_cache_read_block(
+	              block_cache,
+	              0,
+	              16,
+	              buffer,
+	              256,
+	              &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmraw_block_cache_free(
+	          &block_cache,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "block_cache",
+	 block_cache );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block_cache != NULL )
+	{
+		libsmraw_block_cache_free(
+		 &block_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SMRAW_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SMRAW_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SMRAW_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SMRAW_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SMRAW_TEST_UNREFERENCED_PARAMETER( argc )
+	SMRAW_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT )
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_block_cache_initialize",
+	 smraw_test_block_cache_initialize );
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_block_cache_free",
+	 smraw_test_block_cache_free );
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_block_cache_empty",
+	 smraw_test_block_cache_empty );
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_block_cache_get_statistics",
+	 smraw_test_block_cache_get_statistics );
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_block_cache_read_buffer",
+	 smraw_test_block_cache_read_buffer );
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_block_cache_read_block",
+	 smraw_test_block_cache_read_block );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT ) */
+}
+
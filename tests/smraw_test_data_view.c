@@ -0,0 +1,630 @@
+/*
+ * Library data_view type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "smraw_test_libcerror.h"
+#include "smraw_test_libsmraw.h"
+#include "smraw_test_macros.h"
+#include "smraw_test_memory.h"
+#include "smraw_test_unused.h"
+
+#include "../libsmraw/libsmraw_data_view.h"
+
+#if defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT )
+
+/* Tests the libsmraw_data_view_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_data_view_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libsmraw_data_view_t *data_view = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_SMRAW_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libsmraw_data_view_initialize(
+	          &data_view,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "data_view",
+	 data_view );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_data_view_free(
+	          &data_view,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "data_view",
+	 data_view );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmraw_data_view_initialize(
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	data_view = (libsmraw_data_view_t *) 0x12345678UL;
+
+	result = libsmraw_data_view_initialize(
+	          &data_view,
+	          &error );
+
+	data_view = NULL;
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SMRAW_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsmraw_data_view_initialize with malloc failing
+		 */
+		smraw_test_malloc_attempts_before_fail = test_number;
+
+		result = libsmraw_data_view_initialize(
+		          &data_view,
+		          &error );
+
+		if( smraw_test_malloc_attempts_before_fail != -1 )
+		{
+			smraw_test_malloc_attempts_before_fail = -1;
+
+			if( data_view != NULL )
+			{
+				libsmraw_data_view_free(
+				 &data_view,
+				 NULL );
+			}
+		}
+		else
+		{
+			SMRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SMRAW_TEST_ASSERT_IS_NULL(
+			 "data_view",
+			 data_view );
+
+			SMRAW_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsmraw_data_view_initialize with memset failing
+		 */
+		smraw_test_memset_attempts_before_fail = test_number;
+
+		result = libsmraw_data_view_initialize(
+		          &data_view,
+		          &error );
+
+		if( smraw_test_memset_attempts_before_fail != -1 )
+		{
+			smraw_test_memset_attempts_before_fail = -1;
+
+			if( data_view != NULL )
+			{
+				libsmraw_data_view_free(
+				 &data_view,
+				 NULL );
+			}
+		}
+		else
+		{
+			SMRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SMRAW_TEST_ASSERT_IS_NULL(
+			 "data_view",
+			 data_view );
+
+			SMRAW_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SMRAW_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_view != NULL )
+	{
+		libsmraw_data_view_free(
+		 &data_view,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_data_view_free function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_data_view_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libsmraw_data_view_free(
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_data_view_get_data function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_data_view_get_data(
+     void )
+{
+	uint8_t reference_data[ 16 ];
+
+	libcerror_error_t *error        = NULL;
+	libsmraw_data_view_t *data_view = NULL;
+	const uint8_t *data             = NULL;
+	size_t data_size                = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libsmraw_data_view_initialize(
+	          &data_view,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "data_view",
+	 data_view );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_internal_data_view_set_reference(
+	          (libsmraw_internal_data_view_t *) data_view,
+	          reference_data,
+	          16,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsmraw_data_view_get_data(
+	          data_view,
+	          &data,
+	          &data_size,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 16 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( data != reference_data )
+	{
+		goto on_error;
+	}
+	/* Test error cases
+	 */
+	result = libsmraw_data_view_get_data(
+	          NULL,
+	          &data,
+	          &data_size,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_data_view_get_data(
+	          data_view,
+	          NULL,
+	          &data_size,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_data_view_get_data(
+	          data_view,
+	          &data,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmraw_data_view_free(
+	          &data_view,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "data_view",
+	 data_view );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_view != NULL )
+	{
+		libsmraw_data_view_free(
+		 &data_view,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_internal_data_view_allocate_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_internal_data_view_allocate_buffer(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libsmraw_data_view_t *data_view = NULL;
+	const uint8_t *data             = NULL;
+	size_t data_size                = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libsmraw_data_view_initialize(
+	          &data_view,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "data_view",
+	 data_view );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsmraw_internal_data_view_allocate_buffer(
+	          (libsmraw_internal_data_view_t *) data_view,
+	          64,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_data_view_get_data(
+	          data_view,
+	          &data,
+	          &data_size,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	SMRAW_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 64 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmraw_internal_data_view_allocate_buffer(
+	          NULL,
+	          64,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_internal_data_view_allocate_buffer(
+	          (libsmraw_internal_data_view_t *) data_view,
+	          64,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmraw_data_view_free(
+	          &data_view,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "data_view",
+	 data_view );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_view != NULL )
+	{
+		libsmraw_data_view_free(
+		 &data_view,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SMRAW_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SMRAW_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SMRAW_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SMRAW_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SMRAW_TEST_UNREFERENCED_PARAMETER( argc )
+	SMRAW_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT )
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_data_view_initialize",
+	 smraw_test_data_view_initialize );
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_data_view_free",
+	 smraw_test_data_view_free );
+
+	/* TODO: add tests for libsmraw_internal_data_view_set_reference */
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_internal_data_view_allocate_buffer",
+	 smraw_test_internal_data_view_allocate_buffer );
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_data_view_get_data",
+	 smraw_test_data_view_get_data );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT ) */
+}
+
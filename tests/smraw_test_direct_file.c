@@ -0,0 +1,647 @@
+/*
+ * Library direct_file type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "smraw_test_libcerror.h"
+#include "smraw_test_libsmraw.h"
+#include "smraw_test_macros.h"
+#include "smraw_test_memory.h"
+#include "smraw_test_unused.h"
+
+#include "../libsmraw/libsmraw_direct_file.h"
+
+#if defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT )
+
+/* Tests the libsmraw_direct_file_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_direct_file_initialize(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libsmraw_direct_file_t *direct_file = NULL;
+	int result                          = 0;
+
+#if defined( HAVE_SMRAW_TEST_MEMORY )
+	int number_of_malloc_fail_tests     = 1;
+	int number_of_memset_fail_tests     = 1;
+	int test_number                     = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libsmraw_direct_file_initialize(
+	          &direct_file,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "direct_file",
+	 direct_file );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_direct_file_free(
+	          &direct_file,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "direct_file",
+	 direct_file );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmraw_direct_file_initialize(
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	direct_file = (libsmraw_direct_file_t *) 0x12345678UL;
+
+	result = libsmraw_direct_file_initialize(
+	          &direct_file,
+	          &error );
+
+	direct_file = NULL;
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SMRAW_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsmraw_direct_file_initialize with malloc failing
+		 */
+		smraw_test_malloc_attempts_before_fail = test_number;
+
+		result = libsmraw_direct_file_initialize(
+		          &direct_file,
+		          &error );
+
+		if( smraw_test_malloc_attempts_before_fail != -1 )
+		{
+			smraw_test_malloc_attempts_before_fail = -1;
+
+			if( direct_file != NULL )
+			{
+				libsmraw_direct_file_free(
+				 &direct_file,
+				 NULL );
+			}
+		}
+		else
+		{
+			SMRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SMRAW_TEST_ASSERT_IS_NULL(
+			 "direct_file",
+			 direct_file );
+
+			SMRAW_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsmraw_direct_file_initialize with memset failing
+		 */
+		smraw_test_memset_attempts_before_fail = test_number;
+
+		result = libsmraw_direct_file_initialize(
+		          &direct_file,
+		          &error );
+
+		if( smraw_test_memset_attempts_before_fail != -1 )
+		{
+			smraw_test_memset_attempts_before_fail = -1;
+
+			if( direct_file != NULL )
+			{
+				libsmraw_direct_file_free(
+				 &direct_file,
+				 NULL );
+			}
+		}
+		else
+		{
+			SMRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SMRAW_TEST_ASSERT_IS_NULL(
+			 "direct_file",
+			 direct_file );
+
+			SMRAW_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SMRAW_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( direct_file != NULL )
+	{
+		libsmraw_direct_file_free(
+		 &direct_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_direct_file_free function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_direct_file_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libsmraw_direct_file_free(
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_direct_file_open function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_direct_file_open(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libsmraw_direct_file_t *direct_file = NULL;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libsmraw_direct_file_initialize(
+	          &direct_file,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "direct_file",
+	 direct_file );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmraw_direct_file_open(
+	          NULL,
+	          "test",
+	          LIBSMRAW_ACCESS_FLAG_READ,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_direct_file_open(
+	          direct_file,
+	          NULL,
+	          LIBSMRAW_ACCESS_FLAG_READ,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_direct_file_open(
+	          direct_file,
+	          "test",
+	          0,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmraw_direct_file_free(
+	          &direct_file,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "direct_file",
+	 direct_file );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( direct_file != NULL )
+	{
+		libsmraw_direct_file_free(
+		 &direct_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_direct_file_read_buffer, libsmraw_direct_file_write_buffer
+ * and libsmraw_direct_file_seek_offset functions
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_direct_file_read_buffer(
+     void )
+{
+	uint8_t buffer[ 16 ];
+
+	libcerror_error_t *error            = NULL;
+	libsmraw_direct_file_t *direct_file = NULL;
+	ssize_t read_count                  = 0;
+	ssize_t write_count                 = 0;
+	off64_t offset                      = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libsmraw_direct_file_initialize(
+	          &direct_file,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "direct_file",
+	 direct_file );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	offset = libsmraw_direct_file_seek_offset(
+	          direct_file,
+	          24,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 24 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT64(
+	 "direct_file->current_offset",
+	 (int64_t) direct_file->current_offset,
+	 (int64_t) 24 );
+
+	/* Test error cases
+	 */
+	read_count = libsmraw_direct_file_read_buffer(
+	              NULL,
+	              buffer,
+	              16,
+	              &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test read without an open file
+	 */
+	read_count = libsmraw_direct_file_read_buffer_at_offset(
+	              direct_file,
+	              buffer,
+	              16,
+	              0,
+	              &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	write_count = libsmraw_direct_file_write_buffer(
+	               NULL,
+	               buffer,
+	               16,
+	               &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test write without an open file
+	 */
+	write_count = libsmraw_direct_file_write_buffer(
+	               direct_file,
+	               buffer,
+	               16,
+	               &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	offset = libsmraw_direct_file_seek_offset(
+	          NULL,
+	          0,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	offset = libsmraw_direct_file_seek_offset(
+	          direct_file,
+	          -1,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmraw_direct_file_free(
+	          &direct_file,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "direct_file",
+	 direct_file );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( direct_file != NULL )
+	{
+		libsmraw_direct_file_free(
+		 &direct_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SMRAW_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SMRAW_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SMRAW_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SMRAW_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SMRAW_TEST_UNREFERENCED_PARAMETER( argc )
+	SMRAW_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT )
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_direct_file_initialize",
+	 smraw_test_direct_file_initialize );
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_direct_file_free",
+	 smraw_test_direct_file_free );
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_direct_file_open",
+	 smraw_test_direct_file_open );
+
+	/* TODO: add tests for libsmraw_direct_file_close */
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_direct_file_read_buffer",
+	 smraw_test_direct_file_read_buffer );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT ) */
+}
+
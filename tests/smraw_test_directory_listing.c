@@ -0,0 +1,839 @@
+/*
+ * Library directory_listing type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "smraw_test_libcerror.h"
+#include "smraw_test_libsmraw.h"
+#include "smraw_test_macros.h"
+#include "smraw_test_memory.h"
+#include "smraw_test_unused.h"
+
+#include "../libsmraw/libsmraw_directory_listing.h"
+
+#if defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT )
+
+/* Tests the libsmraw_directory_listing_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_directory_listing_initialize(
+     void )
+{
+	libcerror_error_t *error                        = NULL;
+	libsmraw_directory_listing_t *directory_listing = NULL;
+	int result                                      = 0;
+
+#if defined( HAVE_SMRAW_TEST_MEMORY )
+	int number_of_malloc_fail_tests                 = 1;
+	int number_of_memset_fail_tests                 = 1;
+	int test_number                                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libsmraw_directory_listing_initialize(
+	          &directory_listing,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_listing",
+	 directory_listing );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_directory_listing_free(
+	          &directory_listing,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "directory_listing",
+	 directory_listing );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmraw_directory_listing_initialize(
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	directory_listing = (libsmraw_directory_listing_t *) 0x12345678UL;
+
+	result = libsmraw_directory_listing_initialize(
+	          &directory_listing,
+	          &error );
+
+	directory_listing = NULL;
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SMRAW_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsmraw_directory_listing_initialize with malloc failing
+		 */
+		smraw_test_malloc_attempts_before_fail = test_number;
+
+		result = libsmraw_directory_listing_initialize(
+		          &directory_listing,
+		          &error );
+
+		if( smraw_test_malloc_attempts_before_fail != -1 )
+		{
+			smraw_test_malloc_attempts_before_fail = -1;
+
+			if( directory_listing != NULL )
+			{
+				libsmraw_directory_listing_free(
+				 &directory_listing,
+				 NULL );
+			}
+		}
+		else
+		{
+			SMRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SMRAW_TEST_ASSERT_IS_NULL(
+			 "directory_listing",
+			 directory_listing );
+
+			SMRAW_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsmraw_directory_listing_initialize with memset failing
+		 */
+		smraw_test_memset_attempts_before_fail = test_number;
+
+		result = libsmraw_directory_listing_initialize(
+		          &directory_listing,
+		          &error );
+
+		if( smraw_test_memset_attempts_before_fail != -1 )
+		{
+			smraw_test_memset_attempts_before_fail = -1;
+
+			if( directory_listing != NULL )
+			{
+				libsmraw_directory_listing_free(
+				 &directory_listing,
+				 NULL );
+			}
+		}
+		else
+		{
+			SMRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SMRAW_TEST_ASSERT_IS_NULL(
+			 "directory_listing",
+			 directory_listing );
+
+			SMRAW_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SMRAW_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_listing != NULL )
+	{
+		libsmraw_directory_listing_free(
+		 &directory_listing,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_directory_listing_free function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_directory_listing_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libsmraw_directory_listing_free(
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_directory_listing_append_entry_name function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_directory_listing_append_entry_name(
+     void )
+{
+	libcerror_error_t *error                        = NULL;
+	libsmraw_directory_listing_t *directory_listing = NULL;
+	int result                                      = 0;
+
+	/* Initialize test
+	 */
+	result = libsmraw_directory_listing_initialize(
+	          &directory_listing,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_listing",
+	 directory_listing );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsmraw_directory_listing_append_entry_name(
+	          directory_listing,
+	          "image.001",
+	          9,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "directory_listing->number_of_entries",
+	 directory_listing->number_of_entries,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libsmraw_directory_listing_append_entry_name(
+	          NULL,
+	          "image.001",
+	          9,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_directory_listing_append_entry_name(
+	          directory_listing,
+	          NULL,
+	          9,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_directory_listing_append_entry_name(
+	          directory_listing,
+	          "image.001",
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmraw_directory_listing_free(
+	          &directory_listing,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "directory_listing",
+	 directory_listing );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_listing != NULL )
+	{
+		libsmraw_directory_listing_free(
+		 &directory_listing,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_directory_listing_read function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_directory_listing_read(
+     void )
+{
+	libcerror_error_t *error                        = NULL;
+	libsmraw_directory_listing_t *directory_listing = NULL;
+	int result                                      = 0;
+
+	/* Initialize test
+	 */
+	result = libsmraw_directory_listing_initialize(
+	          &directory_listing,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_listing",
+	 directory_listing );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsmraw_directory_listing_read(
+	          directory_listing,
+	          "smraw_test_directory_listing_nonexistent/image.raw",
+	          50,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "directory_listing->number_of_entries",
+	 directory_listing->number_of_entries,
+	 0 );
+
+	result = libsmraw_directory_listing_read(
+	          directory_listing,
+	          "image.raw",
+	          9,
+	          &error );
+
+	SMRAW_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmraw_directory_listing_read(
+	          NULL,
+	          "image.raw",
+	          9,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_directory_listing_read(
+	          directory_listing,
+	          NULL,
+	          9,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmraw_directory_listing_free(
+	          &directory_listing,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "directory_listing",
+	 directory_listing );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_listing != NULL )
+	{
+		libsmraw_directory_listing_free(
+		 &directory_listing,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_directory_listing_has_entry function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_directory_listing_has_entry(
+     void )
+{
+	const char *entry_names[ 4 ] = {
+		"image.001", "image.002", "image.003", "image.raw" };
+
+	libcerror_error_t *error                        = NULL;
+	libsmraw_directory_listing_t *directory_listing = NULL;
+	int entry_index                                 = 0;
+	int result                                      = 0;
+
+	/* Initialize test
+	 */
+	result = libsmraw_directory_listing_initialize(
+	          &directory_listing,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_listing",
+	 directory_listing );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( entry_index = 0;
+	     entry_index < 4;
+	     entry_index++ )
+	{
+		result = libsmraw_directory_listing_append_entry_name(
+		          directory_listing,
+		          entry_names[ entry_index ],
+		          9,
+		          &error );
+
+		SMRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SMRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	result = libsmraw_directory_listing_has_entry(
+	          directory_listing,
+	          "image.001",
+	          9,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_directory_listing_has_entry(
+	          directory_listing,
+	          "/case/image.003",
+	          15,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_directory_listing_has_entry(
+	          directory_listing,
+	          "image.raw",
+	          9,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_directory_listing_has_entry(
+	          directory_listing,
+	          "image.00",
+	          8,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_directory_listing_has_entry(
+	          directory_listing,
+	          "image.0010",
+	          10,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_directory_listing_has_entry(
+	          directory_listing,
+	          "image.004",
+	          9,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_directory_listing_has_entry(
+	          directory_listing,
+	          "/case/",
+	          6,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmraw_directory_listing_has_entry(
+	          NULL,
+	          "image.001",
+	          9,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_directory_listing_has_entry(
+	          directory_listing,
+	          NULL,
+	          9,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmraw_directory_listing_free(
+	          &directory_listing,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "directory_listing",
+	 directory_listing );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_listing != NULL )
+	{
+		libsmraw_directory_listing_free(
+		 &directory_listing,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SMRAW_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SMRAW_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SMRAW_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SMRAW_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SMRAW_TEST_UNREFERENCED_PARAMETER( argc )
+	SMRAW_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT )
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_directory_listing_initialize",
+	 smraw_test_directory_listing_initialize );
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_directory_listing_free",
+	 smraw_test_directory_listing_free );
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_directory_listing_append_entry_name",
+	 smraw_test_directory_listing_append_entry_name );
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_directory_listing_read",
+	 smraw_test_directory_listing_read );
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_directory_listing_has_entry",
+	 smraw_test_directory_listing_has_entry );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT ) */
+}
+
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -520,8 +521,37 @@ int smraw_test_handle_open(
 	 "error",
 	 error );
 
-	/* Clean up
+	result = libsmraw_handle_close(
+	          handle,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open with lazy opening
 	 */
+	result = libsmraw_handle_open(
+	          handle,
+	          (char * const *) filenames,
+	          number_of_filenames,
+	          LIBSMRAW_OPEN_READ_LAZY,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	result = libsmraw_handle_close(
 	          handle,
 	          &error );
@@ -535,6 +565,67 @@ int smraw_test_handle_open(
 	 "error",
 	 error );
 
+	/* Test error cases
+	 */
+	result = libsmraw_handle_open(
+	          handle,
+	          (char * const *) filenames,
+	          number_of_filenames,
+	          LIBSMRAW_ACCESS_FLAG_READ | LIBSMRAW_ACCESS_FLAG_WRITE | LIBSMRAW_ACCESS_FLAG_MEMORY_MAP,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_handle_open(
+	          handle,
+	          (char * const *) filenames,
+	          number_of_filenames,
+	          LIBSMRAW_ACCESS_FLAG_READ | LIBSMRAW_ACCESS_FLAG_MEMORY_MAP | LIBSMRAW_ACCESS_FLAG_LAZY_OPEN,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_handle_open(
+	          handle,
+	          (char * const *) filenames,
+	          number_of_filenames,
+	          LIBSMRAW_ACCESS_FLAG_READ | LIBSMRAW_ACCESS_FLAG_MEMORY_MAP | LIBSMRAW_ACCESS_FLAG_DIRECT_IO,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
 	result = libsmraw_handle_free(
 	          &handle,
 	          &error );
@@ -1361,19 +1452,59 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libsmraw_handle_signal_abort function
+/* Tests the libsmraw_handle_open function with lazy opening of the segment files
  * Returns 1 if successful or 0 if not
  */
-int smraw_test_handle_signal_abort(
-     libsmraw_handle_t *handle )
+int smraw_test_handle_open_lazy(
+     void )
 {
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	char *filenames[ 4 ] = {
+		"smraw_test_handle_lazy.000",
+		"smraw_test_handle_lazy.001",
+		"smraw_test_handle_lazy.002",
+		"smraw_test_handle_lazy.003" };
 
-	/* Test regular cases
+	uint8_t buffer[ 512 ];
+
+	libcerror_error_t *error  = NULL;
+	libsmraw_handle_t *handle = NULL;
+	FILE *file_stream         = NULL;
+	size64_t media_size       = 0;
+	ssize_t read_count        = 0;
+	off64_t offset            = 0;
+	int filename_index        = 0;
+	int result                = 0;
+
+	/* Initialize test
+	 * The last segment file is smaller than the others
 	 */
-	result = libsmraw_handle_signal_abort(
-	          handle,
+	for( filename_index = 0;
+	     filename_index < 4;
+	     filename_index++ )
+	{
+		file_stream = file_stream_open(
+		               filenames[ filename_index ],
+		               FILE_STREAM_BINARY_OPEN_WRITE );
+
+		SMRAW_TEST_ASSERT_IS_NOT_NULL(
+		 "file_stream",
+		 file_stream );
+
+		memory_set(
+		 buffer,
+		 'A' + filename_index,
+		 512 );
+
+		file_stream_write(
+		 file_stream,
+		 buffer,
+		 ( filename_index < 3 ) ? 512 : 256 );
+
+		file_stream_close(
+		 file_stream );
+	}
+	result = libsmraw_handle_initialize(
+	          &handle,
 	          &error );
 
 	SMRAW_TEST_ASSERT_EQUAL_INT(
@@ -1381,64 +1512,31 @@ int smraw_test_handle_signal_abort(
 	 result,
 	 1 );
 
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
 	SMRAW_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libsmraw_handle_signal_abort(
-	          NULL,
+	result = libsmraw_handle_open(
+	          handle,
+	          filenames,
+	          4,
+	          LIBSMRAW_OPEN_READ_LAZY,
 	          &error );
 
 	SMRAW_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	SMRAW_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-/* Tests the libsmraw_handle_read_buffer function
- * Returns 1 if successful or 0 if not
- */
-int smraw_test_handle_read_buffer(
-     libsmraw_handle_t *handle )
-{
-	uint8_t buffer[ SMRAW_TEST_HANDLE_READ_BUFFER_SIZE ];
-
-	libcerror_error_t *error      = NULL;
-	time_t timestamp              = 0;
-	size64_t media_size           = 0;
-	size64_t remaining_media_size = 0;
-	size_t read_size              = 0;
-	ssize_t read_count            = 0;
-	off64_t offset                = 0;
-	int number_of_tests           = 1024;
-	int random_number             = 0;
-	int result                    = 0;
-	int test_number               = 0;
-
-#if defined( SMRAW_TEST_HANDLE_VERBOSE )
-	off64_t media_offset          = 0;
-#endif
-
-	/* Determine size
+	/* Test regular cases
 	 */
 	result = libsmraw_handle_get_media_size(
 	          handle,
@@ -1450,93 +1548,329 @@ int smraw_test_handle_read_buffer(
 	 result,
 	 1 );
 
+	SMRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "media_size",
+	 (uint64_t) media_size,
+	 (uint64_t) 1792 );
+
 	SMRAW_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Reset offset to 0
+	/* Read from a segment file that was not opened with the handle
+	 */
+	read_count = libsmraw_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              256,
+	              768,
+	              &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 256 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "buffer[ 0 ]",
+	 (int) buffer[ 0 ],
+	 (int) 'B' );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "buffer[ 255 ]",
+	 (int) buffer[ 255 ],
+	 (int) 'B' );
+
+	/* Read across the boundary of two segment files that were not opened with the handle
 	 */
 	offset = libsmraw_handle_seek_offset(
 	          handle,
-	          0,
+	          1000,
 	          SEEK_SET,
 	          &error );
 
 	SMRAW_TEST_ASSERT_EQUAL_INT64(
 	 "offset",
-	 offset,
-	 (int64_t) 0 );
+	 (int64_t) offset,
+	 (int64_t) 1000 );
 
 	SMRAW_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	read_size = SMRAW_TEST_HANDLE_READ_BUFFER_SIZE;
-
-	if( media_size < SMRAW_TEST_HANDLE_READ_BUFFER_SIZE )
-	{
-		read_size = (size_t) media_size;
-	}
 	read_count = libsmraw_handle_read_buffer(
 	              handle,
 	              buffer,
-	              SMRAW_TEST_HANDLE_READ_BUFFER_SIZE,
+	              512,
 	              &error );
 
 	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
 	 "read_count",
 	 read_count,
-	 (ssize_t) read_size );
+	 (ssize_t) 512 );
 
 	SMRAW_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	if( media_size > 8 )
-	{
-		/* Set offset to media_size - 8
-		 */
-		offset = libsmraw_handle_seek_offset(
-		          handle,
-		          -8,
-		          SEEK_END,
-		          &error );
-
-		SMRAW_TEST_ASSERT_EQUAL_INT64(
-		 "offset",
-		 offset,
-		 (int64_t) media_size - 8 );
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "buffer[ 23 ]",
+	 (int) buffer[ 23 ],
+	 (int) 'B' );
 
-		SMRAW_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "buffer[ 24 ]",
+	 (int) buffer[ 24 ],
+	 (int) 'C' );
 
-		/* Read buffer on media_size boundary
-		 */
-		read_count = libsmraw_handle_read_buffer(
-		              handle,
-		              buffer,
-		              SMRAW_TEST_HANDLE_READ_BUFFER_SIZE,
-		              &error );
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "buffer[ 511 ]",
+	 (int) buffer[ 511 ],
+	 (int) 'C' );
 
-		SMRAW_TEST_ASSERT_EQUAL_SSIZE(
-		 "read_count",
-		 read_count,
-		 (ssize_t) 8 );
+	/* Clean up
+	 */
+	result = libsmraw_handle_close(
+	          handle,
+	          &error );
 
-		SMRAW_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-		/* Read buffer beyond media_size boundary
-		 */
-		read_count = libsmraw_handle_read_buffer(
-		              handle,
-		              buffer,
-		              SMRAW_TEST_HANDLE_READ_BUFFER_SIZE,
-		              &error );
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_handle_free(
+	          &handle,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( filename_index = 0;
+	     filename_index < 4;
+	     filename_index++ )
+	{
+		remove(
+		 filenames[ filename_index ] );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libsmraw_handle_free(
+		 &handle,
+		 NULL );
+	}
+	for( filename_index = 0;
+	     filename_index < 4;
+	     filename_index++ )
+	{
+		remove(
+		 filenames[ filename_index ] );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_handle_signal_abort function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_handle_signal_abort(
+     libsmraw_handle_t *handle )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libsmraw_handle_signal_abort(
+	          handle,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmraw_handle_signal_abort(
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_handle_read_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_handle_read_buffer(
+     libsmraw_handle_t *handle )
+{
+	uint8_t buffer[ SMRAW_TEST_HANDLE_READ_BUFFER_SIZE ];
+
+	libcerror_error_t *error      = NULL;
+	time_t timestamp              = 0;
+	size64_t media_size           = 0;
+	size64_t remaining_media_size = 0;
+	size_t read_size              = 0;
+	ssize_t read_count            = 0;
+	off64_t offset                = 0;
+	int number_of_tests           = 1024;
+	int random_number             = 0;
+	int result                    = 0;
+	int test_number               = 0;
+
+#if defined( SMRAW_TEST_HANDLE_VERBOSE )
+	off64_t media_offset          = 0;
+#endif
+
+	/* Determine size
+	 */
+	result = libsmraw_handle_get_media_size(
+	          handle,
+	          &media_size,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Reset offset to 0
+	 */
+	offset = libsmraw_handle_seek_offset(
+	          handle,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	read_size = SMRAW_TEST_HANDLE_READ_BUFFER_SIZE;
+
+	if( media_size < SMRAW_TEST_HANDLE_READ_BUFFER_SIZE )
+	{
+		read_size = (size_t) media_size;
+	}
+	read_count = libsmraw_handle_read_buffer(
+	              handle,
+	              buffer,
+	              SMRAW_TEST_HANDLE_READ_BUFFER_SIZE,
+	              &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) read_size );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( media_size > 8 )
+	{
+		/* Set offset to media_size - 8
+		 */
+		offset = libsmraw_handle_seek_offset(
+		          handle,
+		          -8,
+		          SEEK_END,
+		          &error );
+
+		SMRAW_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 offset,
+		 (int64_t) media_size - 8 );
+
+		SMRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Read buffer on media_size boundary
+		 */
+		read_count = libsmraw_handle_read_buffer(
+		              handle,
+		              buffer,
+		              SMRAW_TEST_HANDLE_READ_BUFFER_SIZE,
+		              &error );
+
+		SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 8 );
+
+		SMRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Read buffer beyond media_size boundary
+		 */
+		read_count = libsmraw_handle_read_buffer(
+		              handle,
+		              buffer,
+		              SMRAW_TEST_HANDLE_READ_BUFFER_SIZE,
+		              &error );
 
 		SMRAW_TEST_ASSERT_EQUAL_SSIZE(
 		 "read_count",
@@ -1723,6 +2057,7 @@ int smraw_test_handle_read_buffer_at_offset(
 	size64_t remaining_media_size = 0;
 	size_t read_size              = 0;
 	ssize_t read_count            = 0;
+	off64_t current_offset        = 0;
 	off64_t media_offset          = 0;
 	off64_t offset                = 0;
 	int number_of_tests           = 1024;
@@ -1746,6 +2081,22 @@ int smraw_test_handle_read_buffer_at_offset(
 	 "error",
 	 error );
 
+	/* Determine the current offset
+	 */
+	result = libsmraw_handle_get_offset(
+	          handle,
+	          &current_offset,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test regular cases
 	 */
 	read_size = SMRAW_TEST_HANDLE_READ_BUFFER_SIZE;
@@ -1770,6 +2121,27 @@ int smraw_test_handle_read_buffer_at_offset(
 	 "error",
 	 error );
 
+	/* Check that the current offset was not changed
+	 */
+	result = libsmraw_handle_get_offset(
+	          handle,
+	          &offset,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) current_offset );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	if( media_size > 8 )
 	{
 		/* Read buffer on media_size boundary
@@ -1972,109 +2344,1606 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libsmraw_handle_seek_offset function
+/* Tests the libsmraw_handle_get_data_view function
  * Returns 1 if successful or 0 if not
  */
-int smraw_test_handle_seek_offset(
+int smraw_test_handle_get_data_view(
+     libsmraw_handle_t *handle )
+{
+	uint8_t buffer[ SMRAW_TEST_HANDLE_READ_BUFFER_SIZE ];
+
+	libcerror_error_t *error        = NULL;
+	libsmraw_data_view_t *data_view = NULL;
+	const uint8_t *data             = NULL;
+	size64_t media_size             = 0;
+	size_t data_size                = 0;
+	size_t read_size                = 0;
+	ssize_t read_count              = 0;
+	int result                      = 0;
+
+	/* Determine size
+	 */
+	result = libsmraw_handle_get_media_size(
+	          handle,
+	          &media_size,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_size = SMRAW_TEST_HANDLE_READ_BUFFER_SIZE;
+
+	if( media_size < SMRAW_TEST_HANDLE_READ_BUFFER_SIZE )
+	{
+		read_size = (size_t) media_size;
+	}
+	read_count = libsmraw_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              SMRAW_TEST_HANDLE_READ_BUFFER_SIZE,
+	              0,
+	              &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) read_size );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	if( media_size > 0 )
+	{
+		result = libsmraw_handle_get_data_view(
+		          handle,
+		          0,
+		          SMRAW_TEST_HANDLE_READ_BUFFER_SIZE,
+		          &data_view,
+		          &error );
+
+		SMRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SMRAW_TEST_ASSERT_IS_NOT_NULL(
+		 "data_view",
+		 data_view );
+
+		SMRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsmraw_data_view_get_data(
+		          data_view,
+		          &data,
+		          &data_size,
+		          &error );
+
+		SMRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SMRAW_TEST_ASSERT_EQUAL_SIZE(
+		 "data_size",
+		 data_size,
+		 read_size );
+
+		SMRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          data,
+		          buffer,
+		          read_size );
+
+		SMRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		result = libsmraw_data_view_free(
+		          &data_view,
+		          &error );
+
+		SMRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SMRAW_TEST_ASSERT_IS_NULL(
+		 "data_view",
+		 data_view );
+
+		SMRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Retrieve data view beyond media_size boundary
+	 */
+	result = libsmraw_handle_get_data_view(
+	          handle,
+	          media_size + 8,
+	          SMRAW_TEST_HANDLE_READ_BUFFER_SIZE,
+	          &data_view,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "data_view",
+	 data_view );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmraw_handle_get_data_view(
+	          NULL,
+	          0,
+	          SMRAW_TEST_HANDLE_READ_BUFFER_SIZE,
+	          &data_view,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_handle_get_data_view(
+	          handle,
+	          -1,
+	          SMRAW_TEST_HANDLE_READ_BUFFER_SIZE,
+	          &data_view,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_handle_get_data_view(
+	          handle,
+	          0,
+	          0,
+	          &data_view,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_handle_get_data_view(
+	          handle,
+	          0,
+	          SMRAW_TEST_HANDLE_READ_BUFFER_SIZE,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_view != NULL )
+	{
+		libsmraw_data_view_free(
+		 &data_view,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_handle_submit_reads and libsmraw_handle_reap_reads functions
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_handle_submit_reads(
+     libsmraw_handle_t *handle )
+{
+	libsmraw_read_request_t read_requests[ 4 ];
+	uint8_t buffer[ SMRAW_TEST_HANDLE_READ_BUFFER_SIZE ];
+	uint8_t request_buffers[ 4 ][ SMRAW_TEST_HANDLE_READ_BUFFER_SIZE ];
+
+	libcerror_error_t *error = NULL;
+	size64_t media_size      = 0;
+	ssize_t read_count       = 0;
+	int read_request_index   = 0;
+	int result               = 0;
+
+	/* Determine size
+	 */
+	result = libsmraw_handle_get_media_size(
+	          handle,
+	          &media_size,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( read_request_index = 0;
+	     read_request_index < 4;
+	     read_request_index++ )
+	{
+		read_requests[ read_request_index ].offset      = (off64_t) read_request_index * SMRAW_TEST_HANDLE_READ_BUFFER_SIZE;
+		read_requests[ read_request_index ].buffer      = request_buffers[ read_request_index ];
+		read_requests[ read_request_index ].buffer_size = SMRAW_TEST_HANDLE_READ_BUFFER_SIZE;
+		read_requests[ read_request_index ].read_count  = 0;
+	}
+	result = libsmraw_handle_submit_reads(
+	          handle,
+	          read_requests,
+	          4,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_handle_reap_reads(
+	          handle,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( read_request_index = 0;
+	     read_request_index < 4;
+	     read_request_index++ )
+	{
+		read_count = libsmraw_handle_read_buffer_at_offset(
+		              handle,
+		              buffer,
+		              SMRAW_TEST_HANDLE_READ_BUFFER_SIZE,
+		              read_requests[ read_request_index ].offset,
+		              &error );
+
+		SMRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_requests[ read_request_index ].read_count,
+		 read_count );
+
+		if( read_count > 0 )
+		{
+			result = memory_compare(
+			          request_buffers[ read_request_index ],
+			          buffer,
+			          (size_t) read_count );
+
+			SMRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+	}
+	/* Test error cases
+	 */
+	result = libsmraw_handle_submit_reads(
+	          NULL,
+	          read_requests,
+	          4,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_handle_submit_reads(
+	          handle,
+	          NULL,
+	          4,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_handle_submit_reads(
+	          handle,
+	          read_requests,
+	          0,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_requests[ 0 ].buffer = NULL;
+
+	result = libsmraw_handle_submit_reads(
+	          handle,
+	          read_requests,
+	          4,
+	          &error );
+
+	read_requests[ 0 ].buffer = request_buffers[ 0 ];
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_requests[ 0 ].offset = -1;
+
+	result = libsmraw_handle_submit_reads(
+	          handle,
+	          read_requests,
+	          4,
+	          &error );
+
+	read_requests[ 0 ].offset = 0;
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_handle_reap_reads(
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_handle_seek_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_handle_seek_offset(
+     libsmraw_handle_t *handle )
+{
+	libcerror_error_t *error = NULL;
+	size64_t size            = 0;
+	off64_t offset           = 0;
+
+	/* Test regular cases
+	 */
+	offset = libsmraw_handle_seek_offset(
+	          handle,
+	          0,
+	          SEEK_END,
+	          &error );
+
+	SMRAW_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	size = (size64_t) offset;
+
+	offset = libsmraw_handle_seek_offset(
+	          handle,
+	          1024,
+	          SEEK_SET,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 1024 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libsmraw_handle_seek_offset(
+	          handle,
+	          -512,
+	          SEEK_CUR,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 512 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libsmraw_handle_seek_offset(
+	          handle,
+	          (off64_t) ( size + 512 ),
+	          SEEK_SET,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) ( size + 512 ) );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Reset offset to 0
+	 */
+	offset = libsmraw_handle_seek_offset(
+	          handle,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	offset = libsmraw_handle_seek_offset(
+	          NULL,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	offset = libsmraw_handle_seek_offset(
+	          handle,
+	          -1,
+	          SEEK_SET,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	offset = libsmraw_handle_seek_offset(
+	          handle,
+	          -1,
+	          SEEK_CUR,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	offset = libsmraw_handle_seek_offset(
+	          handle,
+	          (off64_t) ( -1 * ( size + 1 ) ),
+	          SEEK_END,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_handle_get_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_handle_get_offset(
+     libsmraw_handle_t *handle )
+{
+	libcerror_error_t *error = NULL;
+	off64_t offset           = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libsmraw_handle_get_offset(
+	          handle,
+	          &offset,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmraw_handle_get_offset(
+	          NULL,
+	          &offset,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_handle_get_offset(
+	          handle,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_handle_set_read_ahead_size function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_handle_set_read_ahead_size(
+     libsmraw_handle_t *handle )
+{
+	uint8_t buffer[ 512 ];
+	uint8_t expected_buffer[ 512 ];
+
+	libcerror_error_t *error = NULL;
+	off64_t current_offset   = 0;
+	off64_t offset           = 0;
+	ssize_t read_count       = 0;
+	int iterator             = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libsmraw_handle_set_read_ahead_size(
+	          handle,
+	          SMRAW_TEST_HANDLE_READ_BUFFER_SIZE,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libsmraw_handle_seek_offset(
+	          handle,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 0 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Read sequentially across multiple read-ahead windows
+	 */
+	for( iterator = 0;
+	     iterator < 24;
+	     iterator++ )
+	{
+		read_count = libsmraw_handle_read_buffer_at_offset(
+		              handle,
+		              expected_buffer,
+		              512,
+		              offset,
+		              &error );
+
+		SMRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = (int) read_count;
+
+		read_count = libsmraw_handle_read_buffer(
+		              handle,
+		              buffer,
+		              512,
+		              &error );
+
+		SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) result );
+
+		SMRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( read_count == 0 )
+		{
+			break;
+		}
+		result = memory_compare(
+		          buffer,
+		          expected_buffer,
+		          (size_t) read_count );
+
+		SMRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		offset += read_count;
+	}
+	result = libsmraw_handle_get_offset(
+	          handle,
+	          &current_offset,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT64(
+	 "current_offset",
+	 (int64_t) current_offset,
+	 (int64_t) offset );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_handle_set_read_ahead_size(
+	          handle,
+	          0,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmraw_handle_set_read_ahead_size(
+	          NULL,
+	          SMRAW_TEST_HANDLE_READ_BUFFER_SIZE,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_handle_set_read_ahead_size(
+	          handle,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	libsmraw_handle_set_read_ahead_size(
+	 handle,
+	 0,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libsmraw_handle_set_access_pattern function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_handle_set_access_pattern(
+     libsmraw_handle_t *handle )
+{
+	uint8_t buffer[ 512 ];
+	uint8_t expected_buffer[ 512 ];
+
+	libcerror_error_t *error = NULL;
+	off64_t offset           = 0;
+	ssize_t read_count       = 0;
+	int iterator             = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libsmraw_handle_set_access_pattern(
+	          handle,
+	          LIBSMRAW_ACCESS_PATTERN_FLAG_SEQUENTIAL | LIBSMRAW_ACCESS_PATTERN_FLAG_NO_REUSE,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libsmraw_handle_seek_offset(
+	          handle,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 0 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The access pattern hints should not affect the data that is read
+	 */
+	for( iterator = 0;
+	     iterator < 8;
+	     iterator++ )
+	{
+		read_count = libsmraw_handle_read_buffer_at_offset(
+		              handle,
+		              expected_buffer,
+		              512,
+		              offset,
+		              &error );
+
+		SMRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = (int) read_count;
+
+		read_count = libsmraw_handle_read_buffer(
+		              handle,
+		              buffer,
+		              512,
+		              &error );
+
+		SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) result );
+
+		SMRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( read_count == 0 )
+		{
+			break;
+		}
+		result = memory_compare(
+		          buffer,
+		          expected_buffer,
+		          (size_t) read_count );
+
+		SMRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		offset += read_count;
+	}
+	result = libsmraw_handle_set_access_pattern(
+	          handle,
+	          LIBSMRAW_ACCESS_PATTERN_FLAG_RANDOM,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_handle_set_access_pattern(
+	          handle,
+	          0,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmraw_handle_set_access_pattern(
+	          NULL,
+	          LIBSMRAW_ACCESS_PATTERN_FLAG_SEQUENTIAL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_handle_set_access_pattern(
+	          handle,
+	          0x08,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_handle_set_access_pattern(
+	          handle,
+	          LIBSMRAW_ACCESS_PATTERN_FLAG_SEQUENTIAL | LIBSMRAW_ACCESS_PATTERN_FLAG_RANDOM,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	libsmraw_handle_set_access_pattern(
+	 handle,
+	 0,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libsmraw_handle_set_write_buffer_size function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_handle_set_write_buffer_size(
+     libsmraw_handle_t *handle )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libsmraw_handle_set_write_buffer_size(
+	          handle,
+	          1024 * 1024,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_handle_set_write_buffer_size(
+	          handle,
+	          0,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmraw_handle_set_write_buffer_size(
+	          NULL,
+	          1024 * 1024,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_handle_set_write_buffer_size(
+	          handle,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_handle_set_write_queue_size function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_handle_set_write_queue_size(
+     libsmraw_handle_t *handle )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libsmraw_handle_set_write_queue_size(
+	          handle,
+	          4,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_handle_set_write_queue_size(
+	          handle,
+	          0,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmraw_handle_set_write_queue_size(
+	          NULL,
+	          4,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_handle_set_write_queue_size(
+	          handle,
+	          -1,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_handle_set_block_cache_size function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_handle_set_block_cache_size(
+     libsmraw_handle_t *handle )
+{
+	uint8_t buffer[ 512 ];
+	uint8_t expected_buffer[ 512 ];
+
+	libcerror_error_t *error = NULL;
+	size64_t media_size      = 0;
+	off64_t offset           = 0;
+	ssize_t expected_count   = 0;
+	ssize_t read_count       = 0;
+	int iterator             = 0;
+	int read_iterator        = 0;
+	int result               = 0;
+
+	result = libsmraw_handle_get_media_size(
+	          handle,
+	          &media_size,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( iterator = 0;
+	     iterator < 8;
+	     iterator++ )
+	{
+		/* Use offsets that are not aligned to the block size
+		 */
+		offset = (off64_t) ( ( (size64_t) iterator * 1237 ) % ( media_size + 1 ) );
+
+		result = libsmraw_handle_set_block_cache_size(
+		          handle,
+		          0,
+		          0,
+		          &error );
+
+		SMRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SMRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		expected_count = libsmraw_handle_read_buffer_at_offset(
+		                  handle,
+		                  expected_buffer,
+		                  512,
+		                  offset,
+		                  &error );
+
+		SMRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsmraw_handle_set_block_cache_size(
+		          handle,
+		          4096,
+		          1024,
+		          &error );
+
+		SMRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SMRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The first read fills the block cache and the second read is served from it
+		 */
+		for( read_iterator = 0;
+		     read_iterator < 2;
+		     read_iterator++ )
+		{
+			read_count = libsmraw_handle_read_buffer_at_offset(
+			              handle,
+			              buffer,
+			              512,
+			              offset,
+			              &error );
+
+			SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+			 "read_count",
+			 read_count,
+			 expected_count );
+
+			SMRAW_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = memory_compare(
+			          buffer,
+			          expected_buffer,
+			          (size_t) read_count );
+
+			SMRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+	}
+	result = libsmraw_handle_set_block_cache_size(
+	          handle,
+	          0,
+	          0,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmraw_handle_set_block_cache_size(
+	          NULL,
+	          4096,
+	          1024,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_handle_set_block_cache_size(
+	          handle,
+	          (size_t) SSIZE_MAX + 1,
+	          1024,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_handle_set_block_cache_size(
+	          handle,
+	          4096,
+	          0,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_handle_set_block_cache_size(
+	          handle,
+	          1024,
+	          4096,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	libsmraw_handle_set_block_cache_size(
+	 handle,
+	 0,
+	 0,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libsmraw_handle_get_block_cache_statistics function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_handle_get_block_cache_statistics(
      libsmraw_handle_t *handle )
 {
-	libcerror_error_t *error = NULL;
-	size64_t size            = 0;
-	off64_t offset           = 0;
+	uint8_t buffer[ 512 ];
+
+	libcerror_error_t *error     = NULL;
+	uint64_t number_of_evictions = 0;
+	uint64_t number_of_hits      = 0;
+	uint64_t number_of_misses    = 0;
+	ssize_t read_count           = 0;
+	int result                   = 0;
 
 	/* Test regular cases
 	 */
-	offset = libsmraw_handle_seek_offset(
+	result = libsmraw_handle_get_block_cache_statistics(
 	          handle,
-	          0,
-	          SEEK_END,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &number_of_evictions,
 	          &error );
 
-	SMRAW_TEST_ASSERT_NOT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
 	SMRAW_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	size = (size64_t) offset;
-
-	offset = libsmraw_handle_seek_offset(
+	result = libsmraw_handle_set_block_cache_size(
 	          handle,
+	          4096,
 	          1024,
-	          SEEK_SET,
 	          &error );
 
-	SMRAW_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) 1024 );
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	SMRAW_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	offset = libsmraw_handle_seek_offset(
-	          handle,
-	          -512,
-	          SEEK_CUR,
-	          &error );
-
-	SMRAW_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) 512 );
+	read_count = libsmraw_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              512,
+	              0,
+	              &error );
 
 	SMRAW_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	offset = libsmraw_handle_seek_offset(
-	          handle,
-	          (off64_t) ( size + 512 ),
-	          SEEK_SET,
-	          &error );
-
-	SMRAW_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) ( size + 512 ) );
+	read_count = libsmraw_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              512,
+	              0,
+	              &error );
 
 	SMRAW_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Reset offset to 0
-	 */
-	offset = libsmraw_handle_seek_offset(
+	result = libsmraw_handle_get_block_cache_statistics(
 	          handle,
-	          0,
-	          SEEK_SET,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &number_of_evictions,
 	          &error );
 
-	SMRAW_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) 0 );
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	SMRAW_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	if( read_count > 0 )
+	{
+		SMRAW_TEST_ASSERT_EQUAL_UINT64(
+		 "number_of_hits",
+		 number_of_hits,
+		 (uint64_t) 1 );
+
+		SMRAW_TEST_ASSERT_EQUAL_UINT64(
+		 "number_of_misses",
+		 number_of_misses,
+		 (uint64_t) 1 );
+	}
 	/* Test error cases
 	 */
-	offset = libsmraw_handle_seek_offset(
+	result = libsmraw_handle_get_block_cache_statistics(
 	          NULL,
-	          0,
-	          SEEK_SET,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &number_of_evictions,
 	          &error );
 
-	SMRAW_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	SMRAW_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -2083,16 +3952,17 @@ int smraw_test_handle_seek_offset(
 	libcerror_error_free(
 	 &error );
 
-	offset = libsmraw_handle_seek_offset(
+	result = libsmraw_handle_get_block_cache_statistics(
 	          handle,
-	          -1,
-	          SEEK_SET,
+	          NULL,
+	          &number_of_misses,
+	          &number_of_evictions,
 	          &error );
 
-	SMRAW_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	SMRAW_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -2101,39 +3971,23 @@ int smraw_test_handle_seek_offset(
 	libcerror_error_free(
 	 &error );
 
-	offset = libsmraw_handle_seek_offset(
-	          handle,
-	          -1,
-	          SEEK_CUR,
-	          &error );
-
-	SMRAW_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
-
-	SMRAW_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	offset = libsmraw_handle_seek_offset(
+	/* Clean up
+	 */
+	result = libsmraw_handle_set_block_cache_size(
 	          handle,
-	          (off64_t) ( -1 * ( size + 1 ) ),
-	          SEEK_END,
+	          0,
+	          0,
 	          &error );
 
-	SMRAW_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	SMRAW_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
 	return( 1 );
 
 on_error:
@@ -2142,30 +3996,38 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	libsmraw_handle_set_block_cache_size(
+	 handle,
+	 0,
+	 0,
+	 NULL );
+
 	return( 0 );
 }
 
-/* Tests the libsmraw_handle_get_offset function
+/* Tests the libsmraw_handle_get_open_handle_statistics function
  * Returns 1 if successful or 0 if not
  */
-int smraw_test_handle_get_offset(
+int smraw_test_handle_get_open_handle_statistics(
      libsmraw_handle_t *handle )
 {
-	libcerror_error_t *error = NULL;
-	off64_t offset           = 0;
-	int result               = 0;
+	libcerror_error_t *error  = NULL;
+	uint64_t number_of_closes = 0;
+	uint64_t number_of_opens  = 0;
+	int result                = 0;
 
 	/* Test regular cases
 	 */
-	result = libsmraw_handle_get_offset(
+	result = libsmraw_handle_get_open_handle_statistics(
 	          handle,
-	          &offset,
+	          &number_of_opens,
+	          &number_of_closes,
 	          &error );
 
 	SMRAW_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 0 );
 
 	SMRAW_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -2173,26 +4035,10 @@ int smraw_test_handle_get_offset(
 
 	/* Test error cases
 	 */
-	result = libsmraw_handle_get_offset(
-	          NULL,
-	          &offset,
-	          &error );
-
-	SMRAW_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	SMRAW_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	result = libsmraw_handle_get_offset(
-	          handle,
+	result = libsmraw_handle_get_open_handle_statistics(
 	          NULL,
+	          &number_of_opens,
+	          &number_of_closes,
 	          &error );
 
 	SMRAW_TEST_ASSERT_EQUAL_INT(
@@ -2533,6 +4379,75 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libsmraw_handle_set_preallocate_segments function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_handle_set_preallocate_segments(
+     libsmraw_handle_t *handle )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libsmraw_handle_set_preallocate_segments(
+	          handle,
+	          1,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_handle_set_preallocate_segments(
+	          handle,
+	          0,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmraw_handle_set_preallocate_segments(
+	          NULL,
+	          1,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libsmraw_handle_get_filename_size function
  * Returns 1 if successful or 0 if not
  */
@@ -3346,6 +5261,10 @@ int main(
 	 "libsmraw_handle_free",
 	 smraw_test_handle_free );
 
+	SMRAW_TEST_RUN(
+	 "libsmraw_handle_open_lazy",
+	 smraw_test_handle_open_lazy );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 	if( source != NULL )
 	{
@@ -3538,6 +5457,16 @@ int main(
 		 smraw_test_handle_read_buffer_at_offset,
 		 handle );
 
+		SMRAW_TEST_RUN_WITH_ARGS(
+		 "libsmraw_handle_get_data_view",
+		 smraw_test_handle_get_data_view,
+		 handle );
+
+		SMRAW_TEST_RUN_WITH_ARGS(
+		 "libsmraw_handle_submit_reads",
+		 smraw_test_handle_submit_reads,
+		 handle );
+
 		/* TODO: add tests for libsmraw_handle_write_buffer */
 
 		/* TODO: add tests for libsmraw_handle_write_buffer_at_offset */
@@ -3554,6 +5483,41 @@ int main(
 
 		/* TODO: add tests for libsmraw_handle_set_maximum_number_of_open_handles */
 
+		SMRAW_TEST_RUN_WITH_ARGS(
+		 "libsmraw_handle_set_read_ahead_size",
+		 smraw_test_handle_set_read_ahead_size,
+		 handle );
+
+		SMRAW_TEST_RUN_WITH_ARGS(
+		 "libsmraw_handle_set_access_pattern",
+		 smraw_test_handle_set_access_pattern,
+		 handle );
+
+		SMRAW_TEST_RUN_WITH_ARGS(
+		 "libsmraw_handle_set_write_buffer_size",
+		 smraw_test_handle_set_write_buffer_size,
+		 handle );
+
+		SMRAW_TEST_RUN_WITH_ARGS(
+		 "libsmraw_handle_set_write_queue_size",
+		 smraw_test_handle_set_write_queue_size,
+		 handle );
+
+		SMRAW_TEST_RUN_WITH_ARGS(
+		 "libsmraw_handle_set_block_cache_size",
+		 smraw_test_handle_set_block_cache_size,
+		 handle );
+
+		SMRAW_TEST_RUN_WITH_ARGS(
+		 "libsmraw_handle_get_block_cache_statistics",
+		 smraw_test_handle_get_block_cache_statistics,
+		 handle );
+
+		SMRAW_TEST_RUN_WITH_ARGS(
+		 "libsmraw_handle_get_open_handle_statistics",
+		 smraw_test_handle_get_open_handle_statistics,
+		 handle );
+
 #if defined( TODO )
 
 		SMRAW_TEST_RUN_WITH_ARGS(
@@ -3587,6 +5551,11 @@ int main(
 
 		/* TODO: add tests for libsmraw_handle_set_maximum_segment_size */
 
+		SMRAW_TEST_RUN_WITH_ARGS(
+		 "libsmraw_handle_set_preallocate_segments",
+		 smraw_test_handle_set_preallocate_segments,
+		 handle );
+
 		SMRAW_TEST_RUN_WITH_ARGS(
 		 "libsmraw_handle_get_filename_size",
 		 smraw_test_handle_get_filename_size,
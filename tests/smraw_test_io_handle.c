@@ -27,6 +27,7 @@
 #include <stdlib.h>
 #endif
 
+#include "smraw_test_libbfio.h"
 #include "smraw_test_libcerror.h"
 #include "smraw_test_libsmraw.h"
 #include "smraw_test_macros.h"
@@ -771,6 +772,712 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libsmraw_io_handle_get_segment_file_sizes function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_io_handle_get_segment_file_sizes(
+     void )
+{
+	uint8_t segment_data[ 4096 ];
+	size64_t segment_file_sizes[ 3 ];
+	size64_t segment_file_sizes_with_error[ 4 ];
+
+	size_t range_sizes[ 3 ] = { 4096, 4096, 100 };
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libbfio_pool_t *file_io_pool     = NULL;
+	libcerror_error_t *error         = NULL;
+	libsmraw_io_handle_t *io_handle  = NULL;
+	int entry_index                  = 0;
+	int result                       = 0;
+	int segment_file_index           = 0;
+
+	/* Initialize test
+	 */
+	result = libsmraw_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_initialize(
+	          &file_io_pool,
+	          0,
+	          LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_pool",
+	 file_io_pool );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( segment_file_index = 0;
+	     segment_file_index < 3;
+	     segment_file_index++ )
+	{
+		result = libbfio_memory_range_initialize(
+		          &file_io_handle,
+		          &error );
+
+		SMRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SMRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_memory_range_set(
+		          file_io_handle,
+		          segment_data,
+		          range_sizes[ segment_file_index ],
+		          &error );
+
+		SMRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SMRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_pool_append_handle(
+		          file_io_pool,
+		          &entry_index,
+		          file_io_handle,
+		          LIBBFIO_OPEN_READ,
+		          &error );
+
+		SMRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SMRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		file_io_handle = NULL;
+	}
+	/* Test regular cases
+	 */
+	result = libsmraw_io_handle_get_segment_file_sizes(
+	          io_handle,
+	          file_io_pool,
+	          3,
+	          LIBBFIO_OPEN_READ,
+	          segment_file_sizes,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( segment_file_index = 0;
+	     segment_file_index < 3;
+	     segment_file_index++ )
+	{
+		SMRAW_TEST_ASSERT_EQUAL_UINT64(
+		 "segment_file_sizes[ segment_file_index ]",
+		 (uint64_t) segment_file_sizes[ segment_file_index ],
+		 (uint64_t) range_sizes[ segment_file_index ] );
+	}
+	/* Test error cases
+	 */
+	result = libsmraw_io_handle_get_segment_file_sizes(
+	          NULL,
+	          file_io_pool,
+	          3,
+	          LIBBFIO_OPEN_READ,
+	          segment_file_sizes,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_io_handle_get_segment_file_sizes(
+	          io_handle,
+	          file_io_pool,
+	          -1,
+	          LIBBFIO_OPEN_READ,
+	          segment_file_sizes,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_io_handle_get_segment_file_sizes(
+	          io_handle,
+	          file_io_pool,
+	          3,
+	          LIBBFIO_OPEN_READ,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with more segment files than entries in the pool
+	 */
+	result = libsmraw_io_handle_get_segment_file_sizes(
+	          io_handle,
+	          file_io_pool,
+	          4,
+	          LIBBFIO_OPEN_READ,
+	          segment_file_sizes,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a segment file of which the size cannot be retrieved
+	 */
+	result = libbfio_memory_range_initialize(
+	          &file_io_handle,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_append_handle(
+	          file_io_pool,
+	          &entry_index,
+	          file_io_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	file_io_handle = NULL;
+
+	result = libsmraw_io_handle_get_segment_file_sizes(
+	          io_handle,
+	          file_io_pool,
+	          4,
+	          LIBBFIO_OPEN_READ,
+	          segment_file_sizes_with_error,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_pool_free(
+	          &file_io_pool,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &file_io_pool,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libsmraw_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_io_handle_preallocate_segment function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_io_handle_preallocate_segment(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libsmraw_io_handle_t *io_handle = NULL;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libsmraw_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "io_handle->preallocated_segment_index",
+	 io_handle->preallocated_segment_index,
+	 -1 );
+
+	/* Test regular cases
+	 */
+	io_handle->maximum_segment_size = 0;
+
+	result = libsmraw_io_handle_preallocate_segment(
+	          io_handle,
+	          0,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "io_handle->preallocated_segment_index",
+	 io_handle->preallocated_segment_index,
+	 -1 );
+
+	/* Test error cases
+	 */
+	result = libsmraw_io_handle_preallocate_segment(
+	          NULL,
+	          0,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_io_handle_preallocate_segment(
+	          io_handle,
+	          -1,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	io_handle->preallocated_segment_index = 1;
+
+	result = libsmraw_io_handle_preallocate_segment(
+	          io_handle,
+	          0,
+	          &error );
+
+	io_handle->preallocated_segment_index = -1;
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmraw_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libsmraw_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_io_handle_finalize_segments function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_io_handle_finalize_segments(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libsmraw_io_handle_t *io_handle = NULL;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libsmraw_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsmraw_io_handle_finalize_segments(
+	          io_handle,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmraw_io_handle_finalize_segments(
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmraw_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libsmraw_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_io_handle_set_preallocate_segments function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_io_handle_set_preallocate_segments(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libsmraw_io_handle_t *io_handle = NULL;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libsmraw_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsmraw_io_handle_set_preallocate_segments(
+	          io_handle,
+	          2,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "io_handle->preallocate_segments",
+	 io_handle->preallocate_segments,
+	 1 );
+
+	result = libsmraw_io_handle_set_preallocate_segments(
+	          io_handle,
+	          0,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "io_handle->preallocate_segments",
+	 io_handle->preallocate_segments,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libsmraw_io_handle_set_preallocate_segments(
+	          NULL,
+	          1,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmraw_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libsmraw_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT ) */
 
 /* The main program
@@ -804,6 +1511,18 @@ int main(
 
 	/* TODO: add tests for libsmraw_io_handle_create_segment */
 
+	SMRAW_TEST_RUN(
+	 "libsmraw_io_handle_preallocate_segment",
+	 smraw_test_io_handle_preallocate_segment );
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_io_handle_finalize_segments",
+	 smraw_test_io_handle_finalize_segments );
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_io_handle_get_segment_file_sizes",
+	 smraw_test_io_handle_get_segment_file_sizes );
+
 	/* TODO: add tests for libsmraw_io_handle_read_segment_data */
 
 	/* TODO: add tests for libsmraw_io_handle_write_segment_data */
@@ -840,6 +1559,10 @@ int main(
 
 	/* TODO: add tests for libsmraw_io_handle_set_maximum_segment_size */
 
+	SMRAW_TEST_RUN(
+	 "libsmraw_io_handle_set_preallocate_segments",
+	 smraw_test_io_handle_set_preallocate_segments );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -0,0 +1,1239 @@
+/*
+ * Library manifest type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "smraw_test_libcerror.h"
+#include "smraw_test_libsmraw.h"
+#include "smraw_test_macros.h"
+#include "smraw_test_memory.h"
+#include "smraw_test_unused.h"
+
+#include "../libsmraw/libsmraw_definitions.h"
+#include "../libsmraw/libsmraw_manifest.h"
+
+#if defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT )
+
+/* Tests the libsmraw_manifest_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_manifest_initialize(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	libsmraw_manifest_t *manifest = NULL;
+	int result                    = 0;
+
+#if defined( HAVE_SMRAW_TEST_MEMORY )
+	int number_of_malloc_fail_tests                 = 1;
+	int number_of_memset_fail_tests                 = 1;
+	int test_number                                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libsmraw_manifest_initialize(
+	          &manifest,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "manifest",
+	 manifest );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_manifest_free(
+	          &manifest,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "manifest",
+	 manifest );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmraw_manifest_initialize(
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	manifest = (libsmraw_manifest_t *) 0x12345678UL;
+
+	result = libsmraw_manifest_initialize(
+	          &manifest,
+	          &error );
+
+	manifest = NULL;
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SMRAW_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsmraw_manifest_initialize with malloc failing
+		 */
+		smraw_test_malloc_attempts_before_fail = test_number;
+
+		result = libsmraw_manifest_initialize(
+		          &manifest,
+		          &error );
+
+		if( smraw_test_malloc_attempts_before_fail != -1 )
+		{
+			smraw_test_malloc_attempts_before_fail = -1;
+
+			if( manifest != NULL )
+			{
+				libsmraw_manifest_free(
+				 &manifest,
+				 NULL );
+			}
+		}
+		else
+		{
+			SMRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SMRAW_TEST_ASSERT_IS_NULL(
+			 "manifest",
+			 manifest );
+
+			SMRAW_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsmraw_manifest_initialize with memset failing
+		 */
+		smraw_test_memset_attempts_before_fail = test_number;
+
+		result = libsmraw_manifest_initialize(
+		          &manifest,
+		          &error );
+
+		if( smraw_test_memset_attempts_before_fail != -1 )
+		{
+			smraw_test_memset_attempts_before_fail = -1;
+
+			if( manifest != NULL )
+			{
+				libsmraw_manifest_free(
+				 &manifest,
+				 NULL );
+			}
+		}
+		else
+		{
+			SMRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SMRAW_TEST_ASSERT_IS_NULL(
+			 "manifest",
+			 manifest );
+
+			SMRAW_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SMRAW_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( manifest != NULL )
+	{
+		libsmraw_manifest_free(
+		 &manifest,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_manifest_free function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_manifest_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libsmraw_manifest_free(
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_manifest_create_filename function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_manifest_create_filename(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	char *manifest_filename       = NULL;
+	size_t manifest_filename_size = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = libsmraw_manifest_create_filename(
+	          &manifest_filename,
+	          &manifest_filename_size,
+	          "/case/image.001",
+	          15,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "manifest_filename",
+	 manifest_filename );
+
+	SMRAW_TEST_ASSERT_EQUAL_SIZE(
+	 "manifest_filename_size",
+	 manifest_filename_size,
+	 (size_t) 25 );
+
+	result = narrow_string_compare(
+	          manifest_filename,
+	          "/case/image.raw.manifest",
+	          25 );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 manifest_filename );
+
+	manifest_filename = NULL;
+
+	/* Test error cases
+	 */
+	result = libsmraw_manifest_create_filename(
+	          NULL,
+	          &manifest_filename_size,
+	          "/case/image.001",
+	          15,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_manifest_create_filename(
+	          &manifest_filename,
+	          NULL,
+	          "/case/image.001",
+	          15,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_manifest_create_filename(
+	          &manifest_filename,
+	          &manifest_filename_size,
+	          NULL,
+	          15,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_manifest_create_filename(
+	          &manifest_filename,
+	          &manifest_filename_size,
+	          "/case/image.001",
+	          4,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( manifest_filename != NULL )
+	{
+		memory_free(
+		 manifest_filename );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_manifest_append_segment function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_manifest_append_segment(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	libsmraw_manifest_t *manifest = NULL;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = libsmraw_manifest_initialize(
+	          &manifest,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "manifest",
+	 manifest );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsmraw_manifest_append_segment(
+	          manifest,
+	          "/case/image.001",
+	          15,
+	          4096,
+	          1700000000,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "manifest->number_of_segments",
+	 manifest->number_of_segments,
+	 1 );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "manifest->media_size",
+	 (uint64_t) manifest->media_size,
+	 (uint64_t) 4096 );
+
+	SMRAW_TEST_ASSERT_EQUAL_SIZE(
+	 "manifest->segments[ 0 ].name_size",
+	 manifest->segments[ 0 ].name_size,
+	 (size_t) 10 );
+
+	result = narrow_string_compare(
+	          manifest->segments[ 0 ].name,
+	          "image.001",
+	          10 );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libsmraw_manifest_append_segment(
+	          NULL,
+	          "/case/image.001",
+	          15,
+	          4096,
+	          1700000000,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_manifest_append_segment(
+	          manifest,
+	          NULL,
+	          15,
+	          4096,
+	          1700000000,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_manifest_append_segment(
+	          manifest,
+	          "/case/",
+	          6,
+	          4096,
+	          1700000000,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmraw_manifest_free(
+	          &manifest,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "manifest",
+	 manifest );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( manifest != NULL )
+	{
+		libsmraw_manifest_free(
+		 &manifest,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_manifest_write and libsmraw_manifest_read functions
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_manifest_write_read(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	libsmraw_manifest_t *manifest = NULL;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = libsmraw_manifest_initialize(
+	          &manifest,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "manifest",
+	 manifest );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_manifest_append_segment(
+	          manifest,
+	          "image.001",
+	          9,
+	          4096,
+	          1700000000,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_manifest_append_segment(
+	          manifest,
+	          "image.002",
+	          9,
+	          1024,
+	          1700000001,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	manifest->naming_schema = LIBSMRAW_SEGMENT_FILE_NAMING_SCHEMA_NUMERIC;
+
+	/* Test regular cases
+	 */
+	result = libsmraw_manifest_write(
+	          manifest,
+	          "smraw_test_manifest.raw.manifest",
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_manifest_free(
+	          &manifest,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_manifest_initialize(
+	          &manifest,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_manifest_read(
+	          manifest,
+	          "smraw_test_manifest.raw.manifest",
+	          &error );
+
+#if defined( HAVE_LIBSMRAW_MANIFEST_SUPPORT )
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "manifest->number_of_segments",
+	 manifest->number_of_segments,
+	 2 );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "manifest->media_size",
+	 (uint64_t) manifest->media_size,
+	 (uint64_t) 5120 );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "manifest->naming_schema",
+	 (int) manifest->naming_schema,
+	 (int) LIBSMRAW_SEGMENT_FILE_NAMING_SCHEMA_NUMERIC );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT64(
+	 "manifest->segments[ 1 ].modification_time",
+	 manifest->segments[ 1 ].modification_time,
+	 (int64_t) 1700000001 );
+
+	result = narrow_string_compare(
+	          manifest->segments[ 1 ].name,
+	          "image.002",
+	          10 );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+#else
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* defined( HAVE_LIBSMRAW_MANIFEST_SUPPORT ) */
+
+	remove(
+	 "smraw_test_manifest.raw.manifest" );
+
+	result = libsmraw_manifest_free(
+	          &manifest,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_manifest_initialize(
+	          &manifest,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_manifest_read(
+	          manifest,
+	          "smraw_test_manifest.raw.manifest",
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmraw_manifest_read(
+	          NULL,
+	          "smraw_test_manifest.raw.manifest",
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_manifest_read(
+	          manifest,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_manifest_write(
+	          NULL,
+	          "smraw_test_manifest.raw.manifest",
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_manifest_write(
+	          manifest,
+	          "smraw_test_manifest.raw.manifest",
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmraw_manifest_free(
+	          &manifest,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "manifest",
+	 manifest );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	remove(
+	 "smraw_test_manifest.raw.manifest" );
+
+	if( manifest != NULL )
+	{
+		libsmraw_manifest_free(
+		 &manifest,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_LIBSMRAW_MANIFEST_SUPPORT )
+
+/* Tests the libsmraw_manifest_set_segment_files and libsmraw_manifest_compare_segment_files functions
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_manifest_compare_segment_files(
+     void )
+{
+	char *filenames[ 3 ] = {
+		"smraw_test_manifest.001",
+		"smraw_test_manifest.002",
+		"smraw_test_manifest.003" };
+
+	libcerror_error_t *error      = NULL;
+	libsmraw_manifest_t *manifest = NULL;
+	FILE *file_stream             = NULL;
+	int filename_index            = 0;
+	int result                    = 0;
+
+	for( filename_index = 0;
+	     filename_index < 3;
+	     filename_index++ )
+	{
+		file_stream = file_stream_open(
+		               filenames[ filename_index ],
+		               FILE_STREAM_BINARY_OPEN_WRITE );
+
+		SMRAW_TEST_ASSERT_IS_NOT_NULL(
+		 "file_stream",
+		 file_stream );
+
+		file_stream_write(
+		 file_stream,
+		 "segment",
+		 7 );
+
+		file_stream_close(
+		 file_stream );
+	}
+	/* Initialize test
+	 */
+	result = libsmraw_manifest_initialize(
+	          &manifest,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "manifest",
+	 manifest );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsmraw_manifest_set_segment_files(
+	          manifest,
+	          filenames,
+	          3,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "manifest->media_size",
+	 (uint64_t) manifest->media_size,
+	 (uint64_t) 21 );
+
+	result = libsmraw_manifest_compare_segment_files(
+	          manifest,
+	          filenames,
+	          3,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The manifest does not match if the number of segment files differs
+	 */
+	result = libsmraw_manifest_compare_segment_files(
+	          manifest,
+	          filenames,
+	          2,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The manifest still matches if a segment file other than the first and last
+	 * has changed, since its size is verified on first access
+	 */
+	file_stream = file_stream_open(
+	               filenames[ 1 ],
+	               FILE_STREAM_BINARY_OPEN_APPEND );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "file_stream",
+	 file_stream );
+
+	file_stream_write(
+	 file_stream,
+	 "data",
+	 4 );
+
+	file_stream_close(
+	 file_stream );
+
+	result = libsmraw_manifest_compare_segment_files(
+	          manifest,
+	          filenames,
+	          3,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The manifest does not match if the last segment file has changed
+	 */
+	file_stream = file_stream_open(
+	               filenames[ 2 ],
+	               FILE_STREAM_BINARY_OPEN_APPEND );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "file_stream",
+	 file_stream );
+
+	file_stream_write(
+	 file_stream,
+	 "data",
+	 4 );
+
+	file_stream_close(
+	 file_stream );
+
+	result = libsmraw_manifest_compare_segment_files(
+	          manifest,
+	          filenames,
+	          3,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmraw_manifest_compare_segment_files(
+	          NULL,
+	          filenames,
+	          3,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_manifest_compare_segment_files(
+	          manifest,
+	          NULL,
+	          3,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmraw_manifest_free(
+	          &manifest,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "manifest",
+	 manifest );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( filename_index = 0;
+	     filename_index < 3;
+	     filename_index++ )
+	{
+		remove(
+		 filenames[ filename_index ] );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( filename_index = 0;
+	     filename_index < 3;
+	     filename_index++ )
+	{
+		remove(
+		 filenames[ filename_index ] );
+	}
+	if( manifest != NULL )
+	{
+		libsmraw_manifest_free(
+		 &manifest,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_LIBSMRAW_MANIFEST_SUPPORT ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SMRAW_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SMRAW_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SMRAW_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SMRAW_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SMRAW_TEST_UNREFERENCED_PARAMETER( argc )
+	SMRAW_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT )
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_manifest_initialize",
+	 smraw_test_manifest_initialize );
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_manifest_free",
+	 smraw_test_manifest_free );
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_manifest_create_filename",
+	 smraw_test_manifest_create_filename );
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_manifest_append_segment",
+	 smraw_test_manifest_append_segment );
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_manifest_write",
+	 smraw_test_manifest_write_read );
+
+#if defined( HAVE_LIBSMRAW_MANIFEST_SUPPORT )
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_manifest_compare_segment_files",
+	 smraw_test_manifest_compare_segment_files );
+
+#endif /* defined( HAVE_LIBSMRAW_MANIFEST_SUPPORT ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT ) */
+}
+
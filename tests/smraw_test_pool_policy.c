@@ -0,0 +1,1397 @@
+/*
+ * Library pool_policy type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "smraw_test_libbfio.h"
+#include "smraw_test_libcerror.h"
+#include "smraw_test_libsmraw.h"
+#include "smraw_test_macros.h"
+#include "smraw_test_memory.h"
+#include "smraw_test_unused.h"
+
+#include "../libsmraw/libsmraw_pool_policy.h"
+
+#if defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT )
+
+#define SMRAW_TEST_POOL_POLICY_NUMBER_OF_ENTRIES		32
+#define SMRAW_TEST_POOL_POLICY_MAXIMUM_NUMBER_OF_OPEN_HANDLES	4
+#define SMRAW_TEST_POOL_POLICY_NUMBER_OF_THREADS		8
+#define SMRAW_TEST_POOL_POLICY_NUMBER_OF_ITERATIONS		4096
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+
+typedef struct smraw_test_pool_policy_reader smraw_test_pool_policy_reader_t;
+
+struct smraw_test_pool_policy_reader
+{
+	/* The pool policy
+	 */
+	libsmraw_pool_policy_t *pool_policy;
+
+	/* The file IO pool
+	 */
+	libbfio_pool_t *file_io_pool;
+
+	/* The index of the reader
+	 */
+	int reader_index;
+
+	/* The largest number of open handles observed by the reader
+	 */
+	int maximum_number_of_open_handles;
+
+	/* The result, 1 if successful or 0 if not
+	 */
+	int result;
+};
+
+/* Determines the number of open handles in a file IO pool
+ * Returns the number of open handles or -1 on error
+ */
+int smraw_test_pool_policy_get_number_of_open_handles(
+     libbfio_pool_t *file_io_pool )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	int entry                        = 0;
+	int number_of_open_handles       = 0;
+	int result                       = 0;
+
+	for( entry = 0;
+	     entry < SMRAW_TEST_POOL_POLICY_NUMBER_OF_ENTRIES;
+	     entry++ )
+	{
+		if( libbfio_pool_get_handle(
+		     file_io_pool,
+		     entry,
+		     &file_io_handle,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+		result = libbfio_handle_is_open(
+		          file_io_handle,
+		          NULL );
+
+		if( result == -1 )
+		{
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			number_of_open_handles++;
+		}
+	}
+	return( number_of_open_handles );
+}
+
+/* Reads from pool entries acquired by the pool policy
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_pool_policy_reader_thread_function(
+     smraw_test_pool_policy_reader_t *reader )
+{
+	uint8_t data               = 0;
+	ssize_t read_count         = 0;
+	int entry                  = 0;
+	int iteration              = 0;
+	int number_of_open_handles = 0;
+
+	reader->result = 0;
+
+	for( iteration = 0;
+	     iteration < SMRAW_TEST_POOL_POLICY_NUMBER_OF_ITERATIONS;
+	     iteration++ )
+	{
+		entry = ( ( reader->reader_index * 7 ) + ( iteration * 13 ) ) % SMRAW_TEST_POOL_POLICY_NUMBER_OF_ENTRIES;
+
+		if( libsmraw_pool_policy_acquire(
+		     reader->pool_policy,
+		     reader->file_io_pool,
+		     entry,
+		     NULL ) != 1 )
+		{
+			return( 0 );
+		}
+		/* The entry is not closed by other readers while it is acquired,
+		 * otherwise the file IO pool reopens it and the maximum number of open handles is exceeded
+		 */
+		read_count = libbfio_pool_read_buffer_at_offset(
+		              reader->file_io_pool,
+		              entry,
+		              &data,
+		              1,
+		              0,
+		              NULL );
+
+		/* The pool policy only opens and closes handles while its mutex is held
+		 */
+		if( libcthreads_mutex_grab(
+		     reader->pool_policy->mutex,
+		     NULL ) != 1 )
+		{
+			return( 0 );
+		}
+		number_of_open_handles = smraw_test_pool_policy_get_number_of_open_handles(
+		                          reader->file_io_pool );
+
+		if( libcthreads_mutex_release(
+		     reader->pool_policy->mutex,
+		     NULL ) != 1 )
+		{
+			return( 0 );
+		}
+		if( number_of_open_handles == -1 )
+		{
+			return( 0 );
+		}
+		if( number_of_open_handles > reader->maximum_number_of_open_handles )
+		{
+			reader->maximum_number_of_open_handles = number_of_open_handles;
+		}
+		if( libsmraw_pool_policy_release(
+		     reader->pool_policy,
+		     entry,
+		     NULL ) != 1 )
+		{
+			return( 0 );
+		}
+		if( ( read_count != 1 )
+		 || ( data != (uint8_t) entry ) )
+		{
+			return( 0 );
+		}
+	}
+	reader->result = 1;
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT ) */
+
+/* Tests the libsmraw_pool_policy_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_pool_policy_initialize(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libsmraw_pool_policy_t *pool_policy = NULL;
+	int result                          = 0;
+
+#if defined( HAVE_SMRAW_TEST_MEMORY )
+	int number_of_malloc_fail_tests     = 3;
+	int number_of_memset_fail_tests     = 2;
+	int test_number                     = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libsmraw_pool_policy_initialize(
+	          &pool_policy,
+	          8,
+	          4,
+	          0,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "pool_policy",
+	 pool_policy );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_pool_policy_free(
+	          &pool_policy,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "pool_policy",
+	 pool_policy );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmraw_pool_policy_initialize(
+	          NULL,
+	          8,
+	          4,
+	          0,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	pool_policy = (libsmraw_pool_policy_t *) 0x12345678UL;
+
+	result = libsmraw_pool_policy_initialize(
+	          &pool_policy,
+	          8,
+	          4,
+	          0,
+	          &error );
+
+	pool_policy = NULL;
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_pool_policy_initialize(
+	          &pool_policy,
+	          0,
+	          4,
+	          0,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_pool_policy_initialize(
+	          &pool_policy,
+	          8,
+	          -1,
+	          0,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SMRAW_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsmraw_pool_policy_initialize with malloc failing
+		 */
+		smraw_test_malloc_attempts_before_fail = test_number;
+
+		result = libsmraw_pool_policy_initialize(
+		          &pool_policy,
+		          8,
+		          4,
+		          0,
+		          &error );
+
+		if( smraw_test_malloc_attempts_before_fail != -1 )
+		{
+			smraw_test_malloc_attempts_before_fail = -1;
+
+			if( pool_policy != NULL )
+			{
+				libsmraw_pool_policy_free(
+				 &pool_policy,
+				 NULL );
+			}
+		}
+		else
+		{
+			SMRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SMRAW_TEST_ASSERT_IS_NULL(
+			 "pool_policy",
+			 pool_policy );
+
+			SMRAW_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsmraw_pool_policy_initialize with memset failing
+		 */
+		smraw_test_memset_attempts_before_fail = test_number;
+
+		result = libsmraw_pool_policy_initialize(
+		          &pool_policy,
+		          8,
+		          4,
+		          0,
+		          &error );
+
+		if( smraw_test_memset_attempts_before_fail != -1 )
+		{
+			smraw_test_memset_attempts_before_fail = -1;
+
+			if( pool_policy != NULL )
+			{
+				libsmraw_pool_policy_free(
+				 &pool_policy,
+				 NULL );
+			}
+		}
+		else
+		{
+			SMRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SMRAW_TEST_ASSERT_IS_NULL(
+			 "pool_policy",
+			 pool_policy );
+
+			SMRAW_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SMRAW_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( pool_policy != NULL )
+	{
+		libsmraw_pool_policy_free(
+		 &pool_policy,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_pool_policy_free function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_pool_policy_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libsmraw_pool_policy_free(
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_pool_policy_set_maximum_number_of_open_handles function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_pool_policy_set_maximum_number_of_open_handles(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libsmraw_pool_policy_t *pool_policy = NULL;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libsmraw_pool_policy_initialize(
+	          &pool_policy,
+	          8,
+	          4,
+	          0,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "pool_policy",
+	 pool_policy );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsmraw_pool_policy_set_maximum_number_of_open_handles(
+	          pool_policy,
+	          2,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "pool_policy->maximum_number_of_open_handles",
+	 pool_policy->maximum_number_of_open_handles,
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libsmraw_pool_policy_set_maximum_number_of_open_handles(
+	          NULL,
+	          2,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_pool_policy_set_maximum_number_of_open_handles(
+	          pool_policy,
+	          -1,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmraw_pool_policy_free(
+	          &pool_policy,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "pool_policy",
+	 pool_policy );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( pool_policy != NULL )
+	{
+		libsmraw_pool_policy_free(
+		 &pool_policy,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_pool_policy_get_eviction_candidate function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_pool_policy_get_eviction_candidate(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libsmraw_pool_policy_t *pool_policy = NULL;
+	int access_index                    = 0;
+	int open_index                      = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libsmraw_pool_policy_initialize(
+	          &pool_policy,
+	          4,
+	          3,
+	          0,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "pool_policy",
+	 pool_policy );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	open_index = libsmraw_pool_policy_get_eviction_candidate(
+	              pool_policy );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "open_index",
+	 open_index,
+	 -1 );
+
+	/* Entry 0 is accessed frequently, entry 1 and 2 once with entry 1 accessed first
+	 */
+	for( access_index = 0;
+	     access_index < 8;
+	     access_index++ )
+	{
+		libsmraw_pool_policy_access_entry(
+		 pool_policy,
+		 0 );
+	}
+	libsmraw_pool_policy_access_entry(
+	 pool_policy,
+	 1 );
+
+	libsmraw_pool_policy_access_entry(
+	 pool_policy,
+	 2 );
+
+	pool_policy->open_entries[ 0 ] = 0;
+	pool_policy->open_entries[ 1 ] = 2;
+	pool_policy->open_entries[ 2 ] = 1;
+
+	pool_policy->number_of_open_entries = 3;
+
+	open_index = libsmraw_pool_policy_get_eviction_candidate(
+	              pool_policy );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "open_index",
+	 open_index,
+	 2 );
+
+	/* Entry 1 is now accessed more often than entry 2
+	 */
+	libsmraw_pool_policy_access_entry(
+	 pool_policy,
+	 1 );
+
+	open_index = libsmraw_pool_policy_get_eviction_candidate(
+	              pool_policy );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "open_index",
+	 open_index,
+	 1 );
+
+	/* Test if the access counts are aged
+	 */
+	pool_policy->access_time = pool_policy->aging_interval - 1;
+
+	libsmraw_pool_policy_access_entry(
+	 pool_policy,
+	 2 );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT32(
+	 "pool_policy->entries[ 0 ].access_count",
+	 pool_policy->entries[ 0 ].access_count,
+	 4 );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT32(
+	 "pool_policy->entries[ 2 ].access_count",
+	 pool_policy->entries[ 2 ].access_count,
+	 1 );
+
+	pool_policy->number_of_open_entries = 0;
+
+	/* Clean up
+	 */
+	result = libsmraw_pool_policy_free(
+	          &pool_policy,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "pool_policy",
+	 pool_policy );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( pool_policy != NULL )
+	{
+		libsmraw_pool_policy_free(
+		 &pool_policy,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_pool_policy_acquire function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_pool_policy_acquire(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libsmraw_pool_policy_t *pool_policy = NULL;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libsmraw_pool_policy_initialize(
+	          &pool_policy,
+	          4,
+	          2,
+	          0,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "pool_policy",
+	 pool_policy );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmraw_pool_policy_acquire(
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_pool_policy_acquire(
+	          pool_policy,
+	          NULL,
+	          -1,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_pool_policy_acquire(
+	          pool_policy,
+	          NULL,
+	          4,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmraw_pool_policy_free(
+	          &pool_policy,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "pool_policy",
+	 pool_policy );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( pool_policy != NULL )
+	{
+		libsmraw_pool_policy_free(
+		 &pool_policy,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+
+/* Tests the libsmraw_pool_policy_acquire function with concurrent readers
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_pool_policy_acquire_concurrent(
+     void )
+{
+	uint8_t data[ SMRAW_TEST_POOL_POLICY_NUMBER_OF_ENTRIES ];
+
+	smraw_test_pool_policy_reader_t readers[ SMRAW_TEST_POOL_POLICY_NUMBER_OF_THREADS ];
+	libcthreads_thread_t *threads[ SMRAW_TEST_POOL_POLICY_NUMBER_OF_THREADS ];
+
+	libbfio_handle_t *file_io_handle    = NULL;
+	libbfio_pool_t *file_io_pool        = NULL;
+	libcerror_error_t *error            = NULL;
+	libsmraw_pool_policy_t *pool_policy = NULL;
+	uint64_t number_of_closes           = 0;
+	uint64_t number_of_hits             = 0;
+	uint64_t number_of_opens            = 0;
+	int entry                           = 0;
+	int reader_index                    = 0;
+	int result                          = 0;
+
+	for( reader_index = 0;
+	     reader_index < SMRAW_TEST_POOL_POLICY_NUMBER_OF_THREADS;
+	     reader_index++ )
+	{
+		threads[ reader_index ] = NULL;
+	}
+	/* Initialize test
+	 */
+	result = libbfio_pool_initialize(
+	          &file_io_pool,
+	          SMRAW_TEST_POOL_POLICY_NUMBER_OF_ENTRIES,
+	          LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( entry = 0;
+	     entry < SMRAW_TEST_POOL_POLICY_NUMBER_OF_ENTRIES;
+	     entry++ )
+	{
+		data[ entry ] = (uint8_t) entry;
+
+		result = libbfio_memory_range_initialize(
+		          &file_io_handle,
+		          &error );
+
+		SMRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SMRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_memory_range_set(
+		          file_io_handle,
+		          &( data[ entry ] ),
+		          1,
+		          &error );
+
+		SMRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SMRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_pool_set_handle(
+		          file_io_pool,
+		          entry,
+		          file_io_handle,
+		          LIBBFIO_OPEN_READ,
+		          &error );
+
+		SMRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SMRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		file_io_handle = NULL;
+	}
+	result = libsmraw_pool_policy_initialize(
+	          &pool_policy,
+	          SMRAW_TEST_POOL_POLICY_NUMBER_OF_ENTRIES,
+	          SMRAW_TEST_POOL_POLICY_MAXIMUM_NUMBER_OF_OPEN_HANDLES,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "pool_policy",
+	 pool_policy );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( reader_index = 0;
+	     reader_index < SMRAW_TEST_POOL_POLICY_NUMBER_OF_THREADS;
+	     reader_index++ )
+	{
+		readers[ reader_index ].pool_policy                    = pool_policy;
+		readers[ reader_index ].file_io_pool                   = file_io_pool;
+		readers[ reader_index ].reader_index                   = reader_index;
+		readers[ reader_index ].maximum_number_of_open_handles = 0;
+		readers[ reader_index ].result                         = 0;
+
+		result = libcthreads_thread_create(
+		          &( threads[ reader_index ] ),
+		          NULL,
+		          (int (*)(void *)) &smraw_test_pool_policy_reader_thread_function,
+		          (void *) &( readers[ reader_index ] ),
+		          &error );
+
+		SMRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SMRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( reader_index = 0;
+	     reader_index < SMRAW_TEST_POOL_POLICY_NUMBER_OF_THREADS;
+	     reader_index++ )
+	{
+		result = libcthreads_thread_join(
+		          &( threads[ reader_index ] ),
+		          &error );
+
+		SMRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SMRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( reader_index = 0;
+	     reader_index < SMRAW_TEST_POOL_POLICY_NUMBER_OF_THREADS;
+	     reader_index++ )
+	{
+		SMRAW_TEST_ASSERT_EQUAL_INT(
+		 "readers[ reader_index ].result",
+		 readers[ reader_index ].result,
+		 1 );
+
+		SMRAW_TEST_ASSERT_LESS_THAN_INT(
+		 "readers[ reader_index ].maximum_number_of_open_handles",
+		 readers[ reader_index ].maximum_number_of_open_handles,
+		 SMRAW_TEST_POOL_POLICY_MAXIMUM_NUMBER_OF_OPEN_HANDLES + 1 );
+	}
+	result = smraw_test_pool_policy_get_number_of_open_handles(
+	          file_io_pool );
+
+	SMRAW_TEST_ASSERT_LESS_THAN_INT(
+	 "result",
+	 result,
+	 SMRAW_TEST_POOL_POLICY_MAXIMUM_NUMBER_OF_OPEN_HANDLES + 1 );
+
+	result = libsmraw_pool_policy_get_statistics(
+	          pool_policy,
+	          &number_of_hits,
+	          &number_of_opens,
+	          &number_of_closes,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_hits + number_of_opens",
+	 number_of_hits + number_of_opens,
+	 (uint64_t) SMRAW_TEST_POOL_POLICY_NUMBER_OF_THREADS * SMRAW_TEST_POOL_POLICY_NUMBER_OF_ITERATIONS );
+
+	/* Clean up
+	 */
+	result = libsmraw_pool_policy_free(
+	          &pool_policy,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_free(
+	          &file_io_pool,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( reader_index = 0;
+	     reader_index < SMRAW_TEST_POOL_POLICY_NUMBER_OF_THREADS;
+	     reader_index++ )
+	{
+		if( threads[ reader_index ] != NULL )
+		{
+			libcthreads_thread_join(
+			 &( threads[ reader_index ] ),
+			 NULL );
+		}
+	}
+	if( pool_policy != NULL )
+	{
+		libsmraw_pool_policy_free(
+		 &pool_policy,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &file_io_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT ) */
+
+/* Tests the libsmraw_pool_policy_get_statistics function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_pool_policy_get_statistics(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libsmraw_pool_policy_t *pool_policy = NULL;
+	uint64_t number_of_closes           = 0;
+	uint64_t number_of_hits             = 0;
+	uint64_t number_of_opens            = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libsmraw_pool_policy_initialize(
+	          &pool_policy,
+	          4,
+	          2,
+	          0,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "pool_policy",
+	 pool_policy );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsmraw_pool_policy_get_statistics(
+	          pool_policy,
+	          &number_of_hits,
+	          &number_of_opens,
+	          &number_of_closes,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_hits",
+	 number_of_hits,
+	 (uint64_t) 0 );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_opens",
+	 number_of_opens,
+	 (uint64_t) 0 );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_closes",
+	 number_of_closes,
+	 (uint64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libsmraw_pool_policy_get_statistics(
+	          NULL,
+	          &number_of_hits,
+	          &number_of_opens,
+	          &number_of_closes,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_pool_policy_get_statistics(
+	          pool_policy,
+	          NULL,
+	          &number_of_opens,
+	          &number_of_closes,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_pool_policy_get_statistics(
+	          pool_policy,
+	          &number_of_hits,
+	          NULL,
+	          &number_of_closes,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_pool_policy_get_statistics(
+	          pool_policy,
+	          &number_of_hits,
+	          &number_of_opens,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmraw_pool_policy_free(
+	          &pool_policy,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "pool_policy",
+	 pool_policy );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( pool_policy != NULL )
+	{
+		libsmraw_pool_policy_free(
+		 &pool_policy,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SMRAW_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SMRAW_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SMRAW_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SMRAW_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SMRAW_TEST_UNREFERENCED_PARAMETER( argc )
+	SMRAW_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT )
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_pool_policy_initialize",
+	 smraw_test_pool_policy_initialize );
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_pool_policy_free",
+	 smraw_test_pool_policy_free );
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_pool_policy_set_maximum_number_of_open_handles",
+	 smraw_test_pool_policy_set_maximum_number_of_open_handles );
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_pool_policy_get_eviction_candidate",
+	 smraw_test_pool_policy_get_eviction_candidate );
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_pool_policy_acquire",
+	 smraw_test_pool_policy_acquire );
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_pool_policy_acquire_concurrent",
+	 smraw_test_pool_policy_acquire_concurrent );
+
+#endif /* defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT ) */
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_pool_policy_get_statistics",
+	 smraw_test_pool_policy_get_statistics );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,654 @@
+/*
+ * Library read_ahead type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "smraw_test_libcerror.h"
+#include "smraw_test_libsmraw.h"
+#include "smraw_test_macros.h"
+#include "smraw_test_memory.h"
+#include "smraw_test_unused.h"
+
+#include "../libsmraw/libsmraw_read_ahead.h"
+
+#if defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT )
+
+#define SMRAW_TEST_READ_AHEAD_MEDIA_SIZE	4096
+
+/* Test read function that returns the low byte of the offset as data
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t smraw_test_read_ahead_read_function(
+         intptr_t *data_handle SMRAW_TEST_ATTRIBUTE_UNUSED,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "smraw_test_read_ahead_read_function";
+	size_t buffer_offset  = 0;
+
+	SMRAW_TEST_UNREFERENCED_PARAMETER( data_handle )
+
+	if( ( offset < 0 )
+	 || ( offset > SMRAW_TEST_READ_AHEAD_MEDIA_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) ( SMRAW_TEST_READ_AHEAD_MEDIA_SIZE - offset ) )
+	{
+		buffer_size = (size_t) ( SMRAW_TEST_READ_AHEAD_MEDIA_SIZE - offset );
+	}
+	for( buffer_offset = 0;
+	     buffer_offset < buffer_size;
+	     buffer_offset++ )
+	{
+		( (uint8_t *) buffer )[ buffer_offset ] = (uint8_t) ( ( offset + buffer_offset ) & 0xff );
+	}
+	return( (ssize_t) buffer_size );
+}
+
+/* Tests the libsmraw_read_ahead_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_read_ahead_initialize(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libsmraw_read_ahead_t *read_ahead = NULL;
+	int result                        = 0;
+
+#if defined( HAVE_SMRAW_TEST_MEMORY )
+	int number_of_malloc_fail_tests   = 2;
+	int test_number                   = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libsmraw_read_ahead_initialize(
+	          &read_ahead,
+	          1024,
+	          &smraw_test_read_ahead_read_function,
+	          &smraw_test_read_ahead_read_function,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "read_ahead",
+	 read_ahead );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_read_ahead_free(
+	          &read_ahead,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "read_ahead",
+	 read_ahead );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmraw_read_ahead_initialize(
+	          NULL,
+	          1024,
+	          &smraw_test_read_ahead_read_function,
+	          &smraw_test_read_ahead_read_function,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_ahead = (libsmraw_read_ahead_t *) 0x12345678UL;
+
+	result = libsmraw_read_ahead_initialize(
+	          &read_ahead,
+	          1024,
+	          &smraw_test_read_ahead_read_function,
+	          &smraw_test_read_ahead_read_function,
+	          NULL,
+	          &error );
+
+	read_ahead = NULL;
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_read_ahead_initialize(
+	          &read_ahead,
+	          0,
+	          &smraw_test_read_ahead_read_function,
+	          &smraw_test_read_ahead_read_function,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_read_ahead_initialize(
+	          &read_ahead,
+	          1024,
+	          NULL,
+	          &smraw_test_read_ahead_read_function,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_read_ahead_initialize(
+	          &read_ahead,
+	          1024,
+	          &smraw_test_read_ahead_read_function,
+	          NULL,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SMRAW_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsmraw_read_ahead_initialize with malloc failing
+		 */
+		smraw_test_malloc_attempts_before_fail = test_number;
+
+		result = libsmraw_read_ahead_initialize(
+		          &read_ahead,
+		          1024,
+		          &smraw_test_read_ahead_read_function,
+		          &smraw_test_read_ahead_read_function,
+		          NULL,
+		          &error );
+
+		if( smraw_test_malloc_attempts_before_fail != -1 )
+		{
+			smraw_test_malloc_attempts_before_fail = -1;
+
+			if( read_ahead != NULL )
+			{
+				libsmraw_read_ahead_free(
+				 &read_ahead,
+				 NULL );
+			}
+		}
+		else
+		{
+			SMRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SMRAW_TEST_ASSERT_IS_NULL(
+			 "read_ahead",
+			 read_ahead );
+
+			SMRAW_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SMRAW_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_ahead != NULL )
+	{
+		libsmraw_read_ahead_free(
+		 &read_ahead,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_read_ahead_free function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_read_ahead_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libsmraw_read_ahead_free(
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_read_ahead_read_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_read_ahead_read_buffer(
+     void )
+{
+	uint8_t buffer[ 2048 ];
+
+	libcerror_error_t *error          = NULL;
+	libsmraw_read_ahead_t *read_ahead = NULL;
+	off64_t offset                    = 0;
+	size_t buffer_offset              = 0;
+	ssize_t read_count                = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libsmraw_read_ahead_initialize(
+	          &read_ahead,
+	          1000,
+	          &smraw_test_read_ahead_read_function,
+	          &smraw_test_read_ahead_read_function,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "read_ahead",
+	 read_ahead );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test sequential reads that cross window boundaries
+	 */
+	for( offset = 0;
+	     offset < SMRAW_TEST_READ_AHEAD_MEDIA_SIZE;
+	     offset += 96 )
+	{
+		read_count = libsmraw_read_ahead_read_buffer(
+		              read_ahead,
+		              buffer,
+		              96,
+		              offset,
+		              SMRAW_TEST_READ_AHEAD_MEDIA_SIZE,
+		              &error );
+
+		SMRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( ( offset + 96 ) > SMRAW_TEST_READ_AHEAD_MEDIA_SIZE )
+		{
+			SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+			 "read_count",
+			 read_count,
+			 (ssize_t) ( SMRAW_TEST_READ_AHEAD_MEDIA_SIZE - offset ) );
+		}
+		else
+		{
+			SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+			 "read_count",
+			 read_count,
+			 (ssize_t) 96 );
+		}
+		for( buffer_offset = 0;
+		     buffer_offset < (size_t) read_count;
+		     buffer_offset++ )
+		{
+			SMRAW_TEST_ASSERT_EQUAL_UINT8(
+			 "buffer[ buffer_offset ]",
+			 buffer[ buffer_offset ],
+			 (uint8_t) ( ( offset + buffer_offset ) & 0xff ) );
+		}
+	}
+	/* Test non-sequential and large reads
+	 */
+	read_count = libsmraw_read_ahead_read_buffer(
+	              read_ahead,
+	              buffer,
+	              2048,
+	              1001,
+	              SMRAW_TEST_READ_AHEAD_MEDIA_SIZE,
+	              &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 2048 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "buffer[ 2047 ]",
+	 buffer[ 2047 ],
+	 (uint8_t) ( ( 1001 + 2047 ) & 0xff ) );
+
+	read_count = libsmraw_read_ahead_read_buffer(
+	              read_ahead,
+	              buffer,
+	              16,
+	              7,
+	              SMRAW_TEST_READ_AHEAD_MEDIA_SIZE,
+	              &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "buffer[ 0 ]",
+	 buffer[ 0 ],
+	 (uint8_t) 7 );
+
+	/* Test read beyond the media size
+	 */
+	read_count = libsmraw_read_ahead_read_buffer(
+	              read_ahead,
+	              buffer,
+	              16,
+	              SMRAW_TEST_READ_AHEAD_MEDIA_SIZE,
+	              SMRAW_TEST_READ_AHEAD_MEDIA_SIZE,
+	              &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libsmraw_read_ahead_read_buffer(
+	              NULL,
+	              buffer,
+	              16,
+	              0,
+	              SMRAW_TEST_READ_AHEAD_MEDIA_SIZE,
+	              &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libsmraw_read_ahead_read_buffer(
+	              read_ahead,
+	              NULL,
+	              16,
+	              0,
+	              SMRAW_TEST_READ_AHEAD_MEDIA_SIZE,
+	              &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libsmraw_read_ahead_read_buffer(
+	              read_ahead,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              0,
+	              SMRAW_TEST_READ_AHEAD_MEDIA_SIZE,
+	              &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libsmraw_read_ahead_read_buffer(
+	              read_ahead,
+	              buffer,
+	              16,
+	              -1,
+	              SMRAW_TEST_READ_AHEAD_MEDIA_SIZE,
+	              &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmraw_read_ahead_free(
+	          &read_ahead,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "read_ahead",
+	 read_ahead );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_ahead != NULL )
+	{
+		libsmraw_read_ahead_free(
+		 &read_ahead,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SMRAW_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SMRAW_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SMRAW_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SMRAW_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SMRAW_TEST_UNREFERENCED_PARAMETER( argc )
+	SMRAW_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT )
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_read_ahead_initialize",
+	 smraw_test_read_ahead_initialize );
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_read_ahead_free",
+	 smraw_test_read_ahead_free );
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_read_ahead_read_buffer",
+	 smraw_test_read_ahead_read_buffer );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,492 @@
+/*
+ * Library read_queue type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "smraw_test_libcerror.h"
+#include "smraw_test_libsmraw.h"
+#include "smraw_test_macros.h"
+#include "smraw_test_unused.h"
+
+#include "../libsmraw/libsmraw_read_queue.h"
+
+#if defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT ) && defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+
+#define SMRAW_TEST_READ_QUEUE_NUMBER_OF_READ_REQUESTS	32
+
+/* Test read function that fills the buffer with the low byte of the offset
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t smraw_test_read_queue_read_function(
+         intptr_t *data_handle SMRAW_TEST_ATTRIBUTE_UNUSED,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "smraw_test_read_queue_read_function";
+
+	SMRAW_TEST_UNREFERENCED_PARAMETER( data_handle )
+
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     buffer,
+	     (int) ( offset & 0xff ),
+	     buffer_size ) == NULL )
+	{
+		return( -1 );
+	}
+	return( (ssize_t) buffer_size );
+}
+
+/* Tests the libsmraw_read_queue_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_read_queue_initialize(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libsmraw_read_queue_t *read_queue = NULL;
+	int result                        = 0;
+
+	/* Test regular cases
+	 */
+	result = libsmraw_read_queue_initialize(
+	          &read_queue,
+	          2,
+	          &smraw_test_read_queue_read_function,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "read_queue",
+	 read_queue );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_read_queue_free(
+	          &read_queue,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "read_queue",
+	 read_queue );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmraw_read_queue_initialize(
+	          NULL,
+	          2,
+	          &smraw_test_read_queue_read_function,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_queue = (libsmraw_read_queue_t *) 0x12345678UL;
+
+	result = libsmraw_read_queue_initialize(
+	          &read_queue,
+	          2,
+	          &smraw_test_read_queue_read_function,
+	          NULL,
+	          &error );
+
+	read_queue = NULL;
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_read_queue_initialize(
+	          &read_queue,
+	          0,
+	          &smraw_test_read_queue_read_function,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_read_queue_initialize(
+	          &read_queue,
+	          2,
+	          NULL,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_queue != NULL )
+	{
+		libsmraw_read_queue_free(
+		 &read_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_read_queue_free function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_read_queue_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libsmraw_read_queue_free(
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_read_queue_push and libsmraw_read_queue_wait functions
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_read_queue_push(
+     void )
+{
+	libsmraw_read_request_t read_requests[ SMRAW_TEST_READ_QUEUE_NUMBER_OF_READ_REQUESTS ];
+	uint8_t buffers[ SMRAW_TEST_READ_QUEUE_NUMBER_OF_READ_REQUESTS ][ 64 ];
+
+	libcerror_error_t *error          = NULL;
+	libsmraw_read_queue_t *read_queue = NULL;
+	int read_request_index            = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libsmraw_read_queue_initialize(
+	          &read_queue,
+	          4,
+	          &smraw_test_read_queue_read_function,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "read_queue",
+	 read_queue );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( read_request_index = 0;
+	     read_request_index < SMRAW_TEST_READ_QUEUE_NUMBER_OF_READ_REQUESTS;
+	     read_request_index++ )
+	{
+		read_requests[ read_request_index ].offset      = (off64_t) read_request_index;
+		read_requests[ read_request_index ].buffer      = buffers[ read_request_index ];
+		read_requests[ read_request_index ].buffer_size = 64;
+		read_requests[ read_request_index ].read_count  = 0;
+
+		/* The last request is expected to fail
+		 */
+		if( read_request_index == ( SMRAW_TEST_READ_QUEUE_NUMBER_OF_READ_REQUESTS - 1 ) )
+		{
+			read_requests[ read_request_index ].offset = -1;
+		}
+		result = libsmraw_read_queue_push(
+		          read_queue,
+		          &( read_requests[ read_request_index ] ),
+		          &error );
+
+		SMRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SMRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libsmraw_read_queue_wait(
+	          read_queue,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( read_request_index = 0;
+	     read_request_index < ( SMRAW_TEST_READ_QUEUE_NUMBER_OF_READ_REQUESTS - 1 );
+	     read_request_index++ )
+	{
+		SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_requests[ read_request_index ].read_count,
+		 (ssize_t) 64 );
+
+		SMRAW_TEST_ASSERT_EQUAL_UINT8(
+		 "buffer[ 63 ]",
+		 buffers[ read_request_index ][ 63 ],
+		 (uint8_t) read_request_index );
+	}
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_requests[ SMRAW_TEST_READ_QUEUE_NUMBER_OF_READ_REQUESTS - 1 ].read_count,
+	 (ssize_t) -1 );
+
+	/* Test error cases
+	 */
+	result = libsmraw_read_queue_push(
+	          NULL,
+	          &( read_requests[ 0 ] ),
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_read_queue_push(
+	          read_queue,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_read_queue_wait(
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmraw_read_queue_free(
+	          &read_queue,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "read_queue",
+	 read_queue );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_queue != NULL )
+	{
+		libsmraw_read_queue_free(
+		 &read_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT ) && defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SMRAW_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SMRAW_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SMRAW_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SMRAW_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SMRAW_TEST_UNREFERENCED_PARAMETER( argc )
+	SMRAW_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT ) && defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_read_queue_initialize",
+	 smraw_test_read_queue_initialize );
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_read_queue_free",
+	 smraw_test_read_queue_free );
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_read_queue_push",
+	 smraw_test_read_queue_push );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT ) && defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT ) && defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT ) && defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT ) */
+}
+
@@ -0,0 +1,1856 @@
+/*
+ * Library segment_table type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "smraw_test_libcerror.h"
+#include "smraw_test_libsmraw.h"
+#include "smraw_test_macros.h"
+#include "smraw_test_memory.h"
+#include "smraw_test_unused.h"
+
+#include "../libsmraw/libsmraw_definitions.h"
+#include "../libsmraw/libsmraw_segment_table.h"
+
+#if defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT )
+
+/* Tests the libsmraw_segment_table_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_segment_table_initialize(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libsmraw_segment_table_t *segment_table = NULL;
+	int result                              = 0;
+
+#if defined( HAVE_SMRAW_TEST_MEMORY )
+	int number_of_malloc_fail_tests         = 2;
+	int number_of_memset_fail_tests         = 1;
+	int test_number                         = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libsmraw_segment_table_initialize(
+	          &segment_table,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "segment_table",
+	 segment_table );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_segment_table_free(
+	          &segment_table,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "segment_table",
+	 segment_table );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmraw_segment_table_initialize(
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	segment_table = (libsmraw_segment_table_t *) 0x12345678UL;
+
+	result = libsmraw_segment_table_initialize(
+	          &segment_table,
+	          &error );
+
+	segment_table = NULL;
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SMRAW_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsmraw_segment_table_initialize with malloc failing
+		 */
+		smraw_test_malloc_attempts_before_fail = test_number;
+
+		result = libsmraw_segment_table_initialize(
+		          &segment_table,
+		          &error );
+
+		if( smraw_test_malloc_attempts_before_fail != -1 )
+		{
+			smraw_test_malloc_attempts_before_fail = -1;
+
+			if( segment_table != NULL )
+			{
+				libsmraw_segment_table_free(
+				 &segment_table,
+				 NULL );
+			}
+		}
+		else
+		{
+			SMRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SMRAW_TEST_ASSERT_IS_NULL(
+			 "segment_table",
+			 segment_table );
+
+			SMRAW_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsmraw_segment_table_initialize with memset failing
+		 */
+		smraw_test_memset_attempts_before_fail = test_number;
+
+		result = libsmraw_segment_table_initialize(
+		          &segment_table,
+		          &error );
+
+		if( smraw_test_memset_attempts_before_fail != -1 )
+		{
+			smraw_test_memset_attempts_before_fail = -1;
+
+			if( segment_table != NULL )
+			{
+				libsmraw_segment_table_free(
+				 &segment_table,
+				 NULL );
+			}
+		}
+		else
+		{
+			SMRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SMRAW_TEST_ASSERT_IS_NULL(
+			 "segment_table",
+			 segment_table );
+
+			SMRAW_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SMRAW_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( segment_table != NULL )
+	{
+		libsmraw_segment_table_free(
+		 &segment_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_segment_table_free function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_segment_table_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libsmraw_segment_table_free(
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_segment_table_get_number_of_segments function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_segment_table_get_number_of_segments(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libsmraw_segment_table_t *segment_table = NULL;
+	int number_of_segments                  = 0;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libsmraw_segment_table_initialize(
+	          &segment_table,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "segment_table",
+	 segment_table );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_segment_table_append_segment(
+	          segment_table,
+	          1024,
+	          0,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsmraw_segment_table_get_number_of_segments(
+	          segment_table,
+	          &number_of_segments,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segments",
+	 number_of_segments,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmraw_segment_table_get_number_of_segments(
+	          NULL,
+	          &number_of_segments,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_segment_table_get_number_of_segments(
+	          segment_table,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmraw_segment_table_free(
+	          &segment_table,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "segment_table",
+	 segment_table );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( segment_table != NULL )
+	{
+		libsmraw_segment_table_free(
+		 &segment_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_segment_table_get_size function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_segment_table_get_size(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libsmraw_segment_table_t *segment_table = NULL;
+	size64_t size                           = 0;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libsmraw_segment_table_initialize(
+	          &segment_table,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "segment_table",
+	 segment_table );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsmraw_segment_table_get_size(
+	          segment_table,
+	          &size,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 (uint64_t) size,
+	 (uint64_t) 0 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_segment_table_append_segment(
+	          segment_table,
+	          1024,
+	          0,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmraw_segment_table_append_segment(
+	          segment_table,
+	          512,
+	          0,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmraw_segment_table_get_size(
+	          segment_table,
+	          &size,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 (uint64_t) size,
+	 (uint64_t) 1536 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmraw_segment_table_get_size(
+	          NULL,
+	          &size,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_segment_table_get_size(
+	          segment_table,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmraw_segment_table_free(
+	          &segment_table,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "segment_table",
+	 segment_table );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( segment_table != NULL )
+	{
+		libsmraw_segment_table_free(
+		 &segment_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_segment_table_append_segment function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_segment_table_append_segment(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libsmraw_segment_table_t *segment_table = NULL;
+	int result                              = 0;
+	int segment_index                       = 0;
+
+	/* Initialize test
+	 */
+	result = libsmraw_segment_table_initialize(
+	          &segment_table,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "segment_table",
+	 segment_table );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( segment_index = 0;
+	     segment_index < 1000;
+	     segment_index++ )
+	{
+		result = libsmraw_segment_table_append_segment(
+		          segment_table,
+		          4096,
+		          0,
+		          &error );
+
+		SMRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SMRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "segment_table->number_of_segments",
+	 segment_table->number_of_segments,
+	 1000 );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "segment_table->uniform_segment_size",
+	 (uint64_t) segment_table->uniform_segment_size,
+	 (uint64_t) 4096 );
+
+	/* A smaller last segment keeps the segment size uniform
+	 */
+	result = libsmraw_segment_table_append_segment(
+	          segment_table,
+	          100,
+	          0,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "segment_table->uniform_segment_size",
+	 (uint64_t) segment_table->uniform_segment_size,
+	 (uint64_t) 4096 );
+
+	/* A segment after a smaller segment makes the segment size non-uniform
+	 */
+	result = libsmraw_segment_table_append_segment(
+	          segment_table,
+	          100,
+	          0,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "segment_table->uniform_segment_size",
+	 (uint64_t) segment_table->uniform_segment_size,
+	 (uint64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libsmraw_segment_table_append_segment(
+	          NULL,
+	          4096,
+	          0,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_segment_table_append_segment(
+	          segment_table,
+	          (size64_t) INT64_MAX,
+	          0,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmraw_segment_table_free(
+	          &segment_table,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "segment_table",
+	 segment_table );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( segment_table != NULL )
+	{
+		libsmraw_segment_table_free(
+		 &segment_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_segment_table_get_segment_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_segment_table_get_segment_at_offset(
+     void )
+{
+	size64_t segment_sizes[ 6 ] = { 1000, 0, 24, 4096, 0, 7 };
+
+	libcerror_error_t *error                = NULL;
+	libsmraw_segment_table_t *segment_table = NULL;
+	size64_t segment_size                   = 0;
+	off64_t segment_data_offset             = 0;
+	int result                              = 0;
+	int segment_index                       = 0;
+
+	/* Initialize test
+	 */
+	result = libsmraw_segment_table_initialize(
+	          &segment_table,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "segment_table",
+	 segment_table );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( segment_index = 0;
+	     segment_index < 6;
+	     segment_index++ )
+	{
+		result = libsmraw_segment_table_append_segment(
+		          segment_table,
+		          segment_sizes[ segment_index ],
+		          0,
+		          &error );
+
+		SMRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SMRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases with segments of different sizes
+	 */
+	result = libsmraw_segment_table_get_segment_at_offset(
+	          segment_table,
+	          999,
+	          &segment_index,
+	          &segment_data_offset,
+	          &segment_size,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "segment_index",
+	 segment_index,
+	 0 );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT64(
+	 "segment_data_offset",
+	 (int64_t) segment_data_offset,
+	 (int64_t) 999 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The empty segment 1 is skipped
+	 */
+	result = libsmraw_segment_table_get_segment_at_offset(
+	          segment_table,
+	          1000,
+	          &segment_index,
+	          &segment_data_offset,
+	          &segment_size,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "segment_index",
+	 segment_index,
+	 2 );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT64(
+	 "segment_data_offset",
+	 (int64_t) segment_data_offset,
+	 (int64_t) 0 );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "segment_size",
+	 (uint64_t) segment_size,
+	 (uint64_t) 24 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_segment_table_get_segment_at_offset(
+	          segment_table,
+	          1024 + 4096 + 3,
+	          &segment_index,
+	          &segment_data_offset,
+	          &segment_size,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "segment_index",
+	 segment_index,
+	 5 );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT64(
+	 "segment_data_offset",
+	 (int64_t) segment_data_offset,
+	 (int64_t) 3 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test offset beyond the last segment
+	 */
+	result = libsmraw_segment_table_get_segment_at_offset(
+	          segment_table,
+	          1024 + 4096 + 7,
+	          &segment_index,
+	          &segment_data_offset,
+	          &segment_size,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases with segments of uniform size
+	 */
+	result = libsmraw_segment_table_free(
+	          &segment_table,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmraw_segment_table_initialize(
+	          &segment_table,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	for( segment_index = 0;
+	     segment_index < 100;
+	     segment_index++ )
+	{
+		result = libsmraw_segment_table_append_segment(
+		          segment_table,
+		          ( segment_index < 99 ) ? 512 : 100,
+		          0,
+		          &error );
+
+		SMRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	result = libsmraw_segment_table_get_segment_at_offset(
+	          segment_table,
+	          ( 512 * 42 ) + 17,
+	          &segment_index,
+	          &segment_data_offset,
+	          &segment_size,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "segment_index",
+	 segment_index,
+	 42 );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT64(
+	 "segment_data_offset",
+	 (int64_t) segment_data_offset,
+	 (int64_t) 17 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_segment_table_get_segment_at_offset(
+	          segment_table,
+	          ( 512 * 99 ) + 99,
+	          &segment_index,
+	          &segment_data_offset,
+	          &segment_size,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "segment_index",
+	 segment_index,
+	 99 );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "segment_size",
+	 (uint64_t) segment_size,
+	 (uint64_t) 100 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmraw_segment_table_get_segment_at_offset(
+	          NULL,
+	          0,
+	          &segment_index,
+	          &segment_data_offset,
+	          &segment_size,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_segment_table_get_segment_at_offset(
+	          segment_table,
+	          -1,
+	          &segment_index,
+	          &segment_data_offset,
+	          &segment_size,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_segment_table_get_segment_at_offset(
+	          segment_table,
+	          0,
+	          NULL,
+	          &segment_data_offset,
+	          &segment_size,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_segment_table_get_segment_at_offset(
+	          segment_table,
+	          0,
+	          &segment_index,
+	          NULL,
+	          &segment_size,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_segment_table_get_segment_at_offset(
+	          segment_table,
+	          0,
+	          &segment_index,
+	          &segment_data_offset,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmraw_segment_table_free(
+	          &segment_table,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "segment_table",
+	 segment_table );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( segment_table != NULL )
+	{
+		libsmraw_segment_table_free(
+		 &segment_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_segment_table_get_segment_flags function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_segment_table_get_segment_flags(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libsmraw_segment_table_t *segment_table = NULL;
+	uint8_t segment_flags                   = 0;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libsmraw_segment_table_initialize(
+	          &segment_table,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "segment_table",
+	 segment_table );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_segment_table_append_segment(
+	          segment_table,
+	          1024,
+	          0,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_segment_table_append_segment(
+	          segment_table,
+	          1024,
+	          LIBSMRAW_SEGMENT_FLAG_SIZE_INFERRED,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "segment_table->has_inferred_segment_sizes",
+	 segment_table->has_inferred_segment_sizes,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = libsmraw_segment_table_get_segment_flags(
+	          segment_table,
+	          0,
+	          &segment_flags,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "segment_flags",
+	 segment_flags,
+	 0 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_segment_table_get_segment_flags(
+	          segment_table,
+	          1,
+	          &segment_flags,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "segment_flags",
+	 segment_flags,
+	 LIBSMRAW_SEGMENT_FLAG_SIZE_INFERRED );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmraw_segment_table_get_segment_flags(
+	          NULL,
+	          0,
+	          &segment_flags,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_segment_table_get_segment_flags(
+	          segment_table,
+	          -1,
+	          &segment_flags,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_segment_table_get_segment_flags(
+	          segment_table,
+	          2,
+	          &segment_flags,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_segment_table_get_segment_flags(
+	          segment_table,
+	          0,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmraw_segment_table_free(
+	          &segment_table,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "segment_table",
+	 segment_table );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( segment_table != NULL )
+	{
+		libsmraw_segment_table_free(
+		 &segment_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_segment_table_set_segment_flags function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_segment_table_set_segment_flags(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libsmraw_segment_table_t *segment_table = NULL;
+	uint8_t segment_flags                   = 0;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libsmraw_segment_table_initialize(
+	          &segment_table,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "segment_table",
+	 segment_table );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_segment_table_append_segment(
+	          segment_table,
+	          1024,
+	          0,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_segment_table_append_segment(
+	          segment_table,
+	          1024,
+	          LIBSMRAW_SEGMENT_FLAG_SIZE_INFERRED,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "segment_table->has_inferred_segment_sizes",
+	 segment_table->has_inferred_segment_sizes,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = libsmraw_segment_table_set_segment_flags(
+	          segment_table,
+	          1,
+	          0,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_segment_table_get_segment_flags(
+	          segment_table,
+	          1,
+	          &segment_flags,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "segment_flags",
+	 segment_flags,
+	 0 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmraw_segment_table_set_segment_flags(
+	          NULL,
+	          0,
+	          0,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_segment_table_set_segment_flags(
+	          segment_table,
+	          -1,
+	          0,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_segment_table_set_segment_flags(
+	          segment_table,
+	          2,
+	          0,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmraw_segment_table_free(
+	          &segment_table,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "segment_table",
+	 segment_table );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( segment_table != NULL )
+	{
+		libsmraw_segment_table_free(
+		 &segment_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_segment_table_verify_segment_size function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_segment_table_verify_segment_size(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libsmraw_segment_table_t *segment_table = NULL;
+	uint8_t segment_flags                   = 0;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libsmraw_segment_table_initialize(
+	          &segment_table,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "segment_table",
+	 segment_table );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_segment_table_append_segment(
+	          segment_table,
+	          1024,
+	          0,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_segment_table_append_segment(
+	          segment_table,
+	          1024,
+	          LIBSMRAW_SEGMENT_FLAG_SIZE_INFERRED,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsmraw_segment_table_verify_segment_size(
+	          segment_table,
+	          0,
+	          512,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_segment_table_verify_segment_size(
+	          segment_table,
+	          1,
+	          512,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_segment_table_get_segment_flags(
+	          segment_table,
+	          1,
+	          &segment_flags,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "segment_flags",
+	 segment_flags,
+	 LIBSMRAW_SEGMENT_FLAG_SIZE_INFERRED );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_segment_table_verify_segment_size(
+	          segment_table,
+	          1,
+	          1024,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_segment_table_get_segment_flags(
+	          segment_table,
+	          1,
+	          &segment_flags,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT8(
+	 "segment_flags",
+	 segment_flags,
+	 0 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmraw_segment_table_verify_segment_size(
+	          NULL,
+	          0,
+	          1024,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_segment_table_verify_segment_size(
+	          segment_table,
+	          -1,
+	          1024,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_segment_table_verify_segment_size(
+	          segment_table,
+	          2,
+	          1024,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmraw_segment_table_free(
+	          &segment_table,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "segment_table",
+	 segment_table );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( segment_table != NULL )
+	{
+		libsmraw_segment_table_free(
+		 &segment_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SMRAW_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SMRAW_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SMRAW_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SMRAW_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SMRAW_TEST_UNREFERENCED_PARAMETER( argc )
+	SMRAW_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT )
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_segment_table_initialize",
+	 smraw_test_segment_table_initialize );
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_segment_table_free",
+	 smraw_test_segment_table_free );
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_segment_table_get_number_of_segments",
+	 smraw_test_segment_table_get_number_of_segments );
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_segment_table_get_size",
+	 smraw_test_segment_table_get_size );
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_segment_table_append_segment",
+	 smraw_test_segment_table_append_segment );
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_segment_table_get_segment_at_offset",
+	 smraw_test_segment_table_get_segment_at_offset );
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_segment_table_get_segment_flags",
+	 smraw_test_segment_table_get_segment_flags );
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_segment_table_set_segment_flags",
+	 smraw_test_segment_table_set_segment_flags );
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_segment_table_verify_segment_size",
+	 smraw_test_segment_table_verify_segment_size );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,1685 @@
+/*
+ * Tools digest hash functions test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <time.h>
+
+#include "smraw_test_getopt.h"
+#include "smraw_test_libcerror.h"
+#include "smraw_test_macros.h"
+#include "smraw_test_unused.h"
+
+#include "../smrawtools/digest_hash.h"
+#include "../smrawtools/smrawtools_libhmac.h"
+
+#define SMRAW_TEST_TOOLS_DIGEST_HASH_MAXIMUM_HASH_SIZE		32
+#define SMRAW_TEST_TOOLS_DIGEST_HASH_BENCHMARK_BUFFER_SIZE	( 1024 * 1024 )
+#define SMRAW_TEST_TOOLS_DIGEST_HASH_BENCHMARK_ITERATIONS	256
+
+typedef struct smraw_test_tools_digest_hash_type smraw_test_tools_digest_hash_type_t;
+
+struct smraw_test_tools_digest_hash_type
+{
+	/* The name
+	 */
+	const char *name;
+
+	/* The backend
+	 */
+	int backend;
+
+	/* The hash size
+	 */
+	size_t hash_size;
+
+	/* The initialize function
+	 */
+	int (*initialize)(
+	       intptr_t **context,
+	       libcerror_error_t **error );
+
+	/* The initialize with backend function
+	 * This function is optional and used instead of the initialize function if set
+	 */
+	int (*initialize_with_backend)(
+	       intptr_t **context,
+	       int backend,
+	       libcerror_error_t **error );
+
+	/* The update function
+	 */
+	int (*update)(
+	       intptr_t *context,
+	       const uint8_t *buffer,
+	       size_t size,
+	       libcerror_error_t **error );
+
+	/* The finalize function
+	 */
+	int (*finalize)(
+	       intptr_t *context,
+	       uint8_t *hash,
+	       size_t hash_size,
+	       libcerror_error_t **error );
+
+	/* The free function
+	 */
+	int (*free)(
+	       intptr_t **context,
+	       libcerror_error_t **error );
+};
+
+smraw_test_tools_digest_hash_type_t smraw_test_tools_digest_hash_md5 = {
+	"MD5",
+	DIGEST_HASH_BACKEND_GENERIC,
+	LIBHMAC_MD5_HASH_SIZE,
+	(int (*)(intptr_t **, libcerror_error_t **)) &libhmac_md5_initialize,
+	NULL,
+	(int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &libhmac_md5_update,
+	(int (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) &libhmac_md5_finalize,
+	(int (*)(intptr_t **, libcerror_error_t **)) &libhmac_md5_free };
+
+smraw_test_tools_digest_hash_type_t smraw_test_tools_digest_hash_sha1 = {
+	"SHA1",
+	DIGEST_HASH_BACKEND_GENERIC,
+	LIBHMAC_SHA1_HASH_SIZE,
+	(int (*)(intptr_t **, libcerror_error_t **)) &libhmac_sha1_initialize,
+	NULL,
+	(int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &libhmac_sha1_update,
+	(int (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) &libhmac_sha1_finalize,
+	(int (*)(intptr_t **, libcerror_error_t **)) &libhmac_sha1_free };
+
+smraw_test_tools_digest_hash_type_t smraw_test_tools_digest_hash_sha256 = {
+	"SHA256",
+	DIGEST_HASH_BACKEND_GENERIC,
+	LIBHMAC_SHA256_HASH_SIZE,
+	(int (*)(intptr_t **, libcerror_error_t **)) &libhmac_sha256_initialize,
+	NULL,
+	(int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &libhmac_sha256_update,
+	(int (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) &libhmac_sha256_finalize,
+	(int (*)(intptr_t **, libcerror_error_t **)) &libhmac_sha256_free };
+
+smraw_test_tools_digest_hash_type_t smraw_test_tools_digest_hash_sha1_generic = {
+	"SHA1 generic",
+	DIGEST_HASH_BACKEND_GENERIC,
+	LIBHMAC_SHA1_HASH_SIZE,
+	(int (*)(intptr_t **, libcerror_error_t **)) &digest_hash_sha1_initialize,
+	(int (*)(intptr_t **, int, libcerror_error_t **)) &digest_hash_sha1_initialize_with_backend,
+	(int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &digest_hash_sha1_update,
+	(int (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) &digest_hash_sha1_finalize,
+	(int (*)(intptr_t **, libcerror_error_t **)) &digest_hash_sha1_free };
+
+smraw_test_tools_digest_hash_type_t smraw_test_tools_digest_hash_sha1_sha_ni = {
+	"SHA1 SHA-NI",
+	DIGEST_HASH_BACKEND_SHA_NI,
+	LIBHMAC_SHA1_HASH_SIZE,
+	(int (*)(intptr_t **, libcerror_error_t **)) &digest_hash_sha1_initialize,
+	(int (*)(intptr_t **, int, libcerror_error_t **)) &digest_hash_sha1_initialize_with_backend,
+	(int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &digest_hash_sha1_update,
+	(int (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) &digest_hash_sha1_finalize,
+	(int (*)(intptr_t **, libcerror_error_t **)) &digest_hash_sha1_free };
+
+smraw_test_tools_digest_hash_type_t smraw_test_tools_digest_hash_sha256_generic = {
+	"SHA256 generic",
+	DIGEST_HASH_BACKEND_GENERIC,
+	LIBHMAC_SHA256_HASH_SIZE,
+	(int (*)(intptr_t **, libcerror_error_t **)) &digest_hash_sha256_initialize,
+	(int (*)(intptr_t **, int, libcerror_error_t **)) &digest_hash_sha256_initialize_with_backend,
+	(int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &digest_hash_sha256_update,
+	(int (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) &digest_hash_sha256_finalize,
+	(int (*)(intptr_t **, libcerror_error_t **)) &digest_hash_sha256_free };
+
+smraw_test_tools_digest_hash_type_t smraw_test_tools_digest_hash_sha256_sha_ni = {
+	"SHA256 SHA-NI",
+	DIGEST_HASH_BACKEND_SHA_NI,
+	LIBHMAC_SHA256_HASH_SIZE,
+	(int (*)(intptr_t **, libcerror_error_t **)) &digest_hash_sha256_initialize,
+	(int (*)(intptr_t **, int, libcerror_error_t **)) &digest_hash_sha256_initialize_with_backend,
+	(int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &digest_hash_sha256_update,
+	(int (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) &digest_hash_sha256_finalize,
+	(int (*)(intptr_t **, libcerror_error_t **)) &digest_hash_sha256_free };
+
+smraw_test_tools_digest_hash_type_t smraw_test_tools_digest_hash_sha256_avx2 = {
+	"SHA256 AVX2 single buffer",
+	DIGEST_HASH_BACKEND_AVX2,
+	LIBHMAC_SHA256_HASH_SIZE,
+	(int (*)(intptr_t **, libcerror_error_t **)) &digest_hash_sha256_initialize,
+	(int (*)(intptr_t **, int, libcerror_error_t **)) &digest_hash_sha256_initialize_with_backend,
+	(int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &digest_hash_sha256_update,
+	(int (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) &digest_hash_sha256_finalize,
+	(int (*)(intptr_t **, libcerror_error_t **)) &digest_hash_sha256_free };
+
+/* The known answers for "abc"
+ */
+uint8_t smraw_test_tools_digest_hash_md5_abc[ 16 ] = {
+	0x90, 0x01, 0x50, 0x98, 0x3c, 0xd2, 0x4f, 0xb0, 0xd6, 0x96, 0x3f, 0x7d, 0x28, 0xe1, 0x7f, 0x72 };
+
+uint8_t smraw_test_tools_digest_hash_sha1_abc[ 20 ] = {
+	0xa9, 0x99, 0x3e, 0x36, 0x47, 0x06, 0x81, 0x6a, 0xba, 0x3e, 0x25, 0x71, 0x78, 0x50, 0xc2, 0x6c,
+	0x9c, 0xd0, 0xd8, 0x9d };
+
+uint8_t smraw_test_tools_digest_hash_sha256_abc[ 32 ] = {
+	0xba, 0x78, 0x16, 0xbf, 0x8f, 0x01, 0xcf, 0xea, 0x41, 0x41, 0x40, 0xde, 0x5d, 0xae, 0x22, 0x23,
+	0xb0, 0x03, 0x61, 0xa3, 0x96, 0x17, 0x7a, 0x9c, 0xb4, 0x10, 0xff, 0x61, 0xf2, 0x00, 0x15, 0xad };
+
+/* The known answers for 1000000 times "a"
+ */
+uint8_t smraw_test_tools_digest_hash_md5_million_a[ 16 ] = {
+	0x77, 0x07, 0xd6, 0xae, 0x4e, 0x02, 0x7c, 0x70, 0xee, 0xa2, 0xa9, 0x35, 0xc2, 0x29, 0x6f, 0x21 };
+
+uint8_t smraw_test_tools_digest_hash_sha1_million_a[ 20 ] = {
+	0x34, 0xaa, 0x97, 0x3c, 0xd4, 0xc4, 0xda, 0xa4, 0xf6, 0x1e, 0xeb, 0x2b, 0xdb, 0xad, 0x27, 0x31,
+	0x65, 0x34, 0x01, 0x6f };
+
+uint8_t smraw_test_tools_digest_hash_sha256_million_a[ 32 ] = {
+	0xcd, 0xc7, 0x6e, 0x5c, 0x99, 0x14, 0xfb, 0x92, 0x81, 0xa1, 0xc7, 0xe2, 0x84, 0xd7, 0x3e, 0x67,
+	0xf1, 0x80, 0x9a, 0x48, 0xa4, 0x97, 0x20, 0x0e, 0x04, 0x6d, 0x39, 0xcc, 0xc7, 0x11, 0x2c, 0xd0 };
+
+/* Creates a context of a digest hash type
+ * Returns 1 if successful or -1 on error
+ */
+int smraw_test_tools_digest_hash_initialize_context(
+     smraw_test_tools_digest_hash_type_t *digest_hash_type,
+     intptr_t **context,
+     libcerror_error_t **error )
+{
+	if( digest_hash_type->initialize_with_backend != NULL )
+	{
+		return( digest_hash_type->initialize_with_backend(
+		         context,
+		         digest_hash_type->backend,
+		         error ) );
+	}
+	return( digest_hash_type->initialize(
+	         context,
+	         error ) );
+}
+
+/* Calculates a digest hash
+ * The data is processed in chunks of varying sizes to test the handling of partial blocks
+ * Returns 1 if successful or -1 on error
+ */
+int smraw_test_tools_digest_hash_calculate(
+     smraw_test_tools_digest_hash_type_t *digest_hash_type,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	intptr_t *context  = NULL;
+	size_t chunk_size  = 0;
+	size_t data_offset = 0;
+
+	if( smraw_test_tools_digest_hash_initialize_context(
+	     digest_hash_type,
+	     &context,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	while( data_offset < data_size )
+	{
+		chunk_size = ( data_offset % 257 ) + 1;
+
+		if( chunk_size > ( data_size - data_offset ) )
+		{
+			chunk_size = data_size - data_offset;
+		}
+		if( digest_hash_type->update(
+		     context,
+		     &( data[ data_offset ] ),
+		     chunk_size,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		data_offset += chunk_size;
+	}
+	if( digest_hash_type->finalize(
+	     context,
+	     hash,
+	     hash_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( digest_hash_type->free(
+	     &context,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( context != NULL )
+	{
+		digest_hash_type->free(
+		 &context,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the digest_hash_copy_to_string function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_tools_digest_hash_copy_to_string(
+     void )
+{
+	system_character_t string[ 33 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = digest_hash_copy_to_string(
+	          smraw_test_tools_digest_hash_md5_abc,
+	          16,
+	          string,
+	          33,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = system_string_compare(
+	          string,
+	          _SYSTEM_STRING( "900150983cd24fb0d6963f7d28e17f72" ),
+	          33 );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = digest_hash_copy_to_string(
+	          NULL,
+	          16,
+	          string,
+	          33,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_hash_copy_to_string(
+	          smraw_test_tools_digest_hash_md5_abc,
+	          16,
+	          NULL,
+	          33,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_hash_copy_to_string(
+	          smraw_test_tools_digest_hash_md5_abc,
+	          16,
+	          string,
+	          32,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the digest_hash_copy_from_string function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_tools_digest_hash_copy_from_string(
+     void )
+{
+	uint8_t digest_hash[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = digest_hash_copy_from_string(
+	          digest_hash,
+	          16,
+	          "900150983cd24fb0d6963f7d28e17f72",
+	          32,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          digest_hash,
+	          smraw_test_tools_digest_hash_md5_abc,
+	          16 );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = digest_hash_copy_from_string(
+	          digest_hash,
+	          16,
+	          "900150983CD24FB0D6963F7D28E17F72",
+	          32,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          digest_hash,
+	          smraw_test_tools_digest_hash_md5_abc,
+	          16 );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = digest_hash_copy_from_string(
+	          NULL,
+	          16,
+	          "900150983cd24fb0d6963f7d28e17f72",
+	          32,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_hash_copy_from_string(
+	          digest_hash,
+	          16,
+	          NULL,
+	          32,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_hash_copy_from_string(
+	          digest_hash,
+	          16,
+	          "900150983cd24fb0d6963f7d28e17f7",
+	          31,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_hash_copy_from_string(
+	          digest_hash,
+	          16,
+	          "900150983cd24fb0d6963f7d28e17f7g",
+	          32,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the digest_hash_sha1_initialize_with_backend and digest_hash_sha256_initialize_with_backend functions
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_tools_digest_hash_initialize_with_backend(
+     void )
+{
+	digest_hash_sha1_context_t *sha1_context     = NULL;
+	digest_hash_sha256_context_t *sha256_context = NULL;
+	libcerror_error_t *error                     = NULL;
+	int result                                   = 0;
+
+	/* Test regular cases
+	 */
+	result = digest_hash_sha1_initialize_with_backend(
+	          &sha1_context,
+	          DIGEST_HASH_BACKEND_DEFAULT,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "sha1_context",
+	 sha1_context );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "sha1_context->backend",
+	 sha1_context->backend,
+	 digest_hash_sha1_get_default_backend() );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_hash_sha1_free(
+	          &sha1_context,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_hash_sha256_initialize_with_backend(
+	          &sha256_context,
+	          DIGEST_HASH_BACKEND_DEFAULT,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "sha256_context",
+	 sha256_context );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "sha256_context->backend",
+	 sha256_context->backend,
+	 digest_hash_sha256_get_default_backend() );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_hash_sha256_free(
+	          &sha256_context,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = digest_hash_sha1_initialize_with_backend(
+	          NULL,
+	          DIGEST_HASH_BACKEND_DEFAULT,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* There is no AVX2 backend for SHA1
+	 */
+	result = digest_hash_sha1_initialize_with_backend(
+	          &sha1_context,
+	          DIGEST_HASH_BACKEND_AVX2,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "sha1_context",
+	 sha1_context );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_hash_sha256_initialize_with_backend(
+	          NULL,
+	          DIGEST_HASH_BACKEND_DEFAULT,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_hash_sha256_initialize_with_backend(
+	          &sha256_context,
+	          -1,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "sha256_context",
+	 sha256_context );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sha256_context != NULL )
+	{
+		digest_hash_sha256_free(
+		 &sha256_context,
+		 NULL );
+	}
+	if( sha1_context != NULL )
+	{
+		digest_hash_sha1_free(
+		 &sha1_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the digest_hash_sha256_multi_buffer_update function
+ * The lanes alternately hash 1000000 times "a" and "abc" in updates of varying sizes,
+ * including empty updates
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_tools_digest_hash_sha256_multi_buffer_update(
+     int backend )
+{
+	uint8_t hash[ LIBHMAC_SHA256_HASH_SIZE ];
+
+	digest_hash_sha256_context_t *contexts[ DIGEST_HASH_MAXIMUM_NUMBER_OF_LANES ];
+	const uint8_t *buffers[ DIGEST_HASH_MAXIMUM_NUMBER_OF_LANES ];
+	const uint8_t *lane_data[ DIGEST_HASH_MAXIMUM_NUMBER_OF_LANES ];
+	size_t lane_data_sizes[ DIGEST_HASH_MAXIMUM_NUMBER_OF_LANES ];
+	size_t lane_offsets[ DIGEST_HASH_MAXIMUM_NUMBER_OF_LANES ];
+	size_t sizes[ DIGEST_HASH_MAXIMUM_NUMBER_OF_LANES ];
+
+	libcerror_error_t *error   = NULL;
+	const uint8_t *expected    = NULL;
+	uint8_t *data              = NULL;
+	size_t remaining_size      = 0;
+	int lane_index             = 0;
+	int number_of_active_lanes = 0;
+	int number_of_lanes        = 0;
+	int result                 = 0;
+	int update_index           = 0;
+
+	/* A backend that is not supported by the CPU cannot be tested
+	 */
+	if( digest_hash_backend_is_supported(
+	     backend ) == 0 )
+	{
+		return( 1 );
+	}
+	for( lane_index = 0;
+	     lane_index < DIGEST_HASH_MAXIMUM_NUMBER_OF_LANES;
+	     lane_index++ )
+	{
+		contexts[ lane_index ] = NULL;
+	}
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * 1000000 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	result = memory_set(
+	          data,
+	          (int) 'a',
+	          sizeof( uint8_t ) * 1000000 ) != NULL;
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	for( number_of_lanes = 1;
+	     number_of_lanes <= DIGEST_HASH_MAXIMUM_NUMBER_OF_LANES;
+	     number_of_lanes++ )
+	{
+		for( lane_index = 0;
+		     lane_index < number_of_lanes;
+		     lane_index++ )
+		{
+			result = digest_hash_sha256_initialize_with_backend(
+			          &( contexts[ lane_index ] ),
+			          backend,
+			          &error );
+
+			SMRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SMRAW_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			if( ( lane_index % 2 ) == 0 )
+			{
+				lane_data[ lane_index ]       = data;
+				lane_data_sizes[ lane_index ] = 1000000;
+			}
+			else
+			{
+				lane_data[ lane_index ]       = (uint8_t *) "abc";
+				lane_data_sizes[ lane_index ] = 3;
+			}
+			lane_offsets[ lane_index ] = 0;
+		}
+		update_index = 0;
+
+		do
+		{
+			number_of_active_lanes = 0;
+
+			for( lane_index = 0;
+			     lane_index < number_of_lanes;
+			     lane_index++ )
+			{
+				remaining_size = lane_data_sizes[ lane_index ] - lane_offsets[ lane_index ];
+
+				sizes[ lane_index ]   = 0;
+				buffers[ lane_index ] = &( ( lane_data[ lane_index ] )[ lane_offsets[ lane_index ] ] );
+
+				if( ( ( update_index + lane_index ) % 3 ) != 0 )
+				{
+					sizes[ lane_index ] = ( ( lane_offsets[ lane_index ] + ( lane_index * 13 ) ) % 8191 ) + 1;
+
+					if( sizes[ lane_index ] > remaining_size )
+					{
+						sizes[ lane_index ] = remaining_size;
+					}
+				}
+				if( remaining_size > 0 )
+				{
+					number_of_active_lanes++;
+				}
+			}
+			result = digest_hash_sha256_multi_buffer_update(
+			          contexts,
+			          buffers,
+			          sizes,
+			          number_of_lanes,
+			          &error );
+
+			SMRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SMRAW_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			for( lane_index = 0;
+			     lane_index < number_of_lanes;
+			     lane_index++ )
+			{
+				lane_offsets[ lane_index ] += sizes[ lane_index ];
+			}
+			update_index++;
+		}
+		while( number_of_active_lanes > 0 );
+
+		for( lane_index = 0;
+		     lane_index < number_of_lanes;
+		     lane_index++ )
+		{
+			result = digest_hash_sha256_finalize(
+			          contexts[ lane_index ],
+			          hash,
+			          LIBHMAC_SHA256_HASH_SIZE,
+			          &error );
+
+			SMRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SMRAW_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			if( ( lane_index % 2 ) == 0 )
+			{
+				expected = smraw_test_tools_digest_hash_sha256_million_a;
+			}
+			else
+			{
+				expected = smraw_test_tools_digest_hash_sha256_abc;
+			}
+			result = memory_compare(
+			          hash,
+			          expected,
+			          LIBHMAC_SHA256_HASH_SIZE );
+
+			SMRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+
+			result = digest_hash_sha256_free(
+			          &( contexts[ lane_index ] ),
+			          &error );
+
+			SMRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SMRAW_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	/* Test error cases
+	 */
+	result = digest_hash_sha256_initialize_with_backend(
+	          &( contexts[ 0 ] ),
+	          backend,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	buffers[ 0 ] = data;
+	sizes[ 0 ]   = 64;
+
+	result = digest_hash_sha256_multi_buffer_update(
+	          NULL,
+	          buffers,
+	          sizes,
+	          1,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_hash_sha256_multi_buffer_update(
+	          contexts,
+	          NULL,
+	          sizes,
+	          1,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_hash_sha256_multi_buffer_update(
+	          contexts,
+	          buffers,
+	          NULL,
+	          1,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_hash_sha256_multi_buffer_update(
+	          contexts,
+	          buffers,
+	          sizes,
+	          0,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_hash_sha256_multi_buffer_update(
+	          contexts,
+	          buffers,
+	          sizes,
+	          DIGEST_HASH_MAXIMUM_NUMBER_OF_LANES + 1,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = digest_hash_sha256_free(
+	          &( contexts[ 0 ] ),
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( lane_index = 0;
+	     lane_index < DIGEST_HASH_MAXIMUM_NUMBER_OF_LANES;
+	     lane_index++ )
+	{
+		if( contexts[ lane_index ] != NULL )
+		{
+			digest_hash_sha256_free(
+			 &( contexts[ lane_index ] ),
+			 NULL );
+		}
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Tests a digest hash type against known answers
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_tools_digest_hash_known_answers(
+     smraw_test_tools_digest_hash_type_t *digest_hash_type,
+     const uint8_t *expected_abc_hash,
+     const uint8_t *expected_million_a_hash )
+{
+	uint8_t hash[ SMRAW_TEST_TOOLS_DIGEST_HASH_MAXIMUM_HASH_SIZE ];
+
+	libcerror_error_t *error = NULL;
+	uint8_t *data            = NULL;
+	int result               = 0;
+
+	/* A backend that is not supported by the CPU cannot be tested
+	 */
+	if( digest_hash_backend_is_supported(
+	     digest_hash_type->backend ) == 0 )
+	{
+		return( 1 );
+	}
+	/* Test a single partial block
+	 */
+	result = smraw_test_tools_digest_hash_calculate(
+	          digest_hash_type,
+	          (uint8_t *) "abc",
+	          3,
+	          hash,
+	          digest_hash_type->hash_size,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hash,
+	          expected_abc_hash,
+	          digest_hash_type->hash_size );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test multiple blocks
+	 */
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * 1000000 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	result = memory_set(
+	          data,
+	          (int) 'a',
+	          sizeof( uint8_t ) * 1000000 ) != NULL;
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = smraw_test_tools_digest_hash_calculate(
+	          digest_hash_type,
+	          data,
+	          1000000,
+	          hash,
+	          digest_hash_type->hash_size,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hash,
+	          expected_million_a_hash,
+	          digest_hash_type->hash_size );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Benchmarks a digest hash type
+ * The throughput of the generic backend depends on the digest hash implementation libhmac was built with
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_tools_digest_hash_benchmark(
+     smraw_test_tools_digest_hash_type_t *digest_hash_type )
+{
+	uint8_t hash[ SMRAW_TEST_TOOLS_DIGEST_HASH_MAXIMUM_HASH_SIZE ];
+
+	libcerror_error_t *error = NULL;
+	intptr_t *context        = NULL;
+	uint8_t *data            = NULL;
+	clock_t end_time         = 0;
+	clock_t start_time       = 0;
+	double elapsed_time      = 0.0;
+	int iteration            = 0;
+	int result               = 0;
+
+	if( digest_hash_backend_is_supported(
+	     digest_hash_type->backend ) == 0 )
+	{
+		fprintf(
+		 stdout,
+		 "%s:\tnot supported\n",
+		 digest_hash_type->name );
+
+		return( 1 );
+	}
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * SMRAW_TEST_TOOLS_DIGEST_HASH_BENCHMARK_BUFFER_SIZE );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	result = memory_set(
+	          data,
+	          0x5a,
+	          sizeof( uint8_t ) * SMRAW_TEST_TOOLS_DIGEST_HASH_BENCHMARK_BUFFER_SIZE ) != NULL;
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = smraw_test_tools_digest_hash_initialize_context(
+	          digest_hash_type,
+	          &context,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	start_time = clock();
+
+	for( iteration = 0;
+	     iteration < SMRAW_TEST_TOOLS_DIGEST_HASH_BENCHMARK_ITERATIONS;
+	     iteration++ )
+	{
+		result = digest_hash_type->update(
+		          context,
+		          data,
+		          SMRAW_TEST_TOOLS_DIGEST_HASH_BENCHMARK_BUFFER_SIZE,
+		          &error );
+
+		SMRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	result = digest_hash_type->finalize(
+	          context,
+	          hash,
+	          digest_hash_type->hash_size,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	end_time = clock();
+
+	result = digest_hash_type->free(
+	          &context,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	elapsed_time = (double) ( end_time - start_time ) / CLOCKS_PER_SEC;
+
+	if( elapsed_time > 0.0 )
+	{
+		fprintf(
+		 stdout,
+		 "%s:\t%.1f MiB/s\n",
+		 digest_hash_type->name,
+		 (double) SMRAW_TEST_TOOLS_DIGEST_HASH_BENCHMARK_ITERATIONS / elapsed_time );
+	}
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( context != NULL )
+	{
+		digest_hash_type->free(
+		 &context,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Benchmarks the SHA256 multi-buffer update of the AVX2 backend
+ * The throughput is the combined throughput of all the lanes
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_tools_digest_hash_benchmark_sha256_multi_buffer(
+     void )
+{
+	uint8_t hash[ LIBHMAC_SHA256_HASH_SIZE ];
+
+	digest_hash_sha256_context_t *contexts[ DIGEST_HASH_MAXIMUM_NUMBER_OF_LANES ];
+	const uint8_t *buffers[ DIGEST_HASH_MAXIMUM_NUMBER_OF_LANES ];
+	size_t sizes[ DIGEST_HASH_MAXIMUM_NUMBER_OF_LANES ];
+
+	libcerror_error_t *error = NULL;
+	uint8_t *data            = NULL;
+	clock_t end_time         = 0;
+	clock_t start_time       = 0;
+	double elapsed_time      = 0.0;
+	int iteration            = 0;
+	int lane_index           = 0;
+	int result               = 0;
+
+	for( lane_index = 0;
+	     lane_index < DIGEST_HASH_MAXIMUM_NUMBER_OF_LANES;
+	     lane_index++ )
+	{
+		contexts[ lane_index ] = NULL;
+	}
+	if( digest_hash_backend_is_supported(
+	     DIGEST_HASH_BACKEND_AVX2 ) == 0 )
+	{
+		fprintf(
+		 stdout,
+		 "SHA256 AVX2 %d buffers:\tnot supported\n",
+		 DIGEST_HASH_MAXIMUM_NUMBER_OF_LANES );
+
+		return( 1 );
+	}
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * SMRAW_TEST_TOOLS_DIGEST_HASH_BENCHMARK_BUFFER_SIZE );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	result = memory_set(
+	          data,
+	          0x5a,
+	          sizeof( uint8_t ) * SMRAW_TEST_TOOLS_DIGEST_HASH_BENCHMARK_BUFFER_SIZE ) != NULL;
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	for( lane_index = 0;
+	     lane_index < DIGEST_HASH_MAXIMUM_NUMBER_OF_LANES;
+	     lane_index++ )
+	{
+		result = digest_hash_sha256_initialize_with_backend(
+		          &( contexts[ lane_index ] ),
+		          DIGEST_HASH_BACKEND_AVX2,
+		          &error );
+
+		SMRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		buffers[ lane_index ] = data;
+		sizes[ lane_index ]   = SMRAW_TEST_TOOLS_DIGEST_HASH_BENCHMARK_BUFFER_SIZE;
+	}
+	start_time = clock();
+
+	/* Hash the same amount of data as the single buffer benchmarks
+	 */
+	for( iteration = 0;
+	     iteration < ( SMRAW_TEST_TOOLS_DIGEST_HASH_BENCHMARK_ITERATIONS / DIGEST_HASH_MAXIMUM_NUMBER_OF_LANES );
+	     iteration++ )
+	{
+		result = digest_hash_sha256_multi_buffer_update(
+		          contexts,
+		          buffers,
+		          sizes,
+		          DIGEST_HASH_MAXIMUM_NUMBER_OF_LANES,
+		          &error );
+
+		SMRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	for( lane_index = 0;
+	     lane_index < DIGEST_HASH_MAXIMUM_NUMBER_OF_LANES;
+	     lane_index++ )
+	{
+		result = digest_hash_sha256_finalize(
+		          contexts[ lane_index ],
+		          hash,
+		          LIBHMAC_SHA256_HASH_SIZE,
+		          &error );
+
+		SMRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	end_time = clock();
+
+	for( lane_index = 0;
+	     lane_index < DIGEST_HASH_MAXIMUM_NUMBER_OF_LANES;
+	     lane_index++ )
+	{
+		result = digest_hash_sha256_free(
+		          &( contexts[ lane_index ] ),
+		          &error );
+
+		SMRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	elapsed_time = (double) ( end_time - start_time ) / CLOCKS_PER_SEC;
+
+	if( elapsed_time > 0.0 )
+	{
+		fprintf(
+		 stdout,
+		 "SHA256 AVX2 %d buffers:\t%.1f MiB/s\n",
+		 DIGEST_HASH_MAXIMUM_NUMBER_OF_LANES,
+		 (double) SMRAW_TEST_TOOLS_DIGEST_HASH_BENCHMARK_ITERATIONS / elapsed_time );
+	}
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( lane_index = 0;
+	     lane_index < DIGEST_HASH_MAXIMUM_NUMBER_OF_LANES;
+	     lane_index++ )
+	{
+		if( contexts[ lane_index ] != NULL )
+		{
+			digest_hash_sha256_free(
+			 &( contexts[ lane_index ] ),
+			 NULL );
+		}
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	system_integer_t option = 0;
+	int run_benchmark       = 0;
+
+	while( ( option = smraw_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "b" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) 'b':
+				run_benchmark = 1;
+
+				break;
+
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+		}
+	}
+	SMRAW_TEST_RUN(
+	 "digest_hash_copy_to_string",
+	 smraw_test_tools_digest_hash_copy_to_string );
+
+	SMRAW_TEST_RUN(
+	 "digest_hash_copy_from_string",
+	 smraw_test_tools_digest_hash_copy_from_string );
+
+	SMRAW_TEST_RUN(
+	 "digest_hash_initialize_with_backend",
+	 smraw_test_tools_digest_hash_initialize_with_backend );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	SMRAW_TEST_RUN_WITH_ARGS(
+	 "libhmac_md5",
+	 smraw_test_tools_digest_hash_known_answers,
+	 &smraw_test_tools_digest_hash_md5,
+	 smraw_test_tools_digest_hash_md5_abc,
+	 smraw_test_tools_digest_hash_md5_million_a );
+
+	SMRAW_TEST_RUN_WITH_ARGS(
+	 "libhmac_sha1",
+	 smraw_test_tools_digest_hash_known_answers,
+	 &smraw_test_tools_digest_hash_sha1,
+	 smraw_test_tools_digest_hash_sha1_abc,
+	 smraw_test_tools_digest_hash_sha1_million_a );
+
+	SMRAW_TEST_RUN_WITH_ARGS(
+	 "libhmac_sha256",
+	 smraw_test_tools_digest_hash_known_answers,
+	 &smraw_test_tools_digest_hash_sha256,
+	 smraw_test_tools_digest_hash_sha256_abc,
+	 smraw_test_tools_digest_hash_sha256_million_a );
+
+	SMRAW_TEST_RUN_WITH_ARGS(
+	 "digest_hash_sha1 generic",
+	 smraw_test_tools_digest_hash_known_answers,
+	 &smraw_test_tools_digest_hash_sha1_generic,
+	 smraw_test_tools_digest_hash_sha1_abc,
+	 smraw_test_tools_digest_hash_sha1_million_a );
+
+	SMRAW_TEST_RUN_WITH_ARGS(
+	 "digest_hash_sha1 SHA-NI",
+	 smraw_test_tools_digest_hash_known_answers,
+	 &smraw_test_tools_digest_hash_sha1_sha_ni,
+	 smraw_test_tools_digest_hash_sha1_abc,
+	 smraw_test_tools_digest_hash_sha1_million_a );
+
+	SMRAW_TEST_RUN_WITH_ARGS(
+	 "digest_hash_sha256 generic",
+	 smraw_test_tools_digest_hash_known_answers,
+	 &smraw_test_tools_digest_hash_sha256_generic,
+	 smraw_test_tools_digest_hash_sha256_abc,
+	 smraw_test_tools_digest_hash_sha256_million_a );
+
+	SMRAW_TEST_RUN_WITH_ARGS(
+	 "digest_hash_sha256 SHA-NI",
+	 smraw_test_tools_digest_hash_known_answers,
+	 &smraw_test_tools_digest_hash_sha256_sha_ni,
+	 smraw_test_tools_digest_hash_sha256_abc,
+	 smraw_test_tools_digest_hash_sha256_million_a );
+
+	SMRAW_TEST_RUN_WITH_ARGS(
+	 "digest_hash_sha256 AVX2",
+	 smraw_test_tools_digest_hash_known_answers,
+	 &smraw_test_tools_digest_hash_sha256_avx2,
+	 smraw_test_tools_digest_hash_sha256_abc,
+	 smraw_test_tools_digest_hash_sha256_million_a );
+
+	SMRAW_TEST_RUN_WITH_ARGS(
+	 "digest_hash_sha256_multi_buffer_update generic",
+	 smraw_test_tools_digest_hash_sha256_multi_buffer_update,
+	 DIGEST_HASH_BACKEND_GENERIC );
+
+	SMRAW_TEST_RUN_WITH_ARGS(
+	 "digest_hash_sha256_multi_buffer_update SHA-NI",
+	 smraw_test_tools_digest_hash_sha256_multi_buffer_update,
+	 DIGEST_HASH_BACKEND_SHA_NI );
+
+	SMRAW_TEST_RUN_WITH_ARGS(
+	 "digest_hash_sha256_multi_buffer_update AVX2",
+	 smraw_test_tools_digest_hash_sha256_multi_buffer_update,
+	 DIGEST_HASH_BACKEND_AVX2 );
+
+	/* The benchmark is only run on request since its duration depends on the system
+	 * The hardware accelerated backends are compared against the generic backend,
+	 * backends that are not supported by the CPU are reported as such
+	 */
+	if( run_benchmark != 0 )
+	{
+		SMRAW_TEST_RUN_WITH_ARGS(
+		 "benchmark libhmac_md5",
+		 smraw_test_tools_digest_hash_benchmark,
+		 &smraw_test_tools_digest_hash_md5 );
+
+		SMRAW_TEST_RUN_WITH_ARGS(
+		 "benchmark digest_hash_sha1 generic",
+		 smraw_test_tools_digest_hash_benchmark,
+		 &smraw_test_tools_digest_hash_sha1_generic );
+
+		SMRAW_TEST_RUN_WITH_ARGS(
+		 "benchmark digest_hash_sha1 SHA-NI",
+		 smraw_test_tools_digest_hash_benchmark,
+		 &smraw_test_tools_digest_hash_sha1_sha_ni );
+
+		SMRAW_TEST_RUN_WITH_ARGS(
+		 "benchmark digest_hash_sha256 generic",
+		 smraw_test_tools_digest_hash_benchmark,
+		 &smraw_test_tools_digest_hash_sha256_generic );
+
+		SMRAW_TEST_RUN_WITH_ARGS(
+		 "benchmark digest_hash_sha256 SHA-NI",
+		 smraw_test_tools_digest_hash_benchmark,
+		 &smraw_test_tools_digest_hash_sha256_sha_ni );
+
+		SMRAW_TEST_RUN_WITH_ARGS(
+		 "benchmark digest_hash_sha256 AVX2",
+		 smraw_test_tools_digest_hash_benchmark,
+		 &smraw_test_tools_digest_hash_sha256_avx2 );
+
+		SMRAW_TEST_RUN(
+		 "benchmark digest_hash_sha256 AVX2 multi-buffer",
+		 smraw_test_tools_digest_hash_benchmark_sha256_multi_buffer );
+	}
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,488 @@
+/*
+ * Tools digest_pipeline type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "smraw_test_libcerror.h"
+#include "smraw_test_macros.h"
+#include "smraw_test_unused.h"
+
+#include "../smrawtools/digest_pipeline.h"
+#include "../smrawtools/storage_media_buffer.h"
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Order dependent checksum used as test digest
+ * Returns 1 if successful or -1 on error
+ */
+int smraw_test_tools_digest_pipeline_update_checksum(
+     uint32_t *checksum,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error SMRAW_TEST_ATTRIBUTE_UNUSED )
+{
+	size_t buffer_offset = 0;
+
+	SMRAW_TEST_UNREFERENCED_PARAMETER( error )
+
+	for( buffer_offset = 0;
+	     buffer_offset < size;
+	     buffer_offset++ )
+	{
+		*checksum = ( *checksum * 31 ) + buffer[ buffer_offset ];
+	}
+	return( 1 );
+}
+
+/* Tests the digest_pipeline_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_tools_digest_pipeline_initialize(
+     void )
+{
+	digest_pipeline_t *digest_pipeline = NULL;
+	libcerror_error_t *error           = NULL;
+	int result                         = 0;
+
+	/* Test regular cases
+	 */
+	result = digest_pipeline_initialize(
+	          &digest_pipeline,
+	          4,
+	          512,
+	          2,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "digest_pipeline",
+	 digest_pipeline );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_pipeline_free(
+	          &digest_pipeline,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "digest_pipeline",
+	 digest_pipeline );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = digest_pipeline_initialize(
+	          NULL,
+	          4,
+	          512,
+	          2,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_pipeline_initialize(
+	          &digest_pipeline,
+	          0,
+	          512,
+	          2,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_pipeline_initialize(
+	          &digest_pipeline,
+	          4,
+	          512,
+	          0,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( digest_pipeline != NULL )
+	{
+		digest_pipeline_free(
+		 &digest_pipeline,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the digest_pipeline_free function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_tools_digest_pipeline_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = digest_pipeline_free(
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the digest_pipeline_get_buffer and digest_pipeline_push_buffer functions
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_tools_digest_pipeline_push_buffer(
+     void )
+{
+	uint32_t checksums[ 3 ];
+
+	digest_pipeline_t *digest_pipeline           = NULL;
+	libcerror_error_t *error                     = NULL;
+	storage_media_buffer_t *storage_media_buffer = NULL;
+	uint32_t expected_checksum                   = 0;
+	size_t buffer_offset                         = 0;
+	int buffer_index                             = 0;
+	int digest_index                             = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = digest_pipeline_initialize(
+	          &digest_pipeline,
+	          4,
+	          512,
+	          2,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "digest_pipeline",
+	 digest_pipeline );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( digest_index = 0;
+	     digest_index < 3;
+	     digest_index++ )
+	{
+		checksums[ digest_index ] = 0;
+
+		result = digest_pipeline_append_digest(
+		          digest_pipeline,
+		          (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &smraw_test_tools_digest_pipeline_update_checksum,
+		          (intptr_t *) &( checksums[ digest_index ] ),
+		          &error );
+
+		SMRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SMRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = digest_pipeline_start(
+	          digest_pipeline,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( buffer_index = 0;
+	     buffer_index < 64;
+	     buffer_index++ )
+	{
+		storage_media_buffer = NULL;
+
+		result = digest_pipeline_get_buffer(
+		          digest_pipeline,
+		          &storage_media_buffer,
+		          &error );
+
+		SMRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SMRAW_TEST_ASSERT_IS_NOT_NULL(
+		 "storage_media_buffer",
+		 storage_media_buffer );
+
+		SMRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( buffer_offset = 0;
+		     buffer_offset < 512;
+		     buffer_offset++ )
+		{
+			storage_media_buffer->raw_buffer[ buffer_offset ] = (uint8_t) ( buffer_index + buffer_offset );
+		}
+		smraw_test_tools_digest_pipeline_update_checksum(
+		 &expected_checksum,
+		 storage_media_buffer->raw_buffer,
+		 512,
+		 NULL );
+
+		result = digest_pipeline_push_buffer(
+		          digest_pipeline,
+		          storage_media_buffer->raw_buffer,
+		          512,
+		          &error );
+
+		SMRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SMRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = digest_pipeline_wait(
+	          digest_pipeline,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( digest_index = 0;
+	     digest_index < 3;
+	     digest_index++ )
+	{
+		SMRAW_TEST_ASSERT_EQUAL_UINT32(
+		 "checksum",
+		 checksums[ digest_index ],
+		 expected_checksum );
+	}
+	/* Test error cases
+	 */
+	result = digest_pipeline_get_buffer(
+	          NULL,
+	          &storage_media_buffer,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_pipeline_push_buffer(
+	          digest_pipeline,
+	          NULL,
+	          512,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = digest_pipeline_free(
+	          &digest_pipeline,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "digest_pipeline",
+	 digest_pipeline );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( digest_pipeline != NULL )
+	{
+		digest_pipeline_free(
+		 &digest_pipeline,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SMRAW_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SMRAW_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SMRAW_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SMRAW_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SMRAW_TEST_UNREFERENCED_PARAMETER( argc )
+	SMRAW_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+	SMRAW_TEST_RUN(
+	 "digest_pipeline_initialize",
+	 smraw_test_tools_digest_pipeline_initialize );
+
+	SMRAW_TEST_RUN(
+	 "digest_pipeline_free",
+	 smraw_test_tools_digest_pipeline_free );
+
+	SMRAW_TEST_RUN(
+	 "digest_pipeline_push_buffer",
+	 smraw_test_tools_digest_pipeline_push_buffer );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+}
+
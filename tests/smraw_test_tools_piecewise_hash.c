@@ -0,0 +1,1377 @@
+/*
+ * Tools piecewise hash functions test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "smraw_test_libcerror.h"
+#include "smraw_test_macros.h"
+#include "smraw_test_unused.h"
+
+#include "../smrawtools/piecewise_hash.h"
+
+/* Creates a checksum context used as test digest
+ * Returns 1 if successful or -1 on error
+ */
+int smraw_test_tools_piecewise_hash_checksum_initialize(
+     uint32_t **checksum,
+     libcerror_error_t **error SMRAW_TEST_ATTRIBUTE_UNUSED )
+{
+	SMRAW_TEST_UNREFERENCED_PARAMETER( error )
+
+	*checksum = (uint32_t *) memory_allocate(
+	                          sizeof( uint32_t ) );
+
+	if( *checksum == NULL )
+	{
+		return( -1 );
+	}
+	**checksum = 0;
+
+	return( 1 );
+}
+
+/* Updates the order dependent checksum used as test digest
+ * Returns 1 if successful or -1 on error
+ */
+int smraw_test_tools_piecewise_hash_checksum_update(
+     uint32_t *checksum,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error SMRAW_TEST_ATTRIBUTE_UNUSED )
+{
+	size_t buffer_offset = 0;
+
+	SMRAW_TEST_UNREFERENCED_PARAMETER( error )
+
+	for( buffer_offset = 0;
+	     buffer_offset < size;
+	     buffer_offset++ )
+	{
+		*checksum = ( *checksum * 31 ) + buffer[ buffer_offset ];
+	}
+	return( 1 );
+}
+
+/* Updates multiple order dependent checksums used as test digest
+ * Returns 1 if successful or -1 on error
+ */
+int smraw_test_tools_piecewise_hash_checksum_multi_buffer_update(
+     uint32_t **checksums,
+     const uint8_t **buffers,
+     const size_t *sizes,
+     int number_of_checksums,
+     libcerror_error_t **error )
+{
+	int checksum_index = 0;
+
+	for( checksum_index = 0;
+	     checksum_index < number_of_checksums;
+	     checksum_index++ )
+	{
+		if( smraw_test_tools_piecewise_hash_checksum_update(
+		     checksums[ checksum_index ],
+		     buffers[ checksum_index ],
+		     sizes[ checksum_index ],
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Finalizes the checksum used as test digest
+ * Returns 1 if successful or -1 on error
+ */
+int smraw_test_tools_piecewise_hash_checksum_finalize(
+     uint32_t *checksum,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error SMRAW_TEST_ATTRIBUTE_UNUSED )
+{
+	SMRAW_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( hash_size < 4 )
+	{
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_big_endian(
+	 hash,
+	 *checksum );
+
+	return( 1 );
+}
+
+/* Frees the checksum context used as test digest
+ * Returns 1 if successful or -1 on error
+ */
+int smraw_test_tools_piecewise_hash_checksum_free(
+     uint32_t **checksum,
+     libcerror_error_t **error SMRAW_TEST_ATTRIBUTE_UNUSED )
+{
+	SMRAW_TEST_UNREFERENCED_PARAMETER( error )
+
+	memory_free(
+	 *checksum );
+
+	*checksum = NULL;
+
+	return( 1 );
+}
+
+/* Creates a piecewise hash that uses the test digest
+ * Returns 1 if successful or -1 on error
+ */
+int smraw_test_tools_piecewise_hash_initialize_checksum(
+     piecewise_hash_t **piecewise_hash,
+     size64_t chunk_size,
+     libcerror_error_t **error )
+{
+	return( piecewise_hash_initialize(
+	         piecewise_hash,
+	         chunk_size,
+	         4,
+	         (int (*)(intptr_t **, libcerror_error_t **)) &smraw_test_tools_piecewise_hash_checksum_initialize,
+	         (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &smraw_test_tools_piecewise_hash_checksum_update,
+	         (int (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) &smraw_test_tools_piecewise_hash_checksum_finalize,
+	         (int (*)(intptr_t **, libcerror_error_t **)) &smraw_test_tools_piecewise_hash_checksum_free,
+	         error ) );
+}
+
+/* Tests the piecewise_hash_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_tools_piecewise_hash_initialize(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	piecewise_hash_t *piecewise_hash = NULL;
+	int result                       = 0;
+
+	/* Test regular cases
+	 */
+	result = smraw_test_tools_piecewise_hash_initialize_checksum(
+	          &piecewise_hash,
+	          1024,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "piecewise_hash",
+	 piecewise_hash );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = piecewise_hash_free(
+	          &piecewise_hash,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "piecewise_hash",
+	 piecewise_hash );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = smraw_test_tools_piecewise_hash_initialize_checksum(
+	          NULL,
+	          1024,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	piecewise_hash = (piecewise_hash_t *) 0x12345678UL;
+
+	result = smraw_test_tools_piecewise_hash_initialize_checksum(
+	          &piecewise_hash,
+	          1024,
+	          &error );
+
+	piecewise_hash = NULL;
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = smraw_test_tools_piecewise_hash_initialize_checksum(
+	          &piecewise_hash,
+	          0,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = piecewise_hash_initialize(
+	          &piecewise_hash,
+	          1024,
+	          0,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &smraw_test_tools_piecewise_hash_checksum_initialize,
+	          (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &smraw_test_tools_piecewise_hash_checksum_update,
+	          (int (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) &smraw_test_tools_piecewise_hash_checksum_finalize,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &smraw_test_tools_piecewise_hash_checksum_free,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = piecewise_hash_initialize(
+	          &piecewise_hash,
+	          1024,
+	          4,
+	          NULL,
+	          (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &smraw_test_tools_piecewise_hash_checksum_update,
+	          (int (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) &smraw_test_tools_piecewise_hash_checksum_finalize,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &smraw_test_tools_piecewise_hash_checksum_free,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( piecewise_hash != NULL )
+	{
+		piecewise_hash_free(
+		 &piecewise_hash,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the piecewise_hash_free function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_tools_piecewise_hash_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = piecewise_hash_free(
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the piecewise_hash_set_multi_buffer_functions function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_tools_piecewise_hash_set_multi_buffer_functions(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	piecewise_hash_t *piecewise_hash = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = smraw_test_tools_piecewise_hash_initialize_checksum(
+	          &piecewise_hash,
+	          16,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = piecewise_hash_set_multi_buffer_functions(
+	          piecewise_hash,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &smraw_test_tools_piecewise_hash_checksum_initialize,
+	          (int (*)(intptr_t **, const uint8_t **, const size_t *, int, libcerror_error_t **)) &smraw_test_tools_piecewise_hash_checksum_multi_buffer_update,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "piecewise_hash->multi_buffer_initialize_function",
+	 piecewise_hash->multi_buffer_initialize_function );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "piecewise_hash->multi_buffer_update_function",
+	 piecewise_hash->multi_buffer_update_function );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = piecewise_hash_set_multi_buffer_functions(
+	          NULL,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &smraw_test_tools_piecewise_hash_checksum_initialize,
+	          (int (*)(intptr_t **, const uint8_t **, const size_t *, int, libcerror_error_t **)) &smraw_test_tools_piecewise_hash_checksum_multi_buffer_update,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = piecewise_hash_set_multi_buffer_functions(
+	          piecewise_hash,
+	          NULL,
+	          (int (*)(intptr_t **, const uint8_t **, const size_t *, int, libcerror_error_t **)) &smraw_test_tools_piecewise_hash_checksum_multi_buffer_update,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = piecewise_hash_set_multi_buffer_functions(
+	          piecewise_hash,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &smraw_test_tools_piecewise_hash_checksum_initialize,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = piecewise_hash_free(
+	          &piecewise_hash,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( piecewise_hash != NULL )
+	{
+		piecewise_hash_free(
+		 &piecewise_hash,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the piecewise_hash_update function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_tools_piecewise_hash_update(
+     void )
+{
+	uint8_t data[ 1000 ];
+	uint8_t expected_hash[ 4 ];
+	uint8_t hash[ 4 ];
+
+	libcerror_error_t *error         = NULL;
+	piecewise_hash_t *piecewise_hash = NULL;
+	size64_t chunk_size              = 0;
+	size_t data_offset               = 0;
+	size_t update_size               = 0;
+	off64_t chunk_offset             = 0;
+	uint64_t chunk_index             = 0;
+	uint64_t number_of_chunks        = 0;
+	uint32_t checksum                = 0;
+	int result                       = 0;
+
+	for( data_offset = 0;
+	     data_offset < 1000;
+	     data_offset++ )
+	{
+		data[ data_offset ] = (uint8_t) ( data_offset % 251 );
+	}
+	/* Initialize test
+	 */
+	result = smraw_test_tools_piecewise_hash_initialize_checksum(
+	          &piecewise_hash,
+	          64,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "piecewise_hash",
+	 piecewise_hash );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases with buffers that do not align with the chunks
+	 */
+	data_offset = 0;
+
+	while( data_offset < 1000 )
+	{
+		update_size = 1000 - data_offset;
+
+		if( update_size > 100 )
+		{
+			update_size = 100;
+		}
+		result = piecewise_hash_update(
+		          piecewise_hash,
+		          &( data[ data_offset ] ),
+		          update_size,
+		          &error );
+
+		SMRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SMRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		data_offset += update_size;
+	}
+	result = piecewise_hash_get_number_of_chunks(
+	          piecewise_hash,
+	          &number_of_chunks,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_chunks",
+	 number_of_chunks,
+	 (uint64_t) 15 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = piecewise_hash_finalize(
+	          piecewise_hash,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = piecewise_hash_get_number_of_chunks(
+	          piecewise_hash,
+	          &number_of_chunks,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_chunks",
+	 number_of_chunks,
+	 (uint64_t) 16 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		result = piecewise_hash_get_chunk(
+		          piecewise_hash,
+		          chunk_index,
+		          &chunk_offset,
+		          &chunk_size,
+		          hash,
+		          4,
+		          &error );
+
+		SMRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SMRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		SMRAW_TEST_ASSERT_EQUAL_INT64(
+		 "chunk_offset",
+		 (int64_t) chunk_offset,
+		 (int64_t) ( chunk_index * 64 ) );
+
+		if( chunk_index == 15 )
+		{
+			SMRAW_TEST_ASSERT_EQUAL_UINT64(
+			 "chunk_size",
+			 (uint64_t) chunk_size,
+			 (uint64_t) 40 );
+		}
+		else
+		{
+			SMRAW_TEST_ASSERT_EQUAL_UINT64(
+			 "chunk_size",
+			 (uint64_t) chunk_size,
+			 (uint64_t) 64 );
+		}
+		checksum = 0;
+
+		smraw_test_tools_piecewise_hash_checksum_update(
+		 &checksum,
+		 &( data[ chunk_offset ] ),
+		 (size_t) chunk_size,
+		 NULL );
+
+		byte_stream_copy_from_uint32_big_endian(
+		 expected_hash,
+		 checksum );
+
+		result = memory_compare(
+		          hash,
+		          expected_hash,
+		          4 );
+
+		SMRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test error cases
+	 */
+	result = piecewise_hash_update(
+	          NULL,
+	          data,
+	          100,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = piecewise_hash_update(
+	          piecewise_hash,
+	          NULL,
+	          100,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = piecewise_hash_update(
+	          piecewise_hash,
+	          data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = piecewise_hash_get_chunk(
+	          piecewise_hash,
+	          16,
+	          &chunk_offset,
+	          &chunk_size,
+	          hash,
+	          4,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = piecewise_hash_get_chunk(
+	          piecewise_hash,
+	          0,
+	          &chunk_offset,
+	          &chunk_size,
+	          hash,
+	          3,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = piecewise_hash_get_number_of_chunks(
+	          piecewise_hash,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = piecewise_hash_free(
+	          &piecewise_hash,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "piecewise_hash",
+	 piecewise_hash );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( piecewise_hash != NULL )
+	{
+		piecewise_hash_free(
+		 &piecewise_hash,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the piecewise_hash_finalize_chunk function with a large number of chunks
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_tools_piecewise_hash_finalize_chunk(
+     void )
+{
+	uint8_t data[ 256 ];
+
+	libcerror_error_t *error         = NULL;
+	piecewise_hash_t *piecewise_hash = NULL;
+	uint64_t number_of_chunks        = 0;
+	int iteration                    = 0;
+	int result                       = 0;
+
+	result = memory_set(
+	          data,
+	          0x5a,
+	          256 ) != NULL;
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Initialize test
+	 */
+	result = smraw_test_tools_piecewise_hash_initialize_checksum(
+	          &piecewise_hash,
+	          1,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases where the hashes are resized multiple times
+	 */
+	for( iteration = 0;
+	     iteration < 4;
+	     iteration++ )
+	{
+		result = piecewise_hash_update(
+		          piecewise_hash,
+		          data,
+		          256,
+		          &error );
+
+		SMRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SMRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = piecewise_hash_get_number_of_chunks(
+	          piecewise_hash,
+	          &number_of_chunks,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_chunks",
+	 number_of_chunks,
+	 (uint64_t) 1024 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = piecewise_hash_finalize_chunk(
+	          piecewise_hash,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = piecewise_hash_finalize_chunk(
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = piecewise_hash_free(
+	          &piecewise_hash,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( piecewise_hash != NULL )
+	{
+		piecewise_hash_free(
+		 &piecewise_hash,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the piecewise_hash_append_chunk function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_tools_piecewise_hash_append_chunk(
+     void )
+{
+	uint8_t hash[ 4 ] = { 0x01, 0x02, 0x03, 0x04 };
+	uint8_t stored_hash[ 4 ];
+
+	libcerror_error_t *error         = NULL;
+	piecewise_hash_t *piecewise_hash = NULL;
+	size64_t chunk_size              = 0;
+	off64_t chunk_offset             = 0;
+	uint64_t number_of_chunks        = 0;
+	int iteration                    = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = smraw_test_tools_piecewise_hash_initialize_checksum(
+	          &piecewise_hash,
+	          64,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases where the hashes are resized multiple times
+	 */
+	for( iteration = 0;
+	     iteration < 200;
+	     iteration++ )
+	{
+		hash[ 0 ] = (uint8_t) iteration;
+
+		result = piecewise_hash_append_chunk(
+		          piecewise_hash,
+		          hash,
+		          4,
+		          64,
+		          &error );
+
+		SMRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SMRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	hash[ 0 ] = 0xff;
+
+	result = piecewise_hash_append_chunk(
+	          piecewise_hash,
+	          hash,
+	          4,
+	          10,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = piecewise_hash_get_number_of_chunks(
+	          piecewise_hash,
+	          &number_of_chunks,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_chunks",
+	 number_of_chunks,
+	 (uint64_t) 201 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = piecewise_hash_get_chunk(
+	          piecewise_hash,
+	          150,
+	          &chunk_offset,
+	          &chunk_size,
+	          stored_hash,
+	          4,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT64(
+	 "chunk_offset",
+	 (int64_t) chunk_offset,
+	 (int64_t) 9600 );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "chunk_size",
+	 (uint64_t) chunk_size,
+	 (uint64_t) 64 );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "stored_hash[ 0 ]",
+	 (int) stored_hash[ 0 ],
+	 150 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = piecewise_hash_get_chunk(
+	          piecewise_hash,
+	          200,
+	          &chunk_offset,
+	          &chunk_size,
+	          stored_hash,
+	          4,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "chunk_size",
+	 (uint64_t) chunk_size,
+	 (uint64_t) 10 );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "stored_hash[ 0 ]",
+	 (int) stored_hash[ 0 ],
+	 0xff );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = piecewise_hash_append_chunk(
+	          NULL,
+	          hash,
+	          4,
+	          64,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test appending a chunk after a chunk that is smaller than the chunk size
+	 */
+	result = piecewise_hash_append_chunk(
+	          piecewise_hash,
+	          hash,
+	          4,
+	          64,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = piecewise_hash_free(
+	          &piecewise_hash,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = smraw_test_tools_piecewise_hash_initialize_checksum(
+	          &piecewise_hash,
+	          64,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = piecewise_hash_append_chunk(
+	          piecewise_hash,
+	          NULL,
+	          4,
+	          64,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = piecewise_hash_append_chunk(
+	          piecewise_hash,
+	          hash,
+	          3,
+	          64,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = piecewise_hash_append_chunk(
+	          piecewise_hash,
+	          hash,
+	          4,
+	          0,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = piecewise_hash_append_chunk(
+	          piecewise_hash,
+	          hash,
+	          4,
+	          65,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = piecewise_hash_free(
+	          &piecewise_hash,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( piecewise_hash != NULL )
+	{
+		piecewise_hash_free(
+		 &piecewise_hash,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SMRAW_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SMRAW_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SMRAW_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SMRAW_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SMRAW_TEST_UNREFERENCED_PARAMETER( argc )
+	SMRAW_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SMRAW_TEST_RUN(
+	 "piecewise_hash_initialize",
+	 smraw_test_tools_piecewise_hash_initialize );
+
+	SMRAW_TEST_RUN(
+	 "piecewise_hash_free",
+	 smraw_test_tools_piecewise_hash_free );
+
+	SMRAW_TEST_RUN(
+	 "piecewise_hash_set_multi_buffer_functions",
+	 smraw_test_tools_piecewise_hash_set_multi_buffer_functions );
+
+	SMRAW_TEST_RUN(
+	 "piecewise_hash_update",
+	 smraw_test_tools_piecewise_hash_update );
+
+	SMRAW_TEST_RUN(
+	 "piecewise_hash_finalize_chunk",
+	 smraw_test_tools_piecewise_hash_finalize_chunk );
+
+	SMRAW_TEST_RUN(
+	 "piecewise_hash_append_chunk",
+	 smraw_test_tools_piecewise_hash_append_chunk );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
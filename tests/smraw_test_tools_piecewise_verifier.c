@@ -0,0 +1,1546 @@
+/*
+ * Tools piecewise hash verifier functions test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "smraw_test_libcerror.h"
+#include "smraw_test_macros.h"
+#include "smraw_test_unused.h"
+
+#include "../smrawtools/piecewise_hash.h"
+#include "../smrawtools/piecewise_verifier.h"
+
+#define SMRAW_TEST_TOOLS_PIECEWISE_VERIFIER_CHUNK_SIZE	64
+#define SMRAW_TEST_TOOLS_PIECEWISE_VERIFIER_DATA_SIZE	300
+
+typedef struct smraw_test_tools_piecewise_verifier_data smraw_test_tools_piecewise_verifier_data_t;
+
+struct smraw_test_tools_piecewise_verifier_data
+{
+	/* The data
+	 */
+	uint8_t data[ SMRAW_TEST_TOOLS_PIECEWISE_VERIFIER_DATA_SIZE ];
+
+	/* The offset of the range that cannot be read
+	 */
+	off64_t unreadable_offset;
+
+	/* The size of the range that cannot be read
+	 */
+	size64_t unreadable_size;
+};
+
+typedef struct smraw_test_tools_piecewise_verifier_report smraw_test_tools_piecewise_verifier_report_t;
+
+struct smraw_test_tools_piecewise_verifier_report
+{
+	/* The number of reported chunks
+	 */
+	int number_of_chunks;
+
+	/* The offset of the last reported chunk
+	 */
+	off64_t chunk_offset;
+
+	/* The size of the last reported chunk
+	 */
+	size64_t chunk_size;
+
+	/* The status of the last reported chunk
+	 */
+	int chunk_status;
+};
+
+/* Creates a checksum context used as test digest
+ * Returns 1 if successful or -1 on error
+ */
+int smraw_test_tools_piecewise_verifier_checksum_initialize(
+     uint32_t **checksum,
+     libcerror_error_t **error SMRAW_TEST_ATTRIBUTE_UNUSED )
+{
+	SMRAW_TEST_UNREFERENCED_PARAMETER( error )
+
+	*checksum = (uint32_t *) memory_allocate(
+	                          sizeof( uint32_t ) );
+
+	if( *checksum == NULL )
+	{
+		return( -1 );
+	}
+	**checksum = 0;
+
+	return( 1 );
+}
+
+/* Updates the order dependent checksum used as test digest
+ * Returns 1 if successful or -1 on error
+ */
+int smraw_test_tools_piecewise_verifier_checksum_update(
+     uint32_t *checksum,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error SMRAW_TEST_ATTRIBUTE_UNUSED )
+{
+	size_t buffer_offset = 0;
+
+	SMRAW_TEST_UNREFERENCED_PARAMETER( error )
+
+	for( buffer_offset = 0;
+	     buffer_offset < size;
+	     buffer_offset++ )
+	{
+		*checksum = ( *checksum * 31 ) + buffer[ buffer_offset ];
+	}
+	return( 1 );
+}
+
+/* Updates multiple order dependent checksums used as test digest
+ * Returns 1 if successful or -1 on error
+ */
+int smraw_test_tools_piecewise_verifier_checksum_multi_buffer_update(
+     uint32_t **checksums,
+     const uint8_t **buffers,
+     const size_t *sizes,
+     int number_of_checksums,
+     libcerror_error_t **error )
+{
+	int checksum_index = 0;
+
+	for( checksum_index = 0;
+	     checksum_index < number_of_checksums;
+	     checksum_index++ )
+	{
+		if( smraw_test_tools_piecewise_verifier_checksum_update(
+		     checksums[ checksum_index ],
+		     buffers[ checksum_index ],
+		     sizes[ checksum_index ],
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Finalizes the checksum used as test digest
+ * Returns 1 if successful or -1 on error
+ */
+int smraw_test_tools_piecewise_verifier_checksum_finalize(
+     uint32_t *checksum,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error SMRAW_TEST_ATTRIBUTE_UNUSED )
+{
+	SMRAW_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( hash_size < 4 )
+	{
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_big_endian(
+	 hash,
+	 *checksum );
+
+	return( 1 );
+}
+
+/* Frees the checksum context used as test digest
+ * Returns 1 if successful or -1 on error
+ */
+int smraw_test_tools_piecewise_verifier_checksum_free(
+     uint32_t **checksum,
+     libcerror_error_t **error SMRAW_TEST_ATTRIBUTE_UNUSED )
+{
+	SMRAW_TEST_UNREFERENCED_PARAMETER( error )
+
+	memory_free(
+	 *checksum );
+
+	*checksum = NULL;
+
+	return( 1 );
+}
+
+/* Reads data from the test data at a specific offset
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t smraw_test_tools_piecewise_verifier_read(
+         smraw_test_tools_piecewise_verifier_data_t *test_data,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "smraw_test_tools_piecewise_verifier_read";
+
+	if( ( offset < 0 )
+	 || ( offset >= SMRAW_TEST_TOOLS_PIECEWISE_VERIFIER_DATA_SIZE ) )
+	{
+		return( 0 );
+	}
+	if( ( test_data->unreadable_size > 0 )
+	 && ( offset < (off64_t) ( test_data->unreadable_offset + test_data->unreadable_size ) )
+	 && ( (off64_t) ( offset + buffer_size ) > test_data->unreadable_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) ( SMRAW_TEST_TOOLS_PIECEWISE_VERIFIER_DATA_SIZE - offset ) )
+	{
+		buffer_size = (size_t) ( SMRAW_TEST_TOOLS_PIECEWISE_VERIFIER_DATA_SIZE - offset );
+	}
+	if( memory_copy(
+	     buffer,
+	     &( test_data->data[ offset ] ),
+	     buffer_size ) == NULL )
+	{
+		return( -1 );
+	}
+	return( (ssize_t) buffer_size );
+}
+
+/* Records the chunks reported by the piecewise verifier
+ */
+void smraw_test_tools_piecewise_verifier_report(
+      smraw_test_tools_piecewise_verifier_report_t *report,
+      off64_t chunk_offset,
+      size64_t chunk_size,
+      int chunk_status )
+{
+	report->number_of_chunks += 1;
+	report->chunk_offset      = chunk_offset;
+	report->chunk_size        = chunk_size;
+	report->chunk_status      = chunk_status;
+}
+
+/* Creates piecewise hashes of the test data that use the test digest
+ * Returns 1 if successful or -1 on error
+ */
+int smraw_test_tools_piecewise_verifier_initialize_stored_hashes(
+     piecewise_hash_t **piecewise_hash,
+     smraw_test_tools_piecewise_verifier_data_t *test_data,
+     libcerror_error_t **error )
+{
+	if( piecewise_hash_initialize(
+	     piecewise_hash,
+	     SMRAW_TEST_TOOLS_PIECEWISE_VERIFIER_CHUNK_SIZE,
+	     4,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &smraw_test_tools_piecewise_verifier_checksum_initialize,
+	     (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &smraw_test_tools_piecewise_verifier_checksum_update,
+	     (int (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) &smraw_test_tools_piecewise_verifier_checksum_finalize,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &smraw_test_tools_piecewise_verifier_checksum_free,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( piecewise_hash_update(
+	     *piecewise_hash,
+	     test_data->data,
+	     SMRAW_TEST_TOOLS_PIECEWISE_VERIFIER_DATA_SIZE,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( piecewise_hash_finalize(
+	     *piecewise_hash,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	piecewise_hash_free(
+	 piecewise_hash,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Creates a piecewise verifier of the test data
+ * Returns 1 if successful or -1 on error
+ */
+int smraw_test_tools_piecewise_verifier_initialize_test_data(
+     piecewise_verifier_t **piecewise_verifier,
+     smraw_test_tools_piecewise_verifier_data_t *test_data,
+     libcerror_error_t **error )
+{
+	return( piecewise_verifier_initialize(
+	         piecewise_verifier,
+	         SMRAW_TEST_TOOLS_PIECEWISE_VERIFIER_DATA_SIZE,
+	         32,
+	         (ssize_t (*)(intptr_t *, void *, size_t, off64_t, libcerror_error_t **)) &smraw_test_tools_piecewise_verifier_read,
+	         (intptr_t *) test_data,
+	         error ) );
+}
+
+/* Initializes the test data
+ */
+void smraw_test_tools_piecewise_verifier_initialize_data(
+      smraw_test_tools_piecewise_verifier_data_t *test_data )
+{
+	int data_offset = 0;
+
+	for( data_offset = 0;
+	     data_offset < SMRAW_TEST_TOOLS_PIECEWISE_VERIFIER_DATA_SIZE;
+	     data_offset++ )
+	{
+		test_data->data[ data_offset ] = (uint8_t) ( ( data_offset * 7 ) + 3 );
+	}
+	test_data->unreadable_offset = 0;
+	test_data->unreadable_size   = 0;
+}
+
+/* Tests the piecewise_verifier_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_tools_piecewise_verifier_initialize(
+     void )
+{
+	smraw_test_tools_piecewise_verifier_data_t test_data;
+
+	libcerror_error_t *error                 = NULL;
+	piecewise_verifier_t *piecewise_verifier = NULL;
+	int result                               = 0;
+
+	smraw_test_tools_piecewise_verifier_initialize_data(
+	 &test_data );
+
+	/* Test regular cases
+	 */
+	result = smraw_test_tools_piecewise_verifier_initialize_test_data(
+	          &piecewise_verifier,
+	          &test_data,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "piecewise_verifier",
+	 piecewise_verifier );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = piecewise_verifier_free(
+	          &piecewise_verifier,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "piecewise_verifier",
+	 piecewise_verifier );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = smraw_test_tools_piecewise_verifier_initialize_test_data(
+	          NULL,
+	          &test_data,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = piecewise_verifier_initialize(
+	          &piecewise_verifier,
+	          SMRAW_TEST_TOOLS_PIECEWISE_VERIFIER_DATA_SIZE,
+	          0,
+	          (ssize_t (*)(intptr_t *, void *, size_t, off64_t, libcerror_error_t **)) &smraw_test_tools_piecewise_verifier_read,
+	          (intptr_t *) &test_data,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "piecewise_verifier",
+	 piecewise_verifier );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = piecewise_verifier_initialize(
+	          &piecewise_verifier,
+	          SMRAW_TEST_TOOLS_PIECEWISE_VERIFIER_DATA_SIZE,
+	          32,
+	          NULL,
+	          (intptr_t *) &test_data,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "piecewise_verifier",
+	 piecewise_verifier );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( piecewise_verifier != NULL )
+	{
+		piecewise_verifier_free(
+		 &piecewise_verifier,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the piecewise_verifier_append_digest function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_tools_piecewise_verifier_append_digest(
+     void )
+{
+	smraw_test_tools_piecewise_verifier_data_t test_data;
+
+	libcerror_error_t *error                 = NULL;
+	piecewise_hash_t *partial_hashes         = NULL;
+	piecewise_hash_t *stored_hashes          = NULL;
+	piecewise_verifier_t *piecewise_verifier = NULL;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	smraw_test_tools_piecewise_verifier_initialize_data(
+	 &test_data );
+
+	result = smraw_test_tools_piecewise_verifier_initialize_stored_hashes(
+	          &stored_hashes,
+	          &test_data,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = smraw_test_tools_piecewise_verifier_initialize_test_data(
+	          &piecewise_verifier,
+	          &test_data,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = piecewise_verifier_append_digest(
+	          piecewise_verifier,
+	          stored_hashes,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "number_of_digests",
+	 piecewise_verifier->number_of_digests,
+	 1 );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_chunks",
+	 piecewise_verifier->number_of_chunks,
+	 (uint64_t) 5 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = piecewise_verifier_append_digest(
+	          NULL,
+	          stored_hashes,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = piecewise_verifier_append_digest(
+	          piecewise_verifier,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test appending piecewise hashes that do not cover the media
+	 */
+	result = piecewise_hash_initialize(
+	          &partial_hashes,
+	          SMRAW_TEST_TOOLS_PIECEWISE_VERIFIER_CHUNK_SIZE,
+	          4,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &smraw_test_tools_piecewise_verifier_checksum_initialize,
+	          (int (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &smraw_test_tools_piecewise_verifier_checksum_update,
+	          (int (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) &smraw_test_tools_piecewise_verifier_checksum_finalize,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &smraw_test_tools_piecewise_verifier_checksum_free,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = piecewise_hash_update(
+	          partial_hashes,
+	          test_data.data,
+	          SMRAW_TEST_TOOLS_PIECEWISE_VERIFIER_CHUNK_SIZE,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = piecewise_hash_finalize(
+	          partial_hashes,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = piecewise_verifier_append_digest(
+	          piecewise_verifier,
+	          partial_hashes,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = piecewise_hash_free(
+	          &partial_hashes,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = piecewise_verifier_free(
+	          &piecewise_verifier,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = piecewise_hash_free(
+	          &stored_hashes,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( partial_hashes != NULL )
+	{
+		piecewise_hash_free(
+		 &partial_hashes,
+		 NULL );
+	}
+	if( piecewise_verifier != NULL )
+	{
+		piecewise_verifier_free(
+		 &piecewise_verifier,
+		 NULL );
+	}
+	if( stored_hashes != NULL )
+	{
+		piecewise_hash_free(
+		 &stored_hashes,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the piecewise_verifier_verify_chunks function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_tools_piecewise_verifier_verify_chunks(
+     void )
+{
+	smraw_test_tools_piecewise_verifier_data_t test_data;
+
+	uint8_t buffer[ 512 ];
+	uint64_t chunk_indexes[ 5 ] = { 4, 0, 3, 1, 2 };
+	int chunk_statuses[ 5 ];
+
+	libcerror_error_t *error                 = NULL;
+	piecewise_hash_t *stored_hashes          = NULL;
+	piecewise_verifier_t *piecewise_verifier = NULL;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	smraw_test_tools_piecewise_verifier_initialize_data(
+	 &test_data );
+
+	result = smraw_test_tools_piecewise_verifier_initialize_stored_hashes(
+	          &stored_hashes,
+	          &test_data,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = piecewise_hash_set_multi_buffer_functions(
+	          stored_hashes,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &smraw_test_tools_piecewise_verifier_checksum_initialize,
+	          (int (*)(intptr_t **, const uint8_t **, const size_t *, int, libcerror_error_t **)) &smraw_test_tools_piecewise_verifier_checksum_multi_buffer_update,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = smraw_test_tools_piecewise_verifier_initialize_test_data(
+	          &piecewise_verifier,
+	          &test_data,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = piecewise_verifier_append_digest(
+	          piecewise_verifier,
+	          stored_hashes,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases where every chunk is hashed in its own lane
+	 */
+	result = piecewise_verifier_verify_chunks(
+	          piecewise_verifier,
+	          chunk_indexes,
+	          5,
+	          buffer,
+	          512,
+	          chunk_statuses,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "chunk_statuses[ 0 ]",
+	 chunk_statuses[ 0 ],
+	 PIECEWISE_VERIFIER_CHUNK_STATUS_MATCH );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "chunk_statuses[ 1 ]",
+	 chunk_statuses[ 1 ],
+	 PIECEWISE_VERIFIER_CHUNK_STATUS_MATCH );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "chunk_statuses[ 2 ]",
+	 chunk_statuses[ 2 ],
+	 PIECEWISE_VERIFIER_CHUNK_STATUS_MATCH );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "chunk_statuses[ 3 ]",
+	 chunk_statuses[ 3 ],
+	 PIECEWISE_VERIFIER_CHUNK_STATUS_MATCH );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "chunk_statuses[ 4 ]",
+	 chunk_statuses[ 4 ],
+	 PIECEWISE_VERIFIER_CHUNK_STATUS_MATCH );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test data with a corrupted chunk and a chunk that cannot be read
+	 */
+	test_data.data[ 130 ]       ^= 0xff;
+	test_data.unreadable_offset  = 290;
+	test_data.unreadable_size    = 1;
+
+	result = piecewise_verifier_verify_chunks(
+	          piecewise_verifier,
+	          chunk_indexes,
+	          5,
+	          buffer,
+	          512,
+	          chunk_statuses,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "chunk_statuses[ 0 ]",
+	 chunk_statuses[ 0 ],
+	 PIECEWISE_VERIFIER_CHUNK_STATUS_READ_ERROR );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "chunk_statuses[ 1 ]",
+	 chunk_statuses[ 1 ],
+	 PIECEWISE_VERIFIER_CHUNK_STATUS_MATCH );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "chunk_statuses[ 2 ]",
+	 chunk_statuses[ 2 ],
+	 PIECEWISE_VERIFIER_CHUNK_STATUS_MATCH );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "chunk_statuses[ 3 ]",
+	 chunk_statuses[ 3 ],
+	 PIECEWISE_VERIFIER_CHUNK_STATUS_MATCH );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "chunk_statuses[ 4 ]",
+	 chunk_statuses[ 4 ],
+	 PIECEWISE_VERIFIER_CHUNK_STATUS_MISMATCH );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	test_data.data[ 130 ]       = (uint8_t) ( ( 130 * 7 ) + 3 );
+	test_data.unreadable_offset = 0;
+	test_data.unreadable_size   = 0;
+
+	/* Test error cases
+	 */
+	result = piecewise_verifier_verify_chunks(
+	          NULL,
+	          chunk_indexes,
+	          5,
+	          buffer,
+	          512,
+	          chunk_statuses,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = piecewise_verifier_verify_chunks(
+	          piecewise_verifier,
+	          NULL,
+	          5,
+	          buffer,
+	          512,
+	          chunk_statuses,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = piecewise_verifier_verify_chunks(
+	          piecewise_verifier,
+	          chunk_indexes,
+	          0,
+	          buffer,
+	          512,
+	          chunk_statuses,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = piecewise_verifier_verify_chunks(
+	          piecewise_verifier,
+	          chunk_indexes,
+	          PIECEWISE_VERIFIER_MAXIMUM_NUMBER_OF_LANES + 1,
+	          buffer,
+	          512,
+	          chunk_statuses,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = piecewise_verifier_verify_chunks(
+	          piecewise_verifier,
+	          chunk_indexes,
+	          5,
+	          NULL,
+	          512,
+	          chunk_statuses,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = piecewise_verifier_verify_chunks(
+	          piecewise_verifier,
+	          chunk_indexes,
+	          5,
+	          buffer,
+	          0,
+	          chunk_statuses,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = piecewise_verifier_verify_chunks(
+	          piecewise_verifier,
+	          chunk_indexes,
+	          5,
+	          buffer,
+	          512,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a buffer that is too small to provide a lane per chunk
+	 */
+	result = piecewise_verifier_verify_chunks(
+	          piecewise_verifier,
+	          chunk_indexes,
+	          5,
+	          buffer,
+	          4,
+	          chunk_statuses,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	chunk_indexes[ 0 ] = 5;
+
+	result = piecewise_verifier_verify_chunks(
+	          piecewise_verifier,
+	          chunk_indexes,
+	          5,
+	          buffer,
+	          512,
+	          chunk_statuses,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	chunk_indexes[ 0 ] = 4;
+
+	/* Clean up
+	 */
+	result = piecewise_verifier_free(
+	          &piecewise_verifier,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = piecewise_hash_free(
+	          &stored_hashes,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( piecewise_verifier != NULL )
+	{
+		piecewise_verifier_free(
+		 &piecewise_verifier,
+		 NULL );
+	}
+	if( stored_hashes != NULL )
+	{
+		piecewise_hash_free(
+		 &stored_hashes,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Verifies the test data against the stored hashes
+ * Returns 1 if successful or -1 on error
+ */
+int smraw_test_tools_piecewise_verifier_verify_test_data(
+     smraw_test_tools_piecewise_verifier_data_t *test_data,
+     piecewise_hash_t *stored_hashes,
+     int number_of_threads,
+     uint8_t fail_fast,
+     smraw_test_tools_piecewise_verifier_report_t *report,
+     uint64_t *number_of_corrupted_chunks,
+     libcerror_error_t **error )
+{
+	piecewise_verifier_t *piecewise_verifier = NULL;
+
+	report->number_of_chunks = 0;
+	report->chunk_offset     = -1;
+	report->chunk_size       = 0;
+	report->chunk_status     = -1;
+
+	if( smraw_test_tools_piecewise_verifier_initialize_test_data(
+	     &piecewise_verifier,
+	     test_data,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( piecewise_verifier_append_digest(
+	     piecewise_verifier,
+	     stored_hashes,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( piecewise_verifier_set_report_function(
+	     piecewise_verifier,
+	     (void (*)(intptr_t *, off64_t, size64_t, int)) &smraw_test_tools_piecewise_verifier_report,
+	     (intptr_t *) report,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	piecewise_verifier->fail_fast = fail_fast;
+
+	if( piecewise_verifier_run(
+	     piecewise_verifier,
+	     number_of_threads,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( piecewise_verifier_get_number_of_corrupted_chunks(
+	     piecewise_verifier,
+	     number_of_corrupted_chunks,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( piecewise_verifier_free(
+	     &piecewise_verifier,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( piecewise_verifier != NULL )
+	{
+		piecewise_verifier_free(
+		 &piecewise_verifier,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the piecewise_verifier_run function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_tools_piecewise_verifier_run(
+     void )
+{
+	smraw_test_tools_piecewise_verifier_data_t test_data;
+	smraw_test_tools_piecewise_verifier_report_t report;
+
+	libcerror_error_t *error                 = NULL;
+	piecewise_hash_t *stored_hashes          = NULL;
+	piecewise_verifier_t *piecewise_verifier = NULL;
+	uint64_t number_of_corrupted_chunks      = 0;
+	int number_of_threads                    = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	smraw_test_tools_piecewise_verifier_initialize_data(
+	 &test_data );
+
+	result = smraw_test_tools_piecewise_verifier_initialize_stored_hashes(
+	          &stored_hashes,
+	          &test_data,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases with and without worker threads
+	 */
+	for( number_of_threads = 0;
+	     number_of_threads <= 4;
+	     number_of_threads += 4 )
+	{
+		/* Test intact data
+		 */
+		test_data.data[ 130 ] = (uint8_t) ( ( 130 * 7 ) + 3 );
+
+		result = smraw_test_tools_piecewise_verifier_verify_test_data(
+		          &test_data,
+		          stored_hashes,
+		          number_of_threads,
+		          0,
+		          &report,
+		          &number_of_corrupted_chunks,
+		          &error );
+
+		SMRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SMRAW_TEST_ASSERT_EQUAL_UINT64(
+		 "number_of_corrupted_chunks",
+		 number_of_corrupted_chunks,
+		 (uint64_t) 0 );
+
+		SMRAW_TEST_ASSERT_EQUAL_INT(
+		 "report.number_of_chunks",
+		 report.number_of_chunks,
+		 0 );
+
+		SMRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test data with a corrupted chunk
+		 */
+		test_data.data[ 130 ] ^= 0xff;
+
+		result = smraw_test_tools_piecewise_verifier_verify_test_data(
+		          &test_data,
+		          stored_hashes,
+		          number_of_threads,
+		          0,
+		          &report,
+		          &number_of_corrupted_chunks,
+		          &error );
+
+		SMRAW_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SMRAW_TEST_ASSERT_EQUAL_UINT64(
+		 "number_of_corrupted_chunks",
+		 number_of_corrupted_chunks,
+		 (uint64_t) 1 );
+
+		SMRAW_TEST_ASSERT_EQUAL_INT(
+		 "report.number_of_chunks",
+		 report.number_of_chunks,
+		 1 );
+
+		SMRAW_TEST_ASSERT_EQUAL_INT64(
+		 "report.chunk_offset",
+		 (int64_t) report.chunk_offset,
+		 (int64_t) 128 );
+
+		SMRAW_TEST_ASSERT_EQUAL_UINT64(
+		 "report.chunk_size",
+		 (uint64_t) report.chunk_size,
+		 (uint64_t) 64 );
+
+		SMRAW_TEST_ASSERT_EQUAL_INT(
+		 "report.chunk_status",
+		 report.chunk_status,
+		 PIECEWISE_VERIFIER_CHUNK_STATUS_MISMATCH );
+
+		SMRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	test_data.data[ 130 ] = (uint8_t) ( ( 130 * 7 ) + 3 );
+
+	/* Test data of which the last chunk cannot be read
+	 */
+	test_data.unreadable_offset = 290;
+	test_data.unreadable_size   = 1;
+
+	result = smraw_test_tools_piecewise_verifier_verify_test_data(
+	          &test_data,
+	          stored_hashes,
+	          4,
+	          0,
+	          &report,
+	          &number_of_corrupted_chunks,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_corrupted_chunks",
+	 number_of_corrupted_chunks,
+	 (uint64_t) 1 );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT64(
+	 "report.chunk_offset",
+	 (int64_t) report.chunk_offset,
+	 (int64_t) 256 );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "report.chunk_size",
+	 (uint64_t) report.chunk_size,
+	 (uint64_t) 44 );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "report.chunk_status",
+	 report.chunk_status,
+	 PIECEWISE_VERIFIER_CHUNK_STATUS_READ_ERROR );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that fail fast stops at the first chunk that does not verify
+	 */
+	test_data.unreadable_offset = 0;
+	test_data.unreadable_size   = 300;
+
+	result = smraw_test_tools_piecewise_verifier_verify_test_data(
+	          &test_data,
+	          stored_hashes,
+	          0,
+	          1,
+	          &report,
+	          &number_of_corrupted_chunks,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_corrupted_chunks",
+	 number_of_corrupted_chunks,
+	 (uint64_t) 1 );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "report.number_of_chunks",
+	 report.number_of_chunks,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	test_data.unreadable_size = 0;
+
+	/* Test error cases
+	 */
+	result = piecewise_verifier_run(
+	          NULL,
+	          0,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test running a piecewise verifier without digests
+	 */
+	result = smraw_test_tools_piecewise_verifier_initialize_test_data(
+	          &piecewise_verifier,
+	          &test_data,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = piecewise_verifier_run(
+	          piecewise_verifier,
+	          0,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = piecewise_verifier_free(
+	          &piecewise_verifier,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = piecewise_hash_free(
+	          &stored_hashes,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( piecewise_verifier != NULL )
+	{
+		piecewise_verifier_free(
+		 &piecewise_verifier,
+		 NULL );
+	}
+	if( stored_hashes != NULL )
+	{
+		piecewise_hash_free(
+		 &stored_hashes,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SMRAW_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SMRAW_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SMRAW_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SMRAW_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SMRAW_TEST_UNREFERENCED_PARAMETER( argc )
+	SMRAW_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SMRAW_TEST_RUN(
+	 "piecewise_verifier_initialize",
+	 smraw_test_tools_piecewise_verifier_initialize );
+
+	SMRAW_TEST_RUN(
+	 "piecewise_verifier_append_digest",
+	 smraw_test_tools_piecewise_verifier_append_digest );
+
+	SMRAW_TEST_RUN(
+	 "piecewise_verifier_verify_chunks",
+	 smraw_test_tools_piecewise_verifier_verify_chunks );
+
+	SMRAW_TEST_RUN(
+	 "piecewise_verifier_run",
+	 smraw_test_tools_piecewise_verifier_run );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1180 @@
+/*
+ * Library write_behind type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "smraw_test_libcerror.h"
+#include "smraw_test_libsmraw.h"
+#include "smraw_test_macros.h"
+#include "smraw_test_memory.h"
+#include "smraw_test_unused.h"
+
+#include "../libsmraw/libsmraw_write_behind.h"
+
+#if defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT )
+
+#define SMRAW_TEST_WRITE_BEHIND_MEDIA_SIZE		4096
+#define SMRAW_TEST_WRITE_BEHIND_MAXIMUM_NUMBER_OF_WRITES	64
+
+typedef struct smraw_test_write_behind_output smraw_test_write_behind_output_t;
+
+struct smraw_test_write_behind_output
+{
+	/* The written data
+	 */
+	uint8_t data[ SMRAW_TEST_WRITE_BEHIND_MEDIA_SIZE ];
+
+	/* The current offset
+	 */
+	size_t offset;
+
+	/* The number of writes
+	 */
+	int number_of_writes;
+
+	/* The offsets of the writes
+	 */
+	size_t write_offsets[ SMRAW_TEST_WRITE_BEHIND_MAXIMUM_NUMBER_OF_WRITES ];
+
+	/* The sizes of the writes
+	 */
+	size_t write_sizes[ SMRAW_TEST_WRITE_BEHIND_MAXIMUM_NUMBER_OF_WRITES ];
+};
+
+/* Test write function that appends the data to the output
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t smraw_test_write_behind_write_function(
+         intptr_t *data_handle,
+         const uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	smraw_test_write_behind_output_t *output = NULL;
+	static char *function                    = "smraw_test_write_behind_write_function";
+
+	output = (smraw_test_write_behind_output_t *) data_handle;
+
+	if( ( output == NULL )
+	 || ( buffer_size > ( SMRAW_TEST_WRITE_BEHIND_MEDIA_SIZE - output->offset ) )
+	 || ( output->number_of_writes >= SMRAW_TEST_WRITE_BEHIND_MAXIMUM_NUMBER_OF_WRITES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write data.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( output->data[ output->offset ] ),
+	     buffer,
+	     buffer_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data.",
+		 function );
+
+		return( -1 );
+	}
+	output->write_offsets[ output->number_of_writes ] = output->offset;
+	output->write_sizes[ output->number_of_writes ]   = buffer_size;
+
+	output->number_of_writes += 1;
+	output->offset           += buffer_size;
+
+	return( (ssize_t) buffer_size );
+}
+
+/* Tests the libsmraw_write_behind_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_write_behind_initialize(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libsmraw_write_behind_t *write_behind = NULL;
+	int result                            = 0;
+
+#if defined( HAVE_SMRAW_TEST_MEMORY )
+	int number_of_malloc_fail_tests       = 2;
+	int test_number                       = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libsmraw_write_behind_initialize(
+	          &write_behind,
+	          1024,
+	          0,
+	          0,
+	          &smraw_test_write_behind_write_function,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "write_behind",
+	 write_behind );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_write_behind_free(
+	          &write_behind,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "write_behind",
+	 write_behind );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmraw_write_behind_initialize(
+	          NULL,
+	          1024,
+	          0,
+	          0,
+	          &smraw_test_write_behind_write_function,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	write_behind = (libsmraw_write_behind_t *) 0x12345678UL;
+
+	result = libsmraw_write_behind_initialize(
+	          &write_behind,
+	          1024,
+	          0,
+	          0,
+	          &smraw_test_write_behind_write_function,
+	          NULL,
+	          &error );
+
+	write_behind = NULL;
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_write_behind_initialize(
+	          &write_behind,
+	          0,
+	          0,
+	          0,
+	          &smraw_test_write_behind_write_function,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmraw_write_behind_initialize(
+	          &write_behind,
+	          1024,
+	          0,
+	          0,
+	          NULL,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SMRAW_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsmraw_write_behind_initialize with malloc failing
+		 */
+		smraw_test_malloc_attempts_before_fail = test_number;
+
+		result = libsmraw_write_behind_initialize(
+		          &write_behind,
+		          1024,
+		          0,
+		          0,
+		          &smraw_test_write_behind_write_function,
+		          NULL,
+		          &error );
+
+		if( smraw_test_malloc_attempts_before_fail != -1 )
+		{
+			smraw_test_malloc_attempts_before_fail = -1;
+
+			if( write_behind != NULL )
+			{
+				libsmraw_write_behind_free(
+				 &write_behind,
+				 NULL );
+			}
+		}
+		else
+		{
+			SMRAW_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SMRAW_TEST_ASSERT_IS_NULL(
+			 "write_behind",
+			 write_behind );
+
+			SMRAW_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SMRAW_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( write_behind != NULL )
+	{
+		libsmraw_write_behind_free(
+		 &write_behind,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_write_behind_free function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_write_behind_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libsmraw_write_behind_free(
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_write_behind_write_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_write_behind_write_buffer(
+     void )
+{
+	uint8_t buffer[ SMRAW_TEST_WRITE_BEHIND_MEDIA_SIZE ];
+
+	smraw_test_write_behind_output_t output;
+
+	libcerror_error_t *error              = NULL;
+	libsmraw_write_behind_t *write_behind = NULL;
+	size_t buffer_offset                  = 0;
+	size_t write_end_offset               = 0;
+	size_t write_size                     = 0;
+	ssize_t write_count                   = 0;
+	int result                            = 0;
+	int write_index                       = 0;
+
+	for( buffer_offset = 0;
+	     buffer_offset < SMRAW_TEST_WRITE_BEHIND_MEDIA_SIZE;
+	     buffer_offset++ )
+	{
+		buffer[ buffer_offset ] = (uint8_t) ( ( buffer_offset * 7 ) & 0xff );
+	}
+	/* Initialize test
+	 */
+	result = libsmraw_write_behind_initialize(
+	          &write_behind,
+	          256,
+	          1000,
+	          0,
+	          &smraw_test_write_behind_write_function,
+	          (intptr_t *) &output,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "write_behind",
+	 write_behind );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test small writes are coalesced and not written across a buffer size
+	 * aligned offset or boundary
+	 */
+	result = memory_set(
+	          &output,
+	          0,
+	          sizeof( smraw_test_write_behind_output_t ) ) != NULL;
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	for( buffer_offset = 0;
+	     buffer_offset < SMRAW_TEST_WRITE_BEHIND_MEDIA_SIZE;
+	     buffer_offset += write_size )
+	{
+		write_size = 96;
+
+		if( write_size > ( SMRAW_TEST_WRITE_BEHIND_MEDIA_SIZE - buffer_offset ) )
+		{
+			write_size = SMRAW_TEST_WRITE_BEHIND_MEDIA_SIZE - buffer_offset;
+		}
+		write_count = libsmraw_write_behind_write_buffer(
+		               write_behind,
+		               &( buffer[ buffer_offset ] ),
+		               write_size,
+		               (off64_t) buffer_offset,
+		               &error );
+
+		SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+		 "write_count",
+		 write_count,
+		 (ssize_t) write_size );
+
+		SMRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* The data ends on a buffer size aligned offset hence nothing remains buffered
+	 */
+	SMRAW_TEST_ASSERT_EQUAL_SIZE(
+	 "output.offset",
+	 output.offset,
+	 (size_t) SMRAW_TEST_WRITE_BEHIND_MEDIA_SIZE );
+
+	result = libsmraw_write_behind_flush(
+	          write_behind,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SIZE(
+	 "output.offset",
+	 output.offset,
+	 (size_t) SMRAW_TEST_WRITE_BEHIND_MEDIA_SIZE );
+
+	result = memory_compare(
+	          output.data,
+	          buffer,
+	          SMRAW_TEST_WRITE_BEHIND_MEDIA_SIZE );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* 16 buffer size aligned writes plus 4 additional writes split at the boundaries
+	 */
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "output.number_of_writes",
+	 output.number_of_writes,
+	 20 );
+
+	for( write_index = 0;
+	     write_index < output.number_of_writes;
+	     write_index++ )
+	{
+		write_end_offset = output.write_offsets[ write_index ] + output.write_sizes[ write_index ] - 1;
+
+		SMRAW_TEST_ASSERT_EQUAL_SIZE(
+		 "write_end_offset / 256",
+		 write_end_offset / 256,
+		 output.write_offsets[ write_index ] / 256 );
+
+		SMRAW_TEST_ASSERT_EQUAL_SIZE(
+		 "write_end_offset / 1000",
+		 write_end_offset / 1000,
+		 output.write_offsets[ write_index ] / 1000 );
+	}
+	/* Clean up
+	 */
+	result = libsmraw_write_behind_free(
+	          &write_behind,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = libsmraw_write_behind_initialize(
+	          &write_behind,
+	          256,
+	          0,
+	          0,
+	          &smraw_test_write_behind_write_function,
+	          (intptr_t *) &output,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "write_behind",
+	 write_behind );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test large writes are passed through up to the last buffer size aligned offset
+	 */
+	result = memory_set(
+	          &output,
+	          0,
+	          sizeof( smraw_test_write_behind_output_t ) ) != NULL;
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	write_count = libsmraw_write_behind_write_buffer(
+	               write_behind,
+	               buffer,
+	               16,
+	               0,
+	               &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) 16 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	write_count = libsmraw_write_behind_write_buffer(
+	               write_behind,
+	               &( buffer[ 16 ] ),
+	               1024,
+	               16,
+	               &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) 1024 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "output.number_of_writes",
+	 output.number_of_writes,
+	 2 );
+
+	SMRAW_TEST_ASSERT_EQUAL_SIZE(
+	 "output.write_sizes[ 0 ]",
+	 output.write_sizes[ 0 ],
+	 (size_t) 256 );
+
+	SMRAW_TEST_ASSERT_EQUAL_SIZE(
+	 "output.write_sizes[ 1 ]",
+	 output.write_sizes[ 1 ],
+	 (size_t) 768 );
+
+	/* Test error cases
+	 */
+	write_count = libsmraw_write_behind_write_buffer(
+	               NULL,
+	               buffer,
+	               16,
+	               1040,
+	               &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	write_count = libsmraw_write_behind_write_buffer(
+	               write_behind,
+	               NULL,
+	               16,
+	               1040,
+	               &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	write_count = libsmraw_write_behind_write_buffer(
+	               write_behind,
+	               buffer,
+	               (size_t) SSIZE_MAX + 1,
+	               1040,
+	               &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	write_count = libsmraw_write_behind_write_buffer(
+	               write_behind,
+	               buffer,
+	               16,
+	               -1,
+	               &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a write that does not continue where the buffered data ends
+	 */
+	write_count = libsmraw_write_behind_write_buffer(
+	               write_behind,
+	               buffer,
+	               16,
+	               2048,
+	               &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmraw_write_behind_free(
+	          &write_behind,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "write_behind",
+	 write_behind );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( write_behind != NULL )
+	{
+		libsmraw_write_behind_free(
+		 &write_behind,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmraw_write_behind_flush function
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_write_behind_flush(
+     void )
+{
+	uint8_t buffer[ 64 ];
+
+	libcerror_error_t *error              = NULL;
+	libsmraw_write_behind_t *write_behind = NULL;
+	ssize_t write_count                   = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = memory_set(
+	          buffer,
+	          0,
+	          64 ) != NULL;
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmraw_write_behind_initialize(
+	          &write_behind,
+	          256,
+	          0,
+	          0,
+	          &smraw_test_write_behind_write_function,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "write_behind",
+	 write_behind );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsmraw_write_behind_flush(
+	          write_behind,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmraw_write_behind_flush(
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test flush with the write function failing
+	 */
+	write_count = libsmraw_write_behind_write_buffer(
+	               write_behind,
+	               buffer,
+	               64,
+	               0,
+	               &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) 64 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_write_behind_flush(
+	          write_behind,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmraw_write_behind_free(
+	          &write_behind,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( write_behind != NULL )
+	{
+		libsmraw_write_behind_free(
+		 &write_behind,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+
+/* Tests the libsmraw_write_behind_write_buffer function with a writer thread
+ * Returns 1 if successful or 0 if not
+ */
+int smraw_test_write_behind_write_buffer_with_writer_thread(
+     void )
+{
+	uint8_t buffer[ SMRAW_TEST_WRITE_BEHIND_MEDIA_SIZE ];
+
+	smraw_test_write_behind_output_t output;
+
+	libcerror_error_t *error              = NULL;
+	libsmraw_write_behind_t *write_behind = NULL;
+	size_t buffer_offset                  = 0;
+	size_t write_size                     = 0;
+	ssize_t write_count                   = 0;
+	int result                            = 0;
+
+	for( buffer_offset = 0;
+	     buffer_offset < SMRAW_TEST_WRITE_BEHIND_MEDIA_SIZE;
+	     buffer_offset++ )
+	{
+		buffer[ buffer_offset ] = (uint8_t) ( ( buffer_offset * 7 ) & 0xff );
+	}
+	result = memory_set(
+	          &output,
+	          0,
+	          sizeof( smraw_test_write_behind_output_t ) ) != NULL;
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Initialize test
+	 */
+	result = libsmraw_write_behind_initialize(
+	          &write_behind,
+	          256,
+	          1000,
+	          3,
+	          &smraw_test_write_behind_write_function,
+	          (intptr_t *) &output,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "write_behind",
+	 write_behind );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( buffer_offset = 0;
+	     buffer_offset < SMRAW_TEST_WRITE_BEHIND_MEDIA_SIZE;
+	     buffer_offset += write_size )
+	{
+		write_size = 96;
+
+		if( write_size > ( SMRAW_TEST_WRITE_BEHIND_MEDIA_SIZE - buffer_offset ) )
+		{
+			write_size = SMRAW_TEST_WRITE_BEHIND_MEDIA_SIZE - buffer_offset;
+		}
+		write_count = libsmraw_write_behind_write_buffer(
+		               write_behind,
+		               &( buffer[ buffer_offset ] ),
+		               write_size,
+		               (off64_t) buffer_offset,
+		               &error );
+
+		SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+		 "write_count",
+		 write_count,
+		 (ssize_t) write_size );
+
+		SMRAW_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	SMRAW_TEST_ASSERT_EQUAL_INT64(
+	 "write_behind->current_offset",
+	 (int64_t) write_behind->current_offset,
+	 (int64_t) SMRAW_TEST_WRITE_BEHIND_MEDIA_SIZE );
+
+	result = libsmraw_write_behind_flush(
+	          write_behind,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SIZE(
+	 "output.offset",
+	 output.offset,
+	 (size_t) SMRAW_TEST_WRITE_BEHIND_MEDIA_SIZE );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "output.number_of_writes",
+	 output.number_of_writes,
+	 20 );
+
+	result = memory_compare(
+	          output.data,
+	          buffer,
+	          SMRAW_TEST_WRITE_BEHIND_MEDIA_SIZE );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Clean up
+	 */
+	result = libsmraw_write_behind_free(
+	          &write_behind,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a failed write by the writer thread is reported by flush
+	 */
+	result = libsmraw_write_behind_initialize(
+	          &write_behind,
+	          256,
+	          0,
+	          3,
+	          &smraw_test_write_behind_write_function,
+	          NULL,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "write_behind",
+	 write_behind );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	write_count = libsmraw_write_behind_write_buffer(
+	               write_behind,
+	               buffer,
+	               64,
+	               0,
+	               &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) 64 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmraw_write_behind_flush(
+	          write_behind,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMRAW_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmraw_write_behind_free(
+	          &write_behind,
+	          &error );
+
+	SMRAW_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMRAW_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( write_behind != NULL )
+	{
+		libsmraw_write_behind_free(
+		 &write_behind,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SMRAW_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SMRAW_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SMRAW_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SMRAW_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SMRAW_TEST_UNREFERENCED_PARAMETER( argc )
+	SMRAW_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT )
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_write_behind_initialize",
+	 smraw_test_write_behind_initialize );
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_write_behind_free",
+	 smraw_test_write_behind_free );
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_write_behind_write_buffer",
+	 smraw_test_write_behind_write_buffer );
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_write_behind_flush",
+	 smraw_test_write_behind_flush );
+
+#if defined( HAVE_LIBSMRAW_MULTI_THREAD_SUPPORT )
+
+	SMRAW_TEST_RUN(
+	 "libsmraw_write_behind_write_buffer_with_writer_thread",
+	 smraw_test_write_behind_write_buffer_with_writer_thread );
+
+#endif
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMRAW_DLL_IMPORT ) */
+}
+
@@ -1,6 +1,6 @@
 # Tests library functions and types.
 
-$LibraryTests = "error filename information_file io_handle notify support"
+$LibraryTests = "access_hint block_cache data_view direct_file directory_listing error filename information_file io_handle manifest memory_map notify pool_policy read_ahead read_queue segment_table support write_behind"
 $LibraryTestsWithInput = "handle"
 $OptionSets = "" -split " "
 
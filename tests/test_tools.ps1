@@ -1,6 +1,6 @@
 # Tests tools functions and types.
 
-$ToolsTests = "output signal"
+$ToolsTests = "digest_hash digest_pipeline output piecewise_hash piecewise_verifier signal"
 $OptionSets = "" -split " "
 
 . .\test_functions.ps1